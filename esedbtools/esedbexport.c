@@ -60,8 +60,8 @@ void usage_fprint(
 	fprintf( stream, "Use esedbexport to export items stored in an Extensible Storage Engine (ESE)\n"
 	                 "Database (EDB) file\n\n" );
 
-	fprintf( stream, "Usage: esedbexport [ -c codepage ] [ -l logfile ] [ -m mode ] [ -t target ]\n"
-	                 "                   [ -T table_name ] [ -hvV ] source\n\n" );
+	fprintf( stream, "Usage: esedbexport [ -c codepage ] [ -j jobs ] [ -l logfile ] [ -m mode ]\n"
+	                 "                   [ -t target ] [ -T table_name ] [ -hvV ] source\n\n" );
 
 	fprintf( stream, "\tsource: the source file\n\n" );
 
@@ -70,6 +70,12 @@ void usage_fprint(
 	                 "\t        windows-1252 (default), windows-1253, windows-1254\n"
 	                 "\t        windows-1255, windows-1256, windows-1257 or windows-1258\n" );
 	fprintf( stream, "\t-h:     shows this help\n" );
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	fprintf( stream, "\t-j:     the number of concurrent export jobs (threads), where a number\n"
+	                 "\t        of 0 or 1 represents single-threaded mode (default). Tables are\n"
+	                 "\t        distributed over the jobs and large tables are split into\n"
+	                 "\t        ranges of records that are exported concurrently\n" );
+#endif
 	fprintf( stream, "\t-l:     logs information about the exported items\n" );
 	fprintf( stream, "\t-m:     export mode, option: all, tables (default)\n"
 	                 "\t        'all' exports all the tables or a single specified table with indexes,\n"
@@ -137,6 +143,7 @@ int main( int argc, char * const argv[] )
 	system_character_t *log_filename          = NULL;
 	system_character_t *option_ascii_codepage = NULL;
 	system_character_t *option_export_mode    = NULL;
+	system_character_t *option_number_of_jobs = NULL;
 	system_character_t *option_table_name     = NULL;
 	system_character_t *option_target_path    = NULL;
 	system_character_t *path_separator        = NULL;
@@ -183,7 +190,11 @@ int main( int argc, char * const argv[] )
 	while( ( option = esedbtools_getopt(
 	                   argc,
 	                   argv,
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	                   _SYSTEM_STRING( "c:hj:l:m:t:T:vV" ) ) ) != (system_integer_t) -1 )
+#else
 	                   _SYSTEM_STRING( "c:hl:m:t:T:vV" ) ) ) != (system_integer_t) -1 )
+#endif
 	{
 		switch( option )
 		{
@@ -210,6 +221,13 @@ int main( int argc, char * const argv[] )
 
 				return( EXIT_SUCCESS );
 
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+			case (system_integer_t) 'j':
+				option_number_of_jobs = optarg;
+
+				break;
+#endif
+
 			case (system_integer_t) 'l':
 				log_filename = optarg;
 
@@ -355,6 +373,28 @@ int main( int argc, char * const argv[] )
 			 "Unsupported ASCII codepage defaulting to: windows-1252.\n" );
 		}
 	}
+	if( option_number_of_jobs != NULL )
+	{
+		result = export_handle_set_number_of_threads(
+		          esedbexport_export_handle,
+		          option_number_of_jobs,
+		          &error );
+
+		if( result == -1 )
+		{
+			fprintf(
+			 stderr,
+			 "Unable to set number of jobs in export handle.\n" );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			fprintf(
+			 stderr,
+			 "Unsupported number of jobs defaulting to: 1.\n" );
+		}
+	}
 	if( export_handle_set_target_path(
 	     esedbexport_export_handle,
 	     option_target_path,
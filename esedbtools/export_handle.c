@@ -34,18 +34,29 @@
 #include "esedbtools_libcnotify.h"
 #include "esedbtools_libcfile.h"
 #include "esedbtools_libcpath.h"
+#include "esedbtools_libcthreads.h"
 #include "esedbtools_libesedb.h"
 #include "esedbtools_libfdatetime.h"
 #include "esedbtools_system_string.h"
 #include "exchange.h"
 #include "export.h"
 #include "export_handle.h"
+#include "export_job.h"
+#include "export_scheduler.h"
 #include "srumdb.h"
 #include "webcache.h"
 #include "windows_search.h"
 #include "windows_security.h"
 
-#define EXPORT_HANDLE_NOTIFY_STREAM	stdout
+#define EXPORT_HANDLE_NOTIFY_STREAM					stdout
+
+#define EXPORT_HANDLE_MAXIMUM_NUMBER_OF_THREADS				128
+#define EXPORT_HANDLE_NUMBER_OF_RECORDS_PER_PARTITION			16384
+#define EXPORT_HANDLE_MAXIMUM_NUMBER_OF_PARTITIONS_PER_THREAD		4
+#define EXPORT_HANDLE_COPY_BUFFER_SIZE					65536
+#define EXPORT_HANDLE_NUMBER_OF_INDEX_RECORDS_PER_BATCH			1024
+#define EXPORT_HANDLE_NUMBER_OF_RECORDS_PER_CHUNK			1024
+#define EXPORT_HANDLE_MINIMUM_NUMBER_OF_RECORDS_PER_SPLIT_JOB		4096
 
 /* Creates an export handle
  * Make sure the value export_handle is referencing, is set to NULL
@@ -124,11 +135,50 @@ int export_handle_initialize(
 	( *export_handle )->ascii_codepage = LIBESEDB_CODEPAGE_WINDOWS_1252;
 	( *export_handle )->notify_stream  = EXPORT_HANDLE_NOTIFY_STREAM;
 
+	if( log_handle_initialize(
+	     &( ( *export_handle )->notify_log_handle ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize notify log handle.",
+		 function );
+
+		goto on_error;
+	}
+	if( log_handle_open_stream(
+	     ( *export_handle )->notify_log_handle,
+	     ( *export_handle )->notify_stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open notify log handle.",
+		 function );
+
+		goto on_error;
+	}
 	return( 1 );
 
 on_error:
 	if( *export_handle != NULL )
 	{
+		if( ( *export_handle )->notify_log_handle != NULL )
+		{
+			log_handle_free(
+			 &( ( *export_handle )->notify_log_handle ),
+			 NULL );
+		}
+		if( ( *export_handle )->input_file != NULL )
+		{
+			libesedb_file_free(
+			 &( ( *export_handle )->input_file ),
+			 NULL );
+		}
 		memory_free(
 		 *export_handle );
 
@@ -173,6 +223,32 @@ int export_handle_free(
 
 			result = -1;
 		}
+		if( log_handle_close(
+		     ( *export_handle )->notify_log_handle,
+		     error ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+			 "%s: unable to close notify log handle.",
+			 function );
+
+			result = -1;
+		}
+		if( log_handle_free(
+		     &( ( *export_handle )->notify_log_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free notify log handle.",
+			 function );
+
+			result = -1;
+		}
 		if( ( *export_handle )->target_path != NULL )
 		{
 			memory_free(
@@ -339,6 +415,56 @@ int export_handle_set_ascii_codepage(
 	return( result );
 }
 
+/* Sets the number of threads
+ * Returns 1 if successful, 0 if unsupported values or -1 on error
+ */
+int export_handle_set_number_of_threads(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_set_number_of_threads";
+	size_t string_length  = 0;
+	uint64_t value_64bit  = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	string_length = system_string_length(
+	                 string );
+
+	if( esedbtools_system_string_decimal_copy_to_64_bit(
+	     string,
+	     string_length + 1,
+	     &value_64bit,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine number of threads.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_64bit > (uint64_t) EXPORT_HANDLE_MAXIMUM_NUMBER_OF_THREADS )
+	{
+		return( 0 );
+	}
+	export_handle->number_of_threads = (int) value_64bit;
+
+	return( 1 );
+}
+
 /* Sets the target path
  * Returns 1 if successful or -1 on error
  */
@@ -1122,18 +1248,10 @@ int export_handle_export_table(
      libcerror_error_t **error )
 {
 	system_character_t *item_filename = NULL;
-	system_character_t *value_string  = NULL;
-	libesedb_column_t *column         = NULL;
-	libesedb_record_t *record         = NULL;
 	FILE *table_file_stream           = NULL;
 	static char *function             = "export_handle_export_table";
 	size_t item_filename_size         = 0;
-	size_t value_string_size          = 0;
-	int column_iterator               = 0;
-	int known_table                   = 0;
-	int number_of_columns             = 0;
 	int number_of_records             = 0;
-	int record_iterator               = 0;
 	int result                        = 0;
 
 	if( table == NULL )
@@ -1215,6 +1333,150 @@ int export_handle_export_table(
 
 	/* Write the column names to the table file
 	 */
+	if( export_handle_export_table_columns(
+	     table,
+	     table_file_stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to export column names.",
+		 function );
+
+		goto on_error;
+	}
+	/* Write the record (row) values to the table file
+	 */
+	if( libesedb_table_get_number_of_records(
+	     table,
+	     &number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of records.",
+		 function );
+
+		goto on_error;
+	}
+	if( export_handle_export_table_records(
+	     export_handle,
+	     database_type,
+	     table,
+	     table_name,
+	     table_name_length,
+	     0,
+	     number_of_records,
+	     table_file_stream,
+	     log_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to export records.",
+		 function );
+
+		goto on_error;
+	}
+	if( file_stream_close(
+	     table_file_stream ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close table file.",
+		 function );
+
+		goto on_error;
+	}
+	table_file_stream = NULL;
+
+	if( export_handle->abort == 0 )
+	{
+		if( export_handle->export_mode != EXPORT_MODE_TABLES )
+		{
+			if( export_handle_export_indexes(
+			     export_handle,
+			     table,
+			     table_name,
+			     table_name_length,
+			     export_path,
+			     export_path_length,
+			     log_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to export indexes.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( table_file_stream != NULL )
+	{
+		file_stream_close(
+		 table_file_stream );
+	}
+	if( item_filename != NULL )
+	{
+		memory_free(
+		 item_filename );
+	}
+	return( -1 );
+}
+
+/* Exports the column names of the table
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_table_columns(
+     libesedb_table_t *table,
+     FILE *table_file_stream,
+     libcerror_error_t **error )
+{
+	system_character_t *value_string = NULL;
+	libesedb_column_t *column        = NULL;
+	static char *function            = "export_handle_export_table_columns";
+	size_t value_string_size         = 0;
+	int column_iterator              = 0;
+	int number_of_columns            = 0;
+	int result                       = 0;
+
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_file_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table file stream.",
+		 function );
+
+		return( -1 );
+	}
 	if( libesedb_table_get_number_of_columns(
 	     table,
 	     &number_of_columns,
@@ -1358,30 +1620,97 @@ int export_handle_export_table(
 			 "\t" );
 		}
 	}
-	/* Write the record (row) values to the table file
-	 */
-	if( libesedb_table_get_number_of_records(
-	     table,
-	     &number_of_records,
-	     error ) != 1 )
+	return( 1 );
+
+on_error:
+	if( value_string != NULL )
+	{
+		memory_free(
+		 value_string );
+	}
+	if( column != NULL )
+	{
+		libesedb_column_free(
+		 &column,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Exports a range of records of the table
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_table_records(
+     export_handle_t *export_handle,
+     int database_type,
+     libesedb_table_t *table,
+     const system_character_t *table_name,
+     size_t table_name_length,
+     int first_record_entry,
+     int number_of_records,
+     FILE *table_file_stream,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	libesedb_record_t *record = NULL;
+	static char *function     = "export_handle_export_table_records";
+	int known_table           = 0;
+	int record_iterator       = 0;
+	int result                = 0;
+
+	if( export_handle == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of records.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	for( record_iterator = 0;
-	     record_iterator < number_of_records;
-	     record_iterator++ )
+	if( table_name == NULL )
 	{
-		if( libesedb_table_get_record(
-		     table,
-		     record_iterator,
-		     &record,
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table name.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_record_entry < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid first record entry value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_records < 0 )
+	 || ( number_of_records > ( INT_MAX - first_record_entry ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of records value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( record_iterator = 0;
+	     record_iterator < number_of_records;
+	     record_iterator++ )
+	{
+		if( libesedb_table_get_record(
+		     table,
+		     first_record_entry + record_iterator,
+		     &record,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -1390,7 +1719,7 @@ int export_handle_export_table(
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
 			 "%s: unable to retrieve record: %d.",
 			 function,
-			 record_iterator );
+			 first_record_entry + record_iterator );
 
 			goto on_error;
 		}
@@ -1644,45 +1973,6 @@ int export_handle_export_table(
 			break;
 		}
 	}
-	if( file_stream_close(
-	     table_file_stream ) != 0 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
-		 "%s: unable to close table file.",
-		 function );
-
-		goto on_error;
-	}
-	table_file_stream = NULL;
-
-	if( export_handle->abort == 0 )
-	{
-		if( export_handle->export_mode != EXPORT_MODE_TABLES )
-		{
-			if( export_handle_export_indexes(
-			     export_handle,
-			     table,
-			     table_name,
-			     table_name_length,
-			     export_path,
-			     export_path_length,
-			     log_handle,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GENERIC,
-				 "%s: unable to export indexes.",
-				 function );
-
-				goto on_error;
-			}
-		}
-	}
 	return( 1 );
 
 on_error:
@@ -1692,27 +1982,6 @@ on_error:
 		 &record,
 		 NULL );
 	}
-	if( value_string != NULL )
-	{
-		memory_free(
-		 value_string );
-	}
-	if( column != NULL )
-	{
-		libesedb_column_free(
-		 &column,
-		 NULL );
-	}
-	if( table_file_stream != NULL )
-	{
-		file_stream_close(
-		 table_file_stream );
-	}
-	if( item_filename != NULL )
-	{
-		memory_free(
-		 item_filename );
-	}
 	return( -1 );
 }
 
@@ -1950,24 +2219,15 @@ int export_handle_export_indexes(
 
 			goto on_error;
 		}
-		fprintf(
-		 export_handle->notify_stream,
-		 "Exporting index %d (%" PRIs_SYSTEM ")",
+		/* The message is printed at once since the indexes of multiple tables
+		 * can be exported concurrently
+		 */
+		log_handle_printf(
+		 export_handle->notify_log_handle,
+		 "Exporting index %d (%" PRIs_SYSTEM ").\n",
 		 index_iterator + 1,
 		 index_name );
 
-		/* TODO want to change this to an export index name or refactor */
-		if( index_name == NULL )
-		{
-			fprintf(
-			 export_handle->notify_stream,
-			 " out of %d",
-			 number_of_indexes );
-		}
-		fprintf(
-		 export_handle->notify_stream,
-		 ".\n" );
-
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER )
 		if( libcpath_path_get_sanitized_filename_wide(
 		     index_name,
@@ -2080,12 +2340,15 @@ int export_handle_export_index(
      log_handle_t *log_handle,
      libcerror_error_t **error )
 {
+	libesedb_record_t *records[ EXPORT_HANDLE_NUMBER_OF_INDEX_RECORDS_PER_BATCH ];
+
 	system_character_t *item_filename = NULL;
-	libesedb_record_t *record         = NULL;
 	FILE *index_file_stream           = NULL;
 	static char *function             = "export_handle_export_index";
-	int known_index                   = 0;
 	size_t item_filename_size         = 0;
+	int batch_record_index            = 0;
+	int known_index                   = 0;
+	int number_of_batch_records       = 0;
 	int number_of_records             = 0;
 	int record_iterator               = 0;
 	int result                        = 0;
@@ -2112,6 +2375,20 @@ int export_handle_export_index(
 
 		return( -1 );
 	}
+	if( memory_set(
+	     records,
+	     0,
+	     sizeof( libesedb_record_t * ) * EXPORT_HANDLE_NUMBER_OF_INDEX_RECORDS_PER_BATCH ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear records.",
+		 function );
+
+		return( -1 );
+	}
 	if( export_handle_create_item_filename(
 	     export_handle,
 	     index_iterator,
@@ -2330,59 +2607,74 @@ int export_handle_export_index(
 
 		goto on_error;
 	}
+	/* The records are retrieved in batches so that the table is read in key order
+	 */
 	for( record_iterator = 0;
 	     record_iterator < number_of_records;
-	     record_iterator++ )
+	     record_iterator += number_of_batch_records )
 	{
-		if( libesedb_index_get_record(
+		number_of_batch_records = number_of_records - record_iterator;
+
+		if( number_of_batch_records > EXPORT_HANDLE_NUMBER_OF_INDEX_RECORDS_PER_BATCH )
+		{
+			number_of_batch_records = EXPORT_HANDLE_NUMBER_OF_INDEX_RECORDS_PER_BATCH;
+		}
+		if( libesedb_index_get_records(
 		     index,
 		     record_iterator,
-		     &record,
+		     number_of_batch_records,
+		     records,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve record: %d.",
+			 "%s: unable to retrieve records: %d to %d.",
 			 function,
-			 record_iterator );
+			 record_iterator,
+			 record_iterator + number_of_batch_records );
 
 			goto on_error;
 		}
-		known_index = 0;
-
-		if( known_index == 0 )
-		{
-			result = export_handle_export_record(
-			          record,
-			          index_file_stream,
-			          log_handle,
-			          error );
-		}
-		if( result != 1 )
+		for( batch_record_index = 0;
+		     batch_record_index < number_of_batch_records;
+		     batch_record_index++ )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GENERIC,
-			 "%s: unable to export record.",
-			 function );
+			known_index = 0;
 
-			goto on_error;
-		}
-		if( libesedb_record_free(
-		     &record,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free record.",
-			 function );
+			if( known_index == 0 )
+			{
+				result = export_handle_export_record(
+				          records[ batch_record_index ],
+				          index_file_stream,
+				          log_handle,
+				          error );
+			}
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to export record.",
+				 function );
 
-			goto on_error;
+				goto on_error;
+			}
+			if( libesedb_record_free(
+			     &( records[ batch_record_index ] ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free record.",
+				 function );
+
+				goto on_error;
+			}
 		}
 	}
 	if( file_stream_close(
@@ -2402,11 +2694,16 @@ int export_handle_export_index(
 	return( 1 );
 
 on_error:
-	if( record != NULL )
+	for( batch_record_index = 0;
+	     batch_record_index < number_of_batch_records;
+	     batch_record_index++ )
 	{
-		libesedb_record_free(
-		 &record,
-		 NULL );
+		if( records[ batch_record_index ] != NULL )
+		{
+			libesedb_record_free(
+			 &( records[ batch_record_index ] ),
+			 NULL );
+		}
 	}
 #ifdef TODO
 	if( value_string != NULL )
@@ -2533,7 +2830,7 @@ int export_handle_export_record_value(
 	system_character_t *value_string    = NULL;
         libesedb_multi_value_t *multi_value = NULL;
 	uint8_t *binary_data                = NULL;
-	uint8_t *multi_value_data           = NULL;
+	const uint8_t *multi_value_data     = NULL;
 	uint8_t *value_data                 = NULL;
 	static char *function               = "export_handle_export_record_value";
 	size_t binary_data_size             = 0;
@@ -2983,17 +3280,18 @@ int export_handle_export_record_value(
 			}
 			else
 			{
-				if( libesedb_multi_value_get_value_data_size(
+				if( libesedb_multi_value_get_value_data_reference(
 				     multi_value,
 				     multi_value_iterator,
-				     &value_data_size,
+				     &multi_value_data,
+				     &multi_value_data_size,
 				     error ) != 1 )
 				{
 					libcerror_error_set(
 					 error,
 					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to retrieve multi value: %d data size of record entry: %d.",
+					 "%s: unable to retrieve multi value: %d data of record entry: %d.",
 					 function,
 					 multi_value_iterator,
 					 record_value_entry );
@@ -3002,47 +3300,10 @@ int export_handle_export_record_value(
 				}
 				if( multi_value_data_size > 0 )
 				{
-					multi_value_data = (uint8_t *) memory_allocate(
-									sizeof( uint8_t ) * multi_value_data_size );
-
-					if( multi_value_data == NULL )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_MEMORY,
-						 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-						 "%s: unable to create multi value data.",
-						 function );
-
-						goto on_error;
-					}
-					if( libesedb_multi_value_get_value_data(
-					     multi_value,
-					     multi_value_iterator,
-					     multi_value_data,
-					     multi_value_data_size,
-					     error ) != 1 )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-						 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-						 "%s: unable to retrieve multi value: %d data of record entry: %d.",
-						 function,
-						 multi_value_iterator,
-						 record_value_entry );
-
-						goto on_error;
-					}
 					export_binary_data(
 					 multi_value_data,
 					 multi_value_data_size,
 					 record_file_stream );
-
-					memory_free(
-					 multi_value_data );
-
-					multi_value_data = NULL;
 				}
 			}
 		}
@@ -3071,11 +3332,6 @@ int export_handle_export_record_value(
 	return( 1 );
 
 on_error:
-	if( multi_value_data != NULL )
-	{
-		memory_free(
-		 multi_value_data );
-	}
 	if( multi_value != NULL )
 	{
 		libesedb_multi_value_free(
@@ -4097,87 +4353,1524 @@ on_error:
 	return( -1 );
 }
 
-/* Exports the items in the file
- * Returns the 1 if succesful, 0 if no items are available or -1 on error
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Appends the data of a file stream to another file stream
+ * Returns 1 if successful or -1 on error
  */
-int export_handle_export_file(
-     export_handle_t *export_handle,
-     const system_character_t *export_table_name,
-     size_t export_table_name_length,
-     log_handle_t *log_handle,
+int export_handle_append_file_stream(
+     FILE *destination_file_stream,
+     FILE *source_file_stream,
      libcerror_error_t **error )
 {
-	libcdata_array_t *table_names      = NULL;
-	libesedb_table_t *table            = NULL;
-	system_character_t *sanitized_name = NULL;
-	system_character_t *table_name     = NULL;
-	static char *function              = "export_handle_export_file";
-	size_t sanitized_name_size         = 0;
-	size_t table_name_length           = 0;
-	size_t table_name_size             = 0;
-	int database_type                  = 0;
-	int entry_index                    = 0;
-	int number_of_tables               = 0;
-	int result                         = 0;
-	int table_exported                 = 0;
-	int table_index                    = 0;
+	uint8_t *copy_buffer  = NULL;
+	static char *function = "export_handle_append_file_stream";
+	size_t read_count     = 0;
 
-	if( export_handle == NULL )
+	if( destination_file_stream == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid export handle.",
+		 "%s: invalid destination file stream.",
 		 function );
 
 		return( -1 );
 	}
-	if( export_table_name_length > (size_t) SSIZE_MAX )
+	if( source_file_stream == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
-		 "%s: invalid export table name length value exceeds maximum.",
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid source file stream.",
 		 function );
 
 		return( -1 );
 	}
-	if( libesedb_file_get_number_of_tables(
-	     export_handle->input_file,
-	     &number_of_tables,
-	     error ) != 1 )
+	if( file_stream_seek_offset(
+	     source_file_stream,
+	     0,
+	     SEEK_SET ) != 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of tables.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_SEEK_FAILED,
+		 "%s: unable to seek start of source file stream.",
 		 function );
 
 		goto on_error;
 	}
-	if( number_of_tables == 0 )
-	{
-		return( 0 );
-	}
-	if( libcdata_array_initialize(
-	     &table_names,
-	     0,
-	     error ) != 1 )
+	copy_buffer = (uint8_t *) memory_allocate(
+	                           sizeof( uint8_t ) * EXPORT_HANDLE_COPY_BUFFER_SIZE );
+
+	if( copy_buffer == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create table names array.",
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create copy buffer.",
 		 function );
 
 		goto on_error;
 	}
-	for( table_index = 0;
-	     table_index < number_of_tables;
+	do
+	{
+		read_count = file_stream_read(
+		              source_file_stream,
+		              copy_buffer,
+		              EXPORT_HANDLE_COPY_BUFFER_SIZE );
+
+		if( read_count == 0 )
+		{
+			if( file_stream_at_end(
+			     source_file_stream ) == 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read from source file stream.",
+				 function );
+
+				goto on_error;
+			}
+			break;
+		}
+		if( file_stream_write(
+		     destination_file_stream,
+		     copy_buffer,
+		     read_count ) != read_count )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write to destination file stream.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	while( read_count == EXPORT_HANDLE_COPY_BUFFER_SIZE );
+
+	memory_free(
+	 copy_buffer );
+
+	return( 1 );
+
+on_error:
+	if( copy_buffer != NULL )
+	{
+		memory_free(
+		 copy_buffer );
+	}
+	return( -1 );
+}
+
+/* Creates the item filename of a table partition
+ * The partition item filename consists of the table item filename and the job index
+ * since the jobs that were split off from a partition share its partition index
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_create_partition_item_filename(
+     export_handle_t *export_handle,
+     export_job_t *export_job,
+     system_character_t **item_filename,
+     size_t *item_filename_size,
+     libcerror_error_t **error )
+{
+	system_character_t *table_item_filename = NULL;
+	static char *function                   = "export_handle_create_partition_item_filename";
+	size_t table_item_filename_size         = 0;
+
+	if( export_job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export job.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle_create_item_filename(
+	     export_handle,
+	     export_job->table_index,
+	     export_job->table_name,
+	     export_job->table_name_size - 1,
+	     &table_item_filename,
+	     &table_item_filename_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create table item filename.",
+		 function );
+
+		goto on_error;
+	}
+	if( export_handle_create_item_filename(
+	     export_handle,
+	     export_job->job_index,
+	     table_item_filename,
+	     table_item_filename_size - 1,
+	     item_filename,
+	     item_filename_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create partition item filename.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 table_item_filename );
+
+	return( 1 );
+
+on_error:
+	if( table_item_filename != NULL )
+	{
+		memory_free(
+		 table_item_filename );
+	}
+	return( -1 );
+}
+
+/* Appends the partition file of an export job to the table file and removes it
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_append_partition_file(
+     export_handle_t *export_handle,
+     export_job_t *export_job,
+     FILE *table_file_stream,
+     libcerror_error_t **error )
+{
+	system_character_t *item_filename      = NULL;
+	system_character_t *item_filename_path = NULL;
+	FILE *partition_file_stream            = NULL;
+	static char *function                  = "export_handle_append_partition_file";
+	size_t item_filename_path_size         = 0;
+	size_t item_filename_size              = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle_create_partition_item_filename(
+	     export_handle,
+	     export_job,
+	     &item_filename,
+	     &item_filename_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create partition item filename.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libcpath_path_join_wide(
+	     &item_filename_path,
+	     &item_filename_path_size,
+	     export_handle->items_export_path,
+	     export_handle->items_export_path_size - 1,
+	     item_filename,
+	     item_filename_size - 1,
+	     error ) != 1 )
+#else
+	if( libcpath_path_join(
+	     &item_filename_path,
+	     &item_filename_path_size,
+	     export_handle->items_export_path,
+	     export_handle->items_export_path_size - 1,
+	     item_filename,
+	     item_filename_size - 1,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create partition item filename path.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 item_filename );
+
+	item_filename = NULL;
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	partition_file_stream = file_stream_open_wide(
+	                         item_filename_path,
+	                         _SYSTEM_STRING( FILE_STREAM_OPEN_READ ) );
+#else
+	partition_file_stream = file_stream_open(
+	                         item_filename_path,
+	                         FILE_STREAM_OPEN_READ );
+#endif
+	if( partition_file_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open: %" PRIs_SYSTEM ".",
+		 function,
+		 item_filename_path );
+
+		goto on_error;
+	}
+	if( export_handle_append_file_stream(
+	     table_file_stream,
+	     partition_file_stream,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to append: %" PRIs_SYSTEM ".",
+		 function,
+		 item_filename_path );
+
+		goto on_error;
+	}
+	if( file_stream_close(
+	     partition_file_stream ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close partition file.",
+		 function );
+
+		partition_file_stream = NULL;
+
+		goto on_error;
+	}
+	partition_file_stream = NULL;
+
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+	if( libcfile_file_remove_wide(
+	     item_filename_path,
+	     error ) != 1 )
+#else
+	if( libcfile_file_remove(
+	     item_filename_path,
+	     error ) != 1 )
+#endif
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_UNLINK_FAILED,
+		 "%s: unable to remove: %" PRIs_SYSTEM ".",
+		 function,
+		 item_filename_path );
+
+		goto on_error;
+	}
+	memory_free(
+	 item_filename_path );
+
+	return( 1 );
+
+on_error:
+	if( partition_file_stream != NULL )
+	{
+		file_stream_close(
+		 partition_file_stream );
+	}
+	if( item_filename_path != NULL )
+	{
+		memory_free(
+		 item_filename_path );
+	}
+	if( item_filename != NULL )
+	{
+		memory_free(
+		 item_filename );
+	}
+	return( -1 );
+}
+
+/* Exports the table or table partition of an export job
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_export_job(
+     export_handle_t *export_handle,
+     export_job_t *export_job,
+     libcerror_error_t **error )
+{
+	system_character_t *item_filename = NULL;
+	libesedb_table_t *table           = NULL;
+	FILE *table_file_stream           = NULL;
+	static char *function             = "export_handle_export_job";
+	size_t item_filename_size         = 0;
+	int number_of_chunk_records       = 0;
+	int number_of_records             = 0;
+	int number_of_split_records       = 0;
+	int record_entry                  = 0;
+	int result                        = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export job.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_handle->abort != 0 )
+	{
+		return( 1 );
+	}
+	/* Every job uses its own table, the page trees and page cache of the table
+	 * are part of the table state that is shared with the other jobs of the same
+	 * table and that supports concurrent readers
+	 */
+	if( libesedb_file_get_table(
+	     export_handle->input_file,
+	     export_job->table_index,
+	     &table,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve table: %d.",
+		 function,
+		 export_job->table_index );
+
+		goto on_error;
+	}
+	if( export_job->number_of_partitions == 1 )
+	{
+		if( export_handle_export_table(
+		     export_handle,
+		     export_job->database_type,
+		     table,
+		     export_job->table_index,
+		     export_job->table_name,
+		     export_job->table_name_size - 1,
+		     export_handle->items_export_path,
+		     export_handle->items_export_path_size - 1,
+		     export_job->log_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to export table: %d.",
+			 function,
+			 export_job->table_index );
+
+			goto on_error;
+		}
+	}
+	else
+	{
+		/* The partitions are determined by the job instead of the scheduling thread
+		 * since this requires the leaf pages of the table to be read, the record
+		 * range of a split job is set when it is split off
+		 */
+		if( export_job->is_split_job == 0 )
+		{
+			if( libesedb_table_get_record_partition(
+			     table,
+			     export_job->partition_index,
+			     export_job->number_of_partitions,
+			     &( export_job->first_record_entry ),
+			     &( export_job->number_of_records ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve record partition: %d of table: %d.",
+				 function,
+				 export_job->partition_index,
+				 export_job->table_index );
+
+				goto on_error;
+			}
+		}
+		/* The first partition writes to the table file, the other partitions and
+		 * the split jobs write to a partition file that is appended to the table
+		 * file afterwards
+		 */
+		if( ( export_job->partition_index == 0 )
+		 && ( export_job->is_split_job == 0 ) )
+		{
+			table_file_stream = export_job->table_file_stream;
+		}
+		else
+		{
+			if( export_handle_create_partition_item_filename(
+			     export_handle,
+			     export_job,
+			     &item_filename,
+			     &item_filename_size,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create partition item filename.",
+				 function );
+
+				goto on_error;
+			}
+			result = export_handle_create_text_item_file(
+			          export_handle,
+			          item_filename,
+			          item_filename_size - 1,
+			          export_handle->items_export_path,
+			          export_handle->items_export_path_size - 1,
+			          &table_file_stream,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create partition file.",
+				 function );
+
+				goto on_error;
+			}
+			else if( result == 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+				 "%s: partition file: %" PRIs_SYSTEM " already exists.",
+				 function,
+				 item_filename );
+
+				goto on_error;
+			}
+			memory_free(
+			 item_filename );
+
+			item_filename = NULL;
+		}
+		record_entry      = export_job->first_record_entry;
+		number_of_records = export_job->number_of_records;
+
+		/* The records are exported in chunks so that the remaining records
+		 * can be split off into a new job when another thread becomes idle
+		 */
+		while( ( number_of_records > 0 )
+		    && ( export_handle->abort == 0 ) )
+		{
+			if( ( export_handle->scheduler != NULL )
+			 && ( number_of_records >= ( 2 * EXPORT_HANDLE_MINIMUM_NUMBER_OF_RECORDS_PER_SPLIT_JOB ) ) )
+			{
+				if( export_handle_split_export_job(
+				     export_handle,
+				     export_job,
+				     record_entry,
+				     number_of_records,
+				     &number_of_split_records,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to split export job: %d.",
+					 function,
+					 export_job->job_index );
+
+					goto on_error;
+				}
+				number_of_records -= number_of_split_records;
+			}
+			number_of_chunk_records = number_of_records;
+
+			if( number_of_chunk_records > EXPORT_HANDLE_NUMBER_OF_RECORDS_PER_CHUNK )
+			{
+				number_of_chunk_records = EXPORT_HANDLE_NUMBER_OF_RECORDS_PER_CHUNK;
+			}
+			if( export_handle_export_table_records(
+			     export_handle,
+			     export_job->database_type,
+			     table,
+			     export_job->table_name,
+			     export_job->table_name_size - 1,
+			     record_entry,
+			     number_of_chunk_records,
+			     table_file_stream,
+			     export_job->log_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to export records of partition: %d of table: %d.",
+				 function,
+				 export_job->partition_index,
+				 export_job->table_index );
+
+				goto on_error;
+			}
+			record_entry      += number_of_chunk_records;
+			number_of_records -= number_of_chunk_records;
+
+			export_job->number_of_exported_records += number_of_chunk_records;
+		}
+		if( ( export_job->partition_index != 0 )
+		 || ( export_job->is_split_job != 0 ) )
+		{
+			if( file_stream_close(
+			     table_file_stream ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close partition file.",
+				 function );
+
+				table_file_stream = NULL;
+
+				goto on_error;
+			}
+		}
+		table_file_stream = NULL;
+
+		log_handle_printf(
+		 export_job->log_handle,
+		 "Exported %d records starting at record: %d of table: %" PRIs_SYSTEM " (partition %d of %d%s).\n",
+		 export_job->number_of_exported_records,
+		 export_job->first_record_entry,
+		 export_job->table_name,
+		 export_job->partition_index + 1,
+		 export_job->number_of_partitions,
+		 ( export_job->is_split_job != 0 ) ? ", split job" : "" );
+
+		log_handle_printf(
+		 export_job->log_handle,
+		 "Job: %d processed by thread: %d%s, split off jobs: %d.\n",
+		 export_job->job_index,
+		 export_job->thread_index,
+		 ( export_job->is_stolen != 0 ) ? " (stolen)" : "",
+		 export_job->number_of_split_jobs );
+
+		if( ( export_job->partition_index == 0 )
+		 && ( export_job->is_split_job == 0 )
+		 && ( export_handle->abort == 0 )
+		 && ( export_handle->export_mode != EXPORT_MODE_TABLES ) )
+		{
+			if( export_handle_export_indexes(
+			     export_handle,
+			     table,
+			     export_job->table_name,
+			     export_job->table_name_size - 1,
+			     export_handle->items_export_path,
+			     export_handle->items_export_path_size - 1,
+			     export_job->log_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to export indexes of table: %d.",
+				 function,
+				 export_job->table_index );
+
+				goto on_error;
+			}
+		}
+	}
+	if( libesedb_table_free(
+	     &table,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free table: %d.",
+		 function,
+		 export_job->table_index );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( ( table_file_stream != NULL )
+	 && ( table_file_stream != export_job->table_file_stream ) )
+	{
+		file_stream_close(
+		 table_file_stream );
+	}
+	if( item_filename != NULL )
+	{
+		memory_free(
+		 item_filename );
+	}
+	if( table != NULL )
+	{
+		libesedb_table_free(
+		 &table,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Processes an export job
+ * Callback function for the scheduler
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_process_export_job(
+     export_job_t *export_job,
+     export_handle_t *export_handle )
+{
+	if( export_job == NULL )
+	{
+		return( -1 );
+	}
+	export_job->result = export_handle_export_job(
+	                      export_handle,
+	                      export_job,
+	                      &( export_job->error ) );
+
+	return( export_job->result );
+}
+
+/* Splits off the second half of the remaining records of an export job into a new job
+ * The records are only split off when a scheduler thread is idle, the new job is pushed
+ * onto the queue of the thread that processes the export job so that other threads
+ * steal it
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_split_export_job(
+     export_handle_t *export_handle,
+     export_job_t *export_job,
+     int first_record_entry,
+     int number_of_records,
+     int *number_of_split_records,
+     libcerror_error_t **error )
+{
+	export_job_t *split_export_job = NULL;
+	static char *function          = "export_handle_split_export_job";
+	int number_of_idle_threads     = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export job.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_record_entry < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid first record entry value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_records < 0 )
+	 || ( number_of_records > ( INT_MAX - first_record_entry ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of records value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_split_records == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of split records.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_split_records = 0;
+
+	if( ( export_handle->scheduler == NULL )
+	 || ( number_of_records < ( 2 * EXPORT_HANDLE_MINIMUM_NUMBER_OF_RECORDS_PER_SPLIT_JOB ) ) )
+	{
+		return( 1 );
+	}
+	if( export_scheduler_get_number_of_idle_threads(
+	     export_handle->scheduler,
+	     &number_of_idle_threads,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of idle threads.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_idle_threads == 0 )
+	{
+		return( 1 );
+	}
+	if( export_job_initialize(
+	     &split_export_job,
+	     export_job->database_type,
+	     export_job->table_index,
+	     export_job->table_name,
+	     export_job->table_name_size - 1,
+	     export_job->partition_index,
+	     export_job->number_of_partitions,
+	     export_job->output_log_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create split export job.",
+		 function );
+
+		goto on_error;
+	}
+	split_export_job->is_split_job       = 1;
+	split_export_job->number_of_records  = number_of_records / 2;
+	split_export_job->first_record_entry = first_record_entry + number_of_records - split_export_job->number_of_records;
+
+	/* The split export job is now managed by the scheduler
+	 */
+	if( export_scheduler_push_job(
+	     export_handle->scheduler,
+	     export_job->thread_index,
+	     split_export_job,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to push split export job onto scheduler.",
+		 function );
+
+		goto on_error;
+	}
+	*number_of_split_records = split_export_job->number_of_records;
+
+	export_job->number_of_records    -= *number_of_split_records;
+	export_job->number_of_split_jobs += 1;
+
+	return( 1 );
+
+on_error:
+	if( split_export_job != NULL )
+	{
+		export_job_free(
+		 &split_export_job,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Pushes the export jobs of a table onto the scheduler
+ * Tables with a large number of records are split into multiple partitions
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_push_export_jobs(
+     export_handle_t *export_handle,
+     export_scheduler_t *scheduler,
+     int database_type,
+     libesedb_table_t *table,
+     int table_index,
+     const system_character_t *table_name,
+     size_t table_name_length,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	export_job_t *export_job          = NULL;
+	system_character_t *item_filename = NULL;
+	FILE *table_file_stream           = NULL;
+	static char *function             = "export_handle_push_export_jobs";
+	size_t item_filename_size         = 0;
+	int number_of_partitions          = 0;
+	int number_of_records             = 0;
+	int partition_index               = 0;
+	int result                        = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	/* The estimate is used since determining the number of records requires
+	 * all the leaf pages of the table to be read by the scheduling thread
+	 */
+	if( libesedb_table_get_estimated_number_of_records(
+	     table,
+	     &number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve estimated number of records.",
+		 function );
+
+		goto on_error;
+	}
+	/* Large tables are split into more partitions than there are threads
+	 * so that threads that finish early pick up the remaining partitions
+	 * of a large table instead of remaining idle, since the estimate can be
+	 * off, partitions that turn out to be large are split further while
+	 * they are exported
+	 */
+	number_of_partitions = number_of_records / EXPORT_HANDLE_NUMBER_OF_RECORDS_PER_PARTITION;
+
+	if( number_of_partitions > ( export_handle->number_of_threads * EXPORT_HANDLE_MAXIMUM_NUMBER_OF_PARTITIONS_PER_THREAD ) )
+	{
+		number_of_partitions = export_handle->number_of_threads * EXPORT_HANDLE_MAXIMUM_NUMBER_OF_PARTITIONS_PER_THREAD;
+	}
+	else if( number_of_partitions < 1 )
+	{
+		number_of_partitions = 1;
+	}
+	if( number_of_partitions > 1 )
+	{
+		/* The table file and column names are written before the jobs are pushed
+		 * so that the partitions of a table that already exists are not exported
+		 */
+		if( export_handle_create_item_filename(
+		     export_handle,
+		     table_index,
+		     table_name,
+		     table_name_length,
+		     &item_filename,
+		     &item_filename_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create item filename.",
+			 function );
+
+			goto on_error;
+		}
+		result = export_handle_create_text_item_file(
+		          export_handle,
+		          item_filename,
+		          item_filename_size - 1,
+		          export_handle->items_export_path,
+		          export_handle->items_export_path_size - 1,
+		          &table_file_stream,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create table file.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			log_handle_printf(
+			 log_handle,
+			 "Skipping table: %" PRIs_SYSTEM " it already exists.\n",
+			 item_filename );
+
+			memory_free(
+			 item_filename );
+
+			return( 1 );
+		}
+		memory_free(
+		 item_filename );
+
+		item_filename = NULL;
+
+		if( export_handle_export_table_columns(
+		     table,
+		     table_file_stream,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to export column names.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	for( partition_index = 0;
+	     partition_index < number_of_partitions;
+	     partition_index++ )
+	{
+		if( export_job_initialize(
+		     &export_job,
+		     database_type,
+		     table_index,
+		     table_name,
+		     table_name_length,
+		     partition_index,
+		     number_of_partitions,
+		     log_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create export job.",
+			 function );
+
+			goto on_error;
+		}
+		if( partition_index == 0 )
+		{
+			export_job->table_file_stream = table_file_stream;
+			table_file_stream             = NULL;
+		}
+		/* The export job is now managed by the scheduler
+		 */
+		if( export_scheduler_push_job(
+		     scheduler,
+		     -1,
+		     export_job,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push export job onto scheduler.",
+			 function );
+
+			goto on_error;
+		}
+		export_job = NULL;
+	}
+	return( 1 );
+
+on_error:
+	if( export_job != NULL )
+	{
+		export_job_free(
+		 &export_job,
+		 NULL );
+	}
+	if( table_file_stream != NULL )
+	{
+		file_stream_close(
+		 table_file_stream );
+	}
+	if( item_filename != NULL )
+	{
+		memory_free(
+		 item_filename );
+	}
+	return( -1 );
+}
+
+/* Compares two export jobs by table and record range
+ * Returns LIBCDATA_COMPARE_LESS, LIBCDATA_COMPARE_EQUAL, LIBCDATA_COMPARE_GREATER if successful or -1 on error
+ */
+int export_handle_compare_export_jobs(
+     export_job_t *first_export_job,
+     export_job_t *second_export_job,
+     libcerror_error_t **error )
+{
+	static char *function = "export_handle_compare_export_jobs";
+
+	if( first_export_job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first export job.",
+		 function );
+
+		return( -1 );
+	}
+	if( second_export_job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid second export job.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_export_job->table_index < second_export_job->table_index )
+	{
+		return( LIBCDATA_COMPARE_LESS );
+	}
+	else if( first_export_job->table_index > second_export_job->table_index )
+	{
+		return( LIBCDATA_COMPARE_GREATER );
+	}
+	/* The jobs of a table are ordered by partition, a split job covers
+	 * the last records of the job it was split off from
+	 */
+	if( first_export_job->partition_index < second_export_job->partition_index )
+	{
+		return( LIBCDATA_COMPARE_LESS );
+	}
+	else if( first_export_job->partition_index > second_export_job->partition_index )
+	{
+		return( LIBCDATA_COMPARE_GREATER );
+	}
+	if( first_export_job->first_record_entry < second_export_job->first_record_entry )
+	{
+		return( LIBCDATA_COMPARE_LESS );
+	}
+	else if( first_export_job->first_record_entry > second_export_job->first_record_entry )
+	{
+		return( LIBCDATA_COMPARE_GREATER );
+	}
+	if( first_export_job->job_index < second_export_job->job_index )
+	{
+		return( LIBCDATA_COMPARE_LESS );
+	}
+	else if( first_export_job->job_index > second_export_job->job_index )
+	{
+		return( LIBCDATA_COMPARE_GREATER );
+	}
+	return( LIBCDATA_COMPARE_EQUAL );
+}
+
+/* Finalizes the export jobs after the scheduler was joined
+ * The partitions of a table are appended to the table file and the messages
+ * of the jobs are written to the log in table and record order
+ * Returns 1 if successful or -1 on error
+ */
+int export_handle_finalize_export_jobs(
+     export_handle_t *export_handle,
+     export_scheduler_t *scheduler,
+     libcerror_error_t **error )
+{
+	libcdata_array_t *sorted_export_jobs = NULL;
+	export_job_t *export_job             = NULL;
+	export_job_t *table_export_job       = NULL;
+	static char *function                = "export_handle_finalize_export_jobs";
+	int entry_index                      = 0;
+	int job_index                        = 0;
+	int number_of_export_jobs            = 0;
+	int number_of_split_jobs             = 0;
+	int number_of_stolen_jobs            = 0;
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_scheduler_get_number_of_jobs(
+	     scheduler,
+	     &number_of_export_jobs,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of export jobs.",
+		 function );
+
+		goto on_error;
+	}
+	if( export_scheduler_get_number_of_stolen_jobs(
+	     scheduler,
+	     &number_of_stolen_jobs,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of stolen export jobs.",
+		 function );
+
+		goto on_error;
+	}
+	/* The split jobs are pushed after the jobs of the other tables
+	 * hence the jobs are sorted by table and record range
+	 */
+	if( libcdata_array_initialize(
+	     &sorted_export_jobs,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create sorted export jobs array.",
+		 function );
+
+		goto on_error;
+	}
+	for( job_index = 0;
+	     job_index < number_of_export_jobs;
+	     job_index++ )
+	{
+		if( export_scheduler_get_job_by_index(
+		     scheduler,
+		     job_index,
+		     &export_job,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve export job: %d.",
+			 function,
+			 job_index );
+
+			goto on_error;
+		}
+		if( libcdata_array_insert_entry(
+		     sorted_export_jobs,
+		     &entry_index,
+		     (intptr_t *) export_job,
+		     (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &export_handle_compare_export_jobs,
+		     LIBCDATA_INSERT_FLAG_UNIQUE_ENTRIES,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to insert export job: %d into sorted array.",
+			 function,
+			 job_index );
+
+			goto on_error;
+		}
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_export_jobs;
+	     entry_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     sorted_export_jobs,
+		     entry_index,
+		     (intptr_t **) &export_job,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve sorted export job: %d.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		if( export_job == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing sorted export job: %d.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		/* The messages of the jobs are flushed in table and record order
+		 */
+		if( export_job->log_handle != NULL )
+		{
+			if( log_handle_flush_buffer(
+			     export_job->log_handle,
+			     export_job->output_log_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to flush log of export job: %d.",
+				 function,
+				 export_job->job_index );
+
+				goto on_error;
+			}
+		}
+		if( export_job->result == -1 )
+		{
+			if( export_job->error != NULL )
+			{
+				libcnotify_print_error_backtrace(
+				 export_job->error );
+			}
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to export table: %d.",
+			 function,
+			 export_job->table_index );
+
+			goto on_error;
+		}
+		if( export_job->is_split_job != 0 )
+		{
+			number_of_split_jobs++;
+		}
+		if( ( export_job->partition_index == 0 )
+		 && ( export_job->is_split_job == 0 ) )
+		{
+			table_export_job = export_job;
+		}
+		else if( ( table_export_job != NULL )
+		      && ( table_export_job->table_index == export_job->table_index )
+		      && ( export_handle->abort == 0 ) )
+		{
+			if( export_handle_append_partition_file(
+			     export_handle,
+			     export_job,
+			     table_export_job->table_file_stream,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_WRITE_FAILED,
+				 "%s: unable to append partition: %d of table: %d.",
+				 function,
+				 export_job->partition_index,
+				 export_job->table_index );
+
+				goto on_error;
+			}
+		}
+	}
+	if( libcdata_array_free(
+	     &sorted_export_jobs,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free sorted export jobs array.",
+		 function );
+
+		goto on_error;
+	}
+	log_handle_printf(
+	 export_handle->notify_log_handle,
+	 "Export jobs: %d of which split off: %d and stolen by another thread: %d.\n",
+	 number_of_export_jobs,
+	 number_of_split_jobs,
+	 number_of_stolen_jobs );
+
+	return( 1 );
+
+on_error:
+	if( sorted_export_jobs != NULL )
+	{
+		/* The export jobs are managed by the scheduler
+		 */
+		libcdata_array_free(
+		 &sorted_export_jobs,
+		 NULL,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* Exports the items in the file
+ * Returns the 1 if succesful, 0 if no items are available or -1 on error
+ */
+int export_handle_export_file(
+     export_handle_t *export_handle,
+     const system_character_t *export_table_name,
+     size_t export_table_name_length,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	libcdata_array_t *table_names      = NULL;
+	libesedb_table_t *table            = NULL;
+	system_character_t *sanitized_name = NULL;
+	system_character_t *table_name     = NULL;
+	static char *function              = "export_handle_export_file";
+	size_t sanitized_name_size         = 0;
+	size_t table_name_length           = 0;
+	size_t table_name_size             = 0;
+	int database_type                  = 0;
+	int entry_index                    = 0;
+	int number_of_tables               = 0;
+	int result                         = 0;
+	int table_exported                 = 0;
+	int table_index                    = 0;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	export_scheduler_t *scheduler      = NULL;
+#endif
+
+	if( export_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_table_name_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid export table name length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_file_get_number_of_tables(
+	     export_handle->input_file,
+	     &number_of_tables,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of tables.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_tables == 0 )
+	{
+		return( 0 );
+	}
+	if( libcdata_array_initialize(
+	     &table_names,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create table names array.",
+		 function );
+
+		goto on_error;
+	}
+	for( table_index = 0;
+	     table_index < number_of_tables;
 	     table_index++ )
 	{
 		if( libesedb_file_get_table(
@@ -4320,6 +6013,28 @@ int export_handle_export_file(
 	 "Database type: %" PRIs_SYSTEM ".\n",
 	 database_type_descriptions[ database_type ] );
 
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( export_handle->number_of_threads > 1 )
+	{
+		if( export_scheduler_initialize(
+		     &scheduler,
+		     export_handle->number_of_threads,
+		     (int (*)(export_job_t *, void *)) &export_handle_process_export_job,
+		     (void *) export_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create scheduler.",
+			 function );
+
+			goto on_error;
+		}
+		export_handle->scheduler = scheduler;
+	}
+#endif
 	for( table_index = 0;
 	     table_index < number_of_tables;
 	     table_index++ )
@@ -4422,22 +6137,26 @@ int export_handle_export_file(
 
 			table_exported = 1;
 		}
-		fprintf(
-		 export_handle->notify_stream,
-		 "Exporting table %d (%" PRIs_SYSTEM ")",
-		 table_index + 1,
-		 table_name );
-
+		/* The message is printed at once since the export jobs
+		 * can print messages concurrently
+		 */
 		if( export_table_name == NULL )
 		{
-			fprintf(
-			 export_handle->notify_stream,
-			 " out of %d",
+			log_handle_printf(
+			 export_handle->notify_log_handle,
+			 "Exporting table %d (%" PRIs_SYSTEM ") out of %d.\n",
+			 table_index + 1,
+			 table_name,
 			 number_of_tables );
 		}
-		fprintf(
-		 export_handle->notify_stream,
-		 ".\n" );
+		else
+		{
+			log_handle_printf(
+			 export_handle->notify_log_handle,
+			 "Exporting table %d (%" PRIs_SYSTEM ").\n",
+			 table_index + 1,
+			 table_name );
+		}
 
 /* TODO move into export_handle_export_table */
 
@@ -4468,17 +6187,36 @@ int export_handle_export_file(
 
 			goto on_error;
 		}
-		if( export_handle_export_table(
-		     export_handle,
-		     database_type,
-		     table,
-		     table_index,
-		     sanitized_name,
-		     sanitized_name_size - 1,
-		     export_handle->items_export_path,
-		     export_handle->items_export_path_size - 1,
-		     log_handle,
-		     error ) != 1 )
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( scheduler != NULL )
+		{
+			result = export_handle_push_export_jobs(
+			          export_handle,
+			          scheduler,
+			          database_type,
+			          table,
+			          table_index,
+			          sanitized_name,
+			          sanitized_name_size - 1,
+			          log_handle,
+			          error );
+		}
+		else
+#endif
+		{
+			result = export_handle_export_table(
+			          export_handle,
+			          database_type,
+			          table,
+			          table_index,
+			          sanitized_name,
+			          sanitized_name_size - 1,
+			          export_handle->items_export_path,
+			          export_handle->items_export_path_size - 1,
+			          log_handle,
+			          error );
+		}
+		if( result != 1 )
 		{
 			libcerror_error_set(
 			 error,
@@ -4514,6 +6252,55 @@ int export_handle_export_file(
 			goto on_error;
 		}
 	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( scheduler != NULL )
+	{
+		if( export_scheduler_join(
+		     scheduler,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join scheduler.",
+			 function );
+
+			goto on_error;
+		}
+		if( export_handle_finalize_export_jobs(
+		     export_handle,
+		     scheduler,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to finalize export jobs.",
+			 function );
+
+			goto on_error;
+		}
+		export_handle->scheduler = NULL;
+
+		/* The threads have been joined
+		 */
+		if( export_scheduler_free(
+		     &scheduler,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free scheduler.",
+			 function );
+
+			goto on_error;
+		}
+	}
+#endif
 	if( libcdata_array_free(
 	     &table_names,
 	     (int (*)(intptr_t **, libcerror_error_t **)) &export_handle_free_table_name,
@@ -4531,6 +6318,20 @@ int export_handle_export_file(
 	return( table_exported );
 
 on_error:
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( scheduler != NULL )
+	{
+		/* Signal the remaining jobs to stop before waiting for the threads
+		 */
+		export_handle->abort = 1;
+
+		export_scheduler_free(
+		 &scheduler,
+		 NULL );
+
+		export_handle->scheduler = NULL;
+	}
+#endif
 	if( sanitized_name != NULL )
 	{
 		memory_free(
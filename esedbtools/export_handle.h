@@ -28,7 +28,10 @@
 
 #include "esedbtools_libcdata.h"
 #include "esedbtools_libcerror.h"
+#include "esedbtools_libcthreads.h"
 #include "esedbtools_libesedb.h"
+#include "export_job.h"
+#include "export_scheduler.h"
 #include "log_handle.h"
 
 #if defined( __cplusplus )
@@ -73,10 +76,26 @@ struct export_handle
 	 */
 	FILE *notify_stream;
 
+	/* The notification log handle
+	 * Used to print notification messages of concurrent export jobs without interleaving
+	 */
+	log_handle_t *notify_log_handle;
+
 	/* The ascii codepage
 	 */
 	int ascii_codepage;
 
+	/* The number of threads
+	 */
+	int number_of_threads;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The scheduler of the export jobs
+	 * Used by export jobs to split off part of their records
+	 */
+	export_scheduler_t *scheduler;
+#endif
+
 	/* Value to indicate if abort was signalled
 	 */
 	int abort;
@@ -104,6 +123,11 @@ int export_handle_set_ascii_codepage(
      const system_character_t *string,
      libcerror_error_t **error );
 
+int export_handle_set_number_of_threads(
+     export_handle_t *export_handle,
+     const system_character_t *string,
+     libcerror_error_t **error );
+
 int export_handle_set_target_path(
      export_handle_t *export_handle,
      const system_character_t *target_path,
@@ -170,6 +194,23 @@ int export_handle_export_table(
      log_handle_t *log_handle,
      libcerror_error_t **error );
 
+int export_handle_export_table_columns(
+     libesedb_table_t *table,
+     FILE *table_file_stream,
+     libcerror_error_t **error );
+
+int export_handle_export_table_records(
+     export_handle_t *export_handle,
+     int database_type,
+     libesedb_table_t *table,
+     const system_character_t *table_name,
+     size_t table_name_length,
+     int first_record_entry,
+     int number_of_records,
+     FILE *table_file_stream,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
 int export_handle_export_indexes(
      export_handle_t *export_handle,
      libesedb_table_t *table,
@@ -218,6 +259,66 @@ int export_handle_export_long_record_value(
      log_handle_t *log_handle,
      libcerror_error_t **error );
 
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+int export_handle_append_file_stream(
+     FILE *destination_file_stream,
+     FILE *source_file_stream,
+     libcerror_error_t **error );
+
+int export_handle_create_partition_item_filename(
+     export_handle_t *export_handle,
+     export_job_t *export_job,
+     system_character_t **item_filename,
+     size_t *item_filename_size,
+     libcerror_error_t **error );
+
+int export_handle_append_partition_file(
+     export_handle_t *export_handle,
+     export_job_t *export_job,
+     FILE *table_file_stream,
+     libcerror_error_t **error );
+
+int export_handle_export_job(
+     export_handle_t *export_handle,
+     export_job_t *export_job,
+     libcerror_error_t **error );
+
+int export_handle_process_export_job(
+     export_job_t *export_job,
+     export_handle_t *export_handle );
+
+int export_handle_split_export_job(
+     export_handle_t *export_handle,
+     export_job_t *export_job,
+     int first_record_entry,
+     int number_of_records,
+     int *number_of_split_records,
+     libcerror_error_t **error );
+
+int export_handle_push_export_jobs(
+     export_handle_t *export_handle,
+     export_scheduler_t *scheduler,
+     int database_type,
+     libesedb_table_t *table,
+     int table_index,
+     const system_character_t *table_name,
+     size_t table_name_length,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
+int export_handle_compare_export_jobs(
+     export_job_t *first_export_job,
+     export_job_t *second_export_job,
+     libcerror_error_t **error );
+
+int export_handle_finalize_export_jobs(
+     export_handle_t *export_handle,
+     export_scheduler_t *scheduler,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
 int export_handle_export_file(
      export_handle_t *export_handle,
      const system_character_t *export_table_name,
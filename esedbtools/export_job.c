@@ -0,0 +1,301 @@
+/*
+ * Export job
+ *
+ * Copyright (C) 2009-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#include "esedbtools_libcerror.h"
+#include "export_job.h"
+#include "log_handle.h"
+
+/* Creates an export job
+ * Make sure the value export_job is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int export_job_initialize(
+     export_job_t **export_job,
+     int database_type,
+     int table_index,
+     const system_character_t *table_name,
+     size_t table_name_length,
+     int partition_index,
+     int number_of_partitions,
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "export_job_initialize";
+
+	if( export_job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export job.",
+		 function );
+
+		return( -1 );
+	}
+	if( *export_job != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid export job value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table name.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_name_length > (size_t) ( SSIZE_MAX - 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid table name length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_partitions <= 0 )
+	 || ( partition_index < 0 )
+	 || ( partition_index >= number_of_partitions ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid partition index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	*export_job = memory_allocate_structure(
+	               export_job_t );
+
+	if( *export_job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create export job.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *export_job,
+	     0,
+	     sizeof( export_job_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear export job.",
+		 function );
+
+		memory_free(
+		 *export_job );
+
+		*export_job = NULL;
+
+		return( -1 );
+	}
+	( *export_job )->table_name_size = table_name_length + 1;
+
+	( *export_job )->table_name = system_string_allocate(
+	                               ( *export_job )->table_name_size );
+
+	if( ( *export_job )->table_name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create table name.",
+		 function );
+
+		goto on_error;
+	}
+	if( system_string_copy(
+	     ( *export_job )->table_name,
+	     table_name,
+	     table_name_length ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_COPY_FAILED,
+		 "%s: unable to copy table name.",
+		 function );
+
+		goto on_error;
+	}
+	( *export_job )->table_name[ table_name_length ] = 0;
+
+	( *export_job )->database_type        = database_type;
+	( *export_job )->table_index          = table_index;
+	( *export_job )->partition_index      = partition_index;
+	( *export_job )->number_of_partitions = number_of_partitions;
+	( *export_job )->output_log_handle    = log_handle;
+	( *export_job )->job_index            = -1;
+	( *export_job )->thread_index         = -1;
+
+	if( log_handle != NULL )
+	{
+		if( log_handle_initialize(
+		     &( ( *export_job )->log_handle ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create log handle.",
+			 function );
+
+			goto on_error;
+		}
+		if( log_handle_open_buffer(
+		     ( *export_job )->log_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to open log handle buffer.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( *export_job != NULL )
+	{
+		if( ( *export_job )->log_handle != NULL )
+		{
+			log_handle_free(
+			 &( ( *export_job )->log_handle ),
+			 NULL );
+		}
+		if( ( *export_job )->table_name != NULL )
+		{
+			memory_free(
+			 ( *export_job )->table_name );
+		}
+		memory_free(
+		 *export_job );
+
+		*export_job = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees an export job
+ * Returns 1 if successful or -1 on error
+ */
+int export_job_free(
+     export_job_t **export_job,
+     libcerror_error_t **error )
+{
+	static char *function = "export_job_free";
+	int result            = 1;
+
+	if( export_job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export job.",
+		 function );
+
+		return( -1 );
+	}
+	if( *export_job != NULL )
+	{
+		if( ( *export_job )->table_file_stream != NULL )
+		{
+			if( file_stream_close(
+			     ( *export_job )->table_file_stream ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close table file stream.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *export_job )->log_handle != NULL )
+		{
+			if( log_handle_free(
+			     &( ( *export_job )->log_handle ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free log handle.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *export_job )->error != NULL )
+		{
+			libcerror_error_free(
+			 &( ( *export_job )->error ) );
+		}
+		memory_free(
+		 ( *export_job )->table_name );
+
+		memory_free(
+		 *export_job );
+
+		*export_job = NULL;
+	}
+	return( result );
+}
+
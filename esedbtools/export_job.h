@@ -0,0 +1,149 @@
+/*
+ * Export job
+ *
+ * Copyright (C) 2009-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _EXPORT_JOB_H )
+#define _EXPORT_JOB_H
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#include "esedbtools_libcerror.h"
+#include "log_handle.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct export_job export_job_t;
+
+struct export_job
+{
+	/* The database type
+	 */
+	int database_type;
+
+	/* The table index
+	 */
+	int table_index;
+
+	/* The (sanitized) table name
+	 */
+	system_character_t *table_name;
+
+	/* The table name size
+	 */
+	size_t table_name_size;
+
+	/* The partition index
+	 */
+	int partition_index;
+
+	/* The number of partitions
+	 */
+	int number_of_partitions;
+
+	/* The first record entry of the partition
+	 */
+	int first_record_entry;
+
+	/* The number of records in the partition
+	 */
+	int number_of_records;
+
+	/* Value to indicate the job was split off from another job
+	 * The record range of a split job is set when the job is created
+	 */
+	uint8_t is_split_job;
+
+	/* The index of the job in the scheduler
+	 */
+	int job_index;
+
+	/* The previous job in the queue of a scheduler thread
+	 */
+	export_job_t *previous_job;
+
+	/* The next job in the queue of a scheduler thread
+	 */
+	export_job_t *next_job;
+
+	/* The index of the scheduler thread that processed the job
+	 */
+	int thread_index;
+
+	/* Value to indicate the job was stolen from the queue of another scheduler thread
+	 */
+	uint8_t is_stolen;
+
+	/* The number of jobs that were split off from the job
+	 */
+	int number_of_split_jobs;
+
+	/* The number of records that were exported by the job
+	 * Only set by jobs that export a record range of a partitioned table
+	 */
+	int number_of_exported_records;
+
+	/* The table file stream
+	 * Only used by the first partition of a table that is exported in multiple partitions
+	 */
+	FILE *table_file_stream;
+
+	/* The log handle
+	 * The messages of the job are buffered and flushed to the output log handle in job order
+	 */
+	log_handle_t *log_handle;
+
+	/* The output log handle
+	 */
+	log_handle_t *output_log_handle;
+
+	/* The result of the job
+	 */
+	int result;
+
+	/* The error of the job
+	 */
+	libcerror_error_t *error;
+};
+
+int export_job_initialize(
+     export_job_t **export_job,
+     int database_type,
+     int table_index,
+     const system_character_t *table_name,
+     size_t table_name_length,
+     int partition_index,
+     int number_of_partitions,
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
+int export_job_free(
+     export_job_t **export_job,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _EXPORT_JOB_H ) */
+
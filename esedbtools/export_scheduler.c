@@ -0,0 +1,1137 @@
+/*
+ * Export job scheduler
+ *
+ * Copyright (C) 2009-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "esedbtools_libcdata.h"
+#include "esedbtools_libcerror.h"
+#include "esedbtools_libcthreads.h"
+#include "export_job.h"
+#include "export_scheduler.h"
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Creates a scheduler
+ * The scheduler uses a work-stealing approach: every thread has its own queue of jobs,
+ * a thread takes the most recently pushed job from its own queue and when its own queue
+ * is empty it steals the least recently pushed job from the queue of another thread
+ * Make sure the value scheduler is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int export_scheduler_initialize(
+     export_scheduler_t **scheduler,
+     int number_of_threads,
+     int (*callback_function)(
+            export_job_t *export_job,
+            void *callback_data ),
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	static char *function = "export_scheduler_initialize";
+	size_t queues_size    = 0;
+	size_t threads_size   = 0;
+	int thread_index      = 0;
+
+	if( scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scheduler.",
+		 function );
+
+		return( -1 );
+	}
+	if( *scheduler != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid scheduler value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_threads <= 0 )
+	 || ( (size_t) number_of_threads > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( export_scheduler_thread_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( callback_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback function.",
+		 function );
+
+		return( -1 );
+	}
+	*scheduler = memory_allocate_structure(
+	              export_scheduler_t );
+
+	if( *scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create scheduler.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *scheduler,
+	     0,
+	     sizeof( export_scheduler_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear scheduler.",
+		 function );
+
+		memory_free(
+		 *scheduler );
+
+		*scheduler = NULL;
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_initialize(
+	     &( ( *scheduler )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize mutex.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( ( *scheduler )->condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize condition.",
+		 function );
+
+		goto on_error;
+	}
+	if( libcdata_array_initialize(
+	     &( ( *scheduler )->jobs ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create jobs array.",
+		 function );
+
+		goto on_error;
+	}
+	queues_size = sizeof( export_scheduler_queue_t ) * number_of_threads;
+
+	( *scheduler )->queues = (export_scheduler_queue_t *) memory_allocate(
+	                                                       queues_size );
+
+	if( ( *scheduler )->queues == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create queues.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *scheduler )->queues,
+	     0,
+	     queues_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear queues.",
+		 function );
+
+		goto on_error;
+	}
+	threads_size = sizeof( export_scheduler_thread_t ) * number_of_threads;
+
+	( *scheduler )->threads = (export_scheduler_thread_t *) memory_allocate(
+	                                                         threads_size );
+
+	if( ( *scheduler )->threads == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create threads.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *scheduler )->threads,
+	     0,
+	     threads_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear threads.",
+		 function );
+
+		goto on_error;
+	}
+	( *scheduler )->number_of_threads = number_of_threads;
+	( *scheduler )->callback_function = callback_function;
+	( *scheduler )->callback_data     = callback_data;
+
+	for( thread_index = 0;
+	     thread_index < number_of_threads;
+	     thread_index++ )
+	{
+		( *scheduler )->threads[ thread_index ].scheduler    = *scheduler;
+		( *scheduler )->threads[ thread_index ].thread_index = thread_index;
+
+		if( libcthreads_thread_create(
+		     &( ( *scheduler )->threads[ thread_index ].thread ),
+		     NULL,
+		     (int (*)(void *)) &export_scheduler_thread_start_function,
+		     (void *) &( ( *scheduler )->threads[ thread_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread: %d.",
+			 function,
+			 thread_index );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( *scheduler != NULL )
+	{
+		/* This also joins the threads that were created
+		 */
+		export_scheduler_free(
+		 scheduler,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a scheduler
+ * The threads are joined if this was not done before
+ * Returns 1 if successful or -1 on error
+ */
+int export_scheduler_free(
+     export_scheduler_t **scheduler,
+     libcerror_error_t **error )
+{
+	static char *function = "export_scheduler_free";
+	int result            = 1;
+
+	if( scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scheduler.",
+		 function );
+
+		return( -1 );
+	}
+	if( *scheduler != NULL )
+	{
+		if( ( *scheduler )->threads != NULL )
+		{
+			if( export_scheduler_join(
+			     *scheduler,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join scheduler.",
+				 function );
+
+				result = -1;
+			}
+			memory_free(
+			 ( *scheduler )->threads );
+		}
+		if( ( *scheduler )->queues != NULL )
+		{
+			memory_free(
+			 ( *scheduler )->queues );
+		}
+		/* The jobs array manages the jobs that were queued
+		 */
+		if( ( *scheduler )->jobs != NULL )
+		{
+			if( libcdata_array_free(
+			     &( ( *scheduler )->jobs ),
+			     (int (*)(intptr_t **, libcerror_error_t **)) &export_job_free,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free jobs array.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *scheduler )->condition != NULL )
+		{
+			if( libcthreads_condition_free(
+			     &( ( *scheduler )->condition ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free condition.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( ( *scheduler )->mutex != NULL )
+		{
+			if( libcthreads_mutex_free(
+			     &( ( *scheduler )->mutex ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free mutex.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *scheduler );
+
+		*scheduler = NULL;
+	}
+	return( result );
+}
+
+/* Pushes a job onto the queue of a specific thread
+ * A thread index of -1 is used for jobs that are not pushed by a scheduler thread,
+ * these jobs are distributed over the queues of the threads
+ * If successful the scheduler takes over the job
+ * Returns 1 if successful or -1 on error
+ */
+int export_scheduler_push_job(
+     export_scheduler_t *scheduler,
+     int thread_index,
+     export_job_t *export_job,
+     libcerror_error_t **error )
+{
+	export_scheduler_queue_t *queue = NULL;
+	static char *function           = "export_scheduler_push_job";
+	int entry_index                 = 0;
+	int queue_index                 = 0;
+	int result                      = 1;
+
+	if( scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scheduler.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( thread_index < -1 )
+	 || ( thread_index >= scheduler->number_of_threads ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid thread index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export job.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     scheduler->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	/* The waiting threads cannot continue before the mutex is released, hence the
+	 * condition is broadcasted first so that the job is only queued when no error occurred
+	 */
+	if( libcthreads_condition_broadcast(
+	     scheduler->condition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to broadcast condition.",
+		 function );
+
+		result = -1;
+	}
+	else if( libcdata_array_append_entry(
+	          scheduler->jobs,
+	          &entry_index,
+	          (intptr_t *) export_job,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append export job to array.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		if( thread_index == -1 )
+		{
+			queue_index = scheduler->next_queue_index;
+
+			scheduler->next_queue_index += 1;
+
+			if( scheduler->next_queue_index >= scheduler->number_of_threads )
+			{
+				scheduler->next_queue_index = 0;
+			}
+		}
+		else
+		{
+			queue_index = thread_index;
+		}
+		queue = &( scheduler->queues[ queue_index ] );
+
+		export_job->job_index    = entry_index;
+		export_job->previous_job = queue->last_job;
+		export_job->next_job     = NULL;
+
+		if( queue->last_job == NULL )
+		{
+			queue->first_job = export_job;
+		}
+		else
+		{
+			queue->last_job->next_job = export_job;
+		}
+		queue->last_job = export_job;
+
+		queue->number_of_jobs            += 1;
+		scheduler->number_of_queued_jobs += 1;
+	}
+	if( libcthreads_mutex_release(
+	     scheduler->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Pops a job for a specific thread
+ * The thread takes the last job of its own queue or if its own queue is empty
+ * the first job of the queue of another thread
+ * This function must be called while holding the scheduler mutex
+ * Returns 1 if successful, 0 if no job is available or -1 on error
+ */
+int export_scheduler_pop_job(
+     export_scheduler_t *scheduler,
+     int thread_index,
+     export_job_t **export_job,
+     libcerror_error_t **error )
+{
+	export_scheduler_queue_t *queue = NULL;
+	static char *function           = "export_scheduler_pop_job";
+	int queue_iterator              = 0;
+	int queue_index                 = 0;
+
+	if( scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scheduler.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( thread_index < 0 )
+	 || ( thread_index >= scheduler->number_of_threads ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid thread index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( export_job == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid export job.",
+		 function );
+
+		return( -1 );
+	}
+	*export_job = NULL;
+
+	if( scheduler->number_of_queued_jobs == 0 )
+	{
+		return( 0 );
+	}
+	queue = &( scheduler->queues[ thread_index ] );
+
+	if( queue->last_job != NULL )
+	{
+		*export_job = queue->last_job;
+
+		queue->last_job = ( *export_job )->previous_job;
+
+		if( queue->last_job == NULL )
+		{
+			queue->first_job = NULL;
+		}
+		else
+		{
+			queue->last_job->next_job = NULL;
+		}
+		( *export_job )->is_stolen = 0;
+	}
+	else
+	{
+		/* The first job of another queue is stolen since it is the least
+		 * recently pushed and for split jobs typically the largest job
+		 */
+		for( queue_iterator = 1;
+		     queue_iterator < scheduler->number_of_threads;
+		     queue_iterator++ )
+		{
+			queue_index = ( thread_index + queue_iterator ) % scheduler->number_of_threads;
+
+			queue = &( scheduler->queues[ queue_index ] );
+
+			if( queue->first_job != NULL )
+			{
+				break;
+			}
+		}
+		if( queue->first_job == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: invalid scheduler - missing queued job.",
+			 function );
+
+			return( -1 );
+		}
+		*export_job = queue->first_job;
+
+		queue->first_job = ( *export_job )->next_job;
+
+		if( queue->first_job == NULL )
+		{
+			queue->last_job = NULL;
+		}
+		else
+		{
+			queue->first_job->previous_job = NULL;
+		}
+		( *export_job )->is_stolen = 1;
+
+		scheduler->number_of_stolen_jobs += 1;
+	}
+	( *export_job )->previous_job = NULL;
+	( *export_job )->next_job     = NULL;
+	( *export_job )->thread_index = thread_index;
+
+	queue->number_of_jobs            -= 1;
+	scheduler->number_of_queued_jobs -= 1;
+
+	return( 1 );
+}
+
+/* Processes the jobs of a scheduler thread
+ * The thread stops when the scheduler is joined and no jobs are queued or
+ * being processed, since a job that is being processed can push new jobs
+ * Returns 1 if successful or -1 on error
+ */
+int export_scheduler_thread_start_function(
+     export_scheduler_thread_t *scheduler_thread )
+{
+	export_job_t *export_job      = NULL;
+	export_scheduler_t *scheduler = NULL;
+	int result                    = 0;
+
+	if( scheduler_thread == NULL )
+	{
+		return( -1 );
+	}
+	scheduler = scheduler_thread->scheduler;
+
+	if( scheduler == NULL )
+	{
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     scheduler->mutex,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	do
+	{
+		result = export_scheduler_pop_job(
+		          scheduler,
+		          scheduler_thread->thread_index,
+		          &export_job,
+		          NULL );
+
+		if( result == 1 )
+		{
+			scheduler->number_of_running_jobs += 1;
+
+			if( libcthreads_mutex_release(
+			     scheduler->mutex,
+			     NULL ) != 1 )
+			{
+				return( -1 );
+			}
+			/* The job keeps its own result
+			 */
+			scheduler->callback_function(
+			 export_job,
+			 scheduler->callback_data );
+
+			if( libcthreads_mutex_grab(
+			     scheduler->mutex,
+			     NULL ) != 1 )
+			{
+				return( -1 );
+			}
+			scheduler->number_of_running_jobs -= 1;
+
+			/* Wake up the idle threads so that they can stop
+			 * if this was the last job
+			 */
+			if( ( scheduler->number_of_queued_jobs == 0 )
+			 && ( scheduler->number_of_running_jobs == 0 ) )
+			{
+				if( libcthreads_condition_broadcast(
+				     scheduler->condition,
+				     NULL ) != 1 )
+				{
+					result = -1;
+				}
+			}
+		}
+		else if( result == 0 )
+		{
+			if( ( scheduler->is_joining != 0 )
+			 && ( scheduler->number_of_running_jobs == 0 ) )
+			{
+				break;
+			}
+			scheduler->number_of_idle_threads += 1;
+
+			if( libcthreads_condition_wait(
+			     scheduler->condition,
+			     scheduler->mutex,
+			     NULL ) != 1 )
+			{
+				result = -1;
+			}
+			scheduler->number_of_idle_threads -= 1;
+		}
+	}
+	while( result != -1 );
+
+	if( libcthreads_mutex_release(
+	     scheduler->mutex,
+	     NULL ) != 1 )
+	{
+		return( -1 );
+	}
+	if( result == -1 )
+	{
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Joins the scheduler
+ * Waits until all the jobs, including the jobs pushed by jobs, have been processed
+ * and the threads have stopped
+ * Returns 1 if successful or -1 on error
+ */
+int export_scheduler_join(
+     export_scheduler_t *scheduler,
+     libcerror_error_t **error )
+{
+	static char *function = "export_scheduler_join";
+	int result            = 1;
+	int thread_index      = 0;
+
+	if( scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scheduler.",
+		 function );
+
+		return( -1 );
+	}
+	if( scheduler->threads == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid scheduler - missing threads.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     scheduler->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	scheduler->is_joining = 1;
+
+	if( libcthreads_condition_broadcast(
+	     scheduler->condition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to broadcast condition.",
+		 function );
+
+		result = -1;
+	}
+	if( libcthreads_mutex_release(
+	     scheduler->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	for( thread_index = 0;
+	     thread_index < scheduler->number_of_threads;
+	     thread_index++ )
+	{
+		if( scheduler->threads[ thread_index ].thread == NULL )
+		{
+			continue;
+		}
+		if( libcthreads_thread_join(
+		     &( scheduler->threads[ thread_index ].thread ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread: %d.",
+			 function,
+			 thread_index );
+
+			result = -1;
+		}
+	}
+	return( result );
+}
+
+/* Retrieves the number of threads that are waiting for a job
+ * Returns 1 if successful or -1 on error
+ */
+int export_scheduler_get_number_of_idle_threads(
+     export_scheduler_t *scheduler,
+     int *number_of_idle_threads,
+     libcerror_error_t **error )
+{
+	static char *function = "export_scheduler_get_number_of_idle_threads";
+
+	if( scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scheduler.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_idle_threads == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of idle threads.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     scheduler->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	/* Idle threads that will take a queued job are not counted
+	 */
+	*number_of_idle_threads = scheduler->number_of_idle_threads - scheduler->number_of_queued_jobs;
+
+	if( *number_of_idle_threads < 0 )
+	{
+		*number_of_idle_threads = 0;
+	}
+	if( libcthreads_mutex_release(
+	     scheduler->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of jobs that were stolen from the queue of another thread
+ * Returns 1 if successful or -1 on error
+ */
+int export_scheduler_get_number_of_stolen_jobs(
+     export_scheduler_t *scheduler,
+     int *number_of_stolen_jobs,
+     libcerror_error_t **error )
+{
+	static char *function = "export_scheduler_get_number_of_stolen_jobs";
+
+	if( scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scheduler.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_stolen_jobs == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of stolen jobs.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     scheduler->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_stolen_jobs = scheduler->number_of_stolen_jobs;
+
+	if( libcthreads_mutex_release(
+	     scheduler->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the number of jobs that were pushed onto the scheduler
+ * Returns 1 if successful or -1 on error
+ */
+int export_scheduler_get_number_of_jobs(
+     export_scheduler_t *scheduler,
+     int *number_of_jobs,
+     libcerror_error_t **error )
+{
+	static char *function = "export_scheduler_get_number_of_jobs";
+	int result            = 1;
+
+	if( scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scheduler.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     scheduler->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     scheduler->jobs,
+	     number_of_jobs,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of jobs.",
+		 function );
+
+		result = -1;
+	}
+	if( libcthreads_mutex_release(
+	     scheduler->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Retrieves a specific job
+ * The job remains managed by the scheduler
+ * Returns 1 if successful or -1 on error
+ */
+int export_scheduler_get_job_by_index(
+     export_scheduler_t *scheduler,
+     int job_index,
+     export_job_t **export_job,
+     libcerror_error_t **error )
+{
+	static char *function = "export_scheduler_get_job_by_index";
+	int result            = 1;
+
+	if( scheduler == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid scheduler.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_grab(
+	     scheduler->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     scheduler->jobs,
+	     job_index,
+	     (intptr_t **) export_job,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve job: %d.",
+		 function,
+		 job_index );
+
+		result = -1;
+	}
+	if( libcthreads_mutex_release(
+	     scheduler->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
@@ -0,0 +1,194 @@
+/*
+ * Export job scheduler
+ *
+ * Copyright (C) 2009-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _EXPORT_SCHEDULER_H )
+#define _EXPORT_SCHEDULER_H
+
+#include <common.h>
+#include <types.h>
+
+#include "esedbtools_libcdata.h"
+#include "esedbtools_libcerror.h"
+#include "esedbtools_libcthreads.h"
+#include "export_job.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+typedef struct export_scheduler export_scheduler_t;
+typedef struct export_scheduler_queue export_scheduler_queue_t;
+typedef struct export_scheduler_thread export_scheduler_thread_t;
+
+struct export_scheduler_queue
+{
+	/* The first job in the queue
+	 */
+	export_job_t *first_job;
+
+	/* The last job in the queue
+	 */
+	export_job_t *last_job;
+
+	/* The number of jobs in the queue
+	 */
+	int number_of_jobs;
+};
+
+struct export_scheduler_thread
+{
+	/* The scheduler
+	 */
+	export_scheduler_t *scheduler;
+
+	/* The thread index
+	 */
+	int thread_index;
+
+	/* The thread
+	 */
+	libcthreads_thread_t *thread;
+};
+
+struct export_scheduler
+{
+	/* The number of threads
+	 */
+	int number_of_threads;
+
+	/* The threads
+	 */
+	export_scheduler_thread_t *threads;
+
+	/* The job queues, one for every thread
+	 */
+	export_scheduler_queue_t *queues;
+
+	/* The jobs
+	 */
+	libcdata_array_t *jobs;
+
+	/* The mutex
+	 */
+	libcthreads_mutex_t *mutex;
+
+	/* The condition, signalled when a job is pushed or the scheduler is joined
+	 */
+	libcthreads_condition_t *condition;
+
+	/* The callback function that processes a job
+	 */
+	int (*callback_function)(
+	       export_job_t *export_job,
+	       void *callback_data );
+
+	/* The callback data
+	 */
+	void *callback_data;
+
+	/* The index of the queue the next job from outside the scheduler threads is pushed to
+	 */
+	int next_queue_index;
+
+	/* The number of queued jobs
+	 */
+	int number_of_queued_jobs;
+
+	/* The number of jobs that are being processed
+	 */
+	int number_of_running_jobs;
+
+	/* The number of threads that are waiting for a job
+	 */
+	int number_of_idle_threads;
+
+	/* The number of jobs that were stolen from the queue of another thread
+	 */
+	int number_of_stolen_jobs;
+
+	/* Value to indicate the scheduler is being joined
+	 */
+	uint8_t is_joining;
+};
+
+int export_scheduler_initialize(
+     export_scheduler_t **scheduler,
+     int number_of_threads,
+     int (*callback_function)(
+            export_job_t *export_job,
+            void *callback_data ),
+     void *callback_data,
+     libcerror_error_t **error );
+
+int export_scheduler_free(
+     export_scheduler_t **scheduler,
+     libcerror_error_t **error );
+
+int export_scheduler_push_job(
+     export_scheduler_t *scheduler,
+     int thread_index,
+     export_job_t *export_job,
+     libcerror_error_t **error );
+
+int export_scheduler_pop_job(
+     export_scheduler_t *scheduler,
+     int thread_index,
+     export_job_t **export_job,
+     libcerror_error_t **error );
+
+int export_scheduler_thread_start_function(
+     export_scheduler_thread_t *scheduler_thread );
+
+int export_scheduler_join(
+     export_scheduler_t *scheduler,
+     libcerror_error_t **error );
+
+int export_scheduler_get_number_of_idle_threads(
+     export_scheduler_t *scheduler,
+     int *number_of_idle_threads,
+     libcerror_error_t **error );
+
+int export_scheduler_get_number_of_stolen_jobs(
+     export_scheduler_t *scheduler,
+     int *number_of_stolen_jobs,
+     libcerror_error_t **error );
+
+int export_scheduler_get_number_of_jobs(
+     export_scheduler_t *scheduler,
+     int *number_of_jobs,
+     libcerror_error_t **error );
+
+int export_scheduler_get_job_by_index(
+     export_scheduler_t *scheduler,
+     int job_index,
+     export_job_t **export_job,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _EXPORT_SCHEDULER_H ) */
+
@@ -22,6 +22,7 @@
 #include <common.h>
 #include <file_stream.h>
 #include <memory.h>
+#include <narrow_string.h>
 #include <types.h>
 #include <wide_string.h>
 
@@ -34,8 +35,11 @@
 #endif
 
 #include "esedbtools_libcerror.h"
+#include "esedbtools_libcthreads.h"
 #include "log_handle.h"
 
+#define LOG_HANDLE_INITIAL_BUFFER_SIZE	1024
+
 /* Creates a log handle
  * Make sure the value log_handle is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
@@ -94,8 +98,28 @@ int log_handle_initialize(
 		 "%s: unable to clear log handle.",
 		 function );
 
+		memory_free(
+		 *log_handle );
+
+		*log_handle = NULL;
+
+		return( -1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_initialize(
+	     &( ( *log_handle )->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize mutex.",
+		 function );
+
 		goto on_error;
 	}
+#endif
 	return( 1 );
 
 on_error:
@@ -117,6 +141,7 @@ int log_handle_free(
      libcerror_error_t **error )
 {
 	static char *function = "log_handle_free";
+	int result            = 1;
 
 	if( log_handle == NULL )
 	{
@@ -131,12 +156,32 @@ int log_handle_free(
 	}
 	if( *log_handle != NULL )
 	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_free(
+		     &( ( *log_handle )->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free mutex.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		if( ( *log_handle )->buffer != NULL )
+		{
+			memory_free(
+			 ( *log_handle )->buffer );
+		}
 		memory_free(
 		 *log_handle );
 
 		*log_handle = NULL;
 	}
-	return( 1 );
+	return( result );
 }
 
 /* Opens the log handle
@@ -182,7 +227,102 @@ int log_handle_open(
 
 			return( -1 );
 		}
+		log_handle->log_stream_is_owned = 1;
+	}
+	return( 1 );
+}
+
+/* Opens the log handle on an existing stream
+ * The stream is not closed by the log handle
+ * Returns 1 if successful or -1 on error
+ */
+int log_handle_open_stream(
+     log_handle_t *log_handle,
+     FILE *stream,
+     libcerror_error_t **error )
+{
+	static char *function = "log_handle_open_stream";
+
+	if( log_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid log handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( log_handle->log_stream != NULL )
+	 || ( log_handle->buffer != NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid log handle - already open.",
+		 function );
+
+		return( -1 );
+	}
+	log_handle->log_stream          = stream;
+	log_handle->log_stream_is_owned = 0;
+
+	return( 1 );
+}
+
+/* Opens the log handle on a buffer
+ * The messages are kept in the buffer until they are flushed
+ * to another log handle with log_handle_flush_buffer
+ * Returns 1 if successful or -1 on error
+ */
+int log_handle_open_buffer(
+     log_handle_t *log_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "log_handle_open_buffer";
+
+	if( log_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid log handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( log_handle->log_stream != NULL )
+	 || ( log_handle->buffer != NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid log handle - already open.",
+		 function );
+
+		return( -1 );
+	}
+	log_handle->buffer = narrow_string_allocate(
+	                      LOG_HANDLE_INITIAL_BUFFER_SIZE );
+
+	if( log_handle->buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create buffer.",
+		 function );
+
+		return( -1 );
 	}
+	log_handle->buffer_size      = LOG_HANDLE_INITIAL_BUFFER_SIZE;
+	log_handle->buffer_data_size = 0;
+
 	return( 1 );
 }
 
@@ -208,23 +348,141 @@ int log_handle_close(
 	}
 	if( log_handle->log_stream != NULL )
 	{
-		if( file_stream_close(
-		     log_handle->log_stream ) != 0 )
+		if( log_handle->log_stream_is_owned != 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_CLOSE_FAILED,
-			 "%s: unable to close log stream.",
-			 function );
-
-			return( -1 );
+			if( file_stream_close(
+			     log_handle->log_stream ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close log stream.",
+				 function );
+
+				return( -1 );
+			}
 		}
-		log_handle->log_stream = NULL;
+		log_handle->log_stream          = NULL;
+		log_handle->log_stream_is_owned = 0;
+	}
+	if( log_handle->buffer != NULL )
+	{
+		memory_free(
+		 log_handle->buffer );
+
+		log_handle->buffer           = NULL;
+		log_handle->buffer_size      = 0;
+		log_handle->buffer_data_size = 0;
 	}
 	return( 0 );
 }
 
+/* Flushes the buffer of a buffered log handle to another log handle
+ * The buffered messages are written at once while holding the mutex of
+ * the other log handle so that they are not interleaved with other messages
+ * Returns 1 if successful or -1 on error
+ */
+int log_handle_flush_buffer(
+     log_handle_t *log_handle,
+     log_handle_t *output_log_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "log_handle_flush_buffer";
+	size_t write_count    = 0;
+	int result            = 1;
+
+	if( log_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid log handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( log_handle->buffer == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid log handle - missing buffer.",
+		 function );
+
+		return( -1 );
+	}
+	if( output_log_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid output log handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( log_handle->buffer_data_size == 0 )
+	 || ( output_log_handle->log_stream == NULL ) )
+	{
+		log_handle->buffer_data_size = 0;
+
+		return( 1 );
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     output_log_handle->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab output log handle mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	write_count = file_stream_write(
+	               output_log_handle->log_stream,
+	               log_handle->buffer,
+	               log_handle->buffer_data_size );
+
+	if( write_count != log_handle->buffer_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write buffer to output log stream.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     output_log_handle->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release output log handle mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	log_handle->buffer_data_size = 0;
+
+	return( result );
+}
+
 #if defined( HAVE_STDARG_H ) || defined( WINAPI )
 #define VARARGS( function, type, argument ) \
 	function( log_handle_t *log_handle, type argument, ... )
@@ -243,7 +501,9 @@ int log_handle_close(
 
 #endif
 
-/* Print a formatted string on the notify stream
+/* Print a formatted string on the log stream or into the buffer
+ * The string is written while holding the log handle mutex so that
+ * messages of different threads are not interleaved
  */
 void VARARGS(
       log_handle_printf,
@@ -252,9 +512,90 @@ void VARARGS(
 {
 	va_list argument_list;
 
-	if( ( log_handle != NULL )
-	 && ( log_handle->log_stream != NULL ) )
+	char *buffer       = NULL;
+	size_t buffer_size = 0;
+	int print_count    = 0;
+
+	if( log_handle == NULL )
+	{
+		return;
+	}
+	if( log_handle->buffer != NULL )
 	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_grab(
+		     log_handle->mutex,
+		     NULL ) != 1 )
+		{
+			return;
+		}
+#endif
+		do
+		{
+			VASTART(
+			 argument_list,
+			 char *,
+			 format );
+
+			print_count = narrow_string_vsnprintf(
+			               &( log_handle->buffer[ log_handle->buffer_data_size ] ),
+			               log_handle->buffer_size - log_handle->buffer_data_size,
+			               format,
+			               argument_list );
+
+			VAEND(
+			 argument_list );
+
+			if( ( print_count >= 0 )
+			 && ( (size_t) print_count < ( log_handle->buffer_size - log_handle->buffer_data_size ) ) )
+			{
+				log_handle->buffer_data_size += (size_t) print_count;
+
+				break;
+			}
+			/* Some vsnprintf implementations return -1 if the string was truncated
+			 */
+			if( print_count < 0 )
+			{
+				buffer_size = log_handle->buffer_size * 2;
+			}
+			else
+			{
+				buffer_size = log_handle->buffer_data_size + (size_t) print_count + 1;
+			}
+			if( buffer_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+			{
+				break;
+			}
+			buffer = (char *) memory_reallocate(
+			                   log_handle->buffer,
+			                   sizeof( char ) * buffer_size );
+
+			if( buffer == NULL )
+			{
+				break;
+			}
+			log_handle->buffer      = buffer;
+			log_handle->buffer_size = buffer_size;
+		}
+		while( buffer != NULL );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		libcthreads_mutex_release(
+		 log_handle->mutex,
+		 NULL );
+#endif
+	}
+	else if( log_handle->log_stream != NULL )
+	{
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_grab(
+		     log_handle->mutex,
+		     NULL ) != 1 )
+		{
+			return;
+		}
+#endif
 		VASTART(
 		 argument_list,
 		 char *,
@@ -267,6 +608,12 @@ void VARARGS(
 
 		VAEND(
 		 argument_list );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+		libcthreads_mutex_release(
+		 log_handle->mutex,
+		 NULL );
+#endif
 	}
 }
 
@@ -27,6 +27,7 @@
 #include <types.h>
 
 #include "esedbtools_libcerror.h"
+#include "esedbtools_libcthreads.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -39,6 +40,28 @@ struct log_handle
 	/* The log stream
 	 */
 	FILE *log_stream;
+
+	/* Value to indicate the log stream is owned by the log handle
+	 */
+	uint8_t log_stream_is_owned;
+
+	/* The buffer of a buffered log handle
+	 */
+	char *buffer;
+
+	/* The buffer size
+	 */
+	size_t buffer_size;
+
+	/* The size of the data in the buffer
+	 */
+	size_t buffer_data_size;
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+	/* The mutex
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
 };
 
 int log_handle_initialize(
@@ -54,10 +77,24 @@ int log_handle_open(
      const system_character_t *filename,
      libcerror_error_t **error );
 
+int log_handle_open_stream(
+     log_handle_t *log_handle,
+     FILE *stream,
+     libcerror_error_t **error );
+
+int log_handle_open_buffer(
+     log_handle_t *log_handle,
+     libcerror_error_t **error );
+
 int log_handle_close(
      log_handle_t *log_handle,
      libcerror_error_t **error );
 
+int log_handle_flush_buffer(
+     log_handle_t *log_handle,
+     log_handle_t *output_log_handle,
+     libcerror_error_t **error );
+
 void log_handle_printf(
       log_handle_t *log_handle,
       char *format,
@@ -65,7 +65,7 @@ enum WINDOWS_SEARCH_FORMATS
 int windows_search_decode(
      uint8_t *data,
      size_t data_size,
-     uint8_t *encoded_data,
+     const uint8_t *encoded_data,
      size_t encoded_data_size,
      libcerror_error_t **error )
 {
@@ -141,7 +141,7 @@ int windows_search_decode(
  * Returns 1 if successful or -1 on error
  */
 int windows_search_export_compressed_string_value(
-     uint8_t *value_data,
+     const uint8_t *value_data,
      size_t value_data_size,
      int ascii_codepage,
      FILE *record_file_stream,
@@ -1356,7 +1356,7 @@ int windows_search_export_record_value_compressed_string(
 	libesedb_long_value_t *long_value   = NULL;
 	libesedb_multi_value_t *multi_value = NULL;
 	uint8_t *long_value_data            = NULL;
-	uint8_t *multi_value_data           = NULL;
+	const uint8_t *multi_value_data     = NULL;
 	uint8_t *value_data                 = NULL;
 	static char *function               = "windows_search_export_record_value_compressed_string";
 	size_t long_value_data_size         = 0;
@@ -1643,9 +1643,10 @@ int windows_search_export_record_value_compressed_string(
 	 	     multi_value_iterator < number_of_multi_values;
 		     multi_value_iterator++ )
 		{
-			if( libesedb_multi_value_get_value_data_size(
+			if( libesedb_multi_value_get_value_data_reference(
 			     multi_value,
 			     multi_value_iterator,
+			     &multi_value_data,
 			     &multi_value_data_size,
 			     error ) != 1 )
 			{
@@ -1653,7 +1654,7 @@ int windows_search_export_record_value_compressed_string(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve multi value: %d data size of record entry: %d.",
+				 "%s: unable to retrieve multi value: %d data of record entry: %d.",
 				 function,
 				 multi_value_iterator,
 				 record_value_entry );
@@ -1662,38 +1663,6 @@ int windows_search_export_record_value_compressed_string(
 			}
 			if( multi_value_data_size > 0 )
 			{
-				multi_value_data = (uint8_t *) memory_allocate(
-				                                sizeof( uint8_t ) * multi_value_data_size );
-
-				if( multi_value_data == NULL )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_MEMORY,
-					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
-					 "%s: unable to create multi value data.",
-					 function );
-
-					goto on_error;
-				}
-				if( libesedb_multi_value_get_value_data(
-				     multi_value,
-				     multi_value_iterator,
-				     multi_value_data,
-				     multi_value_data_size,
-				     error ) != 1 )
-				{
-					libcerror_error_set(
-					 error,
-					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-					 "%s: unable to retrieve multi value: %d of record entry: %d.",
-					 function,
-					 multi_value_iterator,
-					 record_value_entry );
-
-					goto on_error;
-				}
 /* TODO what about non string multi values ? */
 				if( windows_search_export_compressed_string_value(
 				     multi_value_data,
@@ -1713,11 +1682,6 @@ int windows_search_export_record_value_compressed_string(
 
 					goto on_error;
 				}
-				memory_free(
-				 multi_value_data );
-
-				multi_value_data = NULL;
-
 				if( multi_value_iterator < ( number_of_multi_values - 1 ) )
 				{
 					fprintf(
@@ -1756,11 +1720,6 @@ int windows_search_export_record_value_compressed_string(
 	return( 1 );
 
 on_error:
-	if( multi_value_data != NULL )
-	{
-		memory_free(
-		 multi_value_data );
-	}
 	if( multi_value != NULL )
 	{
 		libesedb_multi_value_free(
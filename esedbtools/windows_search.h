@@ -37,12 +37,12 @@ extern "C" {
 int windows_search_decode(
      uint8_t *data,
      size_t data_size,
-     uint8_t *encoded_data,
+     const uint8_t *encoded_data,
      size_t encoded_data_size,
      libcerror_error_t **error );
 
 int windows_search_export_compressed_string_value(
-     uint8_t *value_data,
+     const uint8_t *value_data,
      size_t value_data_size,
      int ascii_codepage,
      FILE *record_file_stream,
@@ -0,0 +1,139 @@
+/*
+ * The metadata cache file definition
+ *
+ * Copyright (C) 2009-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _ESEDB_METADATA_CACHE_H )
+#define _ESEDB_METADATA_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct esedb_metadata_cache_header esedb_metadata_cache_header_t;
+
+struct esedb_metadata_cache_header
+{
+	/* The signature
+	 * Consists of 8 bytes
+	 * Contains: "esedbmc\x00"
+	 */
+	uint8_t signature[ 8 ];
+
+	/* The format version
+	 * Consists of 4 bytes
+	 */
+	uint8_t format_version[ 4 ];
+
+	/* The number of entries
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_entries[ 4 ];
+
+	/* The size of the database file
+	 * Consists of 8 bytes
+	 */
+	uint8_t file_size[ 8 ];
+
+	/* The database time
+	 * Consists of 8 bytes
+	 * Contains a database time structure
+	 */
+	uint8_t database_time[ 8 ];
+
+	/* The database signature
+	 * Consists of 28 bytes
+	 * Contains a log signature structure
+	 */
+	uint8_t database_signature[ 28 ];
+
+	/* The page size
+	 * Consists of 4 bytes
+	 */
+	uint8_t page_size[ 4 ];
+
+	/* The catalog data size
+	 * Consists of 4 bytes
+	 */
+	uint8_t catalog_data_size[ 4 ];
+};
+
+typedef struct esedb_metadata_cache_catalog_value esedb_metadata_cache_catalog_value_t;
+
+struct esedb_metadata_cache_catalog_value
+{
+	/* The data size
+	 * Consists of 4 bytes
+	 */
+	uint8_t data_size[ 4 ];
+
+	/* The data
+	 * Contains the data of a catalog leaf value
+	 */
+};
+
+typedef struct esedb_metadata_cache_entry esedb_metadata_cache_entry_t;
+
+struct esedb_metadata_cache_entry
+{
+	/* The root page number of the page tree
+	 * Consists of 4 bytes
+	 */
+	uint8_t root_page_number[ 4 ];
+
+	/* The number of leaf values
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_leaf_values[ 4 ];
+
+	/* The number of leaf page descriptors
+	 * Consists of 4 bytes
+	 */
+	uint8_t number_of_leaf_page_descriptors[ 4 ];
+};
+
+typedef struct esedb_metadata_cache_leaf_page_descriptor esedb_metadata_cache_leaf_page_descriptor_t;
+
+struct esedb_metadata_cache_leaf_page_descriptor
+{
+	/* The page number
+	 * Consists of 4 bytes
+	 */
+	uint8_t page_number[ 4 ];
+
+	/* The first leaf value index
+	 * Consists of 4 bytes
+	 */
+	uint8_t first_leaf_value_index[ 4 ];
+
+	/* The last leaf value index
+	 * Consists of 4 bytes
+	 */
+	uint8_t last_leaf_value_index[ 4 ];
+};
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _ESEDB_METADATA_CACHE_H ) */
+
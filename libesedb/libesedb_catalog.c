@@ -20,6 +20,7 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <memory.h>
 #include <types.h>
 
@@ -32,12 +33,16 @@
 #include "libesedb_libcdata.h"
 #include "libesedb_libcerror.h"
 #include "libesedb_libcnotify.h"
-#include "libesedb_libfcache.h"
-#include "libesedb_libfdata.h"
 #include "libesedb_libuna.h"
+#include "libesedb_metadata_cache.h"
+#include "libesedb_name_hash.h"
+#include "libesedb_page_cache.h"
 #include "libesedb_page_tree.h"
 #include "libesedb_table_definition.h"
 
+#include "esedb_metadata_cache.h"
+#include "esedb_page_values.h"
+
 /* Creates a catalog
  * Make sure the value catalog is referencing, is set to NULL
  * Returns 1 if successful or -1 on error
@@ -46,8 +51,7 @@ int libesedb_catalog_initialize(
      libesedb_catalog_t **catalog,
      libesedb_io_handle_t *io_handle,
      uint32_t root_page_number,
-     libfdata_vector_t *pages_vector,
-     libfcache_cache_t *pages_cache,
+     libesedb_page_cache_t *page_cache,
      libcerror_error_t **error )
 {
 	static char *function = "libesedb_catalog_initialize";
@@ -110,8 +114,7 @@ int libesedb_catalog_initialize(
 	if( libesedb_page_tree_initialize(
 	     &( ( *catalog )->page_tree ),
 	     io_handle,
-	     pages_vector,
-	     pages_cache,
+	     page_cache,
 	     LIBESEDB_FDP_OBJECT_IDENTIFIER_CATALOG,
 	     root_page_number,
 	     NULL,
@@ -210,6 +213,21 @@ int libesedb_catalog_free(
 
 			result = -1;
 		}
+		if( ( *catalog )->name_hash_buckets != NULL )
+		{
+			memory_free(
+			 ( *catalog )->name_hash_buckets );
+		}
+		if( ( *catalog )->name_hashes != NULL )
+		{
+			memory_free(
+			 ( *catalog )->name_hashes );
+		}
+		if( ( *catalog )->name_hash_next_indexes != NULL )
+		{
+			memory_free(
+			 ( *catalog )->name_hash_next_indexes );
+		}
 		memory_free(
 		 *catalog );
 
@@ -218,6 +236,261 @@ int libesedb_catalog_free(
 	return( result );
 }
 
+/* Appends the name hash of a table definition to the name hash buckets
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_catalog_append_table_definition_name_hash(
+     libesedb_catalog_t *catalog,
+     libesedb_table_definition_t *table_definition,
+     int table_definition_index,
+     libcerror_error_t **error )
+{
+	void *reallocation              = NULL;
+	static char *function           = "libesedb_catalog_append_table_definition_name_hash";
+	uint32_t name_hash              = 0;
+	int bucket_index                = 0;
+	int entry_index                 = 0;
+	int number_of_name_hash_buckets = 0;
+
+	if( catalog == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_definition->table_catalog_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid table definition - missing table catalog definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_definition_index != catalog->number_of_name_hashes )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid table definition index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_definition->table_catalog_definition->name != NULL )
+	{
+/* TODO use ascii codepage */
+		if( libesedb_name_hash_calculate_from_byte_stream(
+		     &name_hash,
+		     table_definition->table_catalog_definition->name,
+		     table_definition->table_catalog_definition->name_size,
+		     LIBUNA_CODEPAGE_WINDOWS_1252,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to calculate table name hash.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	/* The number of name hashes does not exceed the number of buckets
+	 * so that the buckets contain on average at most 1 table definition
+	 */
+	if( catalog->number_of_name_hashes >= catalog->number_of_name_hash_buckets )
+	{
+		if( catalog->number_of_name_hash_buckets == 0 )
+		{
+			number_of_name_hash_buckets = 64;
+		}
+		else
+		{
+			number_of_name_hash_buckets = catalog->number_of_name_hash_buckets * 2;
+		}
+		if( ( number_of_name_hash_buckets > ( INT_MAX / 2 ) )
+		 || ( (size_t) number_of_name_hash_buckets > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( uint32_t ) ) ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of name hash buckets value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+		reallocation = memory_reallocate(
+		                catalog->name_hashes,
+		                sizeof( uint32_t ) * number_of_name_hash_buckets );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize name hashes.",
+			 function );
+
+			return( -1 );
+		}
+		catalog->name_hashes = (uint32_t *) reallocation;
+
+		reallocation = memory_reallocate(
+		                catalog->name_hash_next_indexes,
+		                sizeof( int ) * number_of_name_hash_buckets );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize name hash next indexes.",
+			 function );
+
+			return( -1 );
+		}
+		catalog->name_hash_next_indexes = (int *) reallocation;
+
+		reallocation = memory_reallocate(
+		                catalog->name_hash_buckets,
+		                sizeof( int ) * number_of_name_hash_buckets );
+
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize name hash buckets.",
+			 function );
+
+			return( -1 );
+		}
+		catalog->name_hash_buckets           = (int *) reallocation;
+		catalog->number_of_name_hash_buckets = number_of_name_hash_buckets;
+
+		for( bucket_index = 0;
+		     bucket_index < number_of_name_hash_buckets;
+		     bucket_index++ )
+		{
+			catalog->name_hash_buckets[ bucket_index ] = -1;
+		}
+		/* Redistribute the name hashes in reverse order so that the buckets
+		 * list the table definitions in catalog order
+		 */
+		for( entry_index = catalog->number_of_name_hashes - 1;
+		     entry_index >= 0;
+		     entry_index-- )
+		{
+			bucket_index = (int) ( catalog->name_hashes[ entry_index ] & (uint32_t) ( number_of_name_hash_buckets - 1 ) );
+
+			catalog->name_hash_next_indexes[ entry_index ] = catalog->name_hash_buckets[ bucket_index ];
+			catalog->name_hash_buckets[ bucket_index ]     = entry_index;
+		}
+	}
+	catalog->name_hashes[ table_definition_index ]            = name_hash;
+	catalog->name_hash_next_indexes[ table_definition_index ] = -1;
+
+	bucket_index = (int) ( name_hash & (uint32_t) ( catalog->number_of_name_hash_buckets - 1 ) );
+
+	/* Append to the end of the bucket so that the first table definition
+	 * in the catalog with a specific name is found first
+	 */
+	entry_index = catalog->name_hash_buckets[ bucket_index ];
+
+	if( entry_index == -1 )
+	{
+		catalog->name_hash_buckets[ bucket_index ] = table_definition_index;
+	}
+	else
+	{
+		while( catalog->name_hash_next_indexes[ entry_index ] != -1 )
+		{
+			entry_index = catalog->name_hash_next_indexes[ entry_index ];
+		}
+		catalog->name_hash_next_indexes[ entry_index ] = table_definition_index;
+	}
+	catalog->number_of_name_hashes += 1;
+
+	return( 1 );
+}
+
+/* Reads the type of a catalog value without reading the catalog definition
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_catalog_read_value_type(
+     const uint8_t *data,
+     size_t data_size,
+     uint16_t *type,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_catalog_read_value_type";
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < ( sizeof( esedb_data_definition_header_t ) + 6 ) )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid type.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 ( (esedb_data_definition_t *) &( data[ sizeof( esedb_data_definition_header_t ) ] ) )->type,
+	 *type );
+
+	return( 1 );
+}
+
 /* Reads a catalog value
  * Returns 1 if successful or -1 on error
  */
@@ -230,6 +503,7 @@ int libesedb_catalog_read_value_data(
 {
 	libesedb_catalog_definition_t *catalog_definition = NULL;
 	static char *function                             = "libesedb_catalog_read_value_data";
+	uint16_t type                                     = 0;
 	int entry_index                                   = 0;
 
 	if( catalog == NULL )
@@ -276,6 +550,32 @@ int libesedb_catalog_read_value_data(
 
 		return( -1 );
 	}
+	/* Only the table catalog definitions are read when the catalog is read on demand
+	 */
+	if( ( catalog->read_on_demand != 0 )
+	 && ( ( *table_definition == NULL )
+	  || ( ( *table_definition )->has_deferred_catalog_definitions != 0 ) ) )
+	{
+		if( libesedb_catalog_read_value_type(
+		     data,
+		     data_size,
+		     &type,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read catalog value type.",
+			 function );
+
+			return( -1 );
+		}
+		if( type != LIBESEDB_CATALOG_DEFINITION_TYPE_TABLE )
+		{
+			return( 1 );
+		}
+	}
 	if( libesedb_catalog_definition_initialize(
 	     &catalog_definition,
 	     error ) != 1 )
@@ -377,6 +677,24 @@ int libesedb_catalog_read_value_data(
 
 				goto on_error;
 			}
+			if( libesedb_catalog_append_table_definition_name_hash(
+			     catalog,
+			     *table_definition,
+			     entry_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append table definition name hash.",
+				 function );
+
+				goto on_error;
+			}
+			( *table_definition )->table_definition_index           = entry_index;
+			( *table_definition )->has_deferred_catalog_definitions = catalog->read_on_demand;
+
 			break;
 
 		case LIBESEDB_CATALOG_DEFINITION_TYPE_COLUMN:
@@ -503,12 +821,13 @@ int libesedb_catalog_read_values_from_leaf_page(
      libesedb_table_definition_t **table_definition,
      libcerror_error_t **error )
 {
-	libesedb_page_tree_value_t *page_tree_value = NULL;
-	libesedb_page_value_t *page_value           = NULL;
-	static char *function                       = "libesedb_catalog_read_values_from_leaf_page";
-	uint32_t page_flags                         = 0;
-	uint16_t number_of_page_values              = 0;
-	uint16_t page_value_index                   = 0;
+	libesedb_page_tree_value_t *page_tree_value            = NULL;
+	libesedb_page_value_t *page_value                      = NULL;
+	libesedb_table_definition_t *previous_table_definition = NULL;
+	static char *function                                  = "libesedb_catalog_read_values_from_leaf_page";
+	uint32_t page_flags                                    = 0;
+	uint16_t number_of_page_values                         = 0;
+	uint16_t page_value_index                              = 0;
 
 	if( catalog == NULL )
 	{
@@ -521,6 +840,28 @@ int libesedb_catalog_read_values_from_leaf_page(
 
 		return( -1 );
 	}
+	if( page == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table definition.",
+		 function );
+
+		return( -1 );
+	}
 	if( libesedb_page_get_flags(
 	     page,
 	     &page_flags,
@@ -640,6 +981,8 @@ int libesedb_catalog_read_values_from_leaf_page(
 
 			goto on_error;
 		}
+		previous_table_definition = *table_definition;
+
 		if( libesedb_catalog_read_value_data(
 		     catalog,
 		     page_tree_value->data,
@@ -656,6 +999,15 @@ int libesedb_catalog_read_values_from_leaf_page(
 
 			goto on_error;
 		}
+		/* Store the location of the table catalog definition so that the catalog
+		 * definitions that follow it can be read on demand
+		 */
+		if( ( *table_definition != NULL )
+		 && ( *table_definition != previous_table_definition ) )
+		{
+			( *table_definition )->catalog_page_number      = page->page_number;
+			( *table_definition )->catalog_page_value_index = page_value_index;
+		}
 		if( libesedb_page_tree_value_free(
 		     &page_tree_value,
 		     error ) != 1 )
@@ -746,6 +1098,17 @@ int libesedb_catalog_read_file_io_handle(
 
 			return( -1 );
 		}
+		if( catalog->page_tree->io_handle->abort != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_ABORT_REQUESTED,
+			 "%s: abort requested.",
+			 function );
+
+			return( -1 );
+		}
 #if ( SIZEOF_INT <= 4 )
 		if( leaf_page_number > (uint32_t) INT_MAX )
 #else
@@ -761,13 +1124,11 @@ int libesedb_catalog_read_file_io_handle(
 
 			return( -1 );
 		}
-		if( libfdata_vector_get_element_value_by_index(
-		     catalog->page_tree->pages_vector,
-		     (intptr_t *) file_io_handle,
-		     (libfdata_cache_t *) catalog->page_tree->pages_cache,
-		     (int) leaf_page_number - 1,
-		     (intptr_t **) &page,
-		     0,
+		if( libesedb_page_cache_get_page(
+		     catalog->page_tree->page_cache,
+		     file_io_handle,
+		     leaf_page_number,
+		     &page,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -794,7 +1155,7 @@ int libesedb_catalog_read_file_io_handle(
 			 function,
 			 leaf_page_number );
 
-			return( -1 );
+			goto on_error;
 		}
 		if( libesedb_page_get_next_page_number(
 		     page,
@@ -809,22 +1170,54 @@ int libesedb_catalog_read_file_io_handle(
 			 function,
 			 leaf_page_number );
 
-			return( -1 );
+			goto on_error;
+		}
+		if( libesedb_page_cache_release_page(
+		     catalog->page_tree->page_cache,
+		     &page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release page.",
+			 function );
+
+			goto on_error;
 		}
 		recursion_depth++;
 	}
 	return( 1 );
+
+on_error:
+	if( page != NULL )
+	{
+		libesedb_page_cache_release_page(
+		 catalog->page_tree->page_cache,
+		 &page,
+		 NULL );
+	}
+	return( -1 );
 }
 
-/* Retrieves the number of table definitions
- * Returns 1 if successful or -1 on error
+/* Reads the catalog from the catalog data in the metadata cache
+ * All the catalog definitions are read since they do not need to be read from the pages
+ * Returns 1 if successful, 0 if the metadata cache contains no catalog data or -1 on error
  */
-int libesedb_catalog_get_number_of_table_definitions(
+int libesedb_catalog_read_metadata_cache(
      libesedb_catalog_t *catalog,
-     int *number_of_table_definitions,
+     libesedb_metadata_cache_t *metadata_cache,
      libcerror_error_t **error )
 {
-	static char *function = "libesedb_catalog_get_number_of_table_definitions";
+	libesedb_table_definition_t *table_definition = NULL;
+	const uint8_t *catalog_data                   = NULL;
+	static char *function                         = "libesedb_catalog_read_metadata_cache";
+	size_t catalog_data_offset                    = 0;
+	size_t catalog_data_size                      = 0;
+	uint32_t value_data_size                      = 0;
+	int number_of_table_definitions               = 0;
+	int result                                    = 0;
 
 	if( catalog == NULL )
 	{
@@ -839,24 +1232,798 @@ int libesedb_catalog_get_number_of_table_definitions(
 	}
 	if( libcdata_array_get_number_of_entries(
 	     catalog->table_definition_array,
-	     number_of_table_definitions,
+	     &number_of_table_definitions,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of entries from table definition array.",
+		 "%s: unable to retrieve number of table definitions.",
 		 function );
 
 		return( -1 );
 	}
-	return( 1 );
-}
-
-/* Retrieves the table definition for the specific index
- * Returns 1 if successful or -1 on error
- */
+	if( number_of_table_definitions != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid catalog - table definitions already set.",
+		 function );
+
+		return( -1 );
+	}
+	result = libesedb_metadata_cache_get_catalog_data(
+	          metadata_cache,
+	          &catalog_data,
+	          &catalog_data_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve catalog data from metadata cache.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	catalog->read_on_demand = 0;
+
+	while( catalog_data_offset < catalog_data_size )
+	{
+		if( sizeof( esedb_metadata_cache_catalog_value_t ) > ( catalog_data_size - catalog_data_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid catalog data size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 ( (esedb_metadata_cache_catalog_value_t *) &( catalog_data[ catalog_data_offset ] ) )->data_size,
+		 value_data_size );
+
+		catalog_data_offset += sizeof( esedb_metadata_cache_catalog_value_t );
+
+		if( (size_t) value_data_size > ( catalog_data_size - catalog_data_offset ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid catalog value data size value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( libesedb_catalog_read_value_data(
+		     catalog,
+		     &( catalog_data[ catalog_data_offset ] ),
+		     (size_t) value_data_size,
+		     &table_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read catalog value at offset: %" PRIzd ".",
+			 function,
+			 catalog_data_offset );
+
+			return( -1 );
+		}
+		catalog_data_offset += (size_t) value_data_size;
+	}
+	return( 1 );
+}
+
+/* Stores the catalog values in the metadata cache
+ * The catalog values are read from the leaf pages of the catalog page tree
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_catalog_write_metadata_cache(
+     libesedb_catalog_t *catalog,
+     libbfio_handle_t *file_io_handle,
+     libesedb_metadata_cache_t *metadata_cache,
+     libcerror_error_t **error )
+{
+	libesedb_page_t *page                       = NULL;
+	libesedb_page_tree_value_t *page_tree_value = NULL;
+	libesedb_page_value_t *page_value           = NULL;
+	uint8_t *catalog_data                       = NULL;
+	void *reallocation                          = NULL;
+	static char *function                       = "libesedb_catalog_write_metadata_cache";
+	size_t catalog_data_offset                  = 0;
+	size_t catalog_data_size                    = 0;
+	size_t value_size                           = 0;
+	uint32_t leaf_page_number                   = 0;
+	uint16_t number_of_page_values              = 0;
+	uint16_t page_value_index                   = 0;
+	int recursion_depth                         = 0;
+
+	if( catalog == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog.",
+		 function );
+
+		return( -1 );
+	}
+	if( catalog->page_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid catalog - missing page tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_page_tree_get_get_first_leaf_page_number(
+	     catalog->page_tree,
+	     file_io_handle,
+	     &leaf_page_number,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve first leaf page number from page tree.",
+		 function );
+
+		return( -1 );
+	}
+	while( leaf_page_number != 0 )
+	{
+		if( recursion_depth > LIBESEDB_MAXIMUM_LEAF_PAGE_RECURSION_DEPTH )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid recursion depth value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		if( libesedb_page_cache_get_page(
+		     catalog->page_tree->page_cache,
+		     file_io_handle,
+		     leaf_page_number,
+		     &page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page: %" PRIu32 ".",
+			 function,
+			 leaf_page_number );
+
+			goto on_error;
+		}
+		if( libesedb_page_get_number_of_values(
+		     page,
+		     &number_of_page_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of page values.",
+			 function );
+
+			goto on_error;
+		}
+		for( page_value_index = 1;
+		     page_value_index < number_of_page_values;
+		     page_value_index++ )
+		{
+			if( libesedb_page_get_value_by_index(
+			     page,
+			     page_value_index,
+			     &page_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve page value: %" PRIu16 ".",
+				 function,
+				 page_value_index );
+
+				goto on_error;
+			}
+			if( page_value == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing page value: %" PRIu16 ".",
+				 function,
+				 page_value_index );
+
+				goto on_error;
+			}
+			if( ( page_value->flags & LIBESEDB_PAGE_TAG_FLAG_IS_DEFUNCT ) != 0 )
+			{
+				continue;
+			}
+			if( libesedb_page_tree_value_initialize(
+			     &page_tree_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create page tree value.",
+				 function );
+
+				goto on_error;
+			}
+			if( libesedb_page_tree_value_read_data(
+			     page_tree_value,
+			     page_value->data,
+			     (size_t) page_value->size,
+			     page_value->flags,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read page tree value: %" PRIu16 ".",
+				 function,
+				 page_value_index );
+
+				goto on_error;
+			}
+			value_size = sizeof( esedb_metadata_cache_catalog_value_t ) + (size_t) page_tree_value->data_size;
+
+			if( value_size > ( catalog_data_size - catalog_data_offset ) )
+			{
+				if( catalog_data_size == 0 )
+				{
+					catalog_data_size = 16384;
+				}
+				while( value_size > ( catalog_data_size - catalog_data_offset ) )
+				{
+					if( catalog_data_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / 2 ) )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+						 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+						 "%s: invalid catalog data size value exceeds maximum.",
+						 function );
+
+						goto on_error;
+					}
+					catalog_data_size *= 2;
+				}
+				reallocation = memory_reallocate(
+				                catalog_data,
+				                sizeof( uint8_t ) * catalog_data_size );
+
+				if( reallocation == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to resize catalog data.",
+					 function );
+
+					goto on_error;
+				}
+				catalog_data = (uint8_t *) reallocation;
+			}
+			byte_stream_copy_from_uint32_little_endian(
+			 ( (esedb_metadata_cache_catalog_value_t *) &( catalog_data[ catalog_data_offset ] ) )->data_size,
+			 (uint32_t) page_tree_value->data_size );
+
+			catalog_data_offset += sizeof( esedb_metadata_cache_catalog_value_t );
+
+			if( page_tree_value->data_size > 0 )
+			{
+				if( memory_copy(
+				     &( catalog_data[ catalog_data_offset ] ),
+				     page_tree_value->data,
+				     (size_t) page_tree_value->data_size ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+					 "%s: unable to copy catalog value data.",
+					 function );
+
+					goto on_error;
+				}
+				catalog_data_offset += (size_t) page_tree_value->data_size;
+			}
+			if( libesedb_page_tree_value_free(
+			     &page_tree_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free page tree value.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		if( libesedb_page_get_next_page_number(
+		     page,
+		     &leaf_page_number,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next page number from page: %" PRIu32 ".",
+			 function,
+			 leaf_page_number );
+
+			goto on_error;
+		}
+		if( libesedb_page_cache_release_page(
+		     catalog->page_tree->page_cache,
+		     &page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release page.",
+			 function );
+
+			goto on_error;
+		}
+		recursion_depth++;
+	}
+	if( catalog_data_offset > 0 )
+	{
+		if( libesedb_metadata_cache_set_catalog_data(
+		     metadata_cache,
+		     catalog_data,
+		     catalog_data_offset,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set catalog data in metadata cache.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( catalog_data != NULL )
+	{
+		memory_free(
+		 catalog_data );
+	}
+	return( 1 );
+
+on_error:
+	if( page_tree_value != NULL )
+	{
+		libesedb_page_tree_value_free(
+		 &page_tree_value,
+		 NULL );
+	}
+	if( page != NULL )
+	{
+		libesedb_page_cache_release_page(
+		 catalog->page_tree->page_cache,
+		 &page,
+		 NULL );
+	}
+	if( catalog_data != NULL )
+	{
+		memory_free(
+		 catalog_data );
+	}
+	return( -1 );
+}
+
+/* Reads the deferred catalog definitions of a table definition
+ * The catalog definitions of a table directly follow its table catalog definition
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_catalog_read_deferred_table_definition(
+     libesedb_catalog_t *catalog,
+     libbfio_handle_t *file_io_handle,
+     libesedb_table_definition_t *table_definition,
+     libcerror_error_t **error )
+{
+	libesedb_page_t *page                              = NULL;
+	libesedb_page_tree_value_t *page_tree_value        = NULL;
+	libesedb_page_value_t *page_value                  = NULL;
+	libesedb_table_definition_t *safe_table_definition = NULL;
+	static char *function                              = "libesedb_catalog_read_deferred_table_definition";
+	uint32_t leaf_page_number                          = 0;
+	uint16_t number_of_page_values                     = 0;
+	uint16_t page_value_index                          = 0;
+	uint16_t type                                      = 0;
+	uint8_t read_next_leaf_page                        = 1;
+	int recursion_depth                                = 0;
+
+	if( catalog == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog.",
+		 function );
+
+		return( -1 );
+	}
+	if( catalog->page_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid catalog - missing page tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_definition->has_deferred_catalog_definitions == 0 )
+	{
+		return( 1 );
+	}
+	table_definition->has_deferred_catalog_definitions = 0;
+
+	safe_table_definition = table_definition;
+	leaf_page_number      = table_definition->catalog_page_number;
+	page_value_index      = table_definition->catalog_page_value_index + 1;
+
+	while( ( read_next_leaf_page != 0 )
+	    && ( leaf_page_number != 0 ) )
+	{
+		if( recursion_depth > LIBESEDB_MAXIMUM_LEAF_PAGE_RECURSION_DEPTH )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid recursion depth value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+#if ( SIZEOF_INT <= 4 )
+		if( leaf_page_number > (uint32_t) INT_MAX )
+#else
+		if( leaf_page_number > (unsigned int) INT_MAX )
+#endif
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid leaf page number value out of bounds.",
+			 function );
+
+			goto on_error;
+		}
+		if( libesedb_page_cache_get_page(
+		     catalog->page_tree->page_cache,
+		     file_io_handle,
+		     leaf_page_number,
+		     &page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page: %" PRIu32 ".",
+			 function,
+			 leaf_page_number );
+
+			goto on_error;
+		}
+		if( libesedb_page_get_number_of_values(
+		     page,
+		     &number_of_page_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of page values.",
+			 function );
+
+			goto on_error;
+		}
+		while( page_value_index < number_of_page_values )
+		{
+			if( libesedb_page_get_value_by_index(
+			     page,
+			     page_value_index,
+			     &page_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve page value: %" PRIu16 ".",
+				 function,
+				 page_value_index );
+
+				goto on_error;
+			}
+			if( page_value == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing page value: %" PRIu16 ".",
+				 function,
+				 page_value_index );
+
+				goto on_error;
+			}
+			page_value_index++;
+
+			if( ( page_value->flags & LIBESEDB_PAGE_TAG_FLAG_IS_DEFUNCT ) != 0 )
+			{
+				continue;
+			}
+			if( libesedb_page_tree_value_initialize(
+			     &page_tree_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create page tree value.",
+				 function );
+
+				goto on_error;
+			}
+			if( libesedb_page_tree_value_read_data(
+			     page_tree_value,
+			     page_value->data,
+			     (size_t) page_value->size,
+			     page_value->flags,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read page tree value: %" PRIu16 ".",
+				 function,
+				 page_value_index - 1 );
+
+				goto on_error;
+			}
+			if( libesedb_catalog_read_value_type(
+			     page_tree_value->data,
+			     page_tree_value->data_size,
+			     &type,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read catalog value type.",
+				 function );
+
+				goto on_error;
+			}
+			/* The next table catalog definition ends the catalog definitions of the table
+			 */
+			if( type == LIBESEDB_CATALOG_DEFINITION_TYPE_TABLE )
+			{
+				read_next_leaf_page = 0;
+			}
+			else if( libesedb_catalog_read_value_data(
+			          catalog,
+			          page_tree_value->data,
+			          page_tree_value->data_size,
+			          &safe_table_definition,
+			          error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read catalog value.",
+				 function );
+
+				goto on_error;
+			}
+			if( libesedb_page_tree_value_free(
+			     &page_tree_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free page tree value.",
+				 function );
+
+				goto on_error;
+			}
+			if( read_next_leaf_page == 0 )
+			{
+				break;
+			}
+		}
+		if( read_next_leaf_page != 0 )
+		{
+			if( libesedb_page_get_next_page_number(
+			     page,
+			     &leaf_page_number,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve next page number from page: %" PRIu32 ".",
+				 function,
+				 leaf_page_number );
+
+				goto on_error;
+			}
+			page_value_index = 1;
+		}
+		if( libesedb_page_cache_release_page(
+		     catalog->page_tree->page_cache,
+		     &page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release page.",
+			 function );
+
+			goto on_error;
+		}
+		recursion_depth++;
+	}
+	return( 1 );
+
+on_error:
+	if( page != NULL )
+	{
+		libesedb_page_cache_release_page(
+		 catalog->page_tree->page_cache,
+		 &page,
+		 NULL );
+	}
+	if( page_tree_value != NULL )
+	{
+		libesedb_page_tree_value_free(
+		 &page_tree_value,
+		 NULL );
+	}
+	/* Remove the catalog definitions that were read so that they can be read again
+	 */
+	libcdata_array_empty(
+	 table_definition->column_catalog_definition_array,
+	 (int (*)(intptr_t **, libcerror_error_t **)) &libesedb_catalog_definition_free,
+	 NULL );
+
+	libcdata_array_empty(
+	 table_definition->index_catalog_definition_array,
+	 (int (*)(intptr_t **, libcerror_error_t **)) &libesedb_catalog_definition_free,
+	 NULL );
+
+	if( table_definition->long_value_catalog_definition != NULL )
+	{
+		libesedb_catalog_definition_free(
+		 &( table_definition->long_value_catalog_definition ),
+		 NULL );
+	}
+	if( table_definition->callback_catalog_definition != NULL )
+	{
+		libesedb_catalog_definition_free(
+		 &( table_definition->callback_catalog_definition ),
+		 NULL );
+	}
+	table_definition->has_deferred_catalog_definitions = 1;
+
+	return( -1 );
+}
+
+/* Retrieves the number of table definitions
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_catalog_get_number_of_table_definitions(
+     libesedb_catalog_t *catalog,
+     int *number_of_table_definitions,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_catalog_get_number_of_table_definitions";
+
+	if( catalog == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     catalog->table_definition_array,
+	     number_of_table_definitions,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries from table definition array.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the table definition for the specific index
+ * Returns 1 if successful or -1 on error
+ */
 int libesedb_catalog_get_table_definition_by_index(
      libesedb_catalog_t *catalog,
      int table_definition_index,
@@ -907,8 +2074,8 @@ int libesedb_catalog_get_table_definition_by_name(
 {
 	libesedb_table_definition_t *safe_table_definition = NULL;
 	static char *function                              = "libesedb_catalog_get_table_definition_by_name";
+	uint32_t name_hash                                 = 0;
 	int entry_index                                    = 0;
-	int number_of_entries                              = 0;
 	int result                                         = 0;
 
 	if( catalog == NULL )
@@ -922,6 +2089,17 @@ int libesedb_catalog_get_table_definition_by_name(
 
 		return( -1 );
 	}
+	if( catalog->table_definition_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid catalog - missing table definition array.",
+		 function );
+
+		return( -1 );
+	}
 	if( table_name == NULL )
 	{
 		libcerror_error_set(
@@ -958,80 +2136,88 @@ int libesedb_catalog_get_table_definition_by_name(
 	}
 	*table_definition = NULL;
 
-	if( libcdata_array_get_number_of_entries(
-	     catalog->table_definition_array,
-	     &number_of_entries,
+	if( libesedb_name_hash_calculate_from_byte_stream(
+	     &name_hash,
+	     table_name,
+	     table_name_size,
+	     LIBUNA_CODEPAGE_WINDOWS_1252,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of entries in table definition array.",
+		 "%s: unable to calculate table name hash.",
 		 function );
 
 		return( -1 );
 	}
-	for( entry_index = 0;
-	     entry_index < number_of_entries;
-	     entry_index++ )
+	if( catalog->number_of_name_hash_buckets == 0 )
 	{
-		if( libcdata_array_get_entry_by_index(
-		     catalog->table_definition_array,
-		     entry_index,
-		     (intptr_t **) &safe_table_definition,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve entry: %d from table definition array.",
-			 function,
-			 entry_index );
+		return( 0 );
+	}
+	entry_index = catalog->name_hash_buckets[ name_hash & (uint32_t) ( catalog->number_of_name_hash_buckets - 1 ) ];
 
-			return( -1 );
-		}
-		if( safe_table_definition == NULL )
+	while( entry_index != -1 )
+	{
+		if( catalog->name_hashes[ entry_index ] == name_hash )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing table definition: %d.",
-			 function,
-			 entry_index );
+			if( libcdata_array_get_entry_by_index(
+			     catalog->table_definition_array,
+			     entry_index,
+			     (intptr_t **) &safe_table_definition,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve entry: %d from table definition array.",
+				 function,
+				 entry_index );
 
-			return( -1 );
-		}
-		result = libesedb_catalog_definition_compare_name(
-			  safe_table_definition->table_catalog_definition,
-			  table_name,
-			  table_name_size,
-			  error );
+				return( -1 );
+			}
+			if( safe_table_definition == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing table definition: %d.",
+				 function,
+				 entry_index );
 
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: unable to compare table name with table catalog definition: %d name.",
-			 function,
-			 entry_index );
+				return( -1 );
+			}
+			result = libesedb_catalog_definition_compare_name(
+			          safe_table_definition->table_catalog_definition,
+			          table_name,
+			          table_name_size,
+			          error );
 
-			return( -1 );
-		}
-		else if( result == 1 )
-		{
-			break;
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: unable to compare table name with table catalog definition: %d name.",
+				 function,
+				 entry_index );
+
+				return( -1 );
+			}
+			else if( result == 1 )
+			{
+				*table_definition = safe_table_definition;
+
+				return( 1 );
+			}
 		}
+		entry_index = catalog->name_hash_next_indexes[ entry_index ];
 	}
-	if( result != 0 )
-	{
-		*table_definition = safe_table_definition;
-	}
-	return( result );
+	return( 0 );
 }
 
 /* Retrieves the table definition for the specific UTF-8 encoded name
@@ -1046,8 +2232,8 @@ int libesedb_catalog_get_table_definition_by_utf8_name(
 {
 	libesedb_table_definition_t *safe_table_definition = NULL;
 	static char *function                              = "libesedb_catalog_get_table_definition_by_utf8_name";
+	uint32_t name_hash                                 = 0;
 	int entry_index                                    = 0;
-	int number_of_entries                              = 0;
 	int result                                         = 0;
 
 	if( catalog == NULL )
@@ -1061,6 +2247,17 @@ int libesedb_catalog_get_table_definition_by_utf8_name(
 
 		return( -1 );
 	}
+	if( catalog->table_definition_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid catalog - missing table definition array.",
+		 function );
+
+		return( -1 );
+	}
 	if( utf8_string == NULL )
 	{
 		libcerror_error_set(
@@ -1097,82 +2294,93 @@ int libesedb_catalog_get_table_definition_by_utf8_name(
 	}
 	*table_definition = NULL;
 
-	if( libcdata_array_get_number_of_entries(
-	     catalog->table_definition_array,
-	     &number_of_entries,
-	     error ) != 1 )
+	result = libesedb_name_hash_calculate_from_utf8_string(
+	          &name_hash,
+	          utf8_string,
+	          utf8_string_length,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of entries in table definition array.",
+		 "%s: unable to calculate UTF-8 string hash.",
 		 function );
 
 		return( -1 );
 	}
-	for( entry_index = 0;
-	     entry_index < number_of_entries;
-	     entry_index++ )
+	else if( result == 0 )
 	{
-		if( libcdata_array_get_entry_by_index(
-		     catalog->table_definition_array,
-		     entry_index,
-		     (intptr_t **) &safe_table_definition,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve entry: %d from table definition array.",
-			 function,
-			 entry_index );
+		return( 0 );
+	}
+	if( catalog->number_of_name_hash_buckets == 0 )
+	{
+		return( 0 );
+	}
+	entry_index = catalog->name_hash_buckets[ name_hash & (uint32_t) ( catalog->number_of_name_hash_buckets - 1 ) ];
 
-			return( -1 );
-		}
-		if( safe_table_definition == NULL )
+	while( entry_index != -1 )
+	{
+		if( catalog->name_hashes[ entry_index ] == name_hash )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing table definition: %d.",
-			 function,
-			 entry_index );
+			if( libcdata_array_get_entry_by_index(
+			     catalog->table_definition_array,
+			     entry_index,
+			     (intptr_t **) &safe_table_definition,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve entry: %d from table definition array.",
+				 function,
+				 entry_index );
 
-			return( -1 );
-		}
-		result = libesedb_catalog_definition_compare_name_with_utf8_string(
-			  safe_table_definition->table_catalog_definition,
-			  utf8_string,
-			  utf8_string_length,
-			  error );
+				return( -1 );
+			}
+			if( safe_table_definition == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing table definition: %d.",
+				 function,
+				 entry_index );
 
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: unable to compare UTF-8 string with table catalog definition: %d name.",
-			 function,
-			 entry_index );
+				return( -1 );
+			}
+			result = libesedb_catalog_definition_compare_name_with_utf8_string(
+			          safe_table_definition->table_catalog_definition,
+			          utf8_string,
+			          utf8_string_length,
+			          error );
 
-			return( -1 );
-		}
-		else if( result == LIBUNA_COMPARE_EQUAL )
-		{
-			result = 1;
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: unable to compare UTF-8 string with table catalog definition: %d name.",
+				 function,
+				 entry_index );
 
-			break;
+				return( -1 );
+			}
+			else if( result == LIBUNA_COMPARE_EQUAL )
+			{
+				*table_definition = safe_table_definition;
+
+				return( 1 );
+			}
 		}
+		entry_index = catalog->name_hash_next_indexes[ entry_index ];
 	}
-	if( result != 0 )
-	{
-		*table_definition = safe_table_definition;
-	}
-	return( result );
+	return( 0 );
 }
 
 /* Retrieves the table definition for the specific UTF-16 encoded name
@@ -1187,8 +2395,8 @@ int libesedb_catalog_get_table_definition_by_utf16_name(
 {
 	libesedb_table_definition_t *safe_table_definition = NULL;
 	static char *function                              = "libesedb_catalog_get_table_definition_by_utf16_name";
+	uint32_t name_hash                                 = 0;
 	int entry_index                                    = 0;
-	int number_of_entries                              = 0;
 	int result                                         = 0;
 
 	if( catalog == NULL )
@@ -1202,6 +2410,17 @@ int libesedb_catalog_get_table_definition_by_utf16_name(
 
 		return( -1 );
 	}
+	if( catalog->table_definition_array == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid catalog - missing table definition array.",
+		 function );
+
+		return( -1 );
+	}
 	if( utf16_string == NULL )
 	{
 		libcerror_error_set(
@@ -1238,81 +2457,92 @@ int libesedb_catalog_get_table_definition_by_utf16_name(
 	}
 	*table_definition = NULL;
 
-	if( libcdata_array_get_number_of_entries(
-	     catalog->table_definition_array,
-	     &number_of_entries,
-	     error ) != 1 )
+	result = libesedb_name_hash_calculate_from_utf16_string(
+	          &name_hash,
+	          utf16_string,
+	          utf16_string_length,
+	          error );
+
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve number of entries in table definition array.",
+		 "%s: unable to calculate UTF-16 string hash.",
 		 function );
 
 		return( -1 );
 	}
-	for( entry_index = 0;
-	     entry_index < number_of_entries;
-	     entry_index++ )
+	else if( result == 0 )
 	{
-		if( libcdata_array_get_entry_by_index(
-		     catalog->table_definition_array,
-		     entry_index,
-		     (intptr_t **) &safe_table_definition,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve entry: %d from table definition array.",
-			 function,
-			 entry_index );
+		return( 0 );
+	}
+	if( catalog->number_of_name_hash_buckets == 0 )
+	{
+		return( 0 );
+	}
+	entry_index = catalog->name_hash_buckets[ name_hash & (uint32_t) ( catalog->number_of_name_hash_buckets - 1 ) ];
 
-			return( -1 );
-		}
-		if( safe_table_definition == NULL )
+	while( entry_index != -1 )
+	{
+		if( catalog->name_hashes[ entry_index ] == name_hash )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing table definition: %d.",
-			 function,
-			 entry_index );
+			if( libcdata_array_get_entry_by_index(
+			     catalog->table_definition_array,
+			     entry_index,
+			     (intptr_t **) &safe_table_definition,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve entry: %d from table definition array.",
+				 function,
+				 entry_index );
 
-			return( -1 );
-		}
-		result = libesedb_catalog_definition_compare_name_with_utf16_string(
-			  safe_table_definition->table_catalog_definition,
-			  utf16_string,
-			  utf16_string_length,
-			  error );
+				return( -1 );
+			}
+			if( safe_table_definition == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing table definition: %d.",
+				 function,
+				 entry_index );
 
-		if( result == -1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: unable to compare UTF-16 string with table catalog definition: %d name.",
-			 function,
-			 entry_index );
+				return( -1 );
+			}
+			result = libesedb_catalog_definition_compare_name_with_utf16_string(
+			          safe_table_definition->table_catalog_definition,
+			          utf16_string,
+			          utf16_string_length,
+			          error );
 
-			return( -1 );
-		}
-		else if( result == LIBUNA_COMPARE_EQUAL )
-		{
-			result = 1;
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: unable to compare UTF-16 string with table catalog definition: %d name.",
+				 function,
+				 entry_index );
 
-			break;
+				return( -1 );
+			}
+			else if( result == LIBUNA_COMPARE_EQUAL )
+			{
+				*table_definition = safe_table_definition;
+
+				return( 1 );
+			}
 		}
+		entry_index = catalog->name_hash_next_indexes[ entry_index ];
 	}
-	if( result != 0 )
-	{
-		*table_definition = safe_table_definition;
-	}
-	return( result );
+	return( 0 );
 }
 
@@ -29,8 +29,8 @@
 #include "libesedb_libbfio.h"
 #include "libesedb_libcdata.h"
 #include "libesedb_libcerror.h"
-#include "libesedb_libfcache.h"
-#include "libesedb_libfdata.h"
+#include "libesedb_metadata_cache.h"
+#include "libesedb_page_cache.h"
 #include "libesedb_page_tree.h"
 #include "libesedb_table_definition.h"
 
@@ -49,20 +49,57 @@ struct libesedb_catalog
 	/* The table definition array
 	 */
 	libcdata_array_t *table_definition_array;
+
+	/* Value to indicate only the table catalog definitions should be read
+	 * The other catalog definitions of a table are read when the table is retrieved
+	 */
+	uint8_t read_on_demand;
+
+	/* The table definition name hash buckets
+	 * Contains the index of the first table definition in the bucket or -1 if empty
+	 */
+	int *name_hash_buckets;
+
+	/* The number of table definition name hash buckets
+	 */
+	int number_of_name_hash_buckets;
+
+	/* The table definition name hashes
+	 */
+	uint32_t *name_hashes;
+
+	/* The index of the next table definition in the same bucket per table definition or -1
+	 */
+	int *name_hash_next_indexes;
+
+	/* The number of table definition name hashes
+	 */
+	int number_of_name_hashes;
 };
 
 int libesedb_catalog_initialize(
      libesedb_catalog_t **catalog,
      libesedb_io_handle_t *io_handle,
      uint32_t root_page_number,
-     libfdata_vector_t *pages_vector,
-     libfcache_cache_t *pages_cache,
+     libesedb_page_cache_t *page_cache,
      libcerror_error_t **error );
 
 int libesedb_catalog_free(
      libesedb_catalog_t **catalog,
      libcerror_error_t **error );
 
+int libesedb_catalog_append_table_definition_name_hash(
+     libesedb_catalog_t *catalog,
+     libesedb_table_definition_t *table_definition,
+     int table_definition_index,
+     libcerror_error_t **error );
+
+int libesedb_catalog_read_value_type(
+     const uint8_t *data,
+     size_t data_size,
+     uint16_t *type,
+     libcerror_error_t **error );
+
 int libesedb_catalog_read_value_data(
      libesedb_catalog_t *catalog,
      const uint8_t *data,
@@ -81,6 +118,23 @@ int libesedb_catalog_read_file_io_handle(
      libbfio_handle_t *file_io_handle,
      libcerror_error_t **error );
 
+int libesedb_catalog_read_metadata_cache(
+     libesedb_catalog_t *catalog,
+     libesedb_metadata_cache_t *metadata_cache,
+     libcerror_error_t **error );
+
+int libesedb_catalog_write_metadata_cache(
+     libesedb_catalog_t *catalog,
+     libbfio_handle_t *file_io_handle,
+     libesedb_metadata_cache_t *metadata_cache,
+     libcerror_error_t **error );
+
+int libesedb_catalog_read_deferred_table_definition(
+     libesedb_catalog_t *catalog,
+     libbfio_handle_t *file_io_handle,
+     libesedb_table_definition_t *table_definition,
+     libcerror_error_t **error );
+
 int libesedb_catalog_get_number_of_table_definitions(
      libesedb_catalog_t *catalog,
      int *number_of_table_definitions,
@@ -27,9 +27,33 @@
 #include "libesedb_compression.h"
 #include "libesedb_libcerror.h"
 #include "libesedb_libcnotify.h"
-#include "libesedb_libfwnt.h"
 #include "libesedb_libuna.h"
 
+/* Unpacks 8 characters from 7 bytes of 7-bit compressed data
+ * The caller must ensure that 7 bytes of compressed data and 8 characters are available
+ */
+static void libesedb_compression_7bit_unpack_characters(
+             const uint8_t *compressed_data,
+             uint8_t *characters )
+{
+	uint64_t value_64bit = 0;
+
+	byte_stream_copy_to_uint48_little_endian(
+	 compressed_data,
+	 value_64bit );
+
+	value_64bit |= (uint64_t) compressed_data[ 6 ] << 48;
+
+	characters[ 0 ] = (uint8_t) ( value_64bit & 0x7f );
+	characters[ 1 ] = (uint8_t) ( ( value_64bit >> 7 ) & 0x7f );
+	characters[ 2 ] = (uint8_t) ( ( value_64bit >> 14 ) & 0x7f );
+	characters[ 3 ] = (uint8_t) ( ( value_64bit >> 21 ) & 0x7f );
+	characters[ 4 ] = (uint8_t) ( ( value_64bit >> 28 ) & 0x7f );
+	characters[ 5 ] = (uint8_t) ( ( value_64bit >> 35 ) & 0x7f );
+	characters[ 6 ] = (uint8_t) ( ( value_64bit >> 42 ) & 0x7f );
+	characters[ 7 ] = (uint8_t) ( value_64bit >> 49 );
+}
+
 /* Retrieves the uncompressed size of the 7-bit compressed data
  * Returns 1 on success or -1 on error
  */
@@ -196,11 +220,24 @@ int libesedb_compression_7bit_decompress(
 
 		return( -1 );
 	}
-	for( compressed_data_index = 1;
-	     compressed_data_index < compressed_data_size;
-	     compressed_data_index++ )
+	compressed_data_index = 1;
+
+	/* Unpack 7 bytes into 8 characters per iteration
+	 */
+	while( ( compressed_data_size - compressed_data_index ) >= 7 )
+	{
+		libesedb_compression_7bit_unpack_characters(
+		 &( compressed_data[ compressed_data_index ] ),
+		 &( uncompressed_data[ uncompressed_data_index ] ) );
+
+		compressed_data_index   += 7;
+		uncompressed_data_index += 8;
+	}
+	/* Unpack the remaining bytes one bit-field at a time
+	 */
+	while( compressed_data_index < compressed_data_size )
 	{
-		value_16bit |= (uint16_t) compressed_data[ compressed_data_index ] << bit_index;
+		value_16bit |= (uint16_t) compressed_data[ compressed_data_index++ ] << bit_index;
 
 		uncompressed_data[ uncompressed_data_index++ ] = (uint8_t) ( value_16bit & 0x7f );
 
@@ -232,6 +269,446 @@ int libesedb_compression_7bit_decompress(
 	return( 1 );
 }
 
+/* Decompresses 7-bit compressed data directly into an UTF-8 string
+ * The unpacked characters are either 7-bit ASCII or UTF-16 little-endian
+ * code units consisting of 7-bit bytes, both map directly onto Unicode
+ * characters without surrogates, hence no separate conversion pass is needed
+ * If utf8_string is NULL only the UTF-8 string size is determined
+ * Returns 1 on success or -1 on error
+ */
+int libesedb_compression_7bit_decompress_to_utf8_string(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *required_utf8_string_size,
+     libcerror_error_t **error )
+{
+	uint8_t characters[ 8 ];
+
+	static char *function        = "libesedb_compression_7bit_decompress_to_utf8_string";
+	size_t character_index       = 0;
+	size_t compressed_data_index = 0;
+	size_t number_of_characters  = 0;
+	size_t utf8_string_index     = 0;
+	uint32_t unicode_character   = 0;
+	uint16_t value_16bit         = 0;
+	uint8_t bit_index            = 0;
+	uint8_t character_size       = 1;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size < 2 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: compressed data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( required_utf8_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid required UTF-8 string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data[ 0 ] == 0x18 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported leading byte: 0x%02" PRIx8 ".",
+		 function,
+		 compressed_data[ 0 ] );
+
+		return( -1 );
+	}
+	/* Data with an even number of characters is UTF-16 little-endian
+	 * unless flag 0x10 of the leading byte is set
+	 */
+	if( ( ( ( ( ( compressed_data_size - 1 ) * 8 ) / 7 ) % 2 ) == 0 )
+	 && ( ( compressed_data[ 0 ] & 0x10 ) == 0 ) )
+	{
+		character_size = 2;
+	}
+	compressed_data_index = 1;
+
+	while( compressed_data_index < compressed_data_size )
+	{
+		if( ( compressed_data_size - compressed_data_index ) >= 7 )
+		{
+			libesedb_compression_7bit_unpack_characters(
+			 &( compressed_data[ compressed_data_index ] ),
+			 characters );
+
+			compressed_data_index += 7;
+			number_of_characters   = 8;
+		}
+		else
+		{
+			number_of_characters = 0;
+
+			while( compressed_data_index < compressed_data_size )
+			{
+				value_16bit |= (uint16_t) compressed_data[ compressed_data_index++ ] << bit_index;
+
+				characters[ number_of_characters++ ] = (uint8_t) ( value_16bit & 0x7f );
+
+				value_16bit >>= 7;
+
+				bit_index++;
+			}
+			if( value_16bit != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported remainder: 0x%02" PRIx16 ".",
+				 function,
+				 value_16bit );
+
+				return( -1 );
+			}
+		}
+		for( character_index = 0;
+		     ( character_index + character_size ) <= number_of_characters;
+		     character_index += character_size )
+		{
+			unicode_character = characters[ character_index ];
+
+			if( character_size == 2 )
+			{
+				unicode_character |= (uint32_t) characters[ character_index + 1 ] << 8;
+			}
+			if( unicode_character == 0 )
+			{
+				break;
+			}
+			if( unicode_character < 0x00000080UL )
+			{
+				if( utf8_string != NULL )
+				{
+					if( ( utf8_string_index + 1 ) > utf8_string_size )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+						 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+						 "%s: UTF-8 string too small.",
+						 function );
+
+						return( -1 );
+					}
+					utf8_string[ utf8_string_index ] = (uint8_t) unicode_character;
+				}
+				utf8_string_index += 1;
+			}
+			else if( unicode_character < 0x00000800UL )
+			{
+				if( utf8_string != NULL )
+				{
+					if( ( utf8_string_index + 2 ) > utf8_string_size )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+						 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+						 "%s: UTF-8 string too small.",
+						 function );
+
+						return( -1 );
+					}
+					utf8_string[ utf8_string_index ]     = (uint8_t) ( 0xc0 | ( unicode_character >> 6 ) );
+					utf8_string[ utf8_string_index + 1 ] = (uint8_t) ( 0x80 | ( unicode_character & 0x3f ) );
+				}
+				utf8_string_index += 2;
+			}
+			else
+			{
+				if( utf8_string != NULL )
+				{
+					if( ( utf8_string_index + 3 ) > utf8_string_size )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+						 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+						 "%s: UTF-8 string too small.",
+						 function );
+
+						return( -1 );
+					}
+					utf8_string[ utf8_string_index ]     = (uint8_t) ( 0xe0 | ( unicode_character >> 12 ) );
+					utf8_string[ utf8_string_index + 1 ] = (uint8_t) ( 0x80 | ( ( unicode_character >> 6 ) & 0x3f ) );
+					utf8_string[ utf8_string_index + 2 ] = (uint8_t) ( 0x80 | ( unicode_character & 0x3f ) );
+				}
+				utf8_string_index += 3;
+			}
+		}
+		if( character_index < number_of_characters )
+		{
+			break;
+		}
+	}
+	if( utf8_string != NULL )
+	{
+		if( ( utf8_string_index + 1 ) > utf8_string_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: UTF-8 string too small.",
+			 function );
+
+			return( -1 );
+		}
+		utf8_string[ utf8_string_index ] = 0;
+	}
+	*required_utf8_string_size = utf8_string_index + 1;
+
+	return( 1 );
+}
+
+/* Decompresses 7-bit compressed data directly into an UTF-16 string
+ * The unpacked characters are either 7-bit ASCII or UTF-16 little-endian
+ * code units consisting of 7-bit bytes, both map directly onto Unicode
+ * characters without surrogates, hence no separate conversion pass is needed
+ * If utf16_string is NULL only the UTF-16 string size is determined
+ * Returns 1 on success or -1 on error
+ */
+int libesedb_compression_7bit_decompress_to_utf16_string(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     size_t *required_utf16_string_size,
+     libcerror_error_t **error )
+{
+	uint8_t characters[ 8 ];
+
+	static char *function        = "libesedb_compression_7bit_decompress_to_utf16_string";
+	size_t character_index       = 0;
+	size_t compressed_data_index = 0;
+	size_t number_of_characters  = 0;
+	size_t utf16_string_index    = 0;
+	uint32_t unicode_character   = 0;
+	uint16_t value_16bit         = 0;
+	uint8_t bit_index            = 0;
+	uint8_t character_size       = 1;
+
+	if( compressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid compressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data_size < 2 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: compressed data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 string size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( required_utf16_string_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid required UTF-16 string size.",
+		 function );
+
+		return( -1 );
+	}
+	if( compressed_data[ 0 ] == 0x18 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported leading byte: 0x%02" PRIx8 ".",
+		 function,
+		 compressed_data[ 0 ] );
+
+		return( -1 );
+	}
+	/* Data with an even number of characters is UTF-16 little-endian
+	 * unless flag 0x10 of the leading byte is set
+	 */
+	if( ( ( ( ( ( compressed_data_size - 1 ) * 8 ) / 7 ) % 2 ) == 0 )
+	 && ( ( compressed_data[ 0 ] & 0x10 ) == 0 ) )
+	{
+		character_size = 2;
+	}
+	compressed_data_index = 1;
+
+	while( compressed_data_index < compressed_data_size )
+	{
+		if( ( compressed_data_size - compressed_data_index ) >= 7 )
+		{
+			libesedb_compression_7bit_unpack_characters(
+			 &( compressed_data[ compressed_data_index ] ),
+			 characters );
+
+			compressed_data_index += 7;
+			number_of_characters   = 8;
+		}
+		else
+		{
+			number_of_characters = 0;
+
+			while( compressed_data_index < compressed_data_size )
+			{
+				value_16bit |= (uint16_t) compressed_data[ compressed_data_index++ ] << bit_index;
+
+				characters[ number_of_characters++ ] = (uint8_t) ( value_16bit & 0x7f );
+
+				value_16bit >>= 7;
+
+				bit_index++;
+			}
+			if( value_16bit != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported remainder: 0x%02" PRIx16 ".",
+				 function,
+				 value_16bit );
+
+				return( -1 );
+			}
+		}
+		for( character_index = 0;
+		     ( character_index + character_size ) <= number_of_characters;
+		     character_index += character_size )
+		{
+			unicode_character = characters[ character_index ];
+
+			if( character_size == 2 )
+			{
+				unicode_character |= (uint32_t) characters[ character_index + 1 ] << 8;
+			}
+			if( unicode_character == 0 )
+			{
+				break;
+			}
+			if( utf16_string != NULL )
+			{
+				if( ( utf16_string_index + 1 ) > utf16_string_size )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+					 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+					 "%s: UTF-16 string too small.",
+					 function );
+
+					return( -1 );
+				}
+				utf16_string[ utf16_string_index ] = (uint16_t) unicode_character;
+			}
+			utf16_string_index += 1;
+		}
+		if( character_index < number_of_characters )
+		{
+			break;
+		}
+	}
+	if( utf16_string != NULL )
+	{
+		if( ( utf16_string_index + 1 ) > utf16_string_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: UTF-16 string too small.",
+			 function );
+
+			return( -1 );
+		}
+		utf16_string[ utf16_string_index ] = 0;
+	}
+	*required_utf16_string_size = utf16_string_index + 1;
+
+	return( 1 );
+}
+
 /* Retrieves the uncompressed size of LZXPRESS compressed data
  * Returns 1 on success or -1 on error
  */
@@ -316,7 +793,18 @@ int libesedb_compression_lzxpress_decompress(
      size_t uncompressed_data_size,
      libcerror_error_t **error )
 {
-	static char *function = "libesedb_compression_lzxpress_decompress";
+	static char *function                      = "libesedb_compression_lzxpress_decompress";
+	size_t compressed_data_offset              = 0;
+	size_t compression_tuple_offset            = 0;
+	size_t compression_tuple_size              = 0;
+	size_t match_offset                        = 0;
+	size_t uncompressed_data_offset            = 0;
+	uint32_t compression_indicator             = 0;
+	uint32_t value_32bit                       = 0;
+	uint16_t compression_tuple                 = 0;
+	uint8_t compression_indicator_bit_index    = 0;
+	uint8_t compression_tuple_size_byte        = 0;
+	uint8_t compression_tuple_size_byte_shared = 0;
 
 	if( compressed_data == NULL )
 	{
@@ -329,6 +817,17 @@ int libesedb_compression_lzxpress_decompress(
 
 		return( -1 );
 	}
+	if( compressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid compressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
 	if( compressed_data_size < 3 )
 	{
 		libcerror_error_set(
@@ -340,6 +839,28 @@ int libesedb_compression_lzxpress_decompress(
 
 		return( -1 );
 	}
+	if( uncompressed_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid uncompressed data.",
+		 function );
+
+		return( -1 );
+	}
+	if( uncompressed_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid uncompressed data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
 	if( compressed_data[ 0 ] != 0x18 )
 	{
 		libcerror_error_set(
@@ -352,21 +873,240 @@ int libesedb_compression_lzxpress_decompress(
 
 		return( -1 );
 	}
-	if( libfwnt_lzxpress_decompress(
-	     &( compressed_data[ 3 ] ),
-	     compressed_data_size - 3,
-	     uncompressed_data,
-	     &uncompressed_data_size,
-	     error ) != 1 )
+	/* Skip the leading byte and the 16-bit uncompressed data size
+	 */
+	compressed_data_offset = 3;
+
+	while( compressed_data_offset < compressed_data_size )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
-		 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
-		 "%s: unable to decompress LZXPRESS compressed data.",
-		 function );
+		if( uncompressed_data_offset >= uncompressed_data_size )
+		{
+			break;
+		}
+		if( ( compressed_data_size - compressed_data_offset ) < 4 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: compressed data too small.",
+			 function );
 
-		return( -1 );
+			return( -1 );
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 &( compressed_data[ compressed_data_offset ] ),
+		 compression_indicator );
+
+		compressed_data_offset += 4;
+
+		for( compression_indicator_bit_index = 0;
+		     compression_indicator_bit_index < 32;
+		     compression_indicator_bit_index++ )
+		{
+			if( compressed_data_offset >= compressed_data_size )
+			{
+				break;
+			}
+			if( ( compression_indicator & 0x80000000UL ) == 0 )
+			{
+				if( uncompressed_data_offset >= uncompressed_data_size )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: uncompressed data too small.",
+					 function );
+
+					return( -1 );
+				}
+				uncompressed_data[ uncompressed_data_offset++ ] = compressed_data[ compressed_data_offset++ ];
+			}
+			else
+			{
+				if( ( compressed_data_size - compressed_data_offset ) < 2 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: compressed data too small.",
+					 function );
+
+					return( -1 );
+				}
+				byte_stream_copy_to_uint16_little_endian(
+				 &( compressed_data[ compressed_data_offset ] ),
+				 compression_tuple );
+
+				compressed_data_offset += 2;
+
+				compression_tuple_size   = (size_t) ( compression_tuple & 0x0007 ) + 3;
+				compression_tuple_offset = (size_t) ( compression_tuple >> 3 ) + 1;
+
+				if( compression_tuple_size == 10 )
+				{
+					/* Two consecutive extended sizes share a single byte
+					 */
+					if( compression_tuple_size_byte_shared == 0 )
+					{
+						if( compressed_data_offset >= compressed_data_size )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+							 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+							 "%s: compressed data too small.",
+							 function );
+
+							return( -1 );
+						}
+						compression_tuple_size_byte = compressed_data[ compressed_data_offset++ ];
+
+						compression_tuple_size = compression_tuple_size_byte & 0x0f;
+
+						compression_tuple_size_byte_shared = 1;
+					}
+					else
+					{
+						compression_tuple_size = compression_tuple_size_byte >> 4;
+
+						compression_tuple_size_byte_shared = 0;
+					}
+					if( compression_tuple_size == 15 )
+					{
+						if( compressed_data_offset >= compressed_data_size )
+						{
+							libcerror_error_set(
+							 error,
+							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+							 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+							 "%s: compressed data too small.",
+							 function );
+
+							return( -1 );
+						}
+						compression_tuple_size = compressed_data[ compressed_data_offset++ ];
+
+						if( compression_tuple_size == 255 )
+						{
+							if( ( compressed_data_size - compressed_data_offset ) < 2 )
+							{
+								libcerror_error_set(
+								 error,
+								 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+								 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+								 "%s: compressed data too small.",
+								 function );
+
+								return( -1 );
+							}
+							byte_stream_copy_to_uint16_little_endian(
+							 &( compressed_data[ compressed_data_offset ] ),
+							 compression_tuple_size );
+
+							compressed_data_offset += 2;
+
+							if( compression_tuple_size == 0 )
+							{
+								if( ( compressed_data_size - compressed_data_offset ) < 4 )
+								{
+									libcerror_error_set(
+									 error,
+									 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+									 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+									 "%s: compressed data too small.",
+									 function );
+
+									return( -1 );
+								}
+								byte_stream_copy_to_uint32_little_endian(
+								 &( compressed_data[ compressed_data_offset ] ),
+								 value_32bit );
+
+								compressed_data_offset += 4;
+
+								compression_tuple_size = (size_t) value_32bit;
+							}
+							if( compression_tuple_size < ( 15 + 7 ) )
+							{
+								libcerror_error_set(
+								 error,
+								 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+								 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+								 "%s: compression tuple size value out of bounds.",
+								 function );
+
+								return( -1 );
+							}
+							compression_tuple_size -= 15 + 7;
+						}
+						compression_tuple_size += 15;
+					}
+					compression_tuple_size += 10;
+				}
+				if( compression_tuple_offset > uncompressed_data_offset )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: compression tuple offset value out of bounds.",
+					 function );
+
+					return( -1 );
+				}
+				if( compression_tuple_size > ( uncompressed_data_size - uncompressed_data_offset ) )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: compression tuple size value out of bounds.",
+					 function );
+
+					return( -1 );
+				}
+				match_offset = uncompressed_data_offset - compression_tuple_offset;
+
+				/* Copy 8 bytes at a time if the match source does not overlap
+				 * the 8 bytes being written and the last copy, which can write
+				 * past the end of the match, still fits in the uncompressed data
+				 */
+				if( ( compression_tuple_offset >= 8 )
+				 && ( ( uncompressed_data_size - uncompressed_data_offset ) >= ( compression_tuple_size + 8 ) ) )
+				{
+					while( compression_tuple_size > 0 )
+					{
+						memory_copy(
+						 &( uncompressed_data[ uncompressed_data_offset ] ),
+						 &( uncompressed_data[ match_offset ] ),
+						 8 );
+
+						if( compression_tuple_size < 8 )
+						{
+							uncompressed_data_offset += compression_tuple_size;
+
+							break;
+						}
+						uncompressed_data_offset += 8;
+						match_offset             += 8;
+						compression_tuple_size   -= 8;
+					}
+				}
+				else
+				{
+					while( compression_tuple_size > 0 )
+					{
+						uncompressed_data[ uncompressed_data_offset++ ] = uncompressed_data[ match_offset++ ];
+
+						compression_tuple_size--;
+					}
+				}
+			}
+			compression_indicator <<= 1;
+		}
 	}
 	return( 1 );
 }
@@ -571,22 +1311,33 @@ int libesedb_compression_get_utf8_string_size(
 
 		return( -1 );
 	}
-	if( compressed_data[ 0 ] == 0x18 )
-	{
-		result = libesedb_compression_lzxpress_decompress_get_size(
-		          compressed_data,
-		          compressed_data_size,
-		          &uncompressed_data_size,
-		          error );
-	}
-	else
+	if( compressed_data[ 0 ] != 0x18 )
 	{
-		result = libesedb_compression_7bit_decompress_get_size(
-		          compressed_data,
-		          compressed_data_size,
-		          &uncompressed_data_size,
-		          error );
+		if( libesedb_compression_7bit_decompress_to_utf8_string(
+		     compressed_data,
+		     compressed_data_size,
+		     NULL,
+		     0,
+		     utf8_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine UTF-8 string size of 7-bit compressed data.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
 	}
+	result = libesedb_compression_lzxpress_decompress_get_size(
+	          compressed_data,
+	          compressed_data_size,
+	          &uncompressed_data_size,
+	          error );
+
 	if( result != 1 )
 	{
 		libcerror_error_set(
@@ -624,24 +1375,13 @@ int libesedb_compression_get_utf8_string_size(
 
 		goto on_error;
 	}
-	if( compressed_data[ 0 ] == 0x18 )
-	{
-		result = libesedb_compression_lzxpress_decompress(
-		          compressed_data,
-		          compressed_data_size,
-		          uncompressed_data,
-		          uncompressed_data_size,
-		          error );
-	}
-	else
-	{
-		result = libesedb_compression_7bit_decompress(
-		          compressed_data,
-		          compressed_data_size,
-		          uncompressed_data,
-		          uncompressed_data_size,
-		          error );
-	}
+	result = libesedb_compression_lzxpress_decompress(
+	          compressed_data,
+	          compressed_data_size,
+	          uncompressed_data,
+	          uncompressed_data_size,
+	          error );
+
 	if( result != 1 )
 	{
 		libcerror_error_set(
@@ -655,9 +1395,7 @@ int libesedb_compression_get_utf8_string_size(
 	}
 	result = 0;
 
-	if( ( ( uncompressed_data_size % 2 ) == 0 )
-	 && ( ( compressed_data[ 0 ] == 0x18 )
-	  ||  ( ( compressed_data[ 0 ] & 0x10 ) == 0 ) ) )
+	if( ( uncompressed_data_size % 2 ) == 0 )
 	{
 		result = libuna_utf8_string_size_from_utf16_stream(
 			  uncompressed_data,
@@ -733,10 +1471,11 @@ int libesedb_compression_copy_to_utf8_string(
      size_t utf8_string_size,
      libcerror_error_t **error )
 {
-	uint8_t *uncompressed_data    = NULL;
-	static char *function         = "libesedb_compression_copy_to_utf8_string";
-	size_t uncompressed_data_size = 0;
-	int result                    = 0;
+	uint8_t *uncompressed_data       = NULL;
+	static char *function            = "libesedb_compression_copy_to_utf8_string";
+	size_t uncompressed_data_size    = 0;
+	size_t required_utf8_string_size = 0;
+	int result                       = 0;
 
 	if( compressed_data == NULL )
 	{
@@ -771,22 +1510,44 @@ int libesedb_compression_copy_to_utf8_string(
 
 		return( -1 );
 	}
-	if( compressed_data[ 0 ] == 0x18 )
+	if( utf8_string == NULL )
 	{
-		result = libesedb_compression_lzxpress_decompress_get_size(
-		          compressed_data,
-		          compressed_data_size,
-		          &uncompressed_data_size,
-		          error );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
 	}
-	else
+	if( compressed_data[ 0 ] != 0x18 )
 	{
-		result = libesedb_compression_7bit_decompress_get_size(
-		          compressed_data,
-		          compressed_data_size,
-		          &uncompressed_data_size,
-		          error );
+		if( libesedb_compression_7bit_decompress_to_utf8_string(
+		     compressed_data,
+		     compressed_data_size,
+		     utf8_string,
+		     utf8_string_size,
+		     &required_utf8_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: unable to decompress 7-bit compressed data to UTF-8 string.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
 	}
+	result = libesedb_compression_lzxpress_decompress_get_size(
+	          compressed_data,
+	          compressed_data_size,
+	          &uncompressed_data_size,
+	          error );
+
 	if( result != 1 )
 	{
 		libcerror_error_set(
@@ -824,24 +1585,13 @@ int libesedb_compression_copy_to_utf8_string(
 
 		goto on_error;
 	}
-	if( compressed_data[ 0 ] == 0x18 )
-	{
-		result = libesedb_compression_lzxpress_decompress(
-		          compressed_data,
-		          compressed_data_size,
-		          uncompressed_data,
-		          uncompressed_data_size,
-		          error );
-	}
-	else
-	{
-		result = libesedb_compression_7bit_decompress(
-		          compressed_data,
-		          compressed_data_size,
-		          uncompressed_data,
-		          uncompressed_data_size,
-		          error );
-	}
+	result = libesedb_compression_lzxpress_decompress(
+	          compressed_data,
+	          compressed_data_size,
+	          uncompressed_data,
+	          uncompressed_data_size,
+	          error );
+
 	if( result != 1 )
 	{
 		libcerror_error_set(
@@ -855,9 +1605,7 @@ int libesedb_compression_copy_to_utf8_string(
 	}
 	result = 0;
 
-	if( ( ( uncompressed_data_size % 2 ) == 0 )
-	 && ( ( compressed_data[ 0 ] == 0x18 )
-	  ||  ( ( compressed_data[ 0 ] & 0x10 ) == 0 ) ) )
+	if( ( uncompressed_data_size % 2 ) == 0 )
 	{
 		result = libuna_utf8_string_copy_from_utf16_stream(
 			  utf8_string,
@@ -972,22 +1720,33 @@ int libesedb_compression_get_utf16_string_size(
 
 		return( -1 );
 	}
-	if( compressed_data[ 0 ] == 0x18 )
-	{
-		result = libesedb_compression_lzxpress_decompress_get_size(
-		          compressed_data,
-		          compressed_data_size,
-		          &uncompressed_data_size,
-		          error );
-	}
-	else
+	if( compressed_data[ 0 ] != 0x18 )
 	{
-		result = libesedb_compression_7bit_decompress_get_size(
-		          compressed_data,
-		          compressed_data_size,
-		          &uncompressed_data_size,
-		          error );
+		if( libesedb_compression_7bit_decompress_to_utf16_string(
+		     compressed_data,
+		     compressed_data_size,
+		     NULL,
+		     0,
+		     utf16_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine UTF-16 string size of 7-bit compressed data.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
 	}
+	result = libesedb_compression_lzxpress_decompress_get_size(
+	          compressed_data,
+	          compressed_data_size,
+	          &uncompressed_data_size,
+	          error );
+
 	if( result != 1 )
 	{
 		libcerror_error_set(
@@ -1025,24 +1784,13 @@ int libesedb_compression_get_utf16_string_size(
 
 		goto on_error;
 	}
-	if( compressed_data[ 0 ] == 0x18 )
-	{
-		result = libesedb_compression_lzxpress_decompress(
-		          compressed_data,
-		          compressed_data_size,
-		          uncompressed_data,
-		          uncompressed_data_size,
-		          error );
-	}
-	else
-	{
-		result = libesedb_compression_7bit_decompress(
-		          compressed_data,
-		          compressed_data_size,
-		          uncompressed_data,
-		          uncompressed_data_size,
-		          error );
-	}
+	result = libesedb_compression_lzxpress_decompress(
+	          compressed_data,
+	          compressed_data_size,
+	          uncompressed_data,
+	          uncompressed_data_size,
+	          error );
+
 	if( result != 1 )
 	{
 		libcerror_error_set(
@@ -1056,9 +1804,7 @@ int libesedb_compression_get_utf16_string_size(
 	}
 	result = 0;
 
-	if( ( ( uncompressed_data_size % 2 ) == 0 )
-	 && ( ( compressed_data[ 0 ] == 0x18 )
-	  ||  ( ( compressed_data[ 0 ] & 0x10 ) == 0 ) ) )
+	if( ( uncompressed_data_size % 2 ) == 0 )
 	{
 		result = libuna_utf16_string_size_from_utf16_stream(
 			  uncompressed_data,
@@ -1134,10 +1880,11 @@ int libesedb_compression_copy_to_utf16_string(
      size_t utf16_string_size,
      libcerror_error_t **error )
 {
-	uint8_t *uncompressed_data    = NULL;
-	static char *function         = "libesedb_compression_copy_to_utf16_string";
-	size_t uncompressed_data_size = 0;
-	int result                    = 0;
+	uint8_t *uncompressed_data        = NULL;
+	static char *function             = "libesedb_compression_copy_to_utf16_string";
+	size_t uncompressed_data_size     = 0;
+	size_t required_utf16_string_size = 0;
+	int result                        = 0;
 
 	if( compressed_data == NULL )
 	{
@@ -1172,22 +1919,44 @@ int libesedb_compression_copy_to_utf16_string(
 
 		return( -1 );
 	}
-	if( compressed_data[ 0 ] == 0x18 )
+	if( utf16_string == NULL )
 	{
-		result = libesedb_compression_lzxpress_decompress_get_size(
-		          compressed_data,
-		          compressed_data_size,
-		          &uncompressed_data_size,
-		          error );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
 	}
-	else
+	if( compressed_data[ 0 ] != 0x18 )
 	{
-		result = libesedb_compression_7bit_decompress_get_size(
-		          compressed_data,
-		          compressed_data_size,
-		          &uncompressed_data_size,
-		          error );
+		if( libesedb_compression_7bit_decompress_to_utf16_string(
+		     compressed_data,
+		     compressed_data_size,
+		     utf16_string,
+		     utf16_string_size,
+		     &required_utf16_string_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_COMPRESSION,
+			 LIBCERROR_COMPRESSION_ERROR_DECOMPRESS_FAILED,
+			 "%s: unable to decompress 7-bit compressed data to UTF-16 string.",
+			 function );
+
+			return( -1 );
+		}
+		return( 1 );
 	}
+	result = libesedb_compression_lzxpress_decompress_get_size(
+	          compressed_data,
+	          compressed_data_size,
+	          &uncompressed_data_size,
+	          error );
+
 	if( result != 1 )
 	{
 		libcerror_error_set(
@@ -1225,24 +1994,13 @@ int libesedb_compression_copy_to_utf16_string(
 
 		goto on_error;
 	}
-	if( compressed_data[ 0 ] == 0x18 )
-	{
-		result = libesedb_compression_lzxpress_decompress(
-		          compressed_data,
-		          compressed_data_size,
-		          uncompressed_data,
-		          uncompressed_data_size,
-		          error );
-	}
-	else
-	{
-		result = libesedb_compression_7bit_decompress(
-		          compressed_data,
-		          compressed_data_size,
-		          uncompressed_data,
-		          uncompressed_data_size,
-		          error );
-	}
+	result = libesedb_compression_lzxpress_decompress(
+	          compressed_data,
+	          compressed_data_size,
+	          uncompressed_data,
+	          uncompressed_data_size,
+	          error );
+
 	if( result != 1 )
 	{
 		libcerror_error_set(
@@ -1256,9 +2014,7 @@ int libesedb_compression_copy_to_utf16_string(
 	}
 	result = 0;
 
-	if( ( ( uncompressed_data_size % 2 ) == 0 )
-	 && ( ( compressed_data[ 0 ] == 0x18 )
-	  ||  ( ( compressed_data[ 0 ] & 0x10 ) == 0 ) ) )
+	if( ( uncompressed_data_size % 2 ) == 0 )
 	{
 		result = libuna_utf16_string_copy_from_utf16_stream(
 			  utf16_string,
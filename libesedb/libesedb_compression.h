@@ -44,6 +44,22 @@ int libesedb_compression_7bit_decompress(
      size_t uncompressed_data_size,
      libcerror_error_t **error );
 
+int libesedb_compression_7bit_decompress_to_utf8_string(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint8_t *utf8_string,
+     size_t utf8_string_size,
+     size_t *required_utf8_string_size,
+     libcerror_error_t **error );
+
+int libesedb_compression_7bit_decompress_to_utf16_string(
+     const uint8_t *compressed_data,
+     size_t compressed_data_size,
+     uint16_t *utf16_string,
+     size_t utf16_string_size,
+     size_t *required_utf16_string_size,
+     libcerror_error_t **error );
+
 int libesedb_compression_lzxpress_decompress_get_size(
      const uint8_t *compressed_data,
      size_t compressed_data_size,
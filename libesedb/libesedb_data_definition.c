@@ -34,10 +34,10 @@
 #include "libesedb_libcdata.h"
 #include "libesedb_libcerror.h"
 #include "libesedb_libcnotify.h"
-#include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
 #include "libesedb_libfvalue.h"
 #include "libesedb_page.h"
+#include "libesedb_page_cache.h"
 #include "libesedb_table_definition.h"
 #include "libesedb_value_data_handle.h"
 
@@ -138,6 +138,11 @@ int libesedb_data_definition_free(
 	}
 	if( *data_definition != NULL )
 	{
+		if( ( *data_definition )->tagged_data_types_data != NULL )
+		{
+			memory_free(
+			 ( *data_definition )->tagged_data_types_data );
+		}
 		memory_free(
 		 *data_definition );
 
@@ -153,16 +158,15 @@ int libesedb_data_definition_read_data(
      libesedb_data_definition_t *data_definition,
      libbfio_handle_t *file_io_handle,
      libesedb_io_handle_t *io_handle,
-     libfdata_vector_t *pages_vector,
-     libfcache_cache_t *pages_cache,
+     libesedb_page_cache_t *page_cache,
+     libesedb_page_t **page,
      uint8_t **data,
      size_t *data_size,
      libcerror_error_t **error )
 {
-	libesedb_page_t *page             = NULL;
+	libesedb_page_t *safe_page        = NULL;
 	libesedb_page_value_t *page_value = NULL;
 	static char *function             = "libesedb_data_definition_read_data";
-	off64_t element_data_offset       = 0;
 	uint16_t data_offset              = 0;
 
 	if( data_definition == NULL )
@@ -187,6 +191,17 @@ int libesedb_data_definition_read_data(
 
 		return( -1 );
 	}
+	if( page == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page.",
+		 function );
+
+		return( -1 );
+	}
 	if( data == NULL )
 	{
 		libcerror_error_set(
@@ -209,14 +224,11 @@ int libesedb_data_definition_read_data(
 
 		return( -1 );
 	}
-	if( libfdata_vector_get_element_value_at_offset(
-	     pages_vector,
-	     (intptr_t *) file_io_handle,
-	     (libfdata_cache_t *) pages_cache,
-	     data_definition->page_offset,
-	     &element_data_offset,
-	     (intptr_t **) &page,
-	     0,
+	if( libesedb_page_cache_get_page(
+	     page_cache,
+	     file_io_handle,
+	     data_definition->page_number,
+	     &safe_page,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -230,7 +242,7 @@ int libesedb_data_definition_read_data(
 
 		return( -1 );
 	}
-	if( page == NULL )
+	if( safe_page == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -239,10 +251,10 @@ int libesedb_data_definition_read_data(
 		 "%s: missing page.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( libesedb_page_get_value_by_index(
-	     page,
+	     safe_page,
 	     data_definition->page_value_index,
 	     &page_value,
 	     error ) != 1 )
@@ -255,7 +267,7 @@ int libesedb_data_definition_read_data(
 		 function,
 		 data_definition->page_value_index );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( page_value == NULL )
 	{
@@ -267,7 +279,7 @@ int libesedb_data_definition_read_data(
 		 function,
 		 data_definition->page_value_index );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( page_value->data == NULL )
 	{
@@ -278,7 +290,7 @@ int libesedb_data_definition_read_data(
 		 "%s: missing page value data.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 	data_offset = data_definition->data_offset - page_value->offset;
 
@@ -292,12 +304,187 @@ int libesedb_data_definition_read_data(
 		 "%s: invalid data definition - data offset value out of bounds.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
+	*page      = safe_page;
 	*data      = &( page_value->data[ data_offset ] );
 	*data_size = (size_t) ( page_value->size - data_offset );
 
 	return( 1 );
+
+on_error:
+	if( safe_page != NULL )
+	{
+		libesedb_page_cache_release_page(
+		 page_cache,
+		 &safe_page,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the record value type and encoding of a column
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_data_definition_get_record_value_type(
+     libesedb_io_handle_t *io_handle,
+     libesedb_catalog_definition_t *column_catalog_definition,
+     uint8_t *record_value_type,
+     int *encoding,
+     libcerror_error_t **error )
+{
+	static char *function     = "libesedb_data_definition_get_record_value_type";
+	int record_value_codepage = 0;
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( column_catalog_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column catalog definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_value_type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record value type.",
+		 function );
+
+		return( -1 );
+	}
+	if( encoding == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid encoding.",
+		 function );
+
+		return( -1 );
+	}
+/* TODO refactor to value type */
+
+	switch( column_catalog_definition->column_type )
+	{
+		case LIBESEDB_COLUMN_TYPE_NULL:
+			/* JET_coltypNil seems to be able to contain data */
+			*record_value_type = LIBFVALUE_VALUE_TYPE_BINARY_DATA;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_BOOLEAN:
+			*record_value_type = LIBFVALUE_VALUE_TYPE_BOOLEAN;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_8BIT_UNSIGNED:
+			*record_value_type = LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_8BIT;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_SIGNED:
+			*record_value_type = LIBFVALUE_VALUE_TYPE_INTEGER_16BIT;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_UNSIGNED:
+			*record_value_type = LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_16BIT;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED:
+			*record_value_type = LIBFVALUE_VALUE_TYPE_INTEGER_32BIT;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED:
+			*record_value_type = LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_32BIT;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_CURRENCY:
+		case LIBESEDB_COLUMN_TYPE_INTEGER_64BIT_SIGNED:
+			*record_value_type = LIBFVALUE_VALUE_TYPE_INTEGER_64BIT;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_FLOAT_32BIT:
+			*record_value_type = LIBFVALUE_VALUE_TYPE_FLOATING_POINT_32BIT;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_DOUBLE_64BIT:
+			*record_value_type = LIBFVALUE_VALUE_TYPE_FLOATING_POINT_64BIT;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_DATE_TIME:
+			*record_value_type = LIBFVALUE_VALUE_TYPE_FILETIME;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_GUID:
+			*record_value_type = LIBFVALUE_VALUE_TYPE_GUID;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_BINARY_DATA:
+		case LIBESEDB_COLUMN_TYPE_LARGE_BINARY_DATA:
+			*record_value_type = LIBFVALUE_VALUE_TYPE_BINARY_DATA;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_TEXT:
+		case LIBESEDB_COLUMN_TYPE_LARGE_TEXT:
+			*record_value_type = LIBFVALUE_VALUE_TYPE_STRING_BYTE_STREAM;
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_SUPER_LARGE_VALUE:
+/* TODO handle this value type */
+			*record_value_type = LIBFVALUE_VALUE_TYPE_UNDEFINED;
+			break;
+
+		default:
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported column type: %" PRIu32 ".",
+			 function,
+			 column_catalog_definition->column_type );
+
+			return( -1 );
+	}
+	if( ( column_catalog_definition->column_type == LIBESEDB_COLUMN_TYPE_TEXT )
+	 || ( column_catalog_definition->column_type == LIBESEDB_COLUMN_TYPE_LARGE_TEXT ) )
+	{
+		record_value_codepage = (int) column_catalog_definition->codepage;
+
+		/* If the codepage is not set use the default codepage
+		 */
+		if( record_value_codepage == 0 )
+		{
+			record_value_codepage = io_handle->ascii_codepage;
+		}
+		/* Codepage 1200 in the ESE database format is not strict UTF-16 little-endian
+		 * it can be used for ASCII strings as well.
+		 */
+		if( record_value_codepage == 1200 )
+		{
+			record_value_codepage = LIBFVALUE_CODEPAGE_1200_MIXED;
+		}
+		*encoding = record_value_codepage;
+	}
+	else
+	{
+		*encoding = LIBFVALUE_ENDIAN_LITTLE;
+	}
+	return( 1 );
 }
 
 /* Reads the record
@@ -308,8 +495,7 @@ int libesedb_data_definition_read_record(
      libesedb_data_definition_t *data_definition,
      libbfio_handle_t *file_io_handle,
      libesedb_io_handle_t *io_handle,
-     libfdata_vector_t *pages_vector,
-     libfcache_cache_t *pages_cache,
+     libesedb_page_cache_t *page_cache,
      libesedb_table_definition_t *table_definition,
      libesedb_table_definition_t *template_table_definition,
      libcdata_array_t *values_array,
@@ -322,21 +508,13 @@ int libesedb_data_definition_read_record(
 	libfvalue_data_handle_t *value_data_handle               = NULL;
 	libfvalue_value_t *record_value                          = NULL;
 	uint8_t *record_data                                     = NULL;
-	uint8_t *tagged_data_type_offset_data                    = NULL;
 	static char *function                                    = "libesedb_data_definition_read_record";
 	size_t record_data_size                                  = 0;
 	size_t remaining_definition_data_size                    = 0;
-	off64_t element_data_offset                              = 0;
 	uint16_t data_offset                                     = 0;
 	uint16_t fixed_size_data_type_value_offset               = 0;
-	uint16_t masked_previous_tagged_data_type_offset         = 0;
-	uint16_t masked_tagged_data_type_offset                  = 0;
-	uint16_t previous_tagged_data_type_offset                = 0;
 	uint16_t previous_variable_size_data_type_size           = 0;
 	uint16_t tagged_data_type_identifier                     = 0;
-	uint16_t tagged_data_type_offset                         = 0;
-	uint16_t tagged_data_type_offset_bitmask                 = 0x3fff;
-	uint16_t tagged_data_type_offset_data_size               = 0;
 	uint16_t tagged_data_type_size                           = 0;
 	uint16_t tagged_data_type_value_offset                   = 0;
 	uint16_t tagged_data_types_offset                        = 0;
@@ -356,7 +534,6 @@ int libesedb_data_definition_read_record(
 	int number_of_column_catalog_definitions                 = 0;
 	int number_of_table_column_catalog_definitions           = 0;
 	int number_of_template_table_column_catalog_definitions  = 0;
-	int record_value_codepage                                = 0;
 
 	if( data_definition == NULL )
 	{
@@ -413,14 +590,11 @@ int libesedb_data_definition_read_record(
 
 		return( -1 );
 	}
-	if( libfdata_vector_get_element_value_at_offset(
-	     pages_vector,
-	     (intptr_t *) file_io_handle,
-	     (libfdata_cache_t *) pages_cache,
-	     data_definition->page_offset,
-	     &element_data_offset,
-	     (intptr_t **) &page,
-	     0,
+	if( libesedb_page_cache_get_page(
+	     page_cache,
+	     file_io_handle,
+	     data_definition->page_number,
+	     &page,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -517,11 +691,6 @@ int libesedb_data_definition_read_record(
 	{
 		tagged_data_types_format = LIBESEDB_TAGGED_DATA_TYPES_FORMAT_LINEAR;
 	}
-	if( ( io_handle->format_revision >= LIBESEDB_FORMAT_REVISION_EXTENDED_PAGE_HEADER )
-	 && ( io_handle->page_size >= 16384 ) )
-	{
-		tagged_data_type_offset_bitmask = 0x7fff;
-	}
 	last_fixed_size_data_type    = ( (esedb_data_definition_header_t *) record_data )->last_fixed_size_data_type;
 	last_variable_size_data_type = ( (esedb_data_definition_header_t *) record_data )->last_variable_size_data_type;
 
@@ -725,85 +894,64 @@ int libesedb_data_definition_read_record(
 		}
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
 
-/* TODO refactor to value type */
-
-		switch( column_catalog_definition->column_type )
+		if( ( tagged_data_types_format == LIBESEDB_TAGGED_DATA_TYPES_FORMAT_INDEX )
+		 && ( column_catalog_definition->identifier > 127 )
+		 && ( current_variable_size_data_type >= last_variable_size_data_type ) )
 		{
-			case LIBESEDB_COLUMN_TYPE_NULL:
-				/* JET_coltypNil seems to be able to contain data */
-				record_value_type = LIBFVALUE_VALUE_TYPE_BINARY_DATA;
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_BOOLEAN:
-				record_value_type = LIBFVALUE_VALUE_TYPE_BOOLEAN;
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_INTEGER_8BIT_UNSIGNED:
-				record_value_type = LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_8BIT;
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_SIGNED:
-				record_value_type = LIBFVALUE_VALUE_TYPE_INTEGER_16BIT;
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_UNSIGNED:
-				record_value_type = LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_16BIT;
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED:
-				record_value_type = LIBFVALUE_VALUE_TYPE_INTEGER_32BIT;
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED:
-				record_value_type = LIBFVALUE_VALUE_TYPE_UNSIGNED_INTEGER_32BIT;
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_CURRENCY:
-			case LIBESEDB_COLUMN_TYPE_INTEGER_64BIT_SIGNED:
-				record_value_type = LIBFVALUE_VALUE_TYPE_INTEGER_64BIT;
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_FLOAT_32BIT:
-				record_value_type = LIBFVALUE_VALUE_TYPE_FLOATING_POINT_32BIT;
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_DOUBLE_64BIT:
-				record_value_type = LIBFVALUE_VALUE_TYPE_FLOATING_POINT_64BIT;
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_DATE_TIME:
-				record_value_type = LIBFVALUE_VALUE_TYPE_FILETIME;
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_GUID:
-				record_value_type = LIBFVALUE_VALUE_TYPE_GUID;
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_BINARY_DATA:
-			case LIBESEDB_COLUMN_TYPE_LARGE_BINARY_DATA:
-				record_value_type = LIBFVALUE_VALUE_TYPE_BINARY_DATA;
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_TEXT:
-			case LIBESEDB_COLUMN_TYPE_LARGE_TEXT:
-				record_value_type = LIBFVALUE_VALUE_TYPE_STRING_BYTE_STREAM;
-				break;
-
-			case LIBESEDB_COLUMN_TYPE_SUPER_LARGE_VALUE:
-/* TODO handle this value type */
-				record_value_type = LIBFVALUE_VALUE_TYPE_UNDEFINED;
-				break;
+			if( tagged_data_types_offset == 0 )
+			{
+				tagged_data_types_offset = variable_size_data_type_value_offset;
 
-			default:
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-				 "%s: unsupported column type: %" PRIu32 ".",
-				 function,
-				 column_catalog_definition->column_type );
+				/* Note that offset is allowed to be equal to the record data size here
+				 */
+				if( tagged_data_types_offset > record_data_size )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+					 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+					 "%s: invalid tagged data types offset value out of bounds.",
+					 function );
 
-				goto on_error;
+					goto on_error;
+				}
+				if( libesedb_data_definition_set_tagged_data_types_data(
+				     data_definition,
+				     io_handle,
+				     &( record_data[ tagged_data_types_offset ] ),
+				     record_data_size - (size_t) tagged_data_types_offset,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to set tagged data types data.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			/* The tagged data type values are read on demand, most records
+			 * only contain a small part of the tagged data types of a table
+			 */
+			continue;
+		}
+		if( libesedb_data_definition_get_record_value_type(
+		     io_handle,
+		     column_catalog_definition,
+		     &record_value_type,
+		     &encoding,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve record value type.",
+			 function );
+
+			goto on_error;
 		}
 		if( libfvalue_data_handle_initialize(
 		     &value_data_handle,
@@ -819,30 +967,6 @@ int libesedb_data_definition_read_record(
 
 			goto on_error;
 		}
-		if( ( column_catalog_definition->column_type == LIBESEDB_COLUMN_TYPE_TEXT )
-		 || ( column_catalog_definition->column_type == LIBESEDB_COLUMN_TYPE_LARGE_TEXT ) )
-		{
-			record_value_codepage = (int) column_catalog_definition->codepage;
-
-			/* If the codepage is not set use the default codepage
-			 */
-			if( record_value_codepage == 0 )
-			{
-				record_value_codepage = io_handle->ascii_codepage;
-			}
-			/* Codepage 1200 in the ESE database format is not strict UTF-16 little-endian
-			 * it can be used for ASCII strings as well.
-			 */
-			if( record_value_codepage == 1200 )
-			{
-				record_value_codepage = LIBFVALUE_CODEPAGE_1200_MIXED;
-			}
-			encoding = record_value_codepage;
-		}
-		else
-		{
-			encoding = LIBFVALUE_ENDIAN_LITTLE;
-		}
 		if( column_catalog_definition->identifier <= 127 )
 		{
 			if( column_catalog_definition->identifier <= last_fixed_size_data_type )
@@ -1210,360 +1334,598 @@ int libesedb_data_definition_read_record(
 					}
 				}
 			}
-			else if( tagged_data_types_format == LIBESEDB_TAGGED_DATA_TYPES_FORMAT_INDEX )
-			{
-				if( tagged_data_types_offset == 0 )
-				{
-					tagged_data_types_offset = variable_size_data_type_value_offset;
-
-					/* Note that offset is allowed to be equal to the record data size here
-					 */
-					if( tagged_data_types_offset > record_data_size )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-						 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-						 "%s: invalid tagged data types offset value out of bounds.",
-						 function );
-
-						goto on_error;
-					}
-					tagged_data_type_offset_data   = &( record_data[ tagged_data_types_offset ] );
-					remaining_definition_data_size = record_data_size - (size_t) tagged_data_types_offset;
+		}
+		if( libfvalue_value_type_initialize_with_data_handle(
+		     &record_value,
+		     record_value_type,
+		     value_data_handle,
+		     LIBFVALUE_VALUE_FLAG_DATA_HANDLE_MANAGED,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create record value.",
+			 function );
 
-					if( remaining_definition_data_size > 0 )
-					{
-						if( record_data_size < 4 )
-						{
-							libcerror_error_set(
-							 error,
-							 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-							 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-							 "%s: invalid tagged data types offset data size value out of bounds.",
-							 function );
+			goto on_error;
+		}
+		value_data_handle = NULL;
 
-							goto on_error;
-						}
-						byte_stream_copy_to_uint16_little_endian(
-						 tagged_data_type_offset_data,
-						 tagged_data_type_identifier );
+		if( libcdata_array_set_entry_by_index(
+		     values_array,
+		     column_catalog_definition_index,
+		     (intptr_t *) record_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to set data type definition: %d.",
+			 function,
+			 column_catalog_definition_index );
 
-						tagged_data_type_offset_data += 2;
+			goto on_error;
+		}
+		record_value = NULL;
+	}
+#if defined( HAVE_DEBUG_OUTPUT )
+	if( libcnotify_verbose != 0 )
+	{
+		if( fixed_size_data_type_value_offset < variable_size_data_types_offset )
+		{
+			libcnotify_printf(
+			 "%s: fixed size data types trailing data:\n",
+			 function );
+			libcnotify_print_data(
+			 &( record_data[ fixed_size_data_type_value_offset ] ),
+			 variable_size_data_types_offset - fixed_size_data_type_value_offset,
+			 0 );
+		}
+		libcnotify_printf(
+		 "\n" );
+	}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
 
-						byte_stream_copy_to_uint16_little_endian(
-						 tagged_data_type_offset_data,
-						 tagged_data_type_offset );
+	if( libesedb_page_cache_release_page(
+	     page_cache,
+	     &page,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release page: %" PRIu32 ".",
+		 function,
+		 data_definition->page_number );
 
-						tagged_data_type_offset_data += 2;
+		goto on_error;
+	}
+	return( 1 );
 
-						if( tagged_data_type_offset == 0 )
-						{
-							libcerror_error_set(
-							 error,
-							 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-							 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-							 "%s: invalid tagged data type offset value out of bounds.",
-							 function );
+on_error:
+	if( page != NULL )
+	{
+		libesedb_page_cache_release_page(
+		 page_cache,
+		 &page,
+		 NULL );
+	}
+	if( record_value != NULL )
+	{
+		libfvalue_value_free(
+		 &record_value,
+		 NULL );
+	}
+	if( value_data_handle != NULL )
+	{
+		libfvalue_data_handle_free(
+		 &value_data_handle,
+		 NULL );
+	}
+	return( -1 );
+}
 
-							goto on_error;
-						}
-						tagged_data_type_offset_data_size = ( tagged_data_type_offset & 0x3fff ) - 4;
+/* Sets the tagged data types data of the record
+ * The data is copied so the tagged data type values can be read on demand
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_data_definition_set_tagged_data_types_data(
+     libesedb_data_definition_t *data_definition,
+     libesedb_io_handle_t *io_handle,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function                       = "libesedb_data_definition_set_tagged_data_types_data";
+	size_t data_offset                          = 0;
+	uint16_t masked_previous_tagged_data_offset = 0;
+	uint16_t masked_tagged_data_type_offset     = 0;
+	uint16_t previous_tagged_data_identifier    = 0;
+	uint16_t tagged_data_type_identifier        = 0;
+	uint16_t tagged_data_type_offset            = 0;
+	uint16_t tagged_data_type_offset_bitmask    = 0x3fff;
+	uint16_t tagged_data_type_offset_data_size  = 0;
+	uint8_t tagged_data_types_sorted            = 1;
 
-						remaining_definition_data_size -= 4;
+	if( data_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size > (size_t) UINT16_MAX )
+	 || ( data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_definition->tagged_data_types_data != NULL )
+	{
+		memory_free(
+		 data_definition->tagged_data_types_data );
+
+		data_definition->tagged_data_types_data = NULL;
+	}
+	data_definition->tagged_data_types_data_size = 0;
+	data_definition->number_of_tagged_data_types = 0;
+
+	if( data_size == 0 )
+	{
+		return( 1 );
+	}
+	if( data_size < 4 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid tagged data types offset data size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 &( data[ 2 ] ),
+	 tagged_data_type_offset );
+
+	tagged_data_type_offset_data_size = tagged_data_type_offset & 0x3fff;
+
+	if( ( tagged_data_type_offset_data_size < 4 )
+	 || ( (size_t) tagged_data_type_offset_data_size > data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid tagged data type offset value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	data_definition->tagged_data_types_data = (uint8_t *) memory_allocate(
+	                                                       sizeof( uint8_t ) * data_size );
+
+	if( data_definition->tagged_data_types_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create tagged data types data.",
+		 function );
 
+		goto on_error;
+	}
+	if( memory_copy(
+	     data_definition->tagged_data_types_data,
+	     data,
+	     data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy tagged data types data.",
+		 function );
+
+		goto on_error;
+	}
 #if defined( HAVE_DEBUG_OUTPUT )
-						if( libcnotify_verbose != 0 )
-						{
-							libcnotify_printf(
-							 "%s: tagged data type offset data size\t\t: %" PRIu16 "\n",
-							 function,
-							 tagged_data_type_offset_data_size );
-							libcnotify_printf(
-							 "%s: tagged data type offset data:\n",
-							 function );
-							libcnotify_print_data(
-							 tagged_data_type_offset_data,
-							 tagged_data_type_offset_data_size + 4,
-							 0 );
-						}
+	if( libcnotify_verbose != 0 )
+	{
+		libcnotify_printf(
+		 "%s: tagged data type offset data size\t\t: %" PRIu16 "\n",
+		 function,
+		 tagged_data_type_offset_data_size - 4 );
+		libcnotify_printf(
+		 "%s: tagged data type offset data:\n",
+		 function );
+		libcnotify_print_data(
+		 data,
+		 (size_t) tagged_data_type_offset_data_size,
+		 0 );
+	}
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
-					}
-				}
-				if( ( remaining_definition_data_size > 0 )
-				 && ( column_catalog_definition->identifier == tagged_data_type_identifier ) )
-				{
-#if defined( HAVE_DEBUG_OUTPUT )
-					if( libcnotify_verbose != 0 )
-					{
-						libcnotify_printf(
-						 "%s: (%03" PRIu16 ") tagged data type identifier\t\t: %" PRIu16 "\n",
-						 function,
-						 column_catalog_definition->identifier,
-						 tagged_data_type_identifier );
 
-						libcnotify_printf(
-						 "%s: (%03" PRIu16 ") tagged data type offset\t\t: 0x%04" PRIx16 " (%" PRIu16 ")\n",
-						 function,
-						 column_catalog_definition->identifier,
-						 tagged_data_type_offset,
-						 tagged_data_type_offset & tagged_data_type_offset_bitmask );
-					}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+	if( io_handle->has_extended_page_header != 0 )
+	{
+		tagged_data_type_offset_bitmask = 0x7fff;
+	}
+	/* The tagged data type values are located by identifier on demand
+	 * hence check the ordering of the offsets and identifiers up front
+	 */
+	for( data_offset = 0;
+	     data_offset < (size_t) ( tagged_data_type_offset_data_size & 0xfffc );
+	     data_offset += 4 )
+	{
+		byte_stream_copy_to_uint16_little_endian(
+		 &( data[ data_offset ] ),
+		 tagged_data_type_identifier );
 
-					previous_tagged_data_type_offset = tagged_data_type_offset;
+		byte_stream_copy_to_uint16_little_endian(
+		 &( data[ data_offset + 2 ] ),
+		 tagged_data_type_offset );
 
-					if( tagged_data_type_offset_data_size > 0 )
-					{
-						if( tagged_data_type_offset_data_size < 4 )
-						{
-							libcerror_error_set(
-							 error,
-							 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-							 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-							 "%s: invalid tagged data types offset data size value out of bounds.",
-							 function );
+		masked_tagged_data_type_offset = tagged_data_type_offset & tagged_data_type_offset_bitmask;
 
-							goto on_error;
-						}
-						byte_stream_copy_to_uint16_little_endian(
-						 tagged_data_type_offset_data,
-						 tagged_data_type_identifier );
+		if( ( masked_tagged_data_type_offset < masked_previous_tagged_data_offset )
+		 || ( (size_t) masked_tagged_data_type_offset > data_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid tagged data type offset value exceeds next tagged data type offset.",
+			 function );
 
-						tagged_data_type_offset_data += 2;
+			goto on_error;
+		}
+		if( ( data_offset > 0 )
+		 && ( tagged_data_type_identifier <= previous_tagged_data_identifier ) )
+		{
+			tagged_data_types_sorted = 0;
+		}
+		masked_previous_tagged_data_offset = masked_tagged_data_type_offset;
+		previous_tagged_data_identifier    = tagged_data_type_identifier;
+	}
+	data_definition->tagged_data_types_data_size  = data_size;
+	data_definition->number_of_tagged_data_types  = tagged_data_type_offset_data_size / 4;
+	data_definition->tagged_data_types_are_sorted = tagged_data_types_sorted;
 
-						byte_stream_copy_to_uint16_little_endian(
-						 tagged_data_type_offset_data,
-						 tagged_data_type_offset );
+	return( 1 );
 
-						tagged_data_type_offset_data += 2;
+on_error:
+	if( data_definition->tagged_data_types_data != NULL )
+	{
+		memory_free(
+		 data_definition->tagged_data_types_data );
 
-						tagged_data_type_offset_data_size -= 4;
-						remaining_definition_data_size    -= 4;
-					}
-					masked_previous_tagged_data_type_offset = previous_tagged_data_type_offset & tagged_data_type_offset_bitmask;
-					masked_tagged_data_type_offset          = tagged_data_type_offset & tagged_data_type_offset_bitmask;
+		data_definition->tagged_data_types_data = NULL;
+	}
+	return( -1 );
+}
 
-					if( masked_previous_tagged_data_type_offset > masked_tagged_data_type_offset )
-					{
-						libcerror_error_set(
-						 error,
-						 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-						 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-						 "%s: invalid tagged data type offset value exceeds next tagged data type offset.",
-						 function );
-
-						goto on_error;
-					}
-					if( masked_tagged_data_type_offset > masked_previous_tagged_data_type_offset )
-					{
-						tagged_data_type_size = masked_tagged_data_type_offset - masked_previous_tagged_data_type_offset;
-					}
-					else
-					{
-						tagged_data_type_size = (uint16_t) remaining_definition_data_size;
-					}
-#if defined( HAVE_DEBUG_OUTPUT )
-					if( libcnotify_verbose != 0 )
-					{
-						libcnotify_printf(
-						 "%s: (%03" PRIu16 ") tagged data type size\t\t: %" PRIu16 "\n",
-						 function,
-						 column_catalog_definition->identifier,
-						 tagged_data_type_size );
-					}
-#endif
-					tagged_data_type_value_offset = tagged_data_types_offset + masked_previous_tagged_data_type_offset;
+/* Reads a tagged data type value of the record
+ * The tagged data type is located in the tagged data types data by its identifier
+ * A value without data is created if the record does not contain the tagged data type
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_data_definition_read_tagged_data_type_value(
+     libesedb_data_definition_t *data_definition,
+     libesedb_io_handle_t *io_handle,
+     libesedb_catalog_definition_t *column_catalog_definition,
+     libfvalue_value_t **record_value,
+     libcerror_error_t **error )
+{
+	libfvalue_data_handle_t *value_data_handle = NULL;
+	static char *function                      = "libesedb_data_definition_read_tagged_data_type_value";
+	size_t tagged_data_type_size               = 0;
+	size_t tagged_data_type_value_offset       = 0;
+	uint16_t next_tagged_data_type_offset      = 0;
+	uint16_t tagged_data_type_identifier       = 0;
+	uint16_t tagged_data_type_offset           = 0;
+	uint16_t tagged_data_type_offset_bitmask   = 0x3fff;
+	uint8_t record_value_type                  = 0;
+	int encoding                               = 0;
+	int lower_index                            = 0;
+	int result                                 = 0;
+	int tagged_data_type_index                 = 0;
+	int upper_index                            = 0;
 
-					if( tagged_data_type_size > 0 )
-					{
-						if( tagged_data_type_size > remaining_definition_data_size )
-						{
-							libcerror_error_set(
-							 error,
-							 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-							 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-							 "%s: invalid tagged data type size value exceeds remaining data size.",
-							 function );
+	if( data_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data definition.",
+		 function );
 
-							goto on_error;
-						}
-						remaining_definition_data_size -= tagged_data_type_size;
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( column_catalog_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column catalog definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record value.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record_value != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record value value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_data_definition_get_record_value_type(
+	     io_handle,
+	     column_catalog_definition,
+	     &record_value_type,
+	     &encoding,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record value type.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfvalue_data_handle_initialize(
+	     &value_data_handle,
+	     (int (*)(libfvalue_data_handle_t *, const uint8_t *, size_t, int, uint32_t, libcerror_error_t **)) &libesedb_value_data_handle_read_value_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create value data handle.",
+		 function );
 
-						if( ( ( io_handle->format_revision >= LIBESEDB_FORMAT_REVISION_EXTENDED_PAGE_HEADER )
-						  &&  ( io_handle->page_size >= 16384 ) )
-						 || ( ( previous_tagged_data_type_offset & 0x4000 ) != 0 ) )
-						{
-							if( tagged_data_type_value_offset >= record_data_size )
-							{
-								libcerror_error_set(
-								 error,
-								 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-								 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-								 "%s: invalid tagged data type offset value out of bounds.",
-								 function );
-
-								goto on_error;
-							}
-							if( libfvalue_data_handle_set_data_flags(
-							     value_data_handle,
-							     (uint32_t) record_data[ tagged_data_type_value_offset ],
-							     error ) != 1 )
-							{
-								libcerror_error_set(
-								 error,
-								 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-								 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-								 "%s: unable to set tagged data type flags in tagged data type definition.",
-								 function );
-
-								goto on_error;
-							}
-							tagged_data_type_value_offset += 1;
-							tagged_data_type_size         -= 1;
-						}
-#if defined( HAVE_DEBUG_OUTPUT )
-						if( libcnotify_verbose != 0 )
-						{
-							libcnotify_printf(
-							 "%s: (%03" PRIu16 ") tagged data type:\n",
-							 function,
-							 column_catalog_definition->identifier );
+		goto on_error;
+	}
+	if( ( data_definition->tagged_data_types_data != NULL )
+	 && ( column_catalog_definition->identifier <= (uint32_t) UINT16_MAX ) )
+	{
+		lower_index = 0;
+		upper_index = (int) data_definition->number_of_tagged_data_types;
 
-							if( tagged_data_type_value_offset < record_data_size )
-							{
-								libcnotify_print_data(
-								 &( record_data[ tagged_data_type_value_offset ] ),
-								 tagged_data_type_size,
-								 0 );
-							}
-							else
-							{
-								libcnotify_printf(
-								 "<NULL>\n\n" );
-							}
-						}
-#endif /* defined( HAVE_DEBUG_OUTPUT ) */
-					}
-#if defined( HAVE_DEBUG_OUTPUT )
-					/* TODO are zero size tagged data type values handled correctly?
-					 */
-					else if( libcnotify_verbose != 0 )
-					{
-						libcnotify_printf(
-						 "%s: (%03" PRIu32 ") tagged data type\t\t\t: <NULL>\n",
-						 function,
-						 column_catalog_definition->identifier );
-					}
-#endif
-					if( tagged_data_type_size > 0 )
-					{
-						if( tagged_data_type_value_offset >= record_data_size )
-						{
-							libcerror_error_set(
-							 error,
-							 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-							 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-							 "%s: invalid tagged data type offset value out of bounds.",
-							 function );
+		if( data_definition->tagged_data_types_are_sorted != 0 )
+		{
+			while( lower_index < upper_index )
+			{
+				tagged_data_type_index = lower_index + ( ( upper_index - lower_index ) / 2 );
 
-							goto on_error;
-						}
-						if( tagged_data_type_size > ( record_data_size - tagged_data_type_value_offset ) )
-						{
-							libcerror_error_set(
-							 error,
-							 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-							 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
-							 "%s: invalid tagged data type size value out of bounds.",
-							 function );
+				byte_stream_copy_to_uint16_little_endian(
+				 &( data_definition->tagged_data_types_data[ tagged_data_type_index * 4 ] ),
+				 tagged_data_type_identifier );
 
-							goto on_error;
-						}
-						if( libfvalue_data_handle_set_data(
-						     value_data_handle,
-						     &( record_data[ tagged_data_type_value_offset ] ),
-						     tagged_data_type_size,
-						     encoding,
-						     LIBFVALUE_VALUE_DATA_FLAG_MANAGED,
-						     error ) != 1 )
-						{
-							libcerror_error_set(
-							 error,
-							 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-							 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-							 "%s: unable to set data in tagged data type definition.",
-							 function );
+				if( (uint32_t) tagged_data_type_identifier == column_catalog_definition->identifier )
+				{
+					result = 1;
 
-							goto on_error;
-						}
-					}
+					break;
+				}
+				else if( (uint32_t) tagged_data_type_identifier < column_catalog_definition->identifier )
+				{
+					lower_index = tagged_data_type_index + 1;
+				}
+				else
+				{
+					upper_index = tagged_data_type_index;
 				}
 			}
 		}
-		if( libfvalue_value_type_initialize_with_data_handle(
-		     &record_value,
-		     record_value_type,
-		     value_data_handle,
-		     LIBFVALUE_VALUE_FLAG_DATA_HANDLE_MANAGED,
-		     error ) != 1 )
+		else
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create record value.",
-			 function );
+			for( tagged_data_type_index = lower_index;
+			     tagged_data_type_index < upper_index;
+			     tagged_data_type_index++ )
+			{
+				byte_stream_copy_to_uint16_little_endian(
+				 &( data_definition->tagged_data_types_data[ tagged_data_type_index * 4 ] ),
+				 tagged_data_type_identifier );
 
-			goto on_error;
+				if( (uint32_t) tagged_data_type_identifier == column_catalog_definition->identifier )
+				{
+					result = 1;
+
+					break;
+				}
+			}
 		}
-		value_data_handle = NULL;
+	}
+	if( result != 0 )
+	{
+		if( io_handle->has_extended_page_header != 0 )
+		{
+			tagged_data_type_offset_bitmask = 0x7fff;
+		}
+		byte_stream_copy_to_uint16_little_endian(
+		 &( data_definition->tagged_data_types_data[ ( tagged_data_type_index * 4 ) + 2 ] ),
+		 tagged_data_type_offset );
 
-		if( libcdata_array_set_entry_by_index(
-		     values_array,
-		     column_catalog_definition_index,
-		     (intptr_t *) record_value,
-		     error ) != 1 )
+		tagged_data_type_value_offset = (size_t) ( tagged_data_type_offset & tagged_data_type_offset_bitmask );
+
+		/* The offsets were validated by libesedb_data_definition_set_tagged_data_types_data
+		 */
+		if( ( tagged_data_type_index + 1 ) < (int) data_definition->number_of_tagged_data_types )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_MEMORY,
-			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
-			 "%s: unable to set data type definition: %d.",
-			 function,
-			 column_catalog_definition_index );
+			byte_stream_copy_to_uint16_little_endian(
+			 &( data_definition->tagged_data_types_data[ ( tagged_data_type_index * 4 ) + 6 ] ),
+			 next_tagged_data_type_offset );
 
-			goto on_error;
+			tagged_data_type_size = (size_t) ( next_tagged_data_type_offset & tagged_data_type_offset_bitmask ) - tagged_data_type_value_offset;
+		}
+		else
+		{
+			tagged_data_type_size = data_definition->tagged_data_types_data_size - tagged_data_type_value_offset;
 		}
-		record_value = NULL;
-	}
 #if defined( HAVE_DEBUG_OUTPUT )
-	if( libcnotify_verbose != 0 )
-	{
-		if( fixed_size_data_type_value_offset < variable_size_data_types_offset )
+		if( libcnotify_verbose != 0 )
 		{
 			libcnotify_printf(
-			 "%s: fixed size data types trailing data:\n",
-			 function );
-			libcnotify_print_data(
-			 &( record_data[ fixed_size_data_type_value_offset ] ),
-			 variable_size_data_types_offset - fixed_size_data_type_value_offset,
-			 0 );
+			 "%s: (%03" PRIu32 ") tagged data type offset\t\t: 0x%04" PRIx16 " (%" PRIzd ")\n",
+			 function,
+			 column_catalog_definition->identifier,
+			 tagged_data_type_offset,
+			 tagged_data_type_value_offset );
+
+			libcnotify_printf(
+			 "%s: (%03" PRIu32 ") tagged data type size\t\t: %" PRIzd "\n",
+			 function,
+			 column_catalog_definition->identifier,
+			 tagged_data_type_size );
 		}
-		libcnotify_printf(
-		 "\n" );
-	}
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
 
-	return( 1 );
+		if( tagged_data_type_size > 0 )
+		{
+			if( ( tagged_data_type_offset_bitmask == 0x7fff )
+			 || ( ( tagged_data_type_offset & 0x4000 ) != 0 ) )
+			{
+				if( libfvalue_data_handle_set_data_flags(
+				     value_data_handle,
+				     (uint32_t) data_definition->tagged_data_types_data[ tagged_data_type_value_offset ],
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to set tagged data type flags in tagged data type definition.",
+					 function );
 
-on_error:
-	if( record_value != NULL )
+					goto on_error;
+				}
+				tagged_data_type_value_offset += 1;
+				tagged_data_type_size         -= 1;
+			}
+		}
+		if( tagged_data_type_size > 0 )
+		{
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "%s: (%03" PRIu32 ") tagged data type:\n",
+				 function,
+				 column_catalog_definition->identifier );
+				libcnotify_print_data(
+				 &( data_definition->tagged_data_types_data[ tagged_data_type_value_offset ] ),
+				 tagged_data_type_size,
+				 0 );
+			}
+#endif /* defined( HAVE_DEBUG_OUTPUT ) */
+
+			if( libfvalue_data_handle_set_data(
+			     value_data_handle,
+			     &( data_definition->tagged_data_types_data[ tagged_data_type_value_offset ] ),
+			     tagged_data_type_size,
+			     encoding,
+			     LIBFVALUE_VALUE_DATA_FLAG_MANAGED,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+				 "%s: unable to set data in tagged data type definition.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+	if( libfvalue_value_type_initialize_with_data_handle(
+	     record_value,
+	     record_value_type,
+	     value_data_handle,
+	     LIBFVALUE_VALUE_FLAG_DATA_HANDLE_MANAGED,
+	     error ) != 1 )
 	{
-		libfvalue_value_free(
-		 &record_value,
-		 NULL );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record value.",
+		 function );
+
+		goto on_error;
 	}
+	return( 1 );
+
+on_error:
 	if( value_data_handle != NULL )
 	{
 		libfvalue_data_handle_free(
@@ -1579,8 +1941,7 @@ on_error:
 int libesedb_data_definition_read_long_value(
      libesedb_data_definition_t *data_definition,
      libbfio_handle_t *file_io_handle,
-     libfdata_vector_t *pages_vector,
-     libfcache_cache_t *pages_cache,
+     libesedb_page_cache_t *page_cache,
      libcerror_error_t **error )
 {
 	libesedb_page_t *page             = NULL;
@@ -1588,7 +1949,6 @@ int libesedb_data_definition_read_long_value(
 	uint8_t *long_value_data          = NULL;
 	static char *function             = "libesedb_data_definition_read_long_value";
 	size_t long_value_data_size       = 0;
-	off64_t element_data_offset       = 0;
 	uint32_t value_32bit              = 0;
 	uint16_t data_offset              = 0;
 
@@ -1603,14 +1963,11 @@ int libesedb_data_definition_read_long_value(
 
 		return( -1 );
 	}
-	if( libfdata_vector_get_element_value_at_offset(
-	     pages_vector,
-	     (intptr_t *) file_io_handle,
-	     (libfdata_cache_t *) pages_cache,
-	     data_definition->page_offset,
-	     &element_data_offset,
-	     (intptr_t **) &page,
-	     0,
+	if( libesedb_page_cache_get_page(
+	     page_cache,
+	     file_io_handle,
+	     data_definition->page_number,
+	     &page,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -1633,7 +1990,7 @@ int libesedb_data_definition_read_long_value(
 		 "%s: missing page.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( libesedb_page_get_value_by_index(
 	     page,
@@ -1649,7 +2006,7 @@ int libesedb_data_definition_read_long_value(
 		 function,
 		 data_definition->page_value_index );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( page_value == NULL )
 	{
@@ -1661,7 +2018,7 @@ int libesedb_data_definition_read_long_value(
 		 function,
 		 data_definition->page_value_index );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( page_value->data == NULL )
 	{
@@ -1672,7 +2029,7 @@ int libesedb_data_definition_read_long_value(
 		 "%s: missing page value data.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 	data_offset = data_definition->data_offset - page_value->offset;
 
@@ -1686,7 +2043,7 @@ int libesedb_data_definition_read_long_value(
 		 "%s: invalid data definition - data offset value out of bounds.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 	long_value_data      = &( page_value->data[ data_offset ] );
 	long_value_data_size = page_value->size - data_offset;
@@ -1701,7 +2058,7 @@ int libesedb_data_definition_read_long_value(
 		 function,
 		 long_value_data_size );
 
-		return( -1 );
+		goto on_error;
 	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
@@ -1748,7 +2105,32 @@ int libesedb_data_definition_read_long_value(
 		 "\n" );
 	}
 #endif
+	if( libesedb_page_cache_release_page(
+	     page_cache,
+	     &page,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release page: %" PRIu32 ".",
+		 function,
+		 data_definition->page_number );
+
+		goto on_error;
+	}
 	return( 1 );
+
+on_error:
+	if( page != NULL )
+	{
+		libesedb_page_cache_release_page(
+		 page_cache,
+		 &page,
+		 NULL );
+	}
+	return( -1 );
 }
 
 /* Reads the long value segment
@@ -1758,8 +2140,7 @@ int libesedb_data_definition_read_long_value_segment(
      libesedb_data_definition_t *data_definition,
      libbfio_handle_t *file_io_handle,
      libesedb_io_handle_t *io_handle,
-     libfdata_vector_t *pages_vector,
-     libfcache_cache_t *pages_cache,
+     libesedb_page_cache_t *page_cache,
      uint32_t long_value_segment_offset,
      libfdata_list_t *data_segments_list,
      libcerror_error_t **error )
@@ -1767,7 +2148,6 @@ int libesedb_data_definition_read_long_value_segment(
 	libesedb_page_t *page                  = NULL;
 	libesedb_page_value_t *page_value      = NULL;
 	static char *function                  = "libesedb_data_definition_read_long_value_segment";
-	off64_t element_data_offset            = 0;
 	off64_t long_value_segment_data_offset = 0;
 	size64_t data_size                     = 0;
 	size_t long_value_segment_data_size    = 0;
@@ -1796,14 +2176,11 @@ int libesedb_data_definition_read_long_value_segment(
 
 		return( -1 );
 	}
-	if( libfdata_vector_get_element_value_at_offset(
-	     pages_vector,
-	     (intptr_t *) file_io_handle,
-	     (libfdata_cache_t *) pages_cache,
-	     data_definition->page_offset,
-	     &element_data_offset,
-	     (intptr_t **) &page,
-	     0,
+	if( libesedb_page_cache_get_page(
+	     page_cache,
+	     file_io_handle,
+	     data_definition->page_number,
+	     &page,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -1826,7 +2203,7 @@ int libesedb_data_definition_read_long_value_segment(
 		 "%s: missing page.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( libesedb_page_get_value_by_index(
 	     page,
@@ -1842,7 +2219,7 @@ int libesedb_data_definition_read_long_value_segment(
 		 function,
 		 data_definition->page_value_index );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( page_value == NULL )
 	{
@@ -1854,7 +2231,7 @@ int libesedb_data_definition_read_long_value_segment(
 		 function,
 		 data_definition->page_value_index );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( page_value->data == NULL )
 	{
@@ -1865,7 +2242,7 @@ int libesedb_data_definition_read_long_value_segment(
 		 "%s: missing page value data.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 	data_offset = data_definition->data_offset - page_value->offset;
 
@@ -1879,7 +2256,7 @@ int libesedb_data_definition_read_long_value_segment(
 		 "%s: invalid data definition - data offset value out of bounds.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 	long_value_segment_data_size = page_value->size - data_offset;
 
@@ -1918,7 +2295,7 @@ int libesedb_data_definition_read_long_value_segment(
 		 "%s: unable to retrieve size of data segments list.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( long_value_segment_offset != (off64_t) data_size )
 	{
@@ -1931,7 +2308,7 @@ int libesedb_data_definition_read_long_value_segment(
 		 long_value_segment_offset,
 		 data_size );
 
-		return( -1 );
+		goto on_error;
 	}
 	if( libfdata_list_append_element(
 	     data_segments_list,
@@ -1950,8 +2327,33 @@ int libesedb_data_definition_read_long_value_segment(
 		 function,
 		 long_value_segment_offset );
 
-		return( -1 );
+		goto on_error;
+	}
+	if( libesedb_page_cache_release_page(
+	     page_cache,
+	     &page,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release page: %" PRIu32 ".",
+		 function,
+		 data_definition->page_number );
+
+		goto on_error;
 	}
 	return( 1 );
+
+on_error:
+	if( page != NULL )
+	{
+		libesedb_page_cache_release_page(
+		 page_cache,
+		 &page,
+		 NULL );
+	}
+	return( -1 );
 }
 
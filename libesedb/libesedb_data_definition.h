@@ -25,12 +25,15 @@
 #include <common.h>
 #include <types.h>
 
+#include "libesedb_catalog_definition.h"
 #include "libesedb_io_handle.h"
 #include "libesedb_libbfio.h"
 #include "libesedb_libcdata.h"
 #include "libesedb_libcerror.h"
-#include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
+#include "libesedb_libfvalue.h"
+#include "libesedb_page.h"
+#include "libesedb_page_cache.h"
 #include "libesedb_table_definition.h"
 
 #if defined( __cplusplus )
@@ -60,6 +63,22 @@ struct libesedb_data_definition
 	/* The data size
 	 */
 	uint16_t data_size;
+
+	/* The tagged data types data
+	 */
+	uint8_t *tagged_data_types_data;
+
+	/* The tagged data types data size
+	 */
+	size_t tagged_data_types_data_size;
+
+	/* The number of tagged data types
+	 */
+	uint16_t number_of_tagged_data_types;
+
+	/* Value to indicate the tagged data types are sorted by identifier
+	 */
+	uint8_t tagged_data_types_are_sorted;
 };
 
 int libesedb_data_definition_initialize(
@@ -74,37 +93,55 @@ int libesedb_data_definition_read_data(
      libesedb_data_definition_t *data_definition,
      libbfio_handle_t *file_io_handle,
      libesedb_io_handle_t *io_handle,
-     libfdata_vector_t *pages_vector,
-     libfcache_cache_t *pages_cache,
+     libesedb_page_cache_t *page_cache,
+     libesedb_page_t **page,
      uint8_t **data,
      size_t *data_size,
      libcerror_error_t **error );
 
+int libesedb_data_definition_get_record_value_type(
+     libesedb_io_handle_t *io_handle,
+     libesedb_catalog_definition_t *column_catalog_definition,
+     uint8_t *record_value_type,
+     int *encoding,
+     libcerror_error_t **error );
+
 int libesedb_data_definition_read_record(
      libesedb_data_definition_t *data_definition,
      libbfio_handle_t *file_io_handle,
      libesedb_io_handle_t *io_handle,
-     libfdata_vector_t *pages_vector,
-     libfcache_cache_t *pages_cache,
+     libesedb_page_cache_t *page_cache,
      libesedb_table_definition_t *table_definition,
      libesedb_table_definition_t *template_table_definition,
      libcdata_array_t *values_array,
      uint8_t *record_flags,
      libcerror_error_t **error );
 
+int libesedb_data_definition_set_tagged_data_types_data(
+     libesedb_data_definition_t *data_definition,
+     libesedb_io_handle_t *io_handle,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libesedb_data_definition_read_tagged_data_type_value(
+     libesedb_data_definition_t *data_definition,
+     libesedb_io_handle_t *io_handle,
+     libesedb_catalog_definition_t *column_catalog_definition,
+     libfvalue_value_t **record_value,
+     libcerror_error_t **error );
+
 int libesedb_data_definition_read_long_value(
      libesedb_data_definition_t *data_definition,
      libbfio_handle_t *file_io_handle,
-     libfdata_vector_t *pages_vector,
-     libfcache_cache_t *pages_cache,
+     libesedb_page_cache_t *page_cache,
      libcerror_error_t **error );
 
 int libesedb_data_definition_read_long_value_segment(
      libesedb_data_definition_t *data_definition,
      libbfio_handle_t *file_io_handle,
      libesedb_io_handle_t *io_handle,
-     libfdata_vector_t *pages_vector,
-     libfcache_cache_t *pages_cache,
+     libesedb_page_cache_t *page_cache,
      uint32_t long_value_segment_offset,
      libfdata_list_t *data_segments_list,
      libcerror_error_t **error );
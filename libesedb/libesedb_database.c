@@ -29,10 +29,9 @@
 #include "libesedb_libbfio.h"
 #include "libesedb_libcerror.h"
 #include "libesedb_libcnotify.h"
-#include "libesedb_libfcache.h"
-#include "libesedb_libfdata.h"
 #include "libesedb_page.h"
 #include "libesedb_page_value.h"
+#include "libesedb_page_cache.h"
 #include "libesedb_page_tree.h"
 #include "libesedb_page_tree_value.h"
 
@@ -43,8 +42,7 @@
 int libesedb_database_initialize(
      libesedb_database_t **database,
      libesedb_io_handle_t *io_handle,
-     libfdata_vector_t *pages_vector,
-     libfcache_cache_t *pages_cache,
+     libesedb_page_cache_t *page_cache,
      libcerror_error_t **error )
 {
 	static char *function = "libesedb_database_initialize";
@@ -107,8 +105,7 @@ int libesedb_database_initialize(
 	if( libesedb_page_tree_initialize(
 	     &( ( *database )->page_tree ),
 	     io_handle,
-	     pages_vector,
-	     pages_cache,
+	     page_cache,
 	     LIBESEDB_FDP_OBJECT_IDENTIFIER_DATABASE,
 	     LIBESEDB_PAGE_NUMBER_DATABASE,
 	     NULL,
@@ -482,13 +479,11 @@ int libesedb_database_read_file_io_handle(
 
 			return( -1 );
 		}
-		if( libfdata_vector_get_element_value_by_index(
-		     database->page_tree->pages_vector,
-		     (intptr_t *) file_io_handle,
-		     (libfdata_cache_t *) database->page_tree->pages_cache,
-		     (int) leaf_page_number - 1,
-		     (intptr_t **) &page,
-		     0,
+		if( libesedb_page_cache_get_page(
+		     database->page_tree->page_cache,
+		     file_io_handle,
+		     leaf_page_number,
+		     &page,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -515,7 +510,7 @@ int libesedb_database_read_file_io_handle(
 			 function,
 			 leaf_page_number );
 
-			return( -1 );
+			goto on_error;
 		}
 		if( libesedb_page_get_next_page_number(
 		     page,
@@ -530,10 +525,34 @@ int libesedb_database_read_file_io_handle(
 			 function,
 			 leaf_page_number );
 
-			return( -1 );
+			goto on_error;
+		}
+		if( libesedb_page_cache_release_page(
+		     database->page_tree->page_cache,
+		     &page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release page.",
+			 function );
+
+			goto on_error;
 		}
 		recursion_depth++;
 	}
 	return( 1 );
+
+on_error:
+	if( page != NULL )
+	{
+		libesedb_page_cache_release_page(
+		 database->page_tree->page_cache,
+		 &page,
+		 NULL );
+	}
+	return( -1 );
 }
 
@@ -28,8 +28,7 @@
 #include "libesedb_io_handle.h"
 #include "libesedb_libbfio.h"
 #include "libesedb_libcerror.h"
-#include "libesedb_libfcache.h"
-#include "libesedb_libfdata.h"
+#include "libesedb_page_cache.h"
 #include "libesedb_page_tree.h"
 
 #if defined( __cplusplus )
@@ -48,8 +47,7 @@ struct libesedb_database
 int libesedb_database_initialize(
      libesedb_database_t **database,
      libesedb_io_handle_t *io_handle,
-     libfdata_vector_t *pages_vector,
-     libfcache_cache_t *pages_cache,
+     libesedb_page_cache_t *page_cache,
      libcerror_error_t **error );
 
 int libesedb_database_free(
@@ -36,9 +36,10 @@
 #include "libesedb_libbfio.h"
 #include "libesedb_libcerror.h"
 #include "libesedb_libcnotify.h"
-#include "libesedb_libfcache.h"
-#include "libesedb_libfdata.h"
+#include "libesedb_libcthreads.h"
+#include "libesedb_metadata_cache.h"
 #include "libesedb_page.h"
+#include "libesedb_page_cache.h"
 #include "libesedb_table.h"
 #include "libesedb_table_definition.h"
 
@@ -131,6 +132,21 @@ int libesedb_file_initialize(
 
 		goto on_error;
 	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( internal_file->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
 	*file = (libesedb_file_t *) internal_file;
 
 	return( 1 );
@@ -207,6 +223,26 @@ int libesedb_file_free(
 
 			result = -1;
 		}
+		if( internal_file->metadata_cache_data != NULL )
+		{
+			memory_free(
+			 internal_file->metadata_cache_data );
+		}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( internal_file->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
 		memory_free(
 		 internal_file );
 	}
@@ -545,6 +581,7 @@ int libesedb_file_open_file_io_handle(
 	static char *function                   = "libesedb_file_open_file_io_handle";
 	int bfio_access_flags                   = 0;
 	int file_io_handle_is_open              = 0;
+	int result                              = 0;
 
 	if( file == NULL )
 	{
@@ -597,6 +634,14 @@ int libesedb_file_open_file_io_handle(
 	{
 		bfio_access_flags = LIBBFIO_ACCESS_FLAG_READ;
 	}
+	if( ( access_flags & LIBESEDB_ACCESS_FLAG_LAZY_CATALOG ) != 0 )
+	{
+		internal_file->read_catalog_on_demand = 1;
+	}
+	else
+	{
+		internal_file->read_catalog_on_demand = 0;
+	}
 	file_io_handle_is_open = libbfio_handle_is_open(
 	                          file_io_handle,
 	                          error );
@@ -630,10 +675,27 @@ int libesedb_file_open_file_io_handle(
 		}
 		internal_file->file_io_handle_opened_in_library = 1;
 	}
-	if( libesedb_file_open_read(
-	     internal_file,
-	     file_io_handle,
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
 	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	result = libesedb_file_open_read(
+	          internal_file,
+	          file_io_handle,
+	          error );
+
+	if( result != 1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -641,11 +703,30 @@ int libesedb_file_open_file_io_handle(
 		 LIBCERROR_IO_ERROR_READ_FAILED,
 		 "%s: unable to read from file handle.",
 		 function );
+	}
+	else
+	{
+		internal_file->file_io_handle = file_io_handle;
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
 
+		return( -1 );
+	}
+#endif
+	if( result != 1 )
+	{
 		goto on_error;
 	}
-	internal_file->file_io_handle = file_io_handle;
-
 	return( 1 );
 
 on_error:
@@ -696,6 +777,21 @@ int libesedb_file_close(
 
 		return( -1 );
 	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -751,7 +847,8 @@ int libesedb_file_close(
 		}
 		internal_file->file_io_handle_created_in_library = 0;
 	}
-	internal_file->file_io_handle = NULL;
+	internal_file->file_io_handle         = NULL;
+	internal_file->read_catalog_on_demand = 0;
 
 	if( libesedb_io_handle_clear(
 	     internal_file->io_handle,
@@ -766,41 +863,41 @@ int libesedb_file_close(
 
 		result = -1;
 	}
-	if( libfdata_vector_free(
-	     &( internal_file->pages_vector ),
+	if( libesedb_page_cache_free(
+	     &( internal_file->page_cache ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free pages vector.",
+		 "%s: unable to free page cache.",
 		 function );
 
 		result = -1;
 	}
-	if( libfcache_cache_free(
-	     &( internal_file->pages_cache ),
+	if( libesedb_database_free(
+	     &( internal_file->database ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free pages cache.",
+		 "%s: unable to free database.",
 		 function );
 
 		result = -1;
 	}
-	if( libesedb_database_free(
-	     &( internal_file->database ),
+	if( libesedb_internal_file_free_table_states(
+	     internal_file,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free database.",
+		 "%s: unable to free table states.",
 		 function );
 
 		result = -1;
@@ -818,19 +915,34 @@ int libesedb_file_close(
 
 		result = -1;
 	}
-	if( libesedb_catalog_free(
-	     &( internal_file->backup_catalog ),
+	if( libesedb_metadata_cache_free(
+	     &( internal_file->metadata_cache ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free backup catalog.",
+		 "%s: unable to free metadata cache.",
 		 function );
 
 		result = -1;
 	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
 	return( result );
 }
 
@@ -847,7 +959,6 @@ int libesedb_file_open_read(
 	size64_t file_size                  = 0;
 	off64_t file_offset                 = 0;
 	int result                          = 0;
-	int segment_index                   = 0;
 
 	if( internal_file == NULL )
 	{
@@ -871,57 +982,57 @@ int libesedb_file_open_read(
 
 		return( -1 );
 	}
-	if( internal_file->pages_vector != NULL )
+	if( internal_file->page_cache != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file - pages vector already set.",
+		 "%s: invalid file - page cache already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_file->pages_cache != NULL )
+	if( internal_file->database != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file - pages cache already set.",
+		 "%s: invalid file - database already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_file->database != NULL )
+	if( internal_file->catalog != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file - database already set.",
+		 "%s: invalid file - catalog already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_file->catalog != NULL )
+	if( internal_file->metadata_cache != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file - catalog already set.",
+		 "%s: invalid file - metadata cache already set.",
 		 function );
 
 		return( -1 );
 	}
-	if( internal_file->backup_catalog != NULL )
+	if( internal_file->table_states_array != NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid file - backup catalog already set.",
+		 "%s: invalid file - table states array already set.",
 		 function );
 
 		return( -1 );
@@ -983,6 +1094,22 @@ int libesedb_file_open_read(
 	internal_file->io_handle->page_size                = file_header->page_size;
 	internal_file->io_handle->creation_format_version  = file_header->creation_format_version;
 	internal_file->io_handle->creation_format_revision = file_header->creation_format_revision;
+	internal_file->io_handle->database_time            = file_header->database_time;
+
+	if( memory_copy(
+	     internal_file->io_handle->database_signature,
+	     file_header->database_signature,
+	     28 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy database signature.",
+		 function );
+
+		goto on_error;
+	}
 
 	if( libesedb_file_header_free(
 	     &file_header,
@@ -1203,6 +1330,11 @@ int libesedb_file_open_read(
 			}
 		}
 	}
+	if( ( internal_file->io_handle->format_revision >= LIBESEDB_FORMAT_REVISION_EXTENDED_PAGE_HEADER )
+	 && ( internal_file->io_handle->page_size >= 16384 ) )
+	{
+		internal_file->io_handle->has_extended_page_header = 1;
+	}
 	if( libesedb_io_handle_set_pages_data_range(
 	     internal_file->io_handle,
 	     file_size,
@@ -1217,58 +1349,63 @@ int libesedb_file_open_read(
 
 		goto on_error;
 	}
-/* TODO add clone function ? */
-	if( libfdata_vector_initialize(
-	     &( internal_file->pages_vector ),
-	     (size64_t) internal_file->io_handle->page_size,
-	     (intptr_t *) internal_file->io_handle,
-	     NULL,
-	     NULL,
-	     (int (*)(intptr_t *, intptr_t *, libfdata_vector_t *, libfdata_cache_t *, int, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libesedb_io_handle_read_page,
-	     NULL,
-	     LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
+	if( libesedb_page_cache_initialize(
+	     &( internal_file->page_cache ),
+	     internal_file->io_handle,
+	     LIBESEDB_MAXIMUM_CACHE_ENTRIES_PAGES,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create pages vector.",
+		 "%s: unable to create page cache.",
 		 function );
 
 		goto on_error;
 	}
-	if( libfdata_vector_append_segment(
-	     internal_file->pages_vector,
-	     &segment_index,
-	     0,
-	     internal_file->io_handle->pages_data_offset,
-	     internal_file->io_handle->pages_data_size,
-	     0,
+	if( libesedb_metadata_cache_initialize(
+	     &( internal_file->metadata_cache ),
+	     internal_file->io_handle,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-		 "%s: unable to append segment to pages vector.",
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create metadata cache.",
 		 function );
 
 		goto on_error;
 	}
-	if( libfcache_cache_initialize(
-	     &( internal_file->pages_cache ),
-	     LIBESEDB_MAXIMUM_CACHE_ENTRIES_PAGES,
-	     error ) != 1 )
+	/* A metadata cache that was read before the file was opened is only used
+	 * if it was written for this database file
+	 */
+	if( internal_file->metadata_cache_data != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create pages cache.",
-		 function );
+		result = libesedb_metadata_cache_read_data(
+		          internal_file->metadata_cache,
+		          internal_file->metadata_cache_data,
+		          internal_file->metadata_cache_data_size,
+		          error );
 
-		goto on_error;
+		memory_free(
+		 internal_file->metadata_cache_data );
+
+		internal_file->metadata_cache_data      = NULL;
+		internal_file->metadata_cache_data_size = 0;
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read metadata cache.",
+			 function );
+
+			goto on_error;
+		}
 	}
 	if( internal_file->io_handle->file_type == LIBESEDB_FILE_TYPE_DATABASE )
 	{
@@ -1282,8 +1419,7 @@ int libesedb_file_open_read(
 		if( libesedb_database_initialize(
 		     &( internal_file->database ),
 		     internal_file->io_handle,
-		     internal_file->pages_vector,
-		     internal_file->pages_cache,
+		     internal_file->page_cache,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -1320,8 +1456,7 @@ int libesedb_file_open_read(
 		     &( internal_file->catalog ),
 		     internal_file->io_handle,
 		     LIBESEDB_PAGE_NUMBER_CATALOG,
-		     internal_file->pages_vector,
-		     internal_file->pages_cache,
+		     internal_file->page_cache,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -1333,71 +1468,122 @@ int libesedb_file_open_read(
 
 			goto on_error;
 		}
-		if( libesedb_catalog_read_file_io_handle(
-		     internal_file->catalog,
-		     file_io_handle,
-		     error ) != 1 )
+		internal_file->catalog->read_on_demand = internal_file->read_catalog_on_demand;
+
+		/* The catalog is read from the metadata cache if it contains the catalog
+		 */
+		result = libesedb_catalog_read_metadata_cache(
+		          internal_file->catalog,
+		          internal_file->metadata_cache,
+		          error );
+
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_IO,
 			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read catalog.",
+			 "%s: unable to read catalog from metadata cache.",
 			 function );
 
 			goto on_error;
 		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		if( libcnotify_verbose != 0 )
+		else if( result == 0 )
 		{
-			libcnotify_printf(
-			 "Reading the backup catalog:\n" );
+			result = libesedb_catalog_read_file_io_handle(
+			          internal_file->catalog,
+			          file_io_handle,
+			          error );
 		}
-#endif
-		if( libesedb_catalog_initialize(
-		     &( internal_file->backup_catalog ),
-		     internal_file->io_handle,
-		     LIBESEDB_PAGE_NUMBER_CATALOG_BACKUP,
-		     internal_file->pages_vector,
-		     internal_file->pages_cache,
-		     error ) != 1 )
+		/* The backup catalog is not read when the catalog was not read because abort was signalled
+		 */
+		if( ( result != 1 )
+		 && ( internal_file->io_handle->abort != 0 ) )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create backup catalog.",
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read catalog.",
 			 function );
 
 			goto on_error;
 		}
-		if( libesedb_catalog_read_file_io_handle(
-		     internal_file->backup_catalog,
-		     file_io_handle,
-		     error ) != 1 )
+		else if( result != 1 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_IO,
-			 LIBCERROR_IO_ERROR_READ_FAILED,
-			 "%s: unable to read backup catalog.",
-			 function );
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( ( libcnotify_verbose != 0 )
+			 && ( error != NULL )
+			 && ( *error != NULL ) )
+			{
+				libcnotify_print_error_backtrace(
+				 *error );
+			}
+#endif
+			libcerror_error_free(
+			 error );
 
-			goto on_error;
+			if( libesedb_catalog_free(
+			     &( internal_file->catalog ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free catalog.",
+				 function );
+
+				goto on_error;
+			}
+			/* The backup catalog is only read when the catalog is unreadable
+			 */
+#if defined( HAVE_DEBUG_OUTPUT )
+			if( libcnotify_verbose != 0 )
+			{
+				libcnotify_printf(
+				 "Reading the backup catalog:\n" );
+			}
+#endif
+			if( libesedb_catalog_initialize(
+			     &( internal_file->catalog ),
+			     internal_file->io_handle,
+			     LIBESEDB_PAGE_NUMBER_CATALOG_BACKUP,
+			     internal_file->page_cache,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+				 "%s: unable to create backup catalog.",
+				 function );
+
+				goto on_error;
+			}
+			internal_file->catalog->read_on_demand = internal_file->read_catalog_on_demand;
+
+			if( libesedb_catalog_read_file_io_handle(
+			     internal_file->catalog,
+			     file_io_handle,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read catalog and backup catalog.",
+				 function );
+
+				goto on_error;
+			}
 		}
-/* TODO compare contents of catalogs ? */
 	}
 	internal_file->io_handle->abort = 0;
 
 	return( 1 );
 
 on_error:
-	if( internal_file->backup_catalog != NULL )
-	{
-		libesedb_catalog_free(
-		 &( internal_file->backup_catalog ),
-		 NULL );
-	}
 	if( internal_file->catalog != NULL )
 	{
 		libesedb_catalog_free(
@@ -1410,16 +1596,16 @@ on_error:
 		 &( internal_file->database ),
 		 NULL );
 	}
-	if( internal_file->pages_cache != NULL )
+	if( internal_file->metadata_cache != NULL )
 	{
-		libfcache_cache_free(
-		 &( internal_file->pages_cache ),
+		libesedb_metadata_cache_free(
+		 &( internal_file->metadata_cache ),
 		 NULL );
 	}
-	if( internal_file->pages_vector != NULL )
+	if( internal_file->page_cache != NULL )
 	{
-		libfdata_vector_free(
-		 &( internal_file->pages_vector ),
+		libesedb_page_cache_free(
+		 &( internal_file->page_cache ),
 		 NULL );
 	}
 	if( file_header != NULL )
@@ -1433,18 +1619,21 @@ on_error:
 	return( -1 );
 }
 
-/* Retrieves the file type
- * Returns 1 if successful or -1 on error
+/* Reads the metadata cache from a file IO handle
+ * If the file is not open the metadata cache data is kept until the file is opened
+ * Returns 1 if successful, 0 if the metadata cache does not exist or does not match or -1 on error
  */
-int libesedb_file_get_type(
-     libesedb_file_t *file,
-     uint32_t *type,
+int libesedb_internal_file_read_metadata_cache_file_io_handle(
+     libesedb_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
      libcerror_error_t **error )
 {
-	libesedb_internal_file_t *internal_file = NULL;
-	static char *function                   = "libesedb_file_get_type";
+	uint8_t *data         = NULL;
+	static char *function = "libesedb_internal_file_read_metadata_cache_file_io_handle";
+	size_t data_size      = 0;
+	int result            = 0;
 
-	if( file == NULL )
+	if( internal_file == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -1455,110 +1644,202 @@ int libesedb_file_get_type(
 
 		return( -1 );
 	}
-	internal_file = (libesedb_internal_file_t *) file;
+	result = libbfio_handle_exists(
+	          file_io_handle,
+	          error );
 
-	if( internal_file->io_handle == NULL )
+	if( result == -1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_GENERIC,
+		 "%s: unable to determine if metadata cache exists.",
 		 function );
 
 		return( -1 );
 	}
-	if( type == NULL )
+	else if( result == 0 )
+	{
+		return( 0 );
+	}
+	if( libbfio_handle_open(
+	     file_io_handle,
+	     LIBBFIO_OPEN_READ,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid type.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open metadata cache.",
 		 function );
 
 		return( -1 );
 	}
-	*type = internal_file->io_handle->file_type;
-
-	return( 1 );
-}
-
-/* Retrieves the file (current) version
- * Returns 1 if successful or -1 on error
- */
-int libesedb_file_get_format_version(
-     libesedb_file_t *file,
-     uint32_t *format_version,
-     uint32_t *format_revision,
-     libcerror_error_t **error )
-{
-	libesedb_internal_file_t *internal_file = NULL;
-	static char *function                   = "libesedb_file_get_format_version";
-
-	if( file == NULL )
+	if( internal_file->metadata_cache != NULL )
 	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		result = libesedb_metadata_cache_read_file_io_handle(
+		          internal_file->metadata_cache,
+		          file_io_handle,
+		          error );
+	}
+	else
+	{
+		result = libesedb_metadata_cache_read_data_from_file_io_handle(
+		          file_io_handle,
+		          &data,
+		          &data_size,
+		          error );
+
+		if( result == 1 )
+		{
+			if( internal_file->metadata_cache_data != NULL )
+			{
+				memory_free(
+				 internal_file->metadata_cache_data );
+			}
+			internal_file->metadata_cache_data      = data;
+			internal_file->metadata_cache_data_size = data_size;
+		}
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read metadata cache.",
+		 function );
+	}
+	if( libbfio_handle_close(
+	     file_io_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close metadata cache.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
+/* Writes the metadata cache to a file IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_internal_file_write_metadata_cache_file_io_handle(
+     libesedb_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_internal_file_write_metadata_cache_file_io_handle";
+	int result            = 1;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
 		 "%s: invalid file.",
 		 function );
 
 		return( -1 );
 	}
-	internal_file = (libesedb_internal_file_t *) file;
-
-	if( internal_file->io_handle == NULL )
+	if( internal_file->metadata_cache == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing IO handle.",
+		 "%s: invalid file - missing metadata cache.",
 		 function );
 
 		return( -1 );
 	}
-	if( format_version == NULL )
+	if( internal_file->catalog != NULL )
+	{
+		if( libesedb_catalog_write_metadata_cache(
+		     internal_file->catalog,
+		     internal_file->file_io_handle,
+		     internal_file->metadata_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to store catalog in metadata cache.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libbfio_handle_open(
+	     file_io_handle,
+	     LIBBFIO_OPEN_WRITE_TRUNCATE,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid format version.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open metadata cache.",
 		 function );
 
 		return( -1 );
 	}
-	if( format_revision == NULL )
+	if( libesedb_metadata_cache_write_file_io_handle(
+	     internal_file->metadata_cache,
+	     file_io_handle,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid format revision.",
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write metadata cache.",
 		 function );
 
-		return( -1 );
+		result = -1;
 	}
-	*format_version  = internal_file->io_handle->format_version;
-	*format_revision = internal_file->io_handle->format_revision;
+	if( libbfio_handle_close(
+	     file_io_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close metadata cache.",
+		 function );
 
-	return( 1 );
+		result = -1;
+	}
+	return( result );
 }
 
-/* Retrieves the file creation format version
- * Returns 1 if successful or -1 on error
+/* Reads a metadata cache file
+ * The metadata cache contains the catalog and the leaf page descriptors of the tables that were read before
+ * and is only used if it was written for the same unmodified database file
+ * If the file is not open the metadata cache is used when the file is opened,
+ * which allows the catalog to be read from the metadata cache instead of the catalog pages
+ * Returns 1 if successful, 0 if the metadata cache does not exist or does not match or -1 on error
  */
-int libesedb_file_get_creation_format_version(
+int libesedb_file_read_metadata_cache(
      libesedb_file_t *file,
-     uint32_t *format_version,
-     uint32_t *format_revision,
+     const char *filename,
      libcerror_error_t **error )
 {
+	libbfio_handle_t *file_io_handle        = NULL;
 	libesedb_internal_file_t *internal_file = NULL;
-	static char *function                   = "libesedb_file_get_creation_format_version";
+	static char *function                   = "libesedb_file_read_metadata_cache";
+	size_t filename_length                  = 0;
+	int result                              = 0;
 
 	if( file == NULL )
 	{
@@ -1573,55 +1854,136 @@ int libesedb_file_get_creation_format_version(
 	}
 	internal_file = (libesedb_internal_file_t *) file;
 
-	if( internal_file->io_handle == NULL )
+	if( filename == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
 		 function );
 
 		return( -1 );
 	}
-	if( format_version == NULL )
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid format version.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	if( format_revision == NULL )
+	filename_length = narrow_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name(
+	     file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid format revision.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in file IO handle.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	*format_version  = internal_file->io_handle->creation_format_version;
-	*format_revision = internal_file->io_handle->creation_format_revision;
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
 
-	return( 1 );
+		goto on_error;
+	}
+#endif
+	result = libesedb_internal_file_read_metadata_cache_file_io_handle(
+	          internal_file,
+	          file_io_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read metadata cache.",
+		 function );
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		result = -1;
+	}
+#endif
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
 }
 
-/* Retrieves the file page size
- * Returns 1 if successful or -1 on error
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Reads a metadata cache file
+ * The metadata cache contains the catalog and the leaf page descriptors of the tables that were read before
+ * and is only used if it was written for the same unmodified database file
+ * If the file is not open the metadata cache is used when the file is opened,
+ * which allows the catalog to be read from the metadata cache instead of the catalog pages
+ * Returns 1 if successful, 0 if the metadata cache does not exist or does not match or -1 on error
  */
-int libesedb_file_get_page_size(
+int libesedb_file_read_metadata_cache_wide(
      libesedb_file_t *file,
-     uint32_t *page_size,
+     const wchar_t *filename,
      libcerror_error_t **error )
 {
+	libbfio_handle_t *file_io_handle        = NULL;
 	libesedb_internal_file_t *internal_file = NULL;
-	static char *function                   = "libesedb_file_get_page_size";
+	static char *function                   = "libesedb_file_read_metadata_cache_wide";
+	size_t filename_length                  = 0;
+	int result                              = 0;
 
 	if( file == NULL )
 	{
@@ -1636,90 +1998,1477 @@ int libesedb_file_get_page_size(
 	}
 	internal_file = (libesedb_internal_file_t *) file;
 
-	if( internal_file->io_handle == NULL )
+	if( filename == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid file - missing IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
 		 function );
 
 		return( -1 );
 	}
-	if( page_size == NULL )
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	filename_length = wide_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name_wide(
+	     file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	result = libesedb_internal_file_read_metadata_cache_file_io_handle(
+	          internal_file,
+	          file_io_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read metadata cache.",
+		 function );
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		result = -1;
+	}
+#endif
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Writes a metadata cache file
+ * The metadata cache contains the catalog and the leaf page descriptors of the tables that were fully read
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_file_write_metadata_cache(
+     libesedb_file_t *file,
+     const char *filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle        = NULL;
+	libesedb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libesedb_file_write_metadata_cache";
+	size_t filename_length                  = 0;
+	int result                              = 1;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libesedb_internal_file_t *) file;
+
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	filename_length = narrow_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name(
+	     file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	result = libesedb_internal_file_write_metadata_cache_file_io_handle(
+	          internal_file,
+	          file_io_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write metadata cache.",
+		 function );
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		result = -1;
+	}
+#endif
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Writes a metadata cache file
+ * The metadata cache contains the catalog and the leaf page descriptors of the tables that were fully read
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_file_write_metadata_cache_wide(
+     libesedb_file_t *file,
+     const wchar_t *filename,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle        = NULL;
+	libesedb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libesedb_file_write_metadata_cache_wide";
+	size_t filename_length                  = 0;
+	int result                              = 1;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libesedb_internal_file_t *) file;
+
+	if( filename == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid filename.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_file_initialize(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	filename_length = wide_string_length(
+	                   filename );
+
+	if( libbfio_file_set_name_wide(
+	     file_io_handle,
+	     filename,
+	     filename_length + 1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set filename in file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	result = libesedb_internal_file_write_metadata_cache_file_io_handle(
+	          internal_file,
+	          file_io_handle,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write metadata cache.",
+		 function );
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		result = -1;
+	}
+#endif
+	if( libbfio_handle_free(
+	     &file_io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( result );
+
+on_error:
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+/* Retrieves the file type
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_file_get_type(
+     libesedb_file_t *file,
+     uint32_t *type,
+     libcerror_error_t **error )
+{
+	libesedb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libesedb_file_get_type";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libesedb_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( type == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid type.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*type = internal_file->io_handle->file_type;
+
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the file (current) version
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_file_get_format_version(
+     libesedb_file_t *file,
+     uint32_t *format_version,
+     uint32_t *format_revision,
+     libcerror_error_t **error )
+{
+	libesedb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libesedb_file_get_format_version";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libesedb_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( format_version == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid format version.",
+		 function );
+
+		return( -1 );
+	}
+	if( format_revision == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid format revision.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*format_version  = internal_file->io_handle->format_version;
+	*format_revision = internal_file->io_handle->format_revision;
+
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the file creation format version
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_file_get_creation_format_version(
+     libesedb_file_t *file,
+     uint32_t *format_version,
+     uint32_t *format_revision,
+     libcerror_error_t **error )
+{
+	libesedb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libesedb_file_get_creation_format_version";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libesedb_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( format_version == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid format version.",
+		 function );
+
+		return( -1 );
+	}
+	if( format_revision == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid format revision.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*format_version  = internal_file->io_handle->creation_format_version;
+	*format_revision = internal_file->io_handle->creation_format_revision;
+
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the file page size
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_file_get_page_size(
+     libesedb_file_t *file,
+     uint32_t *page_size,
+     libcerror_error_t **error )
+{
+	libesedb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libesedb_file_get_page_size";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libesedb_internal_file_t *) file;
+
+	if( internal_file->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid file - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*page_size = internal_file->io_handle->page_size;
+
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Retrieves the number of tables
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_file_get_number_of_tables(
+     libesedb_file_t *file,
+     int *number_of_tables,
+     libcerror_error_t **error )
+{
+	libesedb_internal_file_t *internal_file = NULL;
+	static char *function                   = "libesedb_file_get_number_of_tables";
+	int result                              = 1;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libesedb_internal_file_t *) file;
+
+	if( number_of_tables == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of tables.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( internal_file->catalog == NULL )
+	{
+		*number_of_tables = 0;
+	}
+	else if( libesedb_catalog_get_number_of_table_definitions(
+	          internal_file->catalog,
+	          number_of_tables,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of tables.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Frees the table states
+ * Table states that are still referenced by a table are freed when the table is freed
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_internal_file_free_table_states(
+     libesedb_internal_file_t *internal_file,
+     libcerror_error_t **error )
+{
+	libesedb_table_state_t *table_state = NULL;
+	static char *function               = "libesedb_internal_file_free_table_states";
+	int entry_index                     = 0;
+	int number_of_entries               = 0;
+	int result                          = 1;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->table_states_array == NULL )
+	{
+		return( 1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_file->table_states_array,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries from table states array.",
+		 function );
+
+		return( -1 );
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_file->table_states_array,
+		     entry_index,
+		     (intptr_t **) &table_state,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve table state: %d.",
+			 function,
+			 entry_index );
+
+			result = -1;
+
+			continue;
+		}
+		if( libesedb_table_state_detach(
+		     &table_state,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to detach table state: %d.",
+			 function,
+			 entry_index );
+
+			result = -1;
+		}
+	}
+	if( libcdata_array_free(
+	     &( internal_file->table_states_array ),
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free table states array.",
+		 function );
+
+		result = -1;
+	}
+	internal_file->number_of_table_states = 0;
+	internal_file->table_state_counter    = 0;
+
+	return( result );
+}
+
+/* Frees the least recently referenced table state that is not referenced by a table
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns 1 if successful, 0 if all table states are referenced or -1 on error
+ */
+int libesedb_internal_file_free_unreferenced_table_state(
+     libesedb_internal_file_t *internal_file,
+     libcerror_error_t **error )
+{
+	libesedb_table_state_t *table_state = NULL;
+	static char *function               = "libesedb_internal_file_free_unreferenced_table_state";
+	uint64_t last_referenced            = 0;
+	int entry_index                     = 0;
+	int free_entry_index                = -1;
+	int number_of_entries               = 0;
+	int number_of_references            = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     internal_file->table_states_array,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries from table states array.",
+		 function );
+
+		return( -1 );
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     internal_file->table_states_array,
+		     entry_index,
+		     (intptr_t **) &table_state,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve table state: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		if( table_state == NULL )
+		{
+			continue;
+		}
+		if( libesedb_table_state_get_number_of_references(
+		     table_state,
+		     &number_of_references,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of references of table state: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		if( ( number_of_references == 0 )
+		 && ( ( free_entry_index == -1 )
+		  || ( table_state->last_referenced < last_referenced ) ) )
+		{
+			free_entry_index = entry_index;
+			last_referenced  = table_state->last_referenced;
+		}
+	}
+	if( free_entry_index == -1 )
+	{
+		return( 0 );
+	}
+	if( libcdata_array_get_entry_by_index(
+	     internal_file->table_states_array,
+	     free_entry_index,
+	     (intptr_t **) &table_state,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve table state: %d.",
+		 function,
+		 free_entry_index );
+
+		return( -1 );
+	}
+	if( libcdata_array_set_entry_by_index(
+	     internal_file->table_states_array,
+	     free_entry_index,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set table state: %d.",
+		 function,
+		 free_entry_index );
+
+		return( -1 );
+	}
+	internal_file->number_of_table_states -= 1;
+
+	if( libesedb_table_state_detach(
+	     &table_state,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free table state: %d.",
+		 function,
+		 free_entry_index );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the table state of a specific table definition
+ * The table state is created if the file does not retain it and a reference is added to it
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_internal_file_get_table_state(
+     libesedb_internal_file_t *internal_file,
+     libesedb_table_definition_t *table_definition,
+     libesedb_table_definition_t *template_table_definition,
+     libesedb_table_state_t **table_state,
+     libcerror_error_t **error )
+{
+	libesedb_table_state_t *safe_table_state = NULL;
+	static char *function                    = "libesedb_internal_file_get_table_state";
+	int number_of_table_definitions          = 0;
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table state.",
+		 function );
+
+		return( -1 );
+	}
+	if( internal_file->table_states_array == NULL )
+	{
+		if( libesedb_catalog_get_number_of_table_definitions(
+		     internal_file->catalog,
+		     &number_of_table_definitions,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve number of table definitions.",
+			 function );
+
+			return( -1 );
+		}
+		if( libcdata_array_initialize(
+		     &( internal_file->table_states_array ),
+		     number_of_table_definitions,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create table states array.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libcdata_array_get_entry_by_index(
+	     internal_file->table_states_array,
+	     table_definition->table_definition_index,
+	     (intptr_t **) &safe_table_state,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve table state: %d.",
+		 function,
+		 table_definition->table_definition_index );
+
+		return( -1 );
+	}
+	if( safe_table_state == NULL )
+	{
+		if( internal_file->number_of_table_states >= LIBESEDB_MAXIMUM_CACHE_ENTRIES_TABLE_STATES )
+		{
+			if( libesedb_internal_file_free_unreferenced_table_state(
+			     internal_file,
+			     error ) == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free unreferenced table state.",
+				 function );
+
+				return( -1 );
+			}
+		}
+		if( libesedb_table_state_initialize(
+		     &safe_table_state,
+		     internal_file->io_handle,
+		     table_definition,
+		     template_table_definition,
+		     internal_file->metadata_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create table state.",
+			 function );
+
+			return( -1 );
+		}
+		if( libcdata_array_set_entry_by_index(
+		     internal_file->table_states_array,
+		     table_definition->table_definition_index,
+		     (intptr_t *) safe_table_state,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set table state: %d.",
+			 function,
+			 table_definition->table_definition_index );
+
+			libesedb_table_state_free(
+			 &safe_table_state,
+			 NULL );
+
+			return( -1 );
+		}
+		internal_file->number_of_table_states += 1;
+	}
+	internal_file->table_state_counter += 1;
+
+	if( libesedb_table_state_reference(
+	     safe_table_state,
+	     internal_file->table_state_counter,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to add reference to table state.",
+		 function );
+
+		return( -1 );
+	}
+	*table_state = safe_table_state;
+
+	return( 1 );
+}
+
+/* Retrieves the table for a specific table definition
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_internal_file_get_table_by_definition(
+     libesedb_internal_file_t *internal_file,
+     libesedb_table_definition_t *table_definition,
+     libesedb_table_t **table,
+     libcerror_error_t **error )
+{
+	libbfio_handle_t *file_io_handle                       = NULL;
+	libesedb_table_definition_t *template_table_definition = NULL;
+	libesedb_table_state_t *table_state                    = NULL;
+	static char *function                                  = "libesedb_internal_file_get_table_by_definition";
+	uint8_t file_io_handle_created_in_library              = 0;
+
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	int result                                             = 0;
+#endif
+
+	if( internal_file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_definition->table_catalog_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid table definition - missing table catalog definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_definition->table_catalog_definition->template_name != NULL )
+	{
+		if( libesedb_catalog_get_table_definition_by_name(
+		     internal_file->catalog,
+		     table_definition->table_catalog_definition->template_name,
+		     table_definition->table_catalog_definition->template_name_size,
+		     &template_table_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve template table definition.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	if( libesedb_catalog_read_deferred_table_definition(
+	     internal_file->catalog,
+	     internal_file->file_io_handle,
+	     table_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read deferred table definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( template_table_definition != NULL )
+	{
+		if( libesedb_catalog_read_deferred_table_definition(
+		     internal_file->catalog,
+		     internal_file->file_io_handle,
+		     template_table_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read deferred template table definition.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	file_io_handle = internal_file->file_io_handle;
+
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	/* If the file was opened by name every table reads using its own file IO handle
+	 * so that threads reading different tables do not contend for the same handle
+	 */
+	if( internal_file->file_io_handle_created_in_library != 0 )
+	{
+		file_io_handle = NULL;
+
+		if( libbfio_handle_clone(
+		     &file_io_handle,
+		     internal_file->file_io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create table file IO handle.",
+			 function );
+
+			goto on_error;
+		}
+		file_io_handle_created_in_library = 1;
+
+		result = libbfio_handle_is_open(
+		          file_io_handle,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_OPEN_FAILED,
+			 "%s: unable to determine if table file IO handle is open.",
+			 function );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			if( libbfio_handle_open(
+			     file_io_handle,
+			     LIBBFIO_OPEN_READ,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_OPEN_FAILED,
+				 "%s: unable to open table file IO handle.",
+				 function );
+
+				goto on_error;
+			}
+		}
+	}
+#endif
+	if( libesedb_internal_file_get_table_state(
+	     internal_file,
+	     table_definition,
+	     template_table_definition,
+	     &table_state,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid page size.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve table state.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	*page_size = internal_file->io_handle->page_size;
-
-	return( 1 );
-}
-
-/* Retrieves the number of tables
- * Returns 1 if successful or -1 on error
- */
-int libesedb_file_get_number_of_tables(
-     libesedb_file_t *file,
-     int *number_of_tables,
-     libcerror_error_t **error )
-{
-	libesedb_internal_file_t *internal_file = NULL;
-	static char *function                   = "libesedb_file_get_number_of_tables";
-
-	if( file == NULL )
+	if( libesedb_table_initialize(
+	     table,
+	     file_io_handle,
+	     internal_file->io_handle,
+	     table_state,
+	     internal_file->metadata_cache,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid file.",
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create table.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
-	internal_file = (libesedb_internal_file_t *) file;
+	/* The table now manages the file IO handle
+	 */
+	( (libesedb_internal_table_t *) *table )->file_io_handle_created_in_library = file_io_handle_created_in_library;
 
-	if( internal_file->catalog == NULL )
-	{
-		if( number_of_tables == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-			 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-			 "%s: invalid number of tables.",
-			 function );
+	return( 1 );
 
-			return( -1 );
-		}
-		*number_of_tables = 0;
+on_error:
+	if( table_state != NULL )
+	{
+		libesedb_table_state_release(
+		 &table_state,
+		 NULL );
 	}
-	else
+	if( file_io_handle_created_in_library != 0 )
 	{
-		if( libesedb_catalog_get_number_of_table_definitions(
-		     internal_file->catalog,
-		     number_of_tables,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve number of tables.",
-			 function );
-
-			return( -1 );
-		}
+		libbfio_handle_close(
+		 file_io_handle,
+		 NULL );
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
 	}
-	return( 1 );
+	return( -1 );
 }
 
 /* Retrieves a specific table
@@ -1731,10 +3480,10 @@ int libesedb_file_get_table(
      libesedb_table_t **table,
      libcerror_error_t **error )
 {
-	libesedb_internal_file_t *internal_file                = NULL;
-	libesedb_table_definition_t *table_definition          = NULL;
-	libesedb_table_definition_t *template_table_definition = NULL;
-	static char *function                                  = "libesedb_file_get_table";
+	libesedb_internal_file_t *internal_file       = NULL;
+	libesedb_table_definition_t *table_definition = NULL;
+	static char *function                         = "libesedb_file_get_table";
+	int result                                    = 1;
 
 	if( file == NULL )
 	{
@@ -1771,6 +3520,21 @@ int libesedb_file_get_table(
 
 		return( -1 );
 	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
 	if( libesedb_catalog_get_table_definition_by_index(
 	     internal_file->catalog,
 	     table_entry,
@@ -1785,67 +3549,40 @@ int libesedb_file_get_table(
 		 function,
 		 table_entry );
 
-		return( -1 );
-	}
-	if( table_definition == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: missing table definition.",
-		 function );
-
-		return( -1 );
+		result = -1;
 	}
-	if( table_definition->table_catalog_definition == NULL )
+	else if( libesedb_internal_file_get_table_by_definition(
+	          internal_file,
+	          table_definition,
+	          table,
+	          error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid table definition - missing table catalog definition.",
-		 function );
-
-		return( -1 );
-	}
-	if( table_definition->table_catalog_definition->template_name != NULL )
-	{
-		if( libesedb_catalog_get_table_definition_by_utf8_name(
-		     internal_file->catalog,
-		     table_definition->table_catalog_definition->template_name,
-		     table_definition->table_catalog_definition->template_name_size,
-		     &template_table_definition,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve template table definition.",
-			 function );
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve table: %d.",
+		 function,
+		 table_entry );
 
-			return( -1 );
-		}
+		result = -1;
 	}
-	if( libesedb_table_initialize(
-	     table,
-	     internal_file->file_io_handle,
-	     internal_file->io_handle,
-	     table_definition,
-	     template_table_definition,
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create table.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
 		 function );
 
 		return( -1 );
 	}
-	return( 1 );
+#endif
+	return( result );
 }
 
 /* Retrieves the table for the UTF-8 encoded name
@@ -1858,11 +3595,10 @@ int libesedb_file_get_table_by_utf8_name(
      libesedb_table_t **table,
      libcerror_error_t **error )
 {
-	libesedb_internal_file_t *internal_file                = NULL;
-	libesedb_table_definition_t *table_definition          = NULL;
-	libesedb_table_definition_t *template_table_definition = NULL;
-	static char *function                                  = "libesedb_file_get_table_by_utf8_name";
-	int result                                             = 0;
+	libesedb_internal_file_t *internal_file       = NULL;
+	libesedb_table_definition_t *table_definition = NULL;
+	static char *function                         = "libesedb_file_get_table_by_utf8_name";
+	int result                                    = 0;
 
 	if( file == NULL )
 	{
@@ -1899,6 +3635,21 @@ int libesedb_file_get_table_by_utf8_name(
 
 		return( -1 );
 	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
 	result = libesedb_catalog_get_table_definition_by_utf8_name(
 	          internal_file->catalog,
 	          utf8_string,
@@ -1914,70 +3665,40 @@ int libesedb_file_get_table_by_utf8_name(
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
 		 "%s: unable to retrieve table definition.",
 		 function );
-
-		return( -1 );
 	}
 	else if( result != 0 )
 	{
-		if( table_definition == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing table definition.",
-			 function );
-
-			return( -1 );
-		}
-		if( table_definition->table_catalog_definition == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: invalid table definition - missing table catalog definition.",
-			 function );
-
-			return( -1 );
-		}
-		if( table_definition->table_catalog_definition->template_name != NULL )
-		{
-			if( libesedb_catalog_get_table_definition_by_name(
-			     internal_file->catalog,
-			     table_definition->table_catalog_definition->template_name,
-			     table_definition->table_catalog_definition->template_name_size,
-			     &template_table_definition,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve template table definition.",
-				 function );
-
-				return( -1 );
-			}
-		}
-		if( libesedb_table_initialize(
-		     table,
-		     internal_file->file_io_handle,
-		     internal_file->io_handle,
+		if( libesedb_internal_file_get_table_by_definition(
+		     internal_file,
 		     table_definition,
-		     template_table_definition,
+		     table,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create table.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve table.",
 			 function );
 
-			return( -1 );
+			result = -1;
 		}
 	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
 	return( result );
 }
 
@@ -1991,11 +3712,10 @@ int libesedb_file_get_table_by_utf16_name(
      libesedb_table_t **table,
      libcerror_error_t **error )
 {
-	libesedb_internal_file_t *internal_file                = NULL;
-	libesedb_table_definition_t *table_definition          = NULL;
-	libesedb_table_definition_t *template_table_definition = NULL;
-	static char *function                                  = "libesedb_file_get_table_by_utf16_name";
-	int result                                             = 0;
+	libesedb_internal_file_t *internal_file       = NULL;
+	libesedb_table_definition_t *table_definition = NULL;
+	static char *function                         = "libesedb_file_get_table_by_utf16_name";
+	int result                                    = 0;
 
 	if( file == NULL )
 	{
@@ -2032,6 +3752,21 @@ int libesedb_file_get_table_by_utf16_name(
 
 		return( -1 );
 	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
 	result = libesedb_catalog_get_table_definition_by_utf16_name(
 	          internal_file->catalog,
 	          utf16_string,
@@ -2047,70 +3782,40 @@ int libesedb_file_get_table_by_utf16_name(
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
 		 "%s: unable to retrieve table definition.",
 		 function );
-
-		return( -1 );
 	}
 	else if( result != 0 )
 	{
-		if( table_definition == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing table definition.",
-			 function );
-
-			return( -1 );
-		}
-		if( table_definition->table_catalog_definition == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: invalid table definition - missing table catalog definition.",
-			 function );
-
-			return( -1 );
-		}
-		if( table_definition->table_catalog_definition->template_name != NULL )
-		{
-			if( libesedb_catalog_get_table_definition_by_name(
-			     internal_file->catalog,
-			     table_definition->table_catalog_definition->template_name,
-			     table_definition->table_catalog_definition->template_name_size,
-			     &template_table_definition,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve template table definition.",
-				 function );
-
-				return( -1 );
-			}
-		}
-		if( libesedb_table_initialize(
-		     table,
-		     internal_file->file_io_handle,
-		     internal_file->io_handle,
+		if( libesedb_internal_file_get_table_by_definition(
+		     internal_file,
 		     table_definition,
-		     template_table_definition,
+		     table,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create table.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve table.",
 			 function );
 
-			return( -1 );
+			result = -1;
 		}
 	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_file->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
 	return( result );
 }
 
@@ -30,9 +30,12 @@
 #include "libesedb_extern.h"
 #include "libesedb_io_handle.h"
 #include "libesedb_libbfio.h"
+#include "libesedb_libcdata.h"
 #include "libesedb_libcerror.h"
-#include "libesedb_libfcache.h"
-#include "libesedb_libfdata.h"
+#include "libesedb_libcthreads.h"
+#include "libesedb_metadata_cache.h"
+#include "libesedb_page_cache.h"
+#include "libesedb_table_state.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -58,13 +61,9 @@ struct libesedb_internal_file
 	 */
 	uint8_t file_io_handle_opened_in_library;
 
-	/* The pages vector
+	/* The page cache
 	 */
-	libfdata_vector_t *pages_vector;
-
-	/* The pages cache
-	 */
-	libfcache_cache_t *pages_cache;
+	libesedb_page_cache_t *page_cache;
 
 	/* The database
 	 */
@@ -74,9 +73,39 @@ struct libesedb_internal_file
 	 */
 	libesedb_catalog_t *catalog;
 
-	/* The backup catalog
+	/* Value to indicate the catalog definitions of a table should be read on demand
+	 */
+	uint8_t read_catalog_on_demand;
+
+	/* The metadata cache
+	 */
+	libesedb_metadata_cache_t *metadata_cache;
+
+	/* The metadata cache data that was read before the file was opened
+	 */
+	uint8_t *metadata_cache_data;
+
+	/* The metadata cache data size
+	 */
+	size_t metadata_cache_data_size;
+
+	/* The table states array, with an entry per table definition
+	 */
+	libcdata_array_t *table_states_array;
+
+	/* The number of table states in the table states array
+	 */
+	int number_of_table_states;
+
+	/* The table state counter, used to determine the least recently referenced table state
+	 */
+	uint64_t table_state_counter;
+
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
 	 */
-	libesedb_catalog_t *backup_catalog;
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
 };
 
 LIBESEDB_EXTERN \
@@ -129,6 +158,48 @@ int libesedb_file_open_read(
      libbfio_handle_t *file_io_handle,
      libcerror_error_t **error );
 
+int libesedb_internal_file_read_metadata_cache_file_io_handle(
+     libesedb_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libesedb_internal_file_write_metadata_cache_file_io_handle(
+     libesedb_internal_file_t *internal_file,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_file_read_metadata_cache(
+     libesedb_file_t *file,
+     const char *filename,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+LIBESEDB_EXTERN \
+int libesedb_file_read_metadata_cache_wide(
+     libesedb_file_t *file,
+     const wchar_t *filename,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+LIBESEDB_EXTERN \
+int libesedb_file_write_metadata_cache(
+     libesedb_file_t *file,
+     const char *filename,
+     libcerror_error_t **error );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+LIBESEDB_EXTERN \
+int libesedb_file_write_metadata_cache_wide(
+     libesedb_file_t *file,
+     const wchar_t *filename,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
 LIBESEDB_EXTERN \
 int libesedb_file_get_type(
      libesedb_file_t *file,
@@ -161,6 +232,27 @@ int libesedb_file_get_number_of_tables(
      int *number_of_tables,
      libcerror_error_t **error );
 
+int libesedb_internal_file_free_table_states(
+     libesedb_internal_file_t *internal_file,
+     libcerror_error_t **error );
+
+int libesedb_internal_file_free_unreferenced_table_state(
+     libesedb_internal_file_t *internal_file,
+     libcerror_error_t **error );
+
+int libesedb_internal_file_get_table_state(
+     libesedb_internal_file_t *internal_file,
+     libesedb_table_definition_t *table_definition,
+     libesedb_table_definition_t *template_table_definition,
+     libesedb_table_state_t **table_state,
+     libcerror_error_t **error );
+
+int libesedb_internal_file_get_table_by_definition(
+     libesedb_internal_file_t *internal_file,
+     libesedb_table_definition_t *table_definition,
+     libesedb_table_t **table,
+     libcerror_error_t **error );
+
 LIBESEDB_EXTERN \
 int libesedb_file_get_table(
      libesedb_file_t *file,
@@ -239,6 +239,25 @@ int libesedb_file_header_read_data(
 	 ( (esedb_file_header_t *) data )->database_state,
 	 file_header->database_state );
 
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (esedb_file_header_t *) data )->database_time,
+	 file_header->database_time );
+
+	if( memory_copy(
+	     file_header->database_signature,
+	     ( (esedb_file_header_t *) data )->database_signature,
+	     28 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy database signature.",
+		 function );
+
+		return( -1 );
+	}
+
 	byte_stream_copy_to_uint32_little_endian(
 	 ( (esedb_file_header_t *) data )->format_revision,
 	 file_header->format_revision );
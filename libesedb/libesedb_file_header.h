@@ -60,6 +60,14 @@ struct libesedb_file_header
 	 */
 	uint32_t database_state;
 
+	/* The database time
+	 */
+	uint64_t database_time;
+
+	/* The database signature
+	 */
+	uint8_t database_signature[ 28 ];
+
 	/* The page size
 	 */
 	uint32_t page_size;
@@ -29,10 +29,11 @@
 #include "libesedb_io_handle.h"
 #include "libesedb_index.h"
 #include "libesedb_libbfio.h"
+#include "libesedb_libcdata.h"
 #include "libesedb_libcerror.h"
 #include "libesedb_libcnotify.h"
-#include "libesedb_libfcache.h"
-#include "libesedb_libfdata.h"
+#include "libesedb_libcthreads.h"
+#include "libesedb_page.h"
 #include "libesedb_page_tree.h"
 #include "libesedb_page_tree_key.h"
 #include "libesedb_record.h"
@@ -49,10 +50,7 @@ int libesedb_index_initialize(
      libesedb_table_definition_t *table_definition,
      libesedb_table_definition_t *template_table_definition,
      libesedb_catalog_definition_t *index_catalog_definition,
-     libfdata_vector_t *pages_vector,
-     libfcache_cache_t *pages_cache,
-     libfdata_vector_t *long_values_pages_vector,
-     libfcache_cache_t *long_values_pages_cache,
+     libesedb_page_cache_t *page_cache,
      libesedb_page_tree_t *table_page_tree,
      libesedb_page_tree_t *long_values_page_tree,
      libcerror_error_t **error )
@@ -140,8 +138,7 @@ int libesedb_index_initialize(
 	if( libesedb_page_tree_initialize(
 	     &( internal_index->index_page_tree ),
 	     io_handle,
-	     pages_vector,
-	     pages_cache,
+	     page_cache,
 	     index_catalog_definition->identifier,
 	     index_catalog_definition->father_data_page_number,
 	     NULL,
@@ -162,13 +159,25 @@ int libesedb_index_initialize(
 	internal_index->table_definition          = table_definition;
 	internal_index->template_table_definition = template_table_definition;
 	internal_index->index_catalog_definition  = index_catalog_definition;
-	internal_index->pages_vector              = pages_vector;
-	internal_index->pages_cache               = pages_cache;
-	internal_index->long_values_pages_vector  = long_values_pages_vector;
-	internal_index->long_values_pages_cache   = long_values_pages_cache;
+	internal_index->page_cache                = page_cache;
 	internal_index->table_page_tree           = table_page_tree;
 	internal_index->long_values_page_tree     = long_values_page_tree;
 
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( internal_index->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
 	*index = (libesedb_index_t *) internal_index;
 
 	return( 1 );
@@ -176,6 +185,12 @@ int libesedb_index_initialize(
 on_error:
 	if( internal_index != NULL )
 	{
+		if( internal_index->index_page_tree != NULL )
+		{
+			libesedb_page_tree_free(
+			 &( internal_index->index_page_tree ),
+			 NULL );
+		}
 		memory_free(
 		 internal_index );
 	}
@@ -210,7 +225,7 @@ int libesedb_index_free(
 		*index         = NULL;
 
 		/* The io_handle, file_io_handle, table_definition, template_table_definition,
-		 * index_catalog_definition, pages_vector, pages_cache, table_page_tree and
+		 * index_catalog_definition, page_cache, table_page_tree and
 		 * long_values_page_tree references are freed elsewhere
 		 */
 		if( libesedb_page_tree_free(
@@ -226,6 +241,21 @@ int libesedb_index_free(
 
 			result = -1;
 		}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( internal_index->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
 		memory_free(
 		 internal_index );
 	}
@@ -503,6 +533,7 @@ int libesedb_index_get_number_of_records(
 {
 	libesedb_internal_index_t *internal_index = NULL;
 	static char *function                     = "libesedb_index_get_number_of_records";
+	int result                                = 1;
 
 	if( index == NULL )
 	{
@@ -517,6 +548,21 @@ int libesedb_index_get_number_of_records(
 	}
 	internal_index = (libesedb_internal_index_t *) index;
 
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_index->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
 	if( libesedb_page_tree_get_number_of_leaf_values(
 	     internal_index->index_page_tree,
 	     internal_index->file_io_handle,
@@ -530,29 +576,45 @@ int libesedb_index_get_number_of_records(
 		 "%s: unable to retrieve number of leaf values from index page tree.",
 		 function );
 
+		result = -1;
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_index->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
 		return( -1 );
 	}
-	return( 1 );
+#endif
+	return( result );
 }
 
 /* Retrieves a specific record
+ * This function is not multi-thread safe acquire write lock before call
  * Returns 1 if successful or -1 on error
  */
-int libesedb_index_get_record(
-     libesedb_index_t *index,
+int libesedb_internal_index_get_record(
+     libesedb_internal_index_t *internal_index,
      int record_entry,
      libesedb_record_t **record,
      libcerror_error_t **error )
 {
 	libesedb_data_definition_t *index_data_definition  = NULL;
 	libesedb_data_definition_t *record_data_definition = NULL;
-	libesedb_internal_index_t *internal_index          = NULL;
+	libesedb_page_t *index_page                        = NULL;
 	libesedb_page_tree_key_t *key                      = NULL;
 	uint8_t *index_data                                = NULL;
-	static char *function                              = "libesedb_index_get_record";
+	static char *function                              = "libesedb_internal_index_get_record";
 	size_t index_data_size                             = 0;
 
-	if( index == NULL )
+	if( internal_index == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -563,8 +625,6 @@ int libesedb_index_get_record(
 
 		return( -1 );
 	}
-	internal_index = (libesedb_internal_index_t *) index;
-
 	if( record == NULL )
 	{
 		libcerror_error_set(
@@ -608,8 +668,8 @@ int libesedb_index_get_record(
 	     index_data_definition,
 	     internal_index->file_io_handle,
 	     internal_index->io_handle,
-	     internal_index->pages_vector,
-	     internal_index->pages_cache,
+	     internal_index->page_cache,
+	     &index_page,
 	     &index_data,
 	     &index_data_size,
 	     error ) != 1 )
@@ -664,6 +724,20 @@ int libesedb_index_get_record(
 
 		goto on_error;
 	}
+	if( libesedb_page_cache_release_page(
+	     internal_index->page_cache,
+	     &index_page,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release index page.",
+		 function );
+
+		goto on_error;
+	}
 	key->type = LIBESEDB_KEY_TYPE_INDEX_VALUE;
 
 	if( libesedb_page_tree_get_leaf_value_by_key(
@@ -701,10 +775,7 @@ int libesedb_index_get_record(
 	     internal_index->io_handle,
 	     internal_index->table_definition,
 	     internal_index->template_table_definition,
-	     internal_index->pages_vector,
-	     internal_index->pages_cache,
-	     internal_index->long_values_pages_vector,
-	     internal_index->long_values_pages_cache,
+	     internal_index->page_cache,
 	     record_data_definition,
 	     internal_index->long_values_page_tree,
 	     error ) != 1 )
@@ -721,6 +792,13 @@ int libesedb_index_get_record(
 	return( 1 );
 
 on_error:
+	if( index_page != NULL )
+	{
+		libesedb_page_cache_release_page(
+		 internal_index->page_cache,
+		 &index_page,
+		 NULL );
+	}
 	if( record_data_definition != NULL )
 	{
 		libesedb_data_definition_free(
@@ -742,3 +820,983 @@ on_error:
 	return( -1 );
 }
 
+/* Retrieves a specific record
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_index_get_record(
+     libesedb_index_t *index,
+     int record_entry,
+     libesedb_record_t **record,
+     libcerror_error_t **error )
+{
+	libesedb_internal_index_t *internal_index = NULL;
+	static char *function                     = "libesedb_index_get_record";
+	int result                                = 1;
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_index = (libesedb_internal_index_t *) index;
+
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_index->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libesedb_internal_index_get_record(
+	     internal_index,
+	     record_entry,
+	     record,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record: %d.",
+		 function,
+		 record_entry );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_index->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Frees an index bookmark
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_index_bookmark_free(
+     libesedb_index_bookmark_t **index_bookmark,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_index_bookmark_free";
+	int result            = 1;
+
+	if( index_bookmark == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index bookmark.",
+		 function );
+
+		return( -1 );
+	}
+	if( *index_bookmark != NULL )
+	{
+		if( ( *index_bookmark )->key != NULL )
+		{
+			if( libesedb_page_tree_key_free(
+			     &( ( *index_bookmark )->key ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free key.",
+				 function );
+
+				result = -1;
+			}
+		}
+		memory_free(
+		 *index_bookmark );
+
+		*index_bookmark = NULL;
+	}
+	return( result );
+}
+
+/* Compares 2 index bookmarks by key
+ * The second byte of an index value key can have the 0x80 bit set, which is
+ * ignored when the key is matched against a table key, hence it is ignored here as well
+ * Returns LIBCDATA_COMPARE_LESS, LIBCDATA_COMPARE_EQUAL, LIBCDATA_COMPARE_GREATER if successful or -1 on error
+ */
+int libesedb_index_bookmark_compare(
+     libesedb_index_bookmark_t *first_index_bookmark,
+     libesedb_index_bookmark_t *second_index_bookmark,
+     libcerror_error_t **error )
+{
+	libesedb_page_tree_key_t *first_key  = NULL;
+	libesedb_page_tree_key_t *second_key = NULL;
+	static char *function                = "libesedb_index_bookmark_compare";
+	size_t compare_data_size             = 0;
+	size_t key_data_index                = 0;
+	uint8_t first_key_data               = 0;
+	uint8_t second_key_data              = 0;
+
+	if( ( first_index_bookmark == NULL )
+	 || ( first_index_bookmark->key == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first index bookmark.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( second_index_bookmark == NULL )
+	 || ( second_index_bookmark->key == NULL ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid second index bookmark.",
+		 function );
+
+		return( -1 );
+	}
+	first_key  = first_index_bookmark->key;
+	second_key = second_index_bookmark->key;
+
+	if( first_key->data_size <= second_key->data_size )
+	{
+		compare_data_size = first_key->data_size;
+	}
+	else
+	{
+		compare_data_size = second_key->data_size;
+	}
+	for( key_data_index = 0;
+	     key_data_index < compare_data_size;
+	     key_data_index++ )
+	{
+		first_key_data  = first_key->data[ key_data_index ];
+		second_key_data = second_key->data[ key_data_index ];
+
+		if( key_data_index == 1 )
+		{
+			first_key_data  &= 0x7f;
+			second_key_data &= 0x7f;
+		}
+		if( first_key_data < second_key_data )
+		{
+			return( LIBCDATA_COMPARE_LESS );
+		}
+		else if( first_key_data > second_key_data )
+		{
+			return( LIBCDATA_COMPARE_GREATER );
+		}
+	}
+	if( first_key->data_size < second_key->data_size )
+	{
+		return( LIBCDATA_COMPARE_LESS );
+	}
+	else if( first_key->data_size > second_key->data_size )
+	{
+		return( LIBCDATA_COMPARE_GREATER );
+	}
+	/* Keep the index order of bookmarks with the same key
+	 */
+	if( first_index_bookmark->record_index < second_index_bookmark->record_index )
+	{
+		return( LIBCDATA_COMPARE_LESS );
+	}
+	else if( first_index_bookmark->record_index > second_index_bookmark->record_index )
+	{
+		return( LIBCDATA_COMPARE_GREATER );
+	}
+	return( LIBCDATA_COMPARE_EQUAL );
+}
+
+/* Retrieves the index bookmark of a specific record
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_internal_index_get_bookmark(
+     libesedb_internal_index_t *internal_index,
+     int record_entry,
+     libesedb_index_bookmark_t **index_bookmark,
+     libcerror_error_t **error )
+{
+	libesedb_data_definition_t *index_data_definition = NULL;
+	libesedb_index_bookmark_t *safe_index_bookmark    = NULL;
+	libesedb_page_t *index_page                       = NULL;
+	uint8_t *index_data                               = NULL;
+	static char *function                             = "libesedb_internal_index_get_bookmark";
+	size_t index_data_size                            = 0;
+
+	if( internal_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	if( index_bookmark == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index bookmark.",
+		 function );
+
+		return( -1 );
+	}
+	if( *index_bookmark != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid index bookmark value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_page_tree_get_leaf_value_by_index(
+	     internal_index->index_page_tree,
+	     internal_index->file_io_handle,
+	     record_entry,
+	     &index_data_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve leaf value: %d from index values tree.",
+		 function,
+		 record_entry );
+
+		goto on_error;
+	}
+	if( libesedb_data_definition_read_data(
+	     index_data_definition,
+	     internal_index->file_io_handle,
+	     internal_index->io_handle,
+	     internal_index->page_cache,
+	     &index_page,
+	     &index_data,
+	     &index_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read index data definition data.",
+		 function );
+
+		goto on_error;
+	}
+	safe_index_bookmark = memory_allocate_structure(
+	                       libesedb_index_bookmark_t );
+
+	if( safe_index_bookmark == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create index bookmark.",
+		 function );
+
+		goto on_error;
+	}
+	safe_index_bookmark->key = NULL;
+
+	if( libesedb_page_tree_key_initialize(
+	     &( safe_index_bookmark->key ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create key.",
+		 function );
+
+		goto on_error;
+	}
+	/* The index data references the index page hence it is copied
+	 */
+	if( libesedb_page_tree_key_set_data(
+	     safe_index_bookmark->key,
+	     index_data,
+	     index_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set index data in key.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_page_cache_release_page(
+	     internal_index->page_cache,
+	     &index_page,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release index page.",
+		 function );
+
+		goto on_error;
+	}
+	safe_index_bookmark->key->type    = LIBESEDB_KEY_TYPE_INDEX_VALUE;
+	safe_index_bookmark->record_index = record_entry;
+
+	if( libesedb_data_definition_free(
+	     &index_data_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free index data definition.",
+		 function );
+
+		goto on_error;
+	}
+	*index_bookmark = safe_index_bookmark;
+
+	return( 1 );
+
+on_error:
+	if( safe_index_bookmark != NULL )
+	{
+		libesedb_index_bookmark_free(
+		 &safe_index_bookmark,
+		 NULL );
+	}
+	if( index_page != NULL )
+	{
+		libesedb_page_cache_release_page(
+		 internal_index->page_cache,
+		 &index_page,
+		 NULL );
+	}
+	if( index_data_definition != NULL )
+	{
+		libesedb_data_definition_free(
+		 &index_data_definition,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Sorts index bookmarks by key in-place
+ * The bookmarks are sorted with a heap sort, that does not require additional memory
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_index_bookmarks_sort(
+     libesedb_index_bookmark_t **index_bookmarks,
+     int number_of_index_bookmarks,
+     libcerror_error_t **error )
+{
+	libesedb_index_bookmark_t *index_bookmark = NULL;
+	static char *function                     = "libesedb_index_bookmarks_sort";
+	int child_index                           = 0;
+	int heap_size                             = 0;
+	int parent_index                          = 0;
+	int result                                = 0;
+	int root_index                            = 0;
+
+	if( index_bookmarks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index bookmarks.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_index_bookmarks < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of index bookmarks value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	heap_size    = number_of_index_bookmarks;
+	parent_index = number_of_index_bookmarks / 2;
+
+	/* First the bookmarks are arranged in a heap, with the greatest bookmark as its root,
+	 * after which the root is repeatedly moved to the end of the shrinking heap
+	 */
+	while( heap_size > 1 )
+	{
+		if( parent_index > 0 )
+		{
+			parent_index--;
+
+			root_index = parent_index;
+		}
+		else
+		{
+			heap_size--;
+
+			index_bookmark               = index_bookmarks[ 0 ];
+			index_bookmarks[ 0 ]         = index_bookmarks[ heap_size ];
+			index_bookmarks[ heap_size ] = index_bookmark;
+
+			root_index = 0;
+		}
+		child_index = ( 2 * root_index ) + 1;
+
+		while( child_index < heap_size )
+		{
+			if( ( child_index + 1 ) < heap_size )
+			{
+				result = libesedb_index_bookmark_compare(
+				          index_bookmarks[ child_index ],
+				          index_bookmarks[ child_index + 1 ],
+				          error );
+
+				if( result == -1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GENERIC,
+					 "%s: unable to compare index bookmarks: %d and %d.",
+					 function,
+					 child_index,
+					 child_index + 1 );
+
+					return( -1 );
+				}
+				else if( result == LIBCDATA_COMPARE_LESS )
+				{
+					child_index++;
+				}
+			}
+			result = libesedb_index_bookmark_compare(
+			          index_bookmarks[ root_index ],
+			          index_bookmarks[ child_index ],
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GENERIC,
+				 "%s: unable to compare index bookmarks: %d and %d.",
+				 function,
+				 root_index,
+				 child_index );
+
+				return( -1 );
+			}
+			else if( result != LIBCDATA_COMPARE_LESS )
+			{
+				break;
+			}
+			index_bookmark                 = index_bookmarks[ root_index ];
+			index_bookmarks[ root_index ]  = index_bookmarks[ child_index ];
+			index_bookmarks[ child_index ] = index_bookmark;
+
+			root_index  = child_index;
+			child_index = ( 2 * root_index ) + 1;
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves a range of records
+ * The bookmarks of the records are resolved in key order so that consecutive
+ * bookmarks stored in the same table leaf page do not require a page tree lookup
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_internal_index_get_records(
+     libesedb_internal_index_t *internal_index,
+     int first_record_entry,
+     int number_of_records,
+     libesedb_record_t **records,
+     libcerror_error_t **error )
+{
+	libesedb_data_definition_t *record_data_definition = NULL;
+	libesedb_index_bookmark_t **index_bookmarks        = NULL;
+	libesedb_index_bookmark_t *index_bookmark          = NULL;
+	libesedb_page_t *leaf_page                         = NULL;
+	static char *function                              = "libesedb_internal_index_get_records";
+	size_t index_bookmarks_size                        = 0;
+	int index_bookmark_index                           = 0;
+	int record_index                                   = 0;
+	int result                                         = 0;
+
+	if( internal_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_record_entry < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid first record entry value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_records < 0 )
+	 || ( number_of_records > ( INT_MAX - first_record_entry ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of records value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( records == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid records.",
+		 function );
+
+		return( -1 );
+	}
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		records[ record_index ] = NULL;
+	}
+	if( number_of_records == 0 )
+	{
+		return( 1 );
+	}
+	index_bookmarks_size = sizeof( libesedb_index_bookmark_t * ) * number_of_records;
+
+	if( index_bookmarks_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid index bookmarks size value exceeds maximum.",
+		 function );
+
+		goto on_error;
+	}
+	index_bookmarks = (libesedb_index_bookmark_t **) memory_allocate(
+	                                                  index_bookmarks_size );
+
+	if( index_bookmarks == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create index bookmarks.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     index_bookmarks,
+	     0,
+	     index_bookmarks_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear index bookmarks.",
+		 function );
+
+		memory_free(
+		 index_bookmarks );
+
+		return( -1 );
+	}
+	/* The bookmarks are retrieved in index order and sorted once afterwards
+	 */
+	for( index_bookmark_index = 0;
+	     index_bookmark_index < number_of_records;
+	     index_bookmark_index++ )
+	{
+		if( libesedb_internal_index_get_bookmark(
+		     internal_index,
+		     first_record_entry + index_bookmark_index,
+		     &( index_bookmarks[ index_bookmark_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve bookmark of record: %d.",
+			 function,
+			 first_record_entry + index_bookmark_index );
+
+			goto on_error;
+		}
+	}
+	if( libesedb_index_bookmarks_sort(
+	     index_bookmarks,
+	     number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to sort index bookmarks.",
+		 function );
+
+		goto on_error;
+	}
+	/* The last table leaf page remains referenced until the next lookup by key
+	 */
+	for( index_bookmark_index = 0;
+	     index_bookmark_index < number_of_records;
+	     index_bookmark_index++ )
+	{
+		index_bookmark = index_bookmarks[ index_bookmark_index ];
+
+		result = 0;
+
+		if( leaf_page != NULL )
+		{
+			result = libesedb_page_tree_get_leaf_value_by_key_from_page(
+			          internal_index->table_page_tree,
+			          internal_index->file_io_handle,
+			          leaf_page,
+			          index_bookmark->key,
+			          &record_data_definition,
+			          0,
+			          error );
+
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve leaf value by key from leaf page: %" PRIu32 ".",
+				 function,
+				 leaf_page->page_number );
+
+				goto on_error;
+			}
+		}
+		if( result == 0 )
+		{
+			if( libesedb_page_tree_get_leaf_value_by_key(
+			     internal_index->table_page_tree,
+			     internal_index->file_io_handle,
+			     index_bookmark->key,
+			     &record_data_definition,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve leaf value by key.",
+				 function );
+
+				goto on_error;
+			}
+			if( leaf_page != NULL )
+			{
+				if( libesedb_page_cache_release_page(
+				     internal_index->page_cache,
+				     &leaf_page,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+					 "%s: unable to release leaf page.",
+					 function );
+
+					goto on_error;
+				}
+			}
+			if( libesedb_page_cache_get_page(
+			     internal_index->page_cache,
+			     internal_index->file_io_handle,
+			     record_data_definition->page_number,
+			     &leaf_page,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve page: %" PRIu32 ".",
+				 function,
+				 record_data_definition->page_number );
+
+				goto on_error;
+			}
+			if( libesedb_page_validate_page(
+			     leaf_page,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported page.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		record_index = index_bookmark->record_index - first_record_entry;
+
+		if( libesedb_record_initialize(
+		     &( records[ record_index ] ),
+		     internal_index->file_io_handle,
+		     internal_index->io_handle,
+		     internal_index->table_definition,
+		     internal_index->template_table_definition,
+		     internal_index->page_cache,
+		     record_data_definition,
+		     internal_index->long_values_page_tree,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create record: %d.",
+			 function,
+			 index_bookmark->record_index );
+
+			goto on_error;
+		}
+		record_data_definition = NULL;
+	}
+	if( leaf_page != NULL )
+	{
+		if( libesedb_page_cache_release_page(
+		     internal_index->page_cache,
+		     &leaf_page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release leaf page.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	for( index_bookmark_index = 0;
+	     index_bookmark_index < number_of_records;
+	     index_bookmark_index++ )
+	{
+		if( libesedb_index_bookmark_free(
+		     &( index_bookmarks[ index_bookmark_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free index bookmark: %d.",
+			 function,
+			 index_bookmark_index );
+
+			goto on_error;
+		}
+	}
+	memory_free(
+	 index_bookmarks );
+
+	return( 1 );
+
+on_error:
+	if( record_data_definition != NULL )
+	{
+		libesedb_data_definition_free(
+		 &record_data_definition,
+		 NULL );
+	}
+	if( leaf_page != NULL )
+	{
+		libesedb_page_cache_release_page(
+		 internal_index->page_cache,
+		 &leaf_page,
+		 NULL );
+	}
+	if( index_bookmarks != NULL )
+	{
+		for( index_bookmark_index = 0;
+		     index_bookmark_index < number_of_records;
+		     index_bookmark_index++ )
+		{
+			if( index_bookmarks[ index_bookmark_index ] != NULL )
+			{
+				libesedb_index_bookmark_free(
+				 &( index_bookmarks[ index_bookmark_index ] ),
+				 NULL );
+			}
+		}
+		memory_free(
+		 index_bookmarks );
+	}
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		if( records[ record_index ] != NULL )
+		{
+			libesedb_record_free(
+			 &( records[ record_index ] ),
+			 NULL );
+		}
+	}
+	return( -1 );
+}
+
+/* Retrieves a range of records
+ * The records are stored in index order in records, which must be able to contain
+ * number_of_records records
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_index_get_records(
+     libesedb_index_t *index,
+     int first_record_entry,
+     int number_of_records,
+     libesedb_record_t **records,
+     libcerror_error_t **error )
+{
+	libesedb_internal_index_t *internal_index = NULL;
+	static char *function                     = "libesedb_index_get_records";
+	int result                                = 1;
+
+	if( index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index.",
+		 function );
+
+		return( -1 );
+	}
+	internal_index = (libesedb_internal_index_t *) index;
+
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_index->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libesedb_internal_index_get_records(
+	     internal_index,
+	     first_record_entry,
+	     number_of_records,
+	     records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve records: %d to %d.",
+		 function,
+		 first_record_entry,
+		 first_record_entry + number_of_records );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_index->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
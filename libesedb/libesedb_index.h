@@ -30,9 +30,10 @@
 #include "libesedb_io_handle.h"
 #include "libesedb_libbfio.h"
 #include "libesedb_libcerror.h"
-#include "libesedb_libfcache.h"
-#include "libesedb_libfdata.h"
+#include "libesedb_libcthreads.h"
+#include "libesedb_page_cache.h"
 #include "libesedb_page_tree.h"
+#include "libesedb_page_tree_key.h"
 #include "libesedb_table_definition.h"
 #include "libesedb_types.h"
 
@@ -40,6 +41,19 @@
 extern "C" {
 #endif
 
+typedef struct libesedb_index_bookmark libesedb_index_bookmark_t;
+
+struct libesedb_index_bookmark
+{
+	/* The record index
+	 */
+	int record_index;
+
+	/* The key of the record in the table
+	 */
+	libesedb_page_tree_key_t *key;
+};
+
 typedef struct libesedb_internal_index libesedb_internal_index_t;
 
 struct libesedb_internal_index
@@ -64,21 +78,9 @@ struct libesedb_internal_index
 	 */
 	libesedb_catalog_definition_t *index_catalog_definition;
 
-	/* The pages vector
-	 */
-	libfdata_vector_t *pages_vector;
-
-	/* The pages cache
+	/* The page cache
 	 */
-	libfcache_cache_t *pages_cache;
-
-	/* The long values pages vector
-	 */
-	libfdata_vector_t *long_values_pages_vector;
-
-	/* The long values pages cache
-	 */
-	libfcache_cache_t *long_values_pages_cache;
+	libesedb_page_cache_t *page_cache;
 
 	/* The table page tree
 	 */
@@ -91,6 +93,12 @@ struct libesedb_internal_index
 	/* The index page tree
 	 */
 	libesedb_page_tree_t *index_page_tree;
+
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
 };
 
 int libesedb_index_initialize(
@@ -100,10 +108,7 @@ int libesedb_index_initialize(
      libesedb_table_definition_t *table_definition,
      libesedb_table_definition_t *template_table_definition,
      libesedb_catalog_definition_t *index_catalog_definition,
-     libfdata_vector_t *pages_vector,
-     libfcache_cache_t *pages_cache,
-     libfdata_vector_t *long_values_pages_vector,
-     libfcache_cache_t *long_values_pages_cache,
+     libesedb_page_cache_t *page_cache,
      libesedb_page_tree_t *table_page_tree,
      libesedb_page_tree_t *long_values_page_tree,
      libcerror_error_t **error );
@@ -151,6 +156,12 @@ int libesedb_index_get_number_of_records(
      int *number_of_records,
      libcerror_error_t **error );
 
+int libesedb_internal_index_get_record(
+     libesedb_internal_index_t *internal_index,
+     int record_entry,
+     libesedb_record_t **record,
+     libcerror_error_t **error );
+
 LIBESEDB_EXTERN \
 int libesedb_index_get_record(
      libesedb_index_t *index,
@@ -158,6 +169,41 @@ int libesedb_index_get_record(
      libesedb_record_t **record,
      libcerror_error_t **error );
 
+int libesedb_index_bookmark_free(
+     libesedb_index_bookmark_t **index_bookmark,
+     libcerror_error_t **error );
+
+int libesedb_index_bookmark_compare(
+     libesedb_index_bookmark_t *first_index_bookmark,
+     libesedb_index_bookmark_t *second_index_bookmark,
+     libcerror_error_t **error );
+
+int libesedb_internal_index_get_bookmark(
+     libesedb_internal_index_t *internal_index,
+     int record_entry,
+     libesedb_index_bookmark_t **index_bookmark,
+     libcerror_error_t **error );
+
+int libesedb_index_bookmarks_sort(
+     libesedb_index_bookmark_t **index_bookmarks,
+     int number_of_index_bookmarks,
+     libcerror_error_t **error );
+
+int libesedb_internal_index_get_records(
+     libesedb_internal_index_t *internal_index,
+     int first_record_entry,
+     int number_of_records,
+     libesedb_record_t **records,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_index_get_records(
+     libesedb_index_t *index,
+     int first_record_entry,
+     int number_of_records,
+     libesedb_record_t **records,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -32,9 +32,6 @@
 #include "libesedb_libbfio.h"
 #include "libesedb_libcerror.h"
 #include "libesedb_libcnotify.h"
-#include "libesedb_libfdata.h"
-#include "libesedb_page.h"
-#include "libesedb_unused.h"
 
 const uint8_t esedb_file_signature[ 4 ] = { 0xef, 0xcd, 0xab, 0x89 };
 
@@ -221,89 +218,3 @@ int libesedb_io_handle_set_pages_data_range(
 
 	return( 1 );
 }
-
-/* Reads a page
- * Callback function for the page vector
- * Returns 1 if successful or -1 on error
- */
-int libesedb_io_handle_read_page(
-     libesedb_io_handle_t *io_handle,
-     libbfio_handle_t *file_io_handle,
-     libfdata_vector_t *vector,
-     libfdata_cache_t *cache,
-     int element_index,
-     int element_file_index LIBESEDB_ATTRIBUTE_UNUSED,
-     off64_t element_offset,
-     size64_t element_size LIBESEDB_ATTRIBUTE_UNUSED,
-     uint32_t element_flags LIBESEDB_ATTRIBUTE_UNUSED,
-     uint8_t read_flags LIBESEDB_ATTRIBUTE_UNUSED,
-     libcerror_error_t **error )
-{
-	libesedb_page_t *page = NULL;
-	static char *function = "libesedb_io_handle_read_page";
-
-	LIBESEDB_UNREFERENCED_PARAMETER( element_file_index );
-	LIBESEDB_UNREFERENCED_PARAMETER( element_size );
-	LIBESEDB_UNREFERENCED_PARAMETER( element_flags );
-	LIBESEDB_UNREFERENCED_PARAMETER( read_flags );
-
-	if( libesedb_page_initialize(
-	     &page,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create page.",
-		 function );
-
-		goto on_error;
-	}
-	if( libesedb_page_read_file_io_handle(
-	     page,
-	     io_handle,
-	     file_io_handle,
-	     element_offset,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_IO,
-		 LIBCERROR_IO_ERROR_READ_FAILED,
-		 "%s: unable to read page.",
-		 function );
-
-		goto on_error;
-	}
-	if( libfdata_vector_set_element_value_by_index(
-	     vector,
-	     (intptr_t *) file_io_handle,
-	     cache,
-	     element_index,
-	     (intptr_t *) page,
-	     (int (*)(intptr_t **, libcerror_error_t **)) &libesedb_page_free,
-	     LIBFDATA_VECTOR_ELEMENT_VALUE_FLAG_MANAGED,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
-		 "%s: unable to set page as element value.",
-		 function );
-
-		goto on_error;
-	}
-	return( 1 );
-
-on_error:
-	if( page != NULL )
-	{
-		libesedb_page_free(
-		 &page,
-		 NULL );
-	}
-	return( -1 );
-}
-
@@ -27,7 +27,6 @@
 
 #include "libesedb_libbfio.h"
 #include "libesedb_libcerror.h"
-#include "libesedb_libfdata.h"
 
 #if defined( __cplusplus )
 extern "C" {
@@ -71,10 +70,23 @@ struct libesedb_io_handle
 	 */
 	uint32_t page_size;
 
+	/* Value to indicate the pages have an extended page header
+	 * which also changes the layout of the page tags
+	 */
+	uint8_t has_extended_page_header;
+
 	/* The last page number
 	 */
 	uint32_t last_page_number;
 
+	/* The database time
+	 */
+	uint64_t database_time;
+
+	/* The database signature
+	 */
+	uint8_t database_signature[ 28 ];
+
 	/* The codepage of the ASCII strings
 	 */
 	int ascii_codepage;
@@ -101,19 +113,6 @@ int libesedb_io_handle_set_pages_data_range(
      size64_t file_size,
      libcerror_error_t **error );
 
-int libesedb_io_handle_read_page(
-     libesedb_io_handle_t *io_handle,
-     libbfio_handle_t *file_io_handle,
-     libfdata_vector_t *vector,
-     libfdata_cache_t *cache,
-     int element_index,
-     int element_file_index,
-     off64_t element_offset,
-     size64_t element_size,
-     uint32_t element_flags,
-     uint8_t read_flags,
-     libcerror_error_t **error );
-
 #if defined( __cplusplus )
 }
 #endif
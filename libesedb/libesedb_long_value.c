@@ -30,6 +30,7 @@
 #include "libesedb_libbfio.h"
 #include "libesedb_libcerror.h"
 #include "libesedb_libcnotify.h"
+#include "libesedb_libcthreads.h"
 #include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
 #include "libesedb_libfvalue.h"
@@ -145,6 +146,21 @@ int libesedb_long_value_initialize(
 	internal_long_value->column_catalog_definition = column_catalog_definition;
 	internal_long_value->data_segments_list        = data_segments_list;
 
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( internal_long_value->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
 	*long_value = (libesedb_long_value_t *) internal_long_value;
 
 	return( 1 );
@@ -235,6 +251,21 @@ int libesedb_long_value_free(
 				result = -1;
 			}
 		}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( internal_long_value->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
 		memory_free(
 		 internal_long_value );
 	}
@@ -283,23 +314,23 @@ int libesedb_long_value_get_data_size(
 }
 
 /* Retrieve the data
+ * This function is not multi-thread safe acquire write lock before call
  * Returns 1 if successful or -1 on error
  */
-int libesedb_long_value_get_data(
-     libesedb_long_value_t *long_value,
+int libesedb_internal_long_value_get_data(
+     libesedb_internal_long_value_t *internal_long_value,
      uint8_t *data,
      size_t data_size,
      libcerror_error_t **error )
 {
-	libesedb_data_segment_t *data_segment               = NULL;
-	libesedb_internal_long_value_t *internal_long_value = NULL;
-	static char *function                               = "libesedb_long_value_get_data";
-	size64_t data_segments_size                         = 0;
-	size_t data_offset                                  = 0;
-	int data_segment_index                              = 0;
-	int number_of_data_segments                         = 0;
+	libesedb_data_segment_t *data_segment = NULL;
+	static char *function                 = "libesedb_internal_long_value_get_data";
+	size64_t data_segments_size           = 0;
+	size_t data_offset                    = 0;
+	int data_segment_index                = 0;
+	int number_of_data_segments           = 0;
 
-	if( long_value == NULL )
+	if( internal_long_value == NULL )
 	{
 		libcerror_error_set(
 		 error,
@@ -310,8 +341,6 @@ int libesedb_long_value_get_data(
 
 		return( -1 );
 	}
-	internal_long_value = (libesedb_internal_long_value_t *) long_value;
-
 	if( data == NULL )
 	{
 		libcerror_error_set(
@@ -427,18 +456,94 @@ int libesedb_long_value_get_data(
 	return( 1 );
 }
 
-/* Retrieve the record value
+/* Retrieve the data
  * Returns 1 if successful or -1 on error
  */
-int libesedb_long_value_get_record_value(
+int libesedb_long_value_get_data(
+     libesedb_long_value_t *long_value,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libesedb_internal_long_value_t *internal_long_value = NULL;
+	static char *function                               = "libesedb_long_value_get_data";
+	int result                                          = 1;
+
+	if( long_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid long value.",
+		 function );
+
+		return( -1 );
+	}
+	internal_long_value = (libesedb_internal_long_value_t *) long_value;
+
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	/* The lock is grabbed for writing since reading a data segment modifies the data segments cache
+	 */
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_long_value->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libesedb_internal_long_value_get_data(
+	     internal_long_value,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data.",
+		 function );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_long_value->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Reads the record value
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_long_value_read_record_value(
      libesedb_internal_long_value_t *internal_long_value,
-     libfvalue_value_t **record_value,
      libcerror_error_t **error )
 {
 	libesedb_data_segment_t *data_segment = NULL;
 	uint8_t *compressed_data              = NULL;
 	uint8_t *data                         = NULL;
-	static char *function                 = "libesedb_long_value_get_record_value";
+	static char *function                 = "libesedb_long_value_read_record_value";
 	size64_t data_size                    = 0;
 	size_t compressed_data_size           = 0;
 	size_t data_offset                    = 0;
@@ -471,17 +576,6 @@ int libesedb_long_value_get_record_value(
 
 		return( -1 );
 	}
-	if( record_value == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record value.",
-		 function );
-
-		return( -1 );
-	}
 	if( internal_long_value->record_value == NULL )
 	{
 		if( libfdata_list_get_size(
@@ -762,8 +856,6 @@ int libesedb_long_value_get_record_value(
 		 */
 		data = NULL;
 	}
-	*record_value = internal_long_value->record_value;
-
 	return( 1 );
 
 on_error:
@@ -786,6 +878,133 @@ on_error:
 	return( -1 );
 }
 
+/* Retrieve the record value
+ * The record value is read on first access
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_long_value_get_record_value(
+     libesedb_internal_long_value_t *internal_long_value,
+     libfvalue_value_t **record_value,
+     libcerror_error_t **error )
+{
+	libfvalue_value_t *safe_record_value = NULL;
+	static char *function                = "libesedb_long_value_get_record_value";
+	int result                           = 1;
+
+	if( internal_long_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid long value.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record value.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_long_value->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	safe_record_value = internal_long_value->record_value;
+
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_long_value->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	/* The record value is only read once, after which it is no longer modified
+	 */
+	if( safe_record_value == NULL )
+	{
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_grab_for_write(
+		     internal_long_value->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for writing.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+		if( internal_long_value->record_value == NULL )
+		{
+			if( libesedb_long_value_read_record_value(
+			     internal_long_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read record value.",
+				 function );
+
+				result = -1;
+			}
+		}
+		safe_record_value = internal_long_value->record_value;
+
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_release_for_write(
+		     internal_long_value->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for writing.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+	}
+	if( result == 1 )
+	{
+		*record_value = safe_record_value;
+	}
+	return( result );
+}
+
 /* Retrieve the number of data segments
  * Returns 1 if successful or -1 on error
  */
@@ -839,6 +1058,7 @@ int libesedb_long_value_get_data_segment_size(
 	libesedb_data_segment_t *data_segment               = NULL;
 	libesedb_internal_long_value_t *internal_long_value = NULL;
 	static char *function                               = "libesedb_long_value_get_data_segment_size";
+	int result                                          = 1;
 
 	if( long_value == NULL )
 	{
@@ -853,6 +1073,23 @@ int libesedb_long_value_get_data_segment_size(
 	}
 	internal_long_value = (libesedb_internal_long_value_t *) long_value;
 
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	/* The lock is grabbed for writing since reading a data segment modifies the data segments cache
+	 */
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_long_value->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
 	if( libfdata_list_get_element_value_by_index(
 	     internal_long_value->data_segments_list,
 	     (intptr_t *) internal_long_value->file_io_handle,
@@ -870,12 +1107,12 @@ int libesedb_long_value_get_data_segment_size(
 		 function,
 		 data_segment_index );
 
-		return( -1 );
+		result = -1;
 	}
-	if( libesedb_data_segment_get_data_size(
-	     data_segment,
-	     data_size,
-	     error ) != 1 )
+	else if( libesedb_data_segment_get_data_size(
+	          data_segment,
+	          data_size,
+	          error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -885,9 +1122,24 @@ int libesedb_long_value_get_data_segment_size(
 		 function,
 		 data_segment_index );
 
+		result = -1;
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_long_value->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
 		return( -1 );
 	}
-	return( 1 );
+#endif
+	return( result );
 }
 
 /* Retrieve the data segment
@@ -903,6 +1155,7 @@ int libesedb_long_value_get_data_segment(
 	libesedb_data_segment_t *data_segment               = NULL;
 	libesedb_internal_long_value_t *internal_long_value = NULL;
 	static char *function                               = "libesedb_long_value_get_data_segment";
+	int result                                          = 1;
 
 	if( long_value == NULL )
 	{
@@ -917,6 +1170,23 @@ int libesedb_long_value_get_data_segment(
 	}
 	internal_long_value = (libesedb_internal_long_value_t *) long_value;
 
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	/* The lock is grabbed for writing since reading a data segment modifies the data segments cache
+	 */
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_long_value->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
 	if( libfdata_list_get_element_value_by_index(
 	     internal_long_value->data_segments_list,
 	     (intptr_t *) internal_long_value->file_io_handle,
@@ -934,13 +1204,13 @@ int libesedb_long_value_get_data_segment(
 		 function,
 		 data_segment_index );
 
-		return( -1 );
+		result = -1;
 	}
-	if( libesedb_data_segment_get_data(
-	     data_segment,
-	     data,
-	     data_size,
-	     error ) != 1 )
+	else if( libesedb_data_segment_get_data(
+	          data_segment,
+	          data,
+	          data_size,
+	          error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -950,9 +1220,24 @@ int libesedb_long_value_get_data_segment(
 		 function,
 		 data_segment_index );
 
+		result = -1;
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_long_value->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
 		return( -1 );
 	}
-	return( 1 );
+#endif
+	return( result );
 }
 
 /* Retrieves the size of the data as an UTF-8 encoded string
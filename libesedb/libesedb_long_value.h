@@ -30,6 +30,7 @@
 #include "libesedb_io_handle.h"
 #include "libesedb_libbfio.h"
 #include "libesedb_libcerror.h"
+#include "libesedb_libcthreads.h"
 #include "libesedb_libfcache.h"
 #include "libesedb_libfdata.h"
 #include "libesedb_libfvalue.h"
@@ -66,6 +67,12 @@ struct libesedb_internal_long_value
 	/* The record value
 	 */
 	libfvalue_value_t *record_value;
+
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
 };
 
 int libesedb_long_value_initialize(
@@ -87,6 +94,12 @@ int libesedb_long_value_get_data_size(
      size64_t *data_size,
      libcerror_error_t **error );
 
+int libesedb_internal_long_value_get_data(
+     libesedb_internal_long_value_t *internal_long_value,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
 LIBESEDB_EXTERN \
 int libesedb_long_value_get_data(
      libesedb_long_value_t *long_value,
@@ -94,6 +107,10 @@ int libesedb_long_value_get_data(
      size_t data_size,
      libcerror_error_t **error );
 
+int libesedb_long_value_read_record_value(
+     libesedb_internal_long_value_t *internal_long_value,
+     libcerror_error_t **error );
+
 int libesedb_long_value_get_record_value(
      libesedb_internal_long_value_t *internal_long_value,
      libfvalue_value_t **record_value,
@@ -0,0 +1,1647 @@
+/*
+ * Metadata cache functions
+ *
+ * Copyright (C) 2009-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libesedb_definitions.h"
+#include "libesedb_io_handle.h"
+#include "libesedb_libbfio.h"
+#include "libesedb_libcdata.h"
+#include "libesedb_libcerror.h"
+#include "libesedb_libcthreads.h"
+#include "libesedb_metadata_cache.h"
+#include "libesedb_metadata_cache_entry.h"
+#include "libesedb_page_tree.h"
+
+#include "esedb_metadata_cache.h"
+
+const uint8_t esedb_metadata_cache_signature[ 8 ] = { 'e', 's', 'e', 'd', 'b', 'm', 'c', 0x00 };
+
+/* Creates a metadata cache
+ * The metadata cache is bound to the database file described by the IO handle
+ * Make sure the value metadata_cache is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_metadata_cache_initialize(
+     libesedb_metadata_cache_t **metadata_cache,
+     libesedb_io_handle_t *io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_metadata_cache_initialize";
+
+	if( metadata_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metadata cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *metadata_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid metadata cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	*metadata_cache = memory_allocate_structure(
+	                   libesedb_metadata_cache_t );
+
+	if( *metadata_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create metadata cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *metadata_cache,
+	     0,
+	     sizeof( libesedb_metadata_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear metadata cache.",
+		 function );
+
+		memory_free(
+		 *metadata_cache );
+
+		*metadata_cache = NULL;
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     ( *metadata_cache )->database_signature,
+	     io_handle->database_signature,
+	     28 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy database signature.",
+		 function );
+
+		goto on_error;
+	}
+	( *metadata_cache )->file_size        = (size64_t) io_handle->pages_data_offset + io_handle->pages_data_size;
+	( *metadata_cache )->database_time    = io_handle->database_time;
+	( *metadata_cache )->page_size        = io_handle->page_size;
+	( *metadata_cache )->last_page_number = io_handle->last_page_number;
+
+	if( libcdata_array_initialize(
+	     &( ( *metadata_cache )->entries_array ),
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create entries array.",
+		 function );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( ( *metadata_cache )->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( *metadata_cache != NULL )
+	{
+		if( ( *metadata_cache )->entries_array != NULL )
+		{
+			libcdata_array_free(
+			 &( ( *metadata_cache )->entries_array ),
+			 NULL,
+			 NULL );
+		}
+		memory_free(
+		 *metadata_cache );
+
+		*metadata_cache = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a metadata cache
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_metadata_cache_free(
+     libesedb_metadata_cache_t **metadata_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_metadata_cache_free";
+	int result            = 1;
+
+	if( metadata_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metadata cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *metadata_cache != NULL )
+	{
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( ( *metadata_cache )->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		if( libcdata_array_free(
+		     &( ( *metadata_cache )->entries_array ),
+		     (int (*)(intptr_t **, libcerror_error_t **)) &libesedb_metadata_cache_entry_free,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free entries array.",
+			 function );
+
+			result = -1;
+		}
+		if( ( *metadata_cache )->catalog_data != NULL )
+		{
+			memory_free(
+			 ( *metadata_cache )->catalog_data );
+		}
+		memory_free(
+		 *metadata_cache );
+
+		*metadata_cache = NULL;
+	}
+	return( result );
+}
+
+/* Retrieves the entry of a specific page tree root page number
+ * This function does not grab the read/write lock
+ * Returns 1 if successful, 0 if no such entry or -1 on error
+ */
+int libesedb_metadata_cache_get_entry_by_root_page_number(
+     libesedb_metadata_cache_t *metadata_cache,
+     uint32_t root_page_number,
+     libesedb_metadata_cache_entry_t **metadata_cache_entry,
+     libcerror_error_t **error )
+{
+	libesedb_metadata_cache_entry_t *safe_metadata_cache_entry = NULL;
+	static char *function                                      = "libesedb_metadata_cache_get_entry_by_root_page_number";
+	int entry_index                                            = 0;
+	int number_of_entries                                      = 0;
+
+	if( metadata_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metadata cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( metadata_cache_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metadata cache entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcdata_array_get_number_of_entries(
+	     metadata_cache->entries_array,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries.",
+		 function );
+
+		return( -1 );
+	}
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     metadata_cache->entries_array,
+		     entry_index,
+		     (intptr_t **) &safe_metadata_cache_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve entry: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		if( safe_metadata_cache_entry == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+			 "%s: missing entry: %d.",
+			 function,
+			 entry_index );
+
+			return( -1 );
+		}
+		if( safe_metadata_cache_entry->root_page_number == root_page_number )
+		{
+			*metadata_cache_entry = safe_metadata_cache_entry;
+
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Restores the leaf page descriptors of a page tree from the metadata cache
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libesedb_metadata_cache_get_leaf_page_descriptors(
+     libesedb_metadata_cache_t *metadata_cache,
+     libesedb_page_tree_t *page_tree,
+     libcerror_error_t **error )
+{
+	libesedb_metadata_cache_entry_t *metadata_cache_entry = NULL;
+	static char *function                                 = "libesedb_metadata_cache_get_leaf_page_descriptors";
+	int result                                            = 0;
+
+	if( metadata_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metadata cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page tree.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     metadata_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libesedb_metadata_cache_get_entry_by_root_page_number(
+	          metadata_cache,
+	          page_tree->root_page_number,
+	          &metadata_cache_entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry of root page: %" PRIu32 ".",
+		 function,
+		 page_tree->root_page_number );
+	}
+	else if( result != 0 )
+	{
+		result = libesedb_page_tree_set_leaf_page_descriptors(
+		          page_tree,
+		          metadata_cache_entry->leaf_page_descriptors,
+		          metadata_cache_entry->number_of_leaf_page_descriptors,
+		          metadata_cache_entry->number_of_leaf_values,
+		          error );
+
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set leaf page descriptors of page tree.",
+			 function );
+		}
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     metadata_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Stores the leaf page descriptors of a page tree in the metadata cache
+ * Only page trees of which all leaf pages have been read are stored
+ * Returns 1 if successful, 0 if not stored or -1 on error
+ */
+int libesedb_metadata_cache_set_leaf_page_descriptors(
+     libesedb_metadata_cache_t *metadata_cache,
+     libesedb_page_tree_t *page_tree,
+     libcerror_error_t **error )
+{
+	libesedb_metadata_cache_entry_t *metadata_cache_entry = NULL;
+	static char *function                                 = "libesedb_metadata_cache_set_leaf_page_descriptors";
+	int entry_index                                       = 0;
+	int result                                            = 0;
+
+	if( metadata_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metadata cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( page_tree->number_of_leaf_values < 0 )
+	 || ( page_tree->next_leaf_page_number != 0 ) )
+	{
+		return( 0 );
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     metadata_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	result = libesedb_metadata_cache_get_entry_by_root_page_number(
+	          metadata_cache,
+	          page_tree->root_page_number,
+	          &metadata_cache_entry,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve entry of root page: %" PRIu32 ".",
+		 function,
+		 page_tree->root_page_number );
+
+		goto on_error;
+	}
+	else if( result != 0 )
+	{
+		metadata_cache_entry = NULL;
+		result               = 0;
+	}
+	else
+	{
+		if( libesedb_metadata_cache_entry_initialize(
+		     &metadata_cache_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create entry.",
+			 function );
+
+			goto on_error;
+		}
+		metadata_cache_entry->root_page_number      = page_tree->root_page_number;
+		metadata_cache_entry->number_of_leaf_values = page_tree->number_of_leaf_values;
+
+		if( libesedb_metadata_cache_entry_set_leaf_page_descriptors(
+		     metadata_cache_entry,
+		     page_tree->leaf_page_descriptors,
+		     page_tree->number_of_leaf_page_descriptors,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set leaf page descriptors of entry.",
+			 function );
+
+			goto on_error;
+		}
+		if( libcdata_array_append_entry(
+		     metadata_cache->entries_array,
+		     &entry_index,
+		     (intptr_t *) metadata_cache_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append entry to array.",
+			 function );
+
+			goto on_error;
+		}
+		metadata_cache_entry = NULL;
+		result               = 1;
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     metadata_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+
+on_error:
+	if( metadata_cache_entry != NULL )
+	{
+		libesedb_metadata_cache_entry_free(
+		 &metadata_cache_entry,
+		 NULL );
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 metadata_cache->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Retrieves the catalog data
+ * The catalog data is not changed once set
+ * Returns 1 if successful, 0 if not available or -1 on error
+ */
+int libesedb_metadata_cache_get_catalog_data(
+     libesedb_metadata_cache_t *metadata_cache,
+     const uint8_t **catalog_data,
+     size_t *catalog_data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_metadata_cache_get_catalog_data";
+	int result            = 0;
+
+	if( metadata_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metadata cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( catalog_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog data.",
+		 function );
+
+		return( -1 );
+	}
+	if( catalog_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog data size.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     metadata_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( metadata_cache->catalog_data != NULL )
+	{
+		*catalog_data      = metadata_cache->catalog_data;
+		*catalog_data_size = metadata_cache->catalog_data_size;
+
+		result = 1;
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     metadata_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Sets the catalog data
+ * The catalog data consists of catalog values, each a 32-bit little-endian data size followed by the data
+ * Returns 1 if successful, 0 if the catalog data was already set or -1 on error
+ */
+int libesedb_metadata_cache_set_catalog_data(
+     libesedb_metadata_cache_t *metadata_cache,
+     const uint8_t *catalog_data,
+     size_t catalog_data_size,
+     libcerror_error_t **error )
+{
+	uint8_t *safe_catalog_data = NULL;
+	static char *function      = "libesedb_metadata_cache_set_catalog_data";
+	int result                 = 0;
+
+	if( metadata_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metadata cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( catalog_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( catalog_data_size == 0 )
+	 || ( catalog_data_size > (size_t) UINT32_MAX )
+	 || ( catalog_data_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid catalog data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	safe_catalog_data = (uint8_t *) memory_allocate(
+	                                 sizeof( uint8_t ) * catalog_data_size );
+
+	if( safe_catalog_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create catalog data.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_copy(
+	     safe_catalog_data,
+	     catalog_data,
+	     catalog_data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy catalog data.",
+		 function );
+
+		memory_free(
+		 safe_catalog_data );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     metadata_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		memory_free(
+		 safe_catalog_data );
+
+		return( -1 );
+	}
+#endif
+	/* The catalog of an unmodified database file does not change
+	 * hence catalog data that was set before is kept
+	 */
+	if( metadata_cache->catalog_data == NULL )
+	{
+		metadata_cache->catalog_data      = safe_catalog_data;
+		metadata_cache->catalog_data_size = catalog_data_size;
+
+		safe_catalog_data = NULL;
+
+		result = 1;
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     metadata_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		result = -1;
+	}
+#endif
+	if( safe_catalog_data != NULL )
+	{
+		memory_free(
+		 safe_catalog_data );
+	}
+	return( result );
+}
+
+/* Reads the metadata cache
+ * Returns 1 if successful, 0 if the metadata cache does not match the database file or -1 on error
+ */
+int libesedb_metadata_cache_read_data(
+     libesedb_metadata_cache_t *metadata_cache,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	libesedb_metadata_cache_entry_t *existing_metadata_cache_entry = NULL;
+	libesedb_metadata_cache_entry_t *metadata_cache_entry          = NULL;
+	static char *function                                          = "libesedb_metadata_cache_read_data";
+	size_t data_offset                                             = 0;
+	size_t entry_data_size                                         = 0;
+	uint64_t database_time                                         = 0;
+	uint64_t file_size                                             = 0;
+	uint32_t catalog_data_size                                     = 0;
+	uint32_t format_version                                        = 0;
+	uint32_t number_of_entries                                     = 0;
+	uint32_t page_size                                             = 0;
+	uint32_t value_index                                           = 0;
+	int entry_index                                                = 0;
+	int result                                                     = 0;
+
+	if( metadata_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metadata cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < sizeof( esedb_metadata_cache_header_t ) )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_compare(
+	     ( (esedb_metadata_cache_header_t *) data )->signature,
+	     esedb_metadata_cache_signature,
+	     8 ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported metadata cache signature.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (esedb_metadata_cache_header_t *) data )->format_version,
+	 format_version );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (esedb_metadata_cache_header_t *) data )->number_of_entries,
+	 number_of_entries );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (esedb_metadata_cache_header_t *) data )->file_size,
+	 file_size );
+
+	byte_stream_copy_to_uint64_little_endian(
+	 ( (esedb_metadata_cache_header_t *) data )->database_time,
+	 database_time );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (esedb_metadata_cache_header_t *) data )->page_size,
+	 page_size );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (esedb_metadata_cache_header_t *) data )->catalog_data_size,
+	 catalog_data_size );
+
+	if( format_version != 2 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported metadata cache format version: %" PRIu32 ".",
+		 function,
+		 format_version );
+
+		return( -1 );
+	}
+	/* A metadata cache of another or a modified database file is ignored
+	 */
+	if( ( file_size != (uint64_t) metadata_cache->file_size )
+	 || ( database_time != metadata_cache->database_time )
+	 || ( page_size != metadata_cache->page_size )
+	 || ( memory_compare(
+	       ( (esedb_metadata_cache_header_t *) data )->database_signature,
+	       metadata_cache->database_signature,
+	       28 ) != 0 ) )
+	{
+		return( 0 );
+	}
+	data_offset = sizeof( esedb_metadata_cache_header_t );
+
+	if( (size_t) catalog_data_size > ( data_size - data_offset ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid catalog data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( catalog_data_size > 0 )
+	{
+		if( libesedb_metadata_cache_set_catalog_data(
+		     metadata_cache,
+		     &( data[ data_offset ] ),
+		     (size_t) catalog_data_size,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set catalog data.",
+			 function );
+
+			return( -1 );
+		}
+		data_offset += catalog_data_size;
+	}
+	if( (size_t) number_of_entries > ( ( data_size - data_offset ) / sizeof( esedb_metadata_cache_entry_t ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of entries value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	for( value_index = 0;
+	     value_index < number_of_entries;
+	     value_index++ )
+	{
+		if( libesedb_metadata_cache_entry_initialize(
+		     &metadata_cache_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create entry.",
+			 function );
+
+			goto on_error;
+		}
+		if( libesedb_metadata_cache_entry_read_data(
+		     metadata_cache_entry,
+		     &( data[ data_offset ] ),
+		     data_size - data_offset,
+		     metadata_cache->last_page_number,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read entry: %" PRIu32 ".",
+			 function,
+			 value_index );
+
+			goto on_error;
+		}
+		if( libesedb_metadata_cache_entry_get_data_size(
+		     metadata_cache_entry,
+		     &entry_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve entry: %" PRIu32 " data size.",
+			 function,
+			 value_index );
+
+			goto on_error;
+		}
+		data_offset += entry_data_size;
+
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_grab_for_write(
+		     metadata_cache->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for writing.",
+			 function );
+
+			goto on_error;
+		}
+#endif
+		/* Entries of page trees that were read since the file was opened take precedence
+		 */
+		result = libesedb_metadata_cache_get_entry_by_root_page_number(
+		          metadata_cache,
+		          metadata_cache_entry->root_page_number,
+		          &existing_metadata_cache_entry,
+		          error );
+
+		if( result == 0 )
+		{
+			result = libcdata_array_append_entry(
+			          metadata_cache->entries_array,
+			          &entry_index,
+			          (intptr_t *) metadata_cache_entry,
+			          error );
+
+			if( result == 1 )
+			{
+				metadata_cache_entry = NULL;
+			}
+		}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_release_for_write(
+		     metadata_cache->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for writing.",
+			 function );
+
+			goto on_error;
+		}
+#endif
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append entry: %" PRIu32 " to array.",
+			 function,
+			 value_index );
+
+			goto on_error;
+		}
+		if( metadata_cache_entry != NULL )
+		{
+			if( libesedb_metadata_cache_entry_free(
+			     &metadata_cache_entry,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free entry: %" PRIu32 ".",
+				 function,
+				 value_index );
+
+				goto on_error;
+			}
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( metadata_cache_entry != NULL )
+	{
+		libesedb_metadata_cache_entry_free(
+		 &metadata_cache_entry,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Reads the metadata cache
+ * Returns 1 if successful, 0 if the metadata cache does not match the database file or -1 on error
+ */
+int libesedb_metadata_cache_read_file_io_handle(
+     libesedb_metadata_cache_t *metadata_cache,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	uint8_t *data         = NULL;
+	static char *function = "libesedb_metadata_cache_read_file_io_handle";
+	size_t data_size      = 0;
+	int result            = 0;
+
+	if( metadata_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metadata cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_metadata_cache_read_data_from_file_io_handle(
+	     file_io_handle,
+	     &data,
+	     &data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read metadata cache data.",
+		 function );
+
+		goto on_error;
+	}
+	result = libesedb_metadata_cache_read_data(
+	          metadata_cache,
+	          data,
+	          data_size,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read metadata cache.",
+		 function );
+
+		goto on_error;
+	}
+	memory_free(
+	 data );
+
+	return( result );
+
+on_error:
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	return( -1 );
+}
+
+/* Reads the data of a metadata cache
+ * The data is validated when it is read by libesedb_metadata_cache_read_data
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_metadata_cache_read_data_from_file_io_handle(
+     libbfio_handle_t *file_io_handle,
+     uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	uint8_t *safe_data      = NULL;
+	static char *function   = "libesedb_metadata_cache_read_data_from_file_io_handle";
+	size64_t safe_data_size = 0;
+	ssize_t read_count      = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( *data != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid data value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libbfio_handle_get_size(
+	     file_io_handle,
+	     &safe_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve metadata cache size.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( safe_data_size < (size64_t) sizeof( esedb_metadata_cache_header_t ) )
+	 || ( safe_data_size > (size64_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid metadata cache size value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	safe_data = (uint8_t *) memory_allocate(
+	                         sizeof( uint8_t ) * (size_t) safe_data_size );
+
+	if( safe_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create metadata cache data.",
+		 function );
+
+		goto on_error;
+	}
+	read_count = libbfio_handle_read_buffer_at_offset(
+	              file_io_handle,
+	              safe_data,
+	              (size_t) safe_data_size,
+	              0,
+	              error );
+
+	if( read_count != (ssize_t) safe_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read metadata cache data at offset: 0 (0x00000000).",
+		 function );
+
+		goto on_error;
+	}
+	*data      = safe_data;
+	*data_size = (size_t) safe_data_size;
+
+	return( 1 );
+
+on_error:
+	if( safe_data != NULL )
+	{
+		memory_free(
+		 safe_data );
+	}
+	return( -1 );
+}
+
+/* Writes the metadata cache
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_metadata_cache_write_file_io_handle(
+     libesedb_metadata_cache_t *metadata_cache,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error )
+{
+	libesedb_metadata_cache_entry_t *metadata_cache_entry = NULL;
+	uint8_t *data                                         = NULL;
+	static char *function                                 = "libesedb_metadata_cache_write_file_io_handle";
+	size_t data_offset                                    = 0;
+	size_t data_size                                      = 0;
+	size_t entry_data_size                                = 0;
+	ssize_t write_count                                   = 0;
+	int entry_index                                       = 0;
+	int number_of_entries                                 = 0;
+
+	if( metadata_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metadata cache.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     metadata_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libcdata_array_get_number_of_entries(
+	     metadata_cache->entries_array,
+	     &number_of_entries,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of entries.",
+		 function );
+
+		goto on_error;
+	}
+	/* The first pass determines the size of the metadata cache data
+	 * the second pass writes the entries
+	 */
+	data_size = sizeof( esedb_metadata_cache_header_t ) + metadata_cache->catalog_data_size;
+
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     metadata_cache->entries_array,
+		     entry_index,
+		     (intptr_t **) &metadata_cache_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve entry: %d.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		if( libesedb_metadata_cache_entry_get_data_size(
+		     metadata_cache_entry,
+		     &entry_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve entry: %d data size.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		if( entry_data_size > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE - data_size ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid metadata cache data size value exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		data_size += entry_data_size;
+	}
+	data = (uint8_t *) memory_allocate(
+	                    sizeof( uint8_t ) * data_size );
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create metadata cache data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     data,
+	     0,
+	     sizeof( esedb_metadata_cache_header_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear metadata cache header.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     ( (esedb_metadata_cache_header_t *) data )->signature,
+	     esedb_metadata_cache_signature,
+	     8 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy signature.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (esedb_metadata_cache_header_t *) data )->format_version,
+	 2 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (esedb_metadata_cache_header_t *) data )->number_of_entries,
+	 (uint32_t) number_of_entries );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 ( (esedb_metadata_cache_header_t *) data )->file_size,
+	 (uint64_t) metadata_cache->file_size );
+
+	byte_stream_copy_from_uint64_little_endian(
+	 ( (esedb_metadata_cache_header_t *) data )->database_time,
+	 metadata_cache->database_time );
+
+	if( memory_copy(
+	     ( (esedb_metadata_cache_header_t *) data )->database_signature,
+	     metadata_cache->database_signature,
+	     28 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy database signature.",
+		 function );
+
+		goto on_error;
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (esedb_metadata_cache_header_t *) data )->page_size,
+	 metadata_cache->page_size );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (esedb_metadata_cache_header_t *) data )->catalog_data_size,
+	 (uint32_t) metadata_cache->catalog_data_size );
+
+	data_offset = sizeof( esedb_metadata_cache_header_t );
+
+	if( metadata_cache->catalog_data != NULL )
+	{
+		if( memory_copy(
+		     &( data[ data_offset ] ),
+		     metadata_cache->catalog_data,
+		     metadata_cache->catalog_data_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy catalog data.",
+			 function );
+
+			goto on_error;
+		}
+		data_offset += metadata_cache->catalog_data_size;
+	}
+
+	for( entry_index = 0;
+	     entry_index < number_of_entries;
+	     entry_index++ )
+	{
+		if( libcdata_array_get_entry_by_index(
+		     metadata_cache->entries_array,
+		     entry_index,
+		     (intptr_t **) &metadata_cache_entry,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve entry: %d.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		if( libesedb_metadata_cache_entry_write_data(
+		     metadata_cache_entry,
+		     &( data[ data_offset ] ),
+		     data_size - data_offset,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_WRITE_FAILED,
+			 "%s: unable to write entry: %d.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		if( libesedb_metadata_cache_entry_get_data_size(
+		     metadata_cache_entry,
+		     &entry_data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve entry: %d data size.",
+			 function,
+			 entry_index );
+
+			goto on_error;
+		}
+		data_offset += entry_data_size;
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     metadata_cache->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		memory_free(
+		 data );
+
+		return( -1 );
+	}
+#endif
+	write_count = libbfio_handle_write_buffer_at_offset(
+	               file_io_handle,
+	               data,
+	               data_size,
+	               0,
+	               error );
+
+	if( write_count != (ssize_t) data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write metadata cache data at offset: 0 (0x00000000).",
+		 function );
+
+		memory_free(
+		 data );
+
+		return( -1 );
+	}
+	memory_free(
+	 data );
+
+	return( 1 );
+
+on_error:
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_read(
+	 metadata_cache->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
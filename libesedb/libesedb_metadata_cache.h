@@ -0,0 +1,150 @@
+/*
+ * Metadata cache functions
+ *
+ * Copyright (C) 2009-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBESEDB_METADATA_CACHE_H )
+#define _LIBESEDB_METADATA_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libesedb_io_handle.h"
+#include "libesedb_libbfio.h"
+#include "libesedb_libcdata.h"
+#include "libesedb_libcerror.h"
+#include "libesedb_libcthreads.h"
+#include "libesedb_metadata_cache_entry.h"
+#include "libesedb_page_tree.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+extern const uint8_t esedb_metadata_cache_signature[ 8 ];
+
+typedef struct libesedb_metadata_cache libesedb_metadata_cache_t;
+
+struct libesedb_metadata_cache
+{
+	/* The size of the database file
+	 */
+	size64_t file_size;
+
+	/* The database time
+	 */
+	uint64_t database_time;
+
+	/* The database signature
+	 */
+	uint8_t database_signature[ 28 ];
+
+	/* The page size
+	 */
+	uint32_t page_size;
+
+	/* The last page number
+	 */
+	uint32_t last_page_number;
+
+	/* The catalog data
+	 * Contains the leaf values of the catalog
+	 */
+	uint8_t *catalog_data;
+
+	/* The catalog data size
+	 */
+	size_t catalog_data_size;
+
+	/* The entries array
+	 */
+	libcdata_array_t *entries_array;
+
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
+};
+
+int libesedb_metadata_cache_initialize(
+     libesedb_metadata_cache_t **metadata_cache,
+     libesedb_io_handle_t *io_handle,
+     libcerror_error_t **error );
+
+int libesedb_metadata_cache_free(
+     libesedb_metadata_cache_t **metadata_cache,
+     libcerror_error_t **error );
+
+int libesedb_metadata_cache_get_entry_by_root_page_number(
+     libesedb_metadata_cache_t *metadata_cache,
+     uint32_t root_page_number,
+     libesedb_metadata_cache_entry_t **metadata_cache_entry,
+     libcerror_error_t **error );
+
+int libesedb_metadata_cache_get_leaf_page_descriptors(
+     libesedb_metadata_cache_t *metadata_cache,
+     libesedb_page_tree_t *page_tree,
+     libcerror_error_t **error );
+
+int libesedb_metadata_cache_set_leaf_page_descriptors(
+     libesedb_metadata_cache_t *metadata_cache,
+     libesedb_page_tree_t *page_tree,
+     libcerror_error_t **error );
+
+int libesedb_metadata_cache_get_catalog_data(
+     libesedb_metadata_cache_t *metadata_cache,
+     const uint8_t **catalog_data,
+     size_t *catalog_data_size,
+     libcerror_error_t **error );
+
+int libesedb_metadata_cache_set_catalog_data(
+     libesedb_metadata_cache_t *metadata_cache,
+     const uint8_t *catalog_data,
+     size_t catalog_data_size,
+     libcerror_error_t **error );
+
+int libesedb_metadata_cache_read_data(
+     libesedb_metadata_cache_t *metadata_cache,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+int libesedb_metadata_cache_read_file_io_handle(
+     libesedb_metadata_cache_t *metadata_cache,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+int libesedb_metadata_cache_read_data_from_file_io_handle(
+     libbfio_handle_t *file_io_handle,
+     uint8_t **data,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+int libesedb_metadata_cache_write_file_io_handle(
+     libesedb_metadata_cache_t *metadata_cache,
+     libbfio_handle_t *file_io_handle,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBESEDB_METADATA_CACHE_H ) */
+
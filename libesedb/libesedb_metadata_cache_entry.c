@@ -0,0 +1,588 @@
+/*
+ * Metadata cache entry functions
+ *
+ * Copyright (C) 2009-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libesedb_definitions.h"
+#include "libesedb_leaf_page_descriptor.h"
+#include "libesedb_libcerror.h"
+#include "libesedb_metadata_cache_entry.h"
+
+#include "esedb_metadata_cache.h"
+
+/* Creates a metadata cache entry
+ * Make sure the value metadata_cache_entry is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_metadata_cache_entry_initialize(
+     libesedb_metadata_cache_entry_t **metadata_cache_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_metadata_cache_entry_initialize";
+
+	if( metadata_cache_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metadata cache entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *metadata_cache_entry != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid metadata cache entry value already set.",
+		 function );
+
+		return( -1 );
+	}
+	*metadata_cache_entry = memory_allocate_structure(
+	                         libesedb_metadata_cache_entry_t );
+
+	if( *metadata_cache_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create metadata cache entry.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *metadata_cache_entry,
+	     0,
+	     sizeof( libesedb_metadata_cache_entry_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear metadata cache entry.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *metadata_cache_entry != NULL )
+	{
+		memory_free(
+		 *metadata_cache_entry );
+
+		*metadata_cache_entry = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a metadata cache entry
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_metadata_cache_entry_free(
+     libesedb_metadata_cache_entry_t **metadata_cache_entry,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_metadata_cache_entry_free";
+
+	if( metadata_cache_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metadata cache entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( *metadata_cache_entry != NULL )
+	{
+		if( ( *metadata_cache_entry )->leaf_page_descriptors != NULL )
+		{
+			memory_free(
+			 ( *metadata_cache_entry )->leaf_page_descriptors );
+		}
+		memory_free(
+		 *metadata_cache_entry );
+
+		*metadata_cache_entry = NULL;
+	}
+	return( 1 );
+}
+
+/* Sets the leaf page descriptors
+ * This function makes a copy of the leaf page descriptors
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_metadata_cache_entry_set_leaf_page_descriptors(
+     libesedb_metadata_cache_entry_t *metadata_cache_entry,
+     const libesedb_leaf_page_descriptor_t *leaf_page_descriptors,
+     int number_of_leaf_page_descriptors,
+     libcerror_error_t **error )
+{
+	libesedb_leaf_page_descriptor_t *safe_leaf_page_descriptors = NULL;
+	static char *function                                       = "libesedb_metadata_cache_entry_set_leaf_page_descriptors";
+	size_t leaf_page_descriptors_size                           = 0;
+
+	if( metadata_cache_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metadata cache entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( number_of_leaf_page_descriptors < 0 )
+	 || ( number_of_leaf_page_descriptors > LIBESEDB_MAXIMUM_NUMBER_OF_LEAF_PAGES ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of leaf page descriptors value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( leaf_page_descriptors == NULL )
+	 && ( number_of_leaf_page_descriptors > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid leaf page descriptors.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_leaf_page_descriptors > 0 )
+	{
+		leaf_page_descriptors_size = sizeof( libesedb_leaf_page_descriptor_t ) * (size_t) number_of_leaf_page_descriptors;
+
+		safe_leaf_page_descriptors = (libesedb_leaf_page_descriptor_t *) memory_allocate(
+		                                                                  leaf_page_descriptors_size );
+
+		if( safe_leaf_page_descriptors == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create leaf page descriptors.",
+			 function );
+
+			return( -1 );
+		}
+		if( memory_copy(
+		     safe_leaf_page_descriptors,
+		     leaf_page_descriptors,
+		     leaf_page_descriptors_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy leaf page descriptors.",
+			 function );
+
+			memory_free(
+			 safe_leaf_page_descriptors );
+
+			return( -1 );
+		}
+	}
+	if( metadata_cache_entry->leaf_page_descriptors != NULL )
+	{
+		memory_free(
+		 metadata_cache_entry->leaf_page_descriptors );
+	}
+	metadata_cache_entry->leaf_page_descriptors           = safe_leaf_page_descriptors;
+	metadata_cache_entry->number_of_leaf_page_descriptors = number_of_leaf_page_descriptors;
+
+	return( 1 );
+}
+
+/* Retrieves the size of the metadata cache entry data
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_metadata_cache_entry_get_data_size(
+     libesedb_metadata_cache_entry_t *metadata_cache_entry,
+     size_t *data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_metadata_cache_entry_get_data_size";
+
+	if( metadata_cache_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metadata cache entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data size.",
+		 function );
+
+		return( -1 );
+	}
+	*data_size = sizeof( esedb_metadata_cache_entry_t )
+	           + ( sizeof( esedb_metadata_cache_leaf_page_descriptor_t ) * (size_t) metadata_cache_entry->number_of_leaf_page_descriptors );
+
+	return( 1 );
+}
+
+/* Reads the metadata cache entry
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_metadata_cache_entry_read_data(
+     libesedb_metadata_cache_entry_t *metadata_cache_entry,
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t last_page_number,
+     libcerror_error_t **error )
+{
+	esedb_metadata_cache_leaf_page_descriptor_t *leaf_page_descriptor_data = NULL;
+	libesedb_leaf_page_descriptor_t *leaf_page_descriptor                  = NULL;
+	static char *function                                                  = "libesedb_metadata_cache_entry_read_data";
+	size_t data_offset                                                     = 0;
+	uint32_t first_leaf_value_index                                        = 0;
+	uint32_t last_leaf_value_index                                         = 0;
+	uint32_t next_leaf_value_index                                         = 0;
+	uint32_t number_of_leaf_page_descriptors                               = 0;
+	uint32_t number_of_leaf_values                                         = 0;
+	uint32_t page_number                                                   = 0;
+	uint32_t root_page_number                                              = 0;
+	int leaf_page_descriptor_index                                         = 0;
+
+	if( metadata_cache_entry == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid metadata cache entry.",
+		 function );
+
+		return( -1 );
+	}
+	if( metadata_cache_entry->leaf_page_descriptors != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid metadata cache entry - leaf page descriptors value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < sizeof( esedb_metadata_cache_entry_t ) )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (esedb_metadata_cache_entry_t *) data )->root_page_number,
+	 root_page_number );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (esedb_metadata_cache_entry_t *) data )->number_of_leaf_values,
+	 number_of_leaf_values );
+
+	byte_stream_copy_to_uint32_little_endian(
+	 ( (esedb_metadata_cache_entry_t *) data )->number_of_leaf_page_descriptors,
+	 number_of_leaf_page_descriptors );
+
+	if( ( root_page_number == 0 )
+	 || ( root_page_number > last_page_number ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid root page number value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_leaf_values > (uint32_t) INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of leaf values value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( ( number_of_leaf_page_descriptors > (uint32_t) LIBESEDB_MAXIMUM_NUMBER_OF_LEAF_PAGES )
+	 || ( (size_t) number_of_leaf_page_descriptors > ( ( data_size - sizeof( esedb_metadata_cache_entry_t ) ) / sizeof( esedb_metadata_cache_leaf_page_descriptor_t ) ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of leaf page descriptors value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_leaf_page_descriptors > 0 )
+	{
+		metadata_cache_entry->leaf_page_descriptors = (libesedb_leaf_page_descriptor_t *) memory_allocate(
+		                                                                                   sizeof( libesedb_leaf_page_descriptor_t ) * (size_t) number_of_leaf_page_descriptors );
+
+		if( metadata_cache_entry->leaf_page_descriptors == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create leaf page descriptors.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	data_offset = sizeof( esedb_metadata_cache_entry_t );
+
+	/* The leaf page descriptors must cover the leaf values contiguously and in order
+	 * otherwise the leaf page descriptor index cannot be searched
+	 */
+	for( leaf_page_descriptor_index = 0;
+	     leaf_page_descriptor_index < (int) number_of_leaf_page_descriptors;
+	     leaf_page_descriptor_index++ )
+	{
+		leaf_page_descriptor_data = (esedb_metadata_cache_leaf_page_descriptor_t *) &( data[ data_offset ] );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 leaf_page_descriptor_data->page_number,
+		 page_number );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 leaf_page_descriptor_data->first_leaf_value_index,
+		 first_leaf_value_index );
+
+		byte_stream_copy_to_uint32_little_endian(
+		 leaf_page_descriptor_data->last_leaf_value_index,
+		 last_leaf_value_index );
+
+		if( ( page_number == 0 )
+		 || ( page_number > last_page_number ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid leaf page descriptor: %d - page number value out of bounds.",
+			 function,
+			 leaf_page_descriptor_index );
+
+			goto on_error;
+		}
+		/* A leaf page without leaf values has a last leaf value index of first leaf value index - 1
+		 */
+		if( ( first_leaf_value_index != next_leaf_value_index )
+		 || ( (uint32_t) ( last_leaf_value_index + 1 ) < first_leaf_value_index )
+		 || ( (uint32_t) ( last_leaf_value_index + 1 ) > number_of_leaf_values ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid leaf page descriptor: %d - leaf value index value out of bounds.",
+			 function,
+			 leaf_page_descriptor_index );
+
+			goto on_error;
+		}
+		next_leaf_value_index = (uint32_t) ( last_leaf_value_index + 1 );
+
+		leaf_page_descriptor = &( metadata_cache_entry->leaf_page_descriptors[ leaf_page_descriptor_index ] );
+
+		leaf_page_descriptor->page_number            = page_number;
+		leaf_page_descriptor->first_leaf_value_index = (int) first_leaf_value_index;
+		leaf_page_descriptor->last_leaf_value_index  = (int) next_leaf_value_index - 1;
+
+		data_offset += sizeof( esedb_metadata_cache_leaf_page_descriptor_t );
+	}
+	if( next_leaf_value_index != number_of_leaf_values )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of leaf values value does not match leaf page descriptors.",
+		 function );
+
+		goto on_error;
+	}
+	metadata_cache_entry->root_page_number                = root_page_number;
+	metadata_cache_entry->number_of_leaf_values           = (int) number_of_leaf_values;
+	metadata_cache_entry->number_of_leaf_page_descriptors = (int) number_of_leaf_page_descriptors;
+
+	return( 1 );
+
+on_error:
+	if( metadata_cache_entry->leaf_page_descriptors != NULL )
+	{
+		memory_free(
+		 metadata_cache_entry->leaf_page_descriptors );
+
+		metadata_cache_entry->leaf_page_descriptors = NULL;
+	}
+	return( -1 );
+}
+
+/* Writes the metadata cache entry
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_metadata_cache_entry_write_data(
+     libesedb_metadata_cache_entry_t *metadata_cache_entry,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	esedb_metadata_cache_leaf_page_descriptor_t *leaf_page_descriptor_data = NULL;
+	libesedb_leaf_page_descriptor_t *leaf_page_descriptor                  = NULL;
+	static char *function                                                  = "libesedb_metadata_cache_entry_write_data";
+	size_t data_offset                                                     = 0;
+	size_t required_data_size                                              = 0;
+	int leaf_page_descriptor_index                                         = 0;
+
+	if( libesedb_metadata_cache_entry_get_data_size(
+	     metadata_cache_entry,
+	     &required_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( data_size < required_data_size )
+	 || ( data_size > (size_t) SSIZE_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid data size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (esedb_metadata_cache_entry_t *) data )->root_page_number,
+	 metadata_cache_entry->root_page_number );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (esedb_metadata_cache_entry_t *) data )->number_of_leaf_values,
+	 (uint32_t) metadata_cache_entry->number_of_leaf_values );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 ( (esedb_metadata_cache_entry_t *) data )->number_of_leaf_page_descriptors,
+	 (uint32_t) metadata_cache_entry->number_of_leaf_page_descriptors );
+
+	data_offset = sizeof( esedb_metadata_cache_entry_t );
+
+	for( leaf_page_descriptor_index = 0;
+	     leaf_page_descriptor_index < metadata_cache_entry->number_of_leaf_page_descriptors;
+	     leaf_page_descriptor_index++ )
+	{
+		leaf_page_descriptor      = &( metadata_cache_entry->leaf_page_descriptors[ leaf_page_descriptor_index ] );
+		leaf_page_descriptor_data = (esedb_metadata_cache_leaf_page_descriptor_t *) &( data[ data_offset ] );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 leaf_page_descriptor_data->page_number,
+		 leaf_page_descriptor->page_number );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 leaf_page_descriptor_data->first_leaf_value_index,
+		 (uint32_t) leaf_page_descriptor->first_leaf_value_index );
+
+		byte_stream_copy_from_uint32_little_endian(
+		 leaf_page_descriptor_data->last_leaf_value_index,
+		 (uint32_t) leaf_page_descriptor->last_leaf_value_index );
+
+		data_offset += sizeof( esedb_metadata_cache_leaf_page_descriptor_t );
+	}
+	return( 1 );
+}
+
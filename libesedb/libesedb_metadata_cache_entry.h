@@ -0,0 +1,93 @@
+/*
+ * Metadata cache entry functions
+ *
+ * Copyright (C) 2009-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBESEDB_METADATA_CACHE_ENTRY_H )
+#define _LIBESEDB_METADATA_CACHE_ENTRY_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libesedb_leaf_page_descriptor.h"
+#include "libesedb_libcerror.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libesedb_metadata_cache_entry libesedb_metadata_cache_entry_t;
+
+struct libesedb_metadata_cache_entry
+{
+	/* The root page number of the page tree
+	 */
+	uint32_t root_page_number;
+
+	/* The number of leaf values
+	 */
+	int number_of_leaf_values;
+
+	/* The leaf page descriptors, stored in leaf page order
+	 */
+	libesedb_leaf_page_descriptor_t *leaf_page_descriptors;
+
+	/* The number of leaf page descriptors
+	 */
+	int number_of_leaf_page_descriptors;
+};
+
+int libesedb_metadata_cache_entry_initialize(
+     libesedb_metadata_cache_entry_t **metadata_cache_entry,
+     libcerror_error_t **error );
+
+int libesedb_metadata_cache_entry_free(
+     libesedb_metadata_cache_entry_t **metadata_cache_entry,
+     libcerror_error_t **error );
+
+int libesedb_metadata_cache_entry_set_leaf_page_descriptors(
+     libesedb_metadata_cache_entry_t *metadata_cache_entry,
+     const libesedb_leaf_page_descriptor_t *leaf_page_descriptors,
+     int number_of_leaf_page_descriptors,
+     libcerror_error_t **error );
+
+int libesedb_metadata_cache_entry_get_data_size(
+     libesedb_metadata_cache_entry_t *metadata_cache_entry,
+     size_t *data_size,
+     libcerror_error_t **error );
+
+int libesedb_metadata_cache_entry_read_data(
+     libesedb_metadata_cache_entry_t *metadata_cache_entry,
+     const uint8_t *data,
+     size_t data_size,
+     uint32_t last_page_number,
+     libcerror_error_t **error );
+
+int libesedb_metadata_cache_entry_write_data(
+     libesedb_metadata_cache_entry_t *metadata_cache_entry,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBESEDB_METADATA_CACHE_ENTRY_H ) */
+
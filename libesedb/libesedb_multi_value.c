@@ -19,6 +19,7 @@
  * along with this program.  If not, see <https://www.gnu.org/licenses/>.
  */
 
+#include <byte_stream.h>
 #include <common.h>
 #include <memory.h>
 #include <types.h>
@@ -29,6 +30,7 @@
 #include "libesedb_libcerror.h"
 #include "libesedb_libfvalue.h"
 #include "libesedb_multi_value.h"
+#include "libesedb_string.h"
 #include "libesedb_types.h"
 
 /* Creates a multi value
@@ -403,6 +405,82 @@ int libesedb_multi_value_get_value_data(
 	return( 1 );
 }
 
+/* Retrieves a reference to the value data of the specific value
+ * The value data is not copied and remains valid as long as the multi value is not freed
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_multi_value_get_value_data_reference(
+     libesedb_multi_value_t *multi_value,
+     int multi_value_index,
+     const uint8_t **value_data,
+     size_t *value_data_size,
+     libcerror_error_t **error )
+{
+	libesedb_internal_multi_value_t *internal_multi_value = NULL;
+	uint8_t *entry_data                                   = NULL;
+	static char *function                                 = "libesedb_multi_value_get_value_data_reference";
+	size_t entry_data_size                                = 0;
+	int encoding                                          = 0;
+
+	if( multi_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid multi value.",
+		 function );
+
+		return( -1 );
+	}
+	internal_multi_value = (libesedb_internal_multi_value_t *) multi_value;
+
+	if( value_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_data_size == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data size.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfvalue_value_get_entry_data(
+	     internal_multi_value->record_value,
+	     multi_value_index,
+	     &entry_data,
+	     &entry_data_size,
+	     &encoding,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value entry data: %d.",
+		 function,
+		 multi_value_index );
+
+		return( -1 );
+	}
+	*value_data      = entry_data;
+	*value_data_size = entry_data_size;
+
+	return( 1 );
+}
+
 /* Retrieves the 8-bit value of a specific value of the multi value
  * Returns 1 if successful or -1 on error
  */
@@ -905,24 +983,87 @@ int libesedb_multi_value_get_value_filetime(
 	return( 1 );
 }
 
-/* Retrieves the size of the UTF-8 encoded string of a specific value of the multi value
- * The returned size includes the end of string character
+/* Retrieves the number of values of the multi value and checks if they fit in an array
  * Returns 1 if successful or -1 on error
  */
-int libesedb_multi_value_get_value_utf8_string_size(
+int libesedb_internal_multi_value_get_number_of_array_values(
+     libesedb_internal_multi_value_t *internal_multi_value,
+     int array_size,
+     int *number_of_values,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_internal_multi_value_get_number_of_array_values";
+
+	if( internal_multi_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid multi value.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of values.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfvalue_value_get_number_of_value_entries(
+	     internal_multi_value->record_value,
+	     number_of_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of value entries.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( *number_of_values < 0 )
+	 || ( *number_of_values > array_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid array size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Retrieves the 32-bit values of all values of the multi value
+ * The values are decoded directly from the value data into the array
+ * The array must be large enough to contain the number of values of the multi value
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_multi_value_get_values_32bit(
      libesedb_multi_value_t *multi_value,
-     int multi_value_index,
-     size_t *utf8_string_size,
+     uint32_t *values_32bit,
+     int array_size,
      libcerror_error_t **error )
 {
 	libesedb_internal_multi_value_t *internal_multi_value = NULL;
 	uint8_t *entry_data                                   = NULL;
-	static char *function                                 = "libesedb_multi_value_get_value_utf8_string_size";
+	static char *function                                 = "libesedb_multi_value_get_values_32bit";
 	size_t entry_data_size                                = 0;
 	uint32_t column_type                                  = 0;
-	uint32_t data_flags                                   = 0;
 	int encoding                                          = 0;
-	int result                                            = 0;
+	int multi_value_index                                 = 0;
+	int number_of_values                                  = 0;
 
 	if( multi_value == NULL )
 	{
@@ -937,6 +1078,17 @@ int libesedb_multi_value_get_value_utf8_string_size(
 	}
 	internal_multi_value = (libesedb_internal_multi_value_t *) multi_value;
 
+	if( values_32bit == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid 32-bit values.",
+		 function );
+
+		return( -1 );
+	}
 	if( libesedb_catalog_definition_get_column_type(
 	     internal_multi_value->column_catalog_definition,
 	     &column_type,
@@ -951,8 +1103,8 @@ int libesedb_multi_value_get_value_utf8_string_size(
 
 		return( -1 );
 	}
-	if( ( column_type != LIBESEDB_COLUMN_TYPE_TEXT )
-	 && ( column_type != LIBESEDB_COLUMN_TYPE_LARGE_TEXT ) )
+	if( ( column_type != LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED )
+	 && ( column_type != LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED ) )
 	{
 		libcerror_error_set(
 		 error,
@@ -964,22 +1116,24 @@ int libesedb_multi_value_get_value_utf8_string_size(
 
 		return( -1 );
 	}
-	if( libfvalue_value_get_data_flags(
-	     internal_multi_value->record_value,
-	     &data_flags,
+	if( libesedb_internal_multi_value_get_number_of_array_values(
+	     internal_multi_value,
+	     array_size,
+	     &number_of_values,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve value data flags.",
+		 "%s: unable to retrieve number of values.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( ( data_flags & LIBESEDB_VALUE_FLAG_COMPRESSED ) != 0 )
-	 && ( multi_value_index == 0 ) )
+	for( multi_value_index = 0;
+	     multi_value_index < number_of_values;
+	     multi_value_index++ )
 	{
 		if( libfvalue_value_get_entry_data(
 		     internal_multi_value->record_value,
@@ -993,12 +1147,384 @@ int libesedb_multi_value_get_value_utf8_string_size(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve record value entry: %d data.",
+			 "%s: unable to retrieve value entry data: %d.",
+			 function,
+			 multi_value_index );
+
+			return( -1 );
+		}
+		if( ( entry_data == NULL )
+		 || ( entry_data_size != 4 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported value entry: %d data size: %" PRIzd ".",
+			 function,
+			 multi_value_index,
+			 entry_data_size );
+
+			return( -1 );
+		}
+		byte_stream_copy_to_uint32_little_endian(
+		 entry_data,
+		 values_32bit[ multi_value_index ] );
+	}
+	return( 1 );
+}
+
+/* Retrieves the 64-bit values of all values of the multi value
+ * The values are decoded directly from the value data into the array
+ * The array must be large enough to contain the number of values of the multi value
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_multi_value_get_values_64bit(
+     libesedb_multi_value_t *multi_value,
+     uint64_t *values_64bit,
+     int array_size,
+     libcerror_error_t **error )
+{
+	libesedb_internal_multi_value_t *internal_multi_value = NULL;
+	uint8_t *entry_data                                   = NULL;
+	static char *function                                 = "libesedb_multi_value_get_values_64bit";
+	size_t entry_data_size                                = 0;
+	uint32_t column_type                                  = 0;
+	int encoding                                          = 0;
+	int multi_value_index                                 = 0;
+	int number_of_values                                  = 0;
+
+	if( multi_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid multi value.",
+		 function );
+
+		return( -1 );
+	}
+	internal_multi_value = (libesedb_internal_multi_value_t *) multi_value;
+
+	if( values_64bit == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid 64-bit values.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_catalog_definition_get_column_type(
+	     internal_multi_value->column_catalog_definition,
+	     &column_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve catalog definition column type.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( column_type != LIBESEDB_COLUMN_TYPE_CURRENCY )
+	 && ( column_type != LIBESEDB_COLUMN_TYPE_INTEGER_64BIT_SIGNED ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported column type: %" PRIu32 ".",
+		 function,
+		 column_type );
+
+		return( -1 );
+	}
+	if( libesedb_internal_multi_value_get_number_of_array_values(
+	     internal_multi_value,
+	     array_size,
+	     &number_of_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of values.",
+		 function );
+
+		return( -1 );
+	}
+	for( multi_value_index = 0;
+	     multi_value_index < number_of_values;
+	     multi_value_index++ )
+	{
+		if( libfvalue_value_get_entry_data(
+		     internal_multi_value->record_value,
+		     multi_value_index,
+		     &entry_data,
+		     &entry_data_size,
+		     &encoding,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value entry data: %d.",
+			 function,
+			 multi_value_index );
+
+			return( -1 );
+		}
+		if( ( entry_data == NULL )
+		 || ( entry_data_size != 8 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported value entry: %d data size: %" PRIzd ".",
+			 function,
+			 multi_value_index,
+			 entry_data_size );
+
+			return( -1 );
+		}
+		byte_stream_copy_to_uint64_little_endian(
+		 entry_data,
+		 values_64bit[ multi_value_index ] );
+	}
+	return( 1 );
+}
+
+/* Retrieves the 64-bit filetime values of all values of the multi value
+ * The values are decoded directly from the value data into the array
+ * The array must be large enough to contain the number of values of the multi value
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_multi_value_get_values_filetime(
+     libesedb_multi_value_t *multi_value,
+     uint64_t *values_filetime,
+     int array_size,
+     libcerror_error_t **error )
+{
+	libesedb_internal_multi_value_t *internal_multi_value = NULL;
+	uint8_t *entry_data                                   = NULL;
+	static char *function                                 = "libesedb_multi_value_get_values_filetime";
+	size_t entry_data_size                                = 0;
+	uint32_t column_type                                  = 0;
+	int encoding                                          = 0;
+	int multi_value_index                                 = 0;
+	int number_of_values                                  = 0;
+
+	if( multi_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid multi value.",
+		 function );
+
+		return( -1 );
+	}
+	internal_multi_value = (libesedb_internal_multi_value_t *) multi_value;
+
+	if( values_filetime == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid 64-bit filetime values.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_catalog_definition_get_column_type(
+	     internal_multi_value->column_catalog_definition,
+	     &column_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve catalog definition column type.",
+		 function );
+
+		return( -1 );
+	}
+	if( column_type != LIBESEDB_COLUMN_TYPE_DATE_TIME )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported column type: %" PRIu32 ".",
+		 function,
+		 column_type );
+
+		return( -1 );
+	}
+	if( libesedb_internal_multi_value_get_number_of_array_values(
+	     internal_multi_value,
+	     array_size,
+	     &number_of_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of values.",
+		 function );
+
+		return( -1 );
+	}
+	for( multi_value_index = 0;
+	     multi_value_index < number_of_values;
+	     multi_value_index++ )
+	{
+		if( libfvalue_value_get_entry_data(
+		     internal_multi_value->record_value,
+		     multi_value_index,
+		     &entry_data,
+		     &entry_data_size,
+		     &encoding,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value entry data: %d.",
 			 function,
 			 multi_value_index );
 
 			return( -1 );
 		}
+		if( ( entry_data == NULL )
+		 || ( entry_data_size != 8 ) )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported value entry: %d data size: %" PRIzd ".",
+			 function,
+			 multi_value_index,
+			 entry_data_size );
+
+			return( -1 );
+		}
+		byte_stream_copy_to_uint64_little_endian(
+		 entry_data,
+		 values_filetime[ multi_value_index ] );
+	}
+	return( 1 );
+}
+
+/* Retrieves the size of the UTF-8 encoded string of a specific value of the multi value
+ * The returned size includes the end of string character
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_multi_value_get_value_utf8_string_size(
+     libesedb_multi_value_t *multi_value,
+     int multi_value_index,
+     size_t *utf8_string_size,
+     libcerror_error_t **error )
+{
+	libesedb_internal_multi_value_t *internal_multi_value = NULL;
+	uint8_t *entry_data                                   = NULL;
+	static char *function                                 = "libesedb_multi_value_get_value_utf8_string_size";
+	size_t entry_data_size                                = 0;
+	uint32_t column_type                                  = 0;
+	uint32_t data_flags                                   = 0;
+	int encoding                                          = 0;
+	int result                                            = 0;
+
+	if( multi_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid multi value.",
+		 function );
+
+		return( -1 );
+	}
+	internal_multi_value = (libesedb_internal_multi_value_t *) multi_value;
+
+	if( libesedb_catalog_definition_get_column_type(
+	     internal_multi_value->column_catalog_definition,
+	     &column_type,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve catalog definition column type.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( column_type != LIBESEDB_COLUMN_TYPE_TEXT )
+	 && ( column_type != LIBESEDB_COLUMN_TYPE_LARGE_TEXT ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported column type: %" PRIu32 ".",
+		 function,
+		 column_type );
+
+		return( -1 );
+	}
+	if( libfvalue_value_get_data_flags(
+	     internal_multi_value->record_value,
+	     &data_flags,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value data flags.",
+		 function );
+
+		return( -1 );
+	}
+	if( libfvalue_value_get_entry_data(
+	     internal_multi_value->record_value,
+	     multi_value_index,
+	     &entry_data,
+	     &entry_data_size,
+	     &encoding,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record value entry: %d data.",
+		 function,
+		 multi_value_index );
+
+		return( -1 );
+	}
+	if( ( ( data_flags & LIBESEDB_VALUE_FLAG_COMPRESSED ) != 0 )
+	 && ( multi_value_index == 0 ) )
+	{
 		result = libesedb_compression_get_utf8_string_size(
 			  entry_data,
 			  entry_data_size,
@@ -1007,11 +1533,28 @@ int libesedb_multi_value_get_value_utf8_string_size(
 	}
 	else
 	{
-		result = libfvalue_value_get_utf8_string_size(
-			  internal_multi_value->record_value,
-			  multi_value_index,
-			  utf8_string_size,
-			  error );
+		result = 0;
+
+		/* Convert codepage 1200 data directly when possible
+		 */
+		if( ( entry_data != NULL )
+		 && ( ( encoding == 1200 )
+		  ||  ( encoding == LIBFVALUE_CODEPAGE_1200_MIXED ) ) )
+		{
+			result = libesedb_string_get_utf8_string_size_from_utf16_stream(
+				  entry_data,
+				  entry_data_size,
+				  utf8_string_size,
+				  error );
+		}
+		if( result == 0 )
+		{
+			result = libfvalue_value_get_utf8_string_size(
+				  internal_multi_value->record_value,
+				  multi_value_index,
+				  utf8_string_size,
+				  error );
+		}
 	}
 	if( result != 1 )
 	{
@@ -1102,27 +1645,27 @@ int libesedb_multi_value_get_value_utf8_string(
 
 		return( -1 );
 	}
+	if( libfvalue_value_get_entry_data(
+	     internal_multi_value->record_value,
+	     multi_value_index,
+	     &entry_data,
+	     &entry_data_size,
+	     &encoding,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve record value entry: %d data.",
+		 function,
+		 multi_value_index );
+
+		return( -1 );
+	}
 	if( ( ( data_flags & LIBESEDB_VALUE_FLAG_COMPRESSED ) != 0 )
 	 && ( multi_value_index == 0 ) )
 	{
-		if( libfvalue_value_get_entry_data(
-		     internal_multi_value->record_value,
-		     multi_value_index,
-		     &entry_data,
-		     &entry_data_size,
-		     &encoding,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve record value entry: %d data.",
-			 function,
-			 multi_value_index );
-
-			return( -1 );
-		}
 		result = libesedb_compression_copy_to_utf8_string(
 			  entry_data,
 			  entry_data_size,
@@ -1132,12 +1675,30 @@ int libesedb_multi_value_get_value_utf8_string(
 	}
 	else
 	{
-		result = libfvalue_value_copy_to_utf8_string(
-			  internal_multi_value->record_value,
-			  multi_value_index,
-			  utf8_string,
-			  utf8_string_size,
-			  error );
+		result = 0;
+
+		/* Convert codepage 1200 data directly when possible
+		 */
+		if( ( entry_data != NULL )
+		 && ( ( encoding == 1200 )
+		  ||  ( encoding == LIBFVALUE_CODEPAGE_1200_MIXED ) ) )
+		{
+			result = libesedb_string_copy_utf16_stream_to_utf8_string(
+				  entry_data,
+				  entry_data_size,
+				  utf8_string,
+				  utf8_string_size,
+				  error );
+		}
+		if( result == 0 )
+		{
+			result = libfvalue_value_copy_to_utf8_string(
+				  internal_multi_value->record_value,
+				  multi_value_index,
+				  utf8_string,
+				  utf8_string_size,
+				  error );
+		}
 	}
 	if( result != 1 )
 	{
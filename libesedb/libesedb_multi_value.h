@@ -111,6 +111,14 @@ int libesedb_record_get_value_data(
      size_t value_data_size,
      libcerror_error_t **error );
 
+LIBESEDB_EXTERN \
+int libesedb_multi_value_get_value_data_reference(
+     libesedb_multi_value_t *multi_value,
+     int multi_value_index,
+     const uint8_t **value_data,
+     size_t *value_data_size,
+     libcerror_error_t **error );
+
 LIBESEDB_EXTERN \
 int libesedb_multi_value_get_value_8bit(
      libesedb_multi_value_t *multi_value,
@@ -160,6 +168,33 @@ int libesedb_multi_value_get_value_filetime(
      uint64_t *value_filetime,
      libcerror_error_t **error );
 
+int libesedb_internal_multi_value_get_number_of_array_values(
+     libesedb_internal_multi_value_t *internal_multi_value,
+     int array_size,
+     int *number_of_values,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_multi_value_get_values_32bit(
+     libesedb_multi_value_t *multi_value,
+     uint32_t *values_32bit,
+     int array_size,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_multi_value_get_values_64bit(
+     libesedb_multi_value_t *multi_value,
+     uint64_t *values_64bit,
+     int array_size,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_multi_value_get_values_filetime(
+     libesedb_multi_value_t *multi_value,
+     uint64_t *values_filetime,
+     int array_size,
+     libcerror_error_t **error );
+
 LIBESEDB_EXTERN \
 int libesedb_multi_value_get_value_utf8_string_size(
      libesedb_multi_value_t *multi_value,
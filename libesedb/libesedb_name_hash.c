@@ -0,0 +1,259 @@
+/*
+ * Name hash functions
+ *
+ * Copyright (C) 2009-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <types.h>
+
+#include "libesedb_libcerror.h"
+#include "libesedb_libuna.h"
+#include "libesedb_name_hash.h"
+
+/* The 32-bit FNV-1a offset basis and prime
+ */
+#define LIBESEDB_NAME_HASH_INITIAL_VALUE	0x811c9dc5UL
+#define LIBESEDB_NAME_HASH_PRIME		0x01000193UL
+
+/* Calculates the hash of a name from a byte stream
+ * The hash is calculated over the Unicode characters of the name up to the end-of-string character
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_name_hash_calculate_from_byte_stream(
+     uint32_t *name_hash,
+     const uint8_t *byte_stream,
+     size_t byte_stream_size,
+     int codepage,
+     libcerror_error_t **error )
+{
+	libuna_unicode_character_t unicode_character = 0;
+	static char *function                        = "libesedb_name_hash_calculate_from_byte_stream";
+	size_t byte_stream_index                     = 0;
+	uint32_t safe_name_hash                      = LIBESEDB_NAME_HASH_INITIAL_VALUE;
+
+	if( name_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid byte stream.",
+		 function );
+
+		return( -1 );
+	}
+	if( byte_stream_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid byte stream size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	while( byte_stream_index < byte_stream_size )
+	{
+		if( libuna_unicode_character_copy_from_byte_stream(
+		     &unicode_character,
+		     byte_stream,
+		     byte_stream_size,
+		     &byte_stream_index,
+		     codepage,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_CONVERSION,
+			 LIBCERROR_CONVERSION_ERROR_GENERIC,
+			 "%s: unable to copy byte stream to Unicode character.",
+			 function );
+
+			return( -1 );
+		}
+		if( unicode_character == 0 )
+		{
+			break;
+		}
+		safe_name_hash ^= (uint32_t) unicode_character;
+		safe_name_hash *= LIBESEDB_NAME_HASH_PRIME;
+	}
+	*name_hash = safe_name_hash;
+
+	return( 1 );
+}
+
+/* Calculates the hash of a name from an UTF-8 encoded string
+ * The hash is calculated over the Unicode characters of the name up to the end-of-string character
+ * Returns 1 if successful, 0 if the name could not be decoded or -1 on error
+ */
+int libesedb_name_hash_calculate_from_utf8_string(
+     uint32_t *name_hash,
+     const uint8_t *utf8_string,
+     size_t utf8_string_length,
+     libcerror_error_t **error )
+{
+	libuna_unicode_character_t unicode_character = 0;
+	static char *function                        = "libesedb_name_hash_calculate_from_utf8_string";
+	size_t utf8_string_index                     = 0;
+	uint32_t safe_name_hash                      = LIBESEDB_NAME_HASH_INITIAL_VALUE;
+
+	if( name_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-8 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf8_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-8 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	while( utf8_string_index < utf8_string_length )
+	{
+		/* Names that cannot be decoded are not hashed, the error is not propagated
+		 */
+		if( libuna_unicode_character_copy_from_utf8(
+		     &unicode_character,
+		     utf8_string,
+		     utf8_string_length,
+		     &utf8_string_index,
+		     NULL ) != 1 )
+		{
+			return( 0 );
+		}
+		if( unicode_character == 0 )
+		{
+			break;
+		}
+		safe_name_hash ^= (uint32_t) unicode_character;
+		safe_name_hash *= LIBESEDB_NAME_HASH_PRIME;
+	}
+	*name_hash = safe_name_hash;
+
+	return( 1 );
+}
+
+/* Calculates the hash of a name from an UTF-16 encoded string
+ * The hash is calculated over the Unicode characters of the name up to the end-of-string character
+ * Returns 1 if successful, 0 if the name could not be decoded or -1 on error
+ */
+int libesedb_name_hash_calculate_from_utf16_string(
+     uint32_t *name_hash,
+     const uint16_t *utf16_string,
+     size_t utf16_string_length,
+     libcerror_error_t **error )
+{
+	libuna_unicode_character_t unicode_character = 0;
+	static char *function                        = "libesedb_name_hash_calculate_from_utf16_string";
+	size_t utf16_string_index                    = 0;
+	uint32_t safe_name_hash                      = LIBESEDB_NAME_HASH_INITIAL_VALUE;
+
+	if( name_hash == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name hash.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid UTF-16 string.",
+		 function );
+
+		return( -1 );
+	}
+	if( utf16_string_length > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid UTF-16 string length value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	while( utf16_string_index < utf16_string_length )
+	{
+		/* Names that cannot be decoded are not hashed, the error is not propagated
+		 */
+		if( libuna_unicode_character_copy_from_utf16(
+		     &unicode_character,
+		     utf16_string,
+		     utf16_string_length,
+		     &utf16_string_index,
+		     NULL ) != 1 )
+		{
+			return( 0 );
+		}
+		if( unicode_character == 0 )
+		{
+			break;
+		}
+		safe_name_hash ^= (uint32_t) unicode_character;
+		safe_name_hash *= LIBESEDB_NAME_HASH_PRIME;
+	}
+	*name_hash = safe_name_hash;
+
+	return( 1 );
+}
+
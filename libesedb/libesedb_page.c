@@ -279,8 +279,7 @@ int libesedb_page_calculate_checksums(
 	{
 		return( 0 );
 	}
-	if( ( io_handle->format_revision >= LIBESEDB_FORMAT_REVISION_EXTENDED_PAGE_HEADER )
-	 && ( io_handle->page_size >= 16384 ) )
+	if( io_handle->has_extended_page_header != 0 )
 	{
 /* TODO calculate checksum */
 	}
@@ -345,7 +344,9 @@ int libesedb_page_read_tags(
 	size_t page_tags_data_size        = 0;
 	uint16_t page_tag_offset          = 0;
 	uint16_t page_tag_size            = 0;
+	uint16_t page_tag_value_bitmask   = 0x1fff;
 	uint16_t page_tags_index          = 0;
+	uint8_t page_tag_flags_bitmask    = 0x07;
 
 	if( page == NULL )
 	{
@@ -432,6 +433,14 @@ int libesedb_page_read_tags(
 
 		goto on_error;
 	}
+	/* In the extended page tag layout the offset and size use 15 bits
+	 * and the page tag flags are stored in the page value data
+	 */
+	if( io_handle->has_extended_page_header != 0 )
+	{
+		page_tag_value_bitmask = 0x7fff;
+		page_tag_flags_bitmask = 0x00;
+	}
 	/* Read the page tags back to front
 	 */
 	page_tags_data = &( page_data[ page_data_size - 2 ] );
@@ -465,19 +474,9 @@ int libesedb_page_read_tags(
 
 		page_tags_data -= 2;
 
-		if( ( io_handle->format_revision >= LIBESEDB_FORMAT_REVISION_EXTENDED_PAGE_HEADER )
-		 && ( io_handle->page_size >= 16384 ) )
-		{
-			page_value->flags  = 0;
-			page_value->offset = page_tag_offset & 0x7fff;
-			page_value->size   = page_tag_size & 0x7fff;;
-		}
-		else
-		{
-			page_value->flags  = page_tag_offset >> 13;
-			page_value->offset = page_tag_offset & 0x1fff;
-			page_value->size   = page_tag_size & 0x1fff;
-		}
+		page_value->flags  = (uint8_t) ( page_tag_offset >> 13 ) & page_tag_flags_bitmask;
+		page_value->offset = page_tag_offset & page_tag_value_bitmask;
+		page_value->size   = page_tag_size & page_tag_value_bitmask;
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
 		{
@@ -495,8 +494,7 @@ int libesedb_page_read_tags(
 			 page_value->size,
 			 page_tag_size );
 
-			if( ( io_handle->format_revision < LIBESEDB_FORMAT_REVISION_EXTENDED_PAGE_HEADER )
-			 && ( io_handle->page_size < 16384 ) )
+			if( io_handle->has_extended_page_header == 0 )
 			{
 				libcnotify_printf(
 				 "%s: page tag: %03" PRIu16 " flags\t\t\t\t: 0x%02" PRIx8 "",
@@ -758,17 +756,14 @@ int libesedb_page_read_values(
 #endif
 			goto on_error;
 		}
-		if( ( io_handle->format_revision >= LIBESEDB_FORMAT_REVISION_EXTENDED_PAGE_HEADER )
-		 && ( io_handle->page_size >= 16384 ) )
+		if( ( io_handle->has_extended_page_header != 0 )
+		 && ( page_value->size >= 2 ) )
 		{
-			if( page_value->size >= 2 )
-			{
-				/* The page tags flags are stored in the upper byte of the first 16-bit value
-				 */
-				page_value->flags = page_values_data[ page_value->offset + 1 ] >> 5;
+			/* The page tags flags are stored in the upper byte of the first 16-bit value
+			 */
+			page_value->flags = page_values_data[ page_value->offset + 1 ] >> 5;
 
-				page_values_data[ page_value->offset + 1 ] &= 0x1f;
-			}
+			page_values_data[ page_value->offset + 1 ] &= 0x1f;
 		}
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
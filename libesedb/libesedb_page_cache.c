@@ -0,0 +1,954 @@
+/*
+ * Page cache functions
+ *
+ * Copyright (C) 2009-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libesedb_definitions.h"
+#include "libesedb_io_handle.h"
+#include "libesedb_libbfio.h"
+#include "libesedb_libcerror.h"
+#include "libesedb_libcthreads.h"
+#include "libesedb_page.h"
+#include "libesedb_page_cache.h"
+
+/* Creates a page cache
+ * Make sure the value page_cache is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_cache_initialize(
+     libesedb_page_cache_t **page_cache,
+     libesedb_io_handle_t *io_handle,
+     int maximum_number_of_pages,
+     libcerror_error_t **error )
+{
+	libesedb_page_cache_shard_t *shard = NULL;
+	static char *function              = "libesedb_page_cache_initialize";
+	size_t entries_size                = 0;
+	int number_of_sets                 = 0;
+	int shard_index                    = 0;
+
+	if( page_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *page_cache != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid page cache value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( maximum_number_of_pages <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid maximum number of pages value zero or less.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_sets = maximum_number_of_pages / ( LIBESEDB_PAGE_CACHE_NUMBER_OF_SHARDS * LIBESEDB_PAGE_CACHE_NUMBER_OF_WAYS );
+
+	if( number_of_sets == 0 )
+	{
+		number_of_sets = 1;
+	}
+	entries_size = sizeof( libesedb_page_cache_entry_t ) * number_of_sets * LIBESEDB_PAGE_CACHE_NUMBER_OF_WAYS;
+
+	if( entries_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid maximum number of pages value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	*page_cache = memory_allocate_structure(
+	               libesedb_page_cache_t );
+
+	if( *page_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create page cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *page_cache,
+	     0,
+	     sizeof( libesedb_page_cache_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear page cache.",
+		 function );
+
+		memory_free(
+		 *page_cache );
+
+		*page_cache = NULL;
+
+		return( -1 );
+	}
+	for( shard_index = 0;
+	     shard_index < LIBESEDB_PAGE_CACHE_NUMBER_OF_SHARDS;
+	     shard_index++ )
+	{
+		shard = &( ( *page_cache )->shards[ shard_index ] );
+
+		shard->entries = (libesedb_page_cache_entry_t *) memory_allocate(
+		                                                  entries_size );
+
+		if( shard->entries == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to create entries of shard: %d.",
+			 function,
+			 shard_index );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     shard->entries,
+		     0,
+		     entries_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+			 "%s: unable to clear entries of shard: %d.",
+			 function,
+			 shard_index );
+
+			goto on_error;
+		}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_initialize(
+		     &( shard->mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create mutex of shard: %d.",
+			 function,
+			 shard_index );
+
+			goto on_error;
+		}
+#endif
+	}
+	( *page_cache )->io_handle      = io_handle;
+	( *page_cache )->number_of_sets = number_of_sets;
+
+	return( 1 );
+
+on_error:
+	if( *page_cache != NULL )
+	{
+		for( shard_index = 0;
+		     shard_index < LIBESEDB_PAGE_CACHE_NUMBER_OF_SHARDS;
+		     shard_index++ )
+		{
+			shard = &( ( *page_cache )->shards[ shard_index ] );
+
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+			if( shard->mutex != NULL )
+			{
+				libcthreads_mutex_free(
+				 &( shard->mutex ),
+				 NULL );
+			}
+#endif
+			if( shard->entries != NULL )
+			{
+				memory_free(
+				 shard->entries );
+			}
+		}
+		memory_free(
+		 *page_cache );
+
+		*page_cache = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a page cache
+ * The pages must no longer be referenced
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_cache_free(
+     libesedb_page_cache_t **page_cache,
+     libcerror_error_t **error )
+{
+	libesedb_page_cache_shard_t *shard = NULL;
+	static char *function              = "libesedb_page_cache_free";
+	int entry_index                    = 0;
+	int number_of_entries              = 0;
+	int result                         = 1;
+	int shard_index                    = 0;
+
+	if( page_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( *page_cache != NULL )
+	{
+		/* The io_handle reference is freed elsewhere
+		 */
+		number_of_entries = ( *page_cache )->number_of_sets * LIBESEDB_PAGE_CACHE_NUMBER_OF_WAYS;
+
+		for( shard_index = 0;
+		     shard_index < LIBESEDB_PAGE_CACHE_NUMBER_OF_SHARDS;
+		     shard_index++ )
+		{
+			shard = &( ( *page_cache )->shards[ shard_index ] );
+
+			for( entry_index = 0;
+			     entry_index < number_of_entries;
+			     entry_index++ )
+			{
+				if( shard->entries[ entry_index ].page == NULL )
+				{
+					continue;
+				}
+				if( libesedb_page_free(
+				     &( shard->entries[ entry_index ].page ),
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to free page: %" PRIu32 ".",
+					 function,
+					 shard->entries[ entry_index ].page_number );
+
+					result = -1;
+				}
+			}
+			memory_free(
+			 shard->entries );
+
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+			if( libcthreads_mutex_free(
+			     &( shard->mutex ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free mutex of shard: %d.",
+				 function,
+				 shard_index );
+
+				result = -1;
+			}
+#endif
+		}
+		memory_free(
+		 *page_cache );
+
+		*page_cache = NULL;
+	}
+	return( result );
+}
+
+/* Empties a page cache
+ * Pages that are referenced remain cached
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_cache_empty(
+     libesedb_page_cache_t *page_cache,
+     libcerror_error_t **error )
+{
+	libesedb_page_cache_shard_t *shard = NULL;
+	static char *function              = "libesedb_page_cache_empty";
+	int entry_index                    = 0;
+	int number_of_entries              = 0;
+	int result                         = 1;
+	int shard_index                    = 0;
+
+	if( page_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page cache.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_entries = page_cache->number_of_sets * LIBESEDB_PAGE_CACHE_NUMBER_OF_WAYS;
+
+	for( shard_index = 0;
+	     shard_index < LIBESEDB_PAGE_CACHE_NUMBER_OF_SHARDS;
+	     shard_index++ )
+	{
+		shard = &( page_cache->shards[ shard_index ] );
+
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_grab(
+		     shard->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex of shard: %d.",
+			 function,
+			 shard_index );
+
+			return( -1 );
+		}
+#endif
+		for( entry_index = 0;
+		     entry_index < number_of_entries;
+		     entry_index++ )
+		{
+			if( ( shard->entries[ entry_index ].page == NULL )
+			 || ( shard->entries[ entry_index ].number_of_references != 0 ) )
+			{
+				continue;
+			}
+			if( libesedb_page_free(
+			     &( shard->entries[ entry_index ].page ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free page: %" PRIu32 ".",
+				 function,
+				 shard->entries[ entry_index ].page_number );
+
+				result = -1;
+			}
+			shard->entries[ entry_index ].page_number   = 0;
+			shard->entries[ entry_index ].last_accessed = 0;
+		}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_release(
+		     shard->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex of shard: %d.",
+			 function,
+			 shard_index );
+
+			return( -1 );
+		}
+#endif
+	}
+	return( result );
+}
+
+/* Retrieves a specific page
+ * The page is read if it is not cached. The page is referenced until it is released
+ * by libesedb_page_cache_release_page and a referenced page is not evicted, hence
+ * the page remains valid when the page cache is used by other threads
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_cache_get_page(
+     libesedb_page_cache_t *page_cache,
+     libbfio_handle_t *file_io_handle,
+     uint32_t page_number,
+     libesedb_page_t **page,
+     libcerror_error_t **error )
+{
+	libesedb_page_cache_entry_t *entries       = NULL;
+	libesedb_page_cache_entry_t *entry         = NULL;
+	libesedb_page_cache_entry_t *unused_entry  = NULL;
+	libesedb_page_cache_shard_t *shard         = NULL;
+	libesedb_page_t *evicted_page              = NULL;
+	libesedb_page_t *read_page                 = NULL;
+	static char *function                      = "libesedb_page_cache_get_page";
+	off64_t page_offset                        = 0;
+	int entry_index                            = 0;
+	int set_index                              = 0;
+
+	if( page_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_cache->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid page cache - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( page_number == 0 )
+	 || ( ( (size64_t) page_number - 1 ) * page_cache->io_handle->page_size >= page_cache->io_handle->pages_data_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page number value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( page == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page.",
+		 function );
+
+		return( -1 );
+	}
+	shard     = &( page_cache->shards[ page_number % LIBESEDB_PAGE_CACHE_NUMBER_OF_SHARDS ] );
+	set_index = (int) ( ( page_number / LIBESEDB_PAGE_CACHE_NUMBER_OF_SHARDS ) % (uint32_t) page_cache->number_of_sets );
+	entries   = &( shard->entries[ set_index * LIBESEDB_PAGE_CACHE_NUMBER_OF_WAYS ] );
+
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     shard->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	for( entry_index = 0;
+	     entry_index < LIBESEDB_PAGE_CACHE_NUMBER_OF_WAYS;
+	     entry_index++ )
+	{
+		if( ( entries[ entry_index ].page != NULL )
+		 && ( entries[ entry_index ].page_number == page_number ) )
+		{
+			entry = &( entries[ entry_index ] );
+
+			break;
+		}
+	}
+	if( entry != NULL )
+	{
+		shard->access_counter += 1;
+		shard->number_of_hits += 1;
+
+		entry->number_of_references += 1;
+		entry->last_accessed         = shard->access_counter;
+
+		*page = entry->page;
+	}
+	else
+	{
+		shard->number_of_misses += 1;
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     shard->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( entry != NULL )
+	{
+		return( 1 );
+	}
+	/* The page is read without holding the mutex so that pages of the same shard
+	 * can be retrieved by other threads in the mean time
+	 */
+	page_offset = page_cache->io_handle->pages_data_offset
+	            + ( (off64_t) page_number - 1 ) * page_cache->io_handle->page_size;
+
+	if( libesedb_page_initialize(
+	     &read_page,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create page.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_page_read_file_io_handle(
+	     read_page,
+	     page_cache->io_handle,
+	     file_io_handle,
+	     page_offset,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read page: %" PRIu32 ".",
+		 function,
+		 page_number );
+
+		goto on_error;
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     shard->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	/* Another thread could have cached the page while it was read, otherwise
+	 * the page is stored in an unused entry or in the least recently used entry
+	 * that is not referenced. If all the entries of the set are referenced
+	 * the page is not cached and is freed when it is released.
+	 */
+	for( entry_index = 0;
+	     entry_index < LIBESEDB_PAGE_CACHE_NUMBER_OF_WAYS;
+	     entry_index++ )
+	{
+		if( entries[ entry_index ].page == NULL )
+		{
+			if( unused_entry == NULL )
+			{
+				unused_entry = &( entries[ entry_index ] );
+			}
+		}
+		else if( entries[ entry_index ].page_number == page_number )
+		{
+			entry = &( entries[ entry_index ] );
+
+			break;
+		}
+		else if( entries[ entry_index ].number_of_references == 0 )
+		{
+			if( ( unused_entry == NULL )
+			 || ( ( unused_entry->page != NULL )
+			  &&  ( entries[ entry_index ].last_accessed < unused_entry->last_accessed ) ) )
+			{
+				unused_entry = &( entries[ entry_index ] );
+			}
+		}
+	}
+	shard->access_counter += 1;
+
+	if( entry != NULL )
+	{
+		evicted_page = read_page;
+		read_page    = NULL;
+
+		entry->number_of_references += 1;
+		entry->last_accessed         = shard->access_counter;
+
+		*page = entry->page;
+	}
+	else if( unused_entry != NULL )
+	{
+		evicted_page = unused_entry->page;
+
+		unused_entry->page_number          = page_number;
+		unused_entry->page                 = read_page;
+		unused_entry->number_of_references = 1;
+		unused_entry->last_accessed        = shard->access_counter;
+
+		*page     = read_page;
+		read_page = NULL;
+	}
+	else
+	{
+		shard->number_of_uncached_pages += 1;
+
+		*page     = read_page;
+		read_page = NULL;
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     shard->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( evicted_page != NULL )
+	{
+		if( libesedb_page_free(
+		     &evicted_page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free evicted page.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( evicted_page != NULL )
+	{
+		libesedb_page_free(
+		 &evicted_page,
+		 NULL );
+	}
+	if( read_page != NULL )
+	{
+		libesedb_page_free(
+		 &read_page,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Releases a page that was retrieved by libesedb_page_cache_get_page
+ * A page that was not cached is freed
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_cache_release_page(
+     libesedb_page_cache_t *page_cache,
+     libesedb_page_t **page,
+     libcerror_error_t **error )
+{
+	libesedb_page_cache_entry_t *entries = NULL;
+	libesedb_page_cache_entry_t *entry   = NULL;
+	libesedb_page_cache_shard_t *shard   = NULL;
+	libesedb_page_t *safe_page           = NULL;
+	static char *function                = "libesedb_page_cache_release_page";
+	int entry_index                      = 0;
+	int result                           = 1;
+	int set_index                        = 0;
+
+	if( page_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( page == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page.",
+		 function );
+
+		return( -1 );
+	}
+	if( *page == NULL )
+	{
+		return( 1 );
+	}
+	safe_page = *page;
+	*page     = NULL;
+
+	shard     = &( page_cache->shards[ safe_page->page_number % LIBESEDB_PAGE_CACHE_NUMBER_OF_SHARDS ] );
+	set_index = (int) ( ( safe_page->page_number / LIBESEDB_PAGE_CACHE_NUMBER_OF_SHARDS ) % (uint32_t) page_cache->number_of_sets );
+	entries   = &( shard->entries[ set_index * LIBESEDB_PAGE_CACHE_NUMBER_OF_WAYS ] );
+
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_grab(
+	     shard->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab mutex.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	for( entry_index = 0;
+	     entry_index < LIBESEDB_PAGE_CACHE_NUMBER_OF_WAYS;
+	     entry_index++ )
+	{
+		if( entries[ entry_index ].page == safe_page )
+		{
+			entry = &( entries[ entry_index ] );
+
+			break;
+		}
+	}
+	if( entry != NULL )
+	{
+		if( entry->number_of_references <= 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid page cache entry - number of references value out of bounds.",
+			 function );
+
+			result = -1;
+		}
+		else
+		{
+			entry->number_of_references -= 1;
+		}
+		safe_page = NULL;
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_mutex_release(
+	     shard->mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release mutex.",
+		 function );
+
+		result = -1;
+	}
+#endif
+	if( safe_page != NULL )
+	{
+		if( libesedb_page_free(
+		     &safe_page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free uncached page.",
+			 function );
+
+			result = -1;
+		}
+	}
+	return( result );
+}
+
+/* Retrieves the page cache statistics
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_cache_get_statistics(
+     libesedb_page_cache_t *page_cache,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     uint64_t *number_of_uncached_pages,
+     libcerror_error_t **error )
+{
+	libesedb_page_cache_shard_t *shard = NULL;
+	static char *function              = "libesedb_page_cache_get_statistics";
+	uint64_t safe_number_of_hits       = 0;
+	uint64_t safe_number_of_misses     = 0;
+	uint64_t safe_number_of_uncached   = 0;
+	int shard_index                    = 0;
+
+	if( page_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_hits == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of hits.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_misses == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of misses.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_uncached_pages == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of uncached pages.",
+		 function );
+
+		return( -1 );
+	}
+	for( shard_index = 0;
+	     shard_index < LIBESEDB_PAGE_CACHE_NUMBER_OF_SHARDS;
+	     shard_index++ )
+	{
+		shard = &( page_cache->shards[ shard_index ] );
+
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_grab(
+		     shard->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab mutex.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+		safe_number_of_hits     += shard->number_of_hits;
+		safe_number_of_misses   += shard->number_of_misses;
+		safe_number_of_uncached += shard->number_of_uncached_pages;
+
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+		if( libcthreads_mutex_release(
+		     shard->mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release mutex.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+	}
+	*number_of_hits           = safe_number_of_hits;
+	*number_of_misses         = safe_number_of_misses;
+	*number_of_uncached_pages = safe_number_of_uncached;
+
+	return( 1 );
+}
+
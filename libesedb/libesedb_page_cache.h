@@ -0,0 +1,150 @@
+/*
+ * Page cache functions
+ *
+ * Copyright (C) 2009-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBESEDB_PAGE_CACHE_H )
+#define _LIBESEDB_PAGE_CACHE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libesedb_definitions.h"
+#include "libesedb_io_handle.h"
+#include "libesedb_libbfio.h"
+#include "libesedb_libcerror.h"
+#include "libesedb_libcthreads.h"
+#include "libesedb_page.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libesedb_page_cache_entry libesedb_page_cache_entry_t;
+
+struct libesedb_page_cache_entry
+{
+	/* The page number
+	 */
+	uint32_t page_number;
+
+	/* The page
+	 */
+	libesedb_page_t *page;
+
+	/* The number of references to the page, a referenced page is not evicted
+	 */
+	int number_of_references;
+
+	/* The value of the shard access counter when the page was last retrieved
+	 */
+	uint64_t last_accessed;
+};
+
+typedef struct libesedb_page_cache_shard libesedb_page_cache_shard_t;
+
+struct libesedb_page_cache_shard
+{
+	/* The entries
+	 */
+	libesedb_page_cache_entry_t *entries;
+
+	/* The access counter
+	 */
+	uint64_t access_counter;
+
+	/* The number of pages that were retrieved from the cache
+	 */
+	uint64_t number_of_hits;
+
+	/* The number of pages that were read
+	 */
+	uint64_t number_of_misses;
+
+	/* The number of pages that could not be cached since all entries of their set were referenced
+	 */
+	uint64_t number_of_uncached_pages;
+
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	/* The mutex
+	 */
+	libcthreads_mutex_t *mutex;
+#endif
+};
+
+typedef struct libesedb_page_cache libesedb_page_cache_t;
+
+/* The page cache is divided into shards, where the shard of a page is determined
+ * by its page number. Every shard has its own mutex that is only held to look up,
+ * reference, insert and evict entries and not while a page is read.
+ */
+struct libesedb_page_cache
+{
+	/* The IO handle
+	 */
+	libesedb_io_handle_t *io_handle;
+
+	/* The shards
+	 */
+	libesedb_page_cache_shard_t shards[ LIBESEDB_PAGE_CACHE_NUMBER_OF_SHARDS ];
+
+	/* The number of sets per shard
+	 */
+	int number_of_sets;
+};
+
+int libesedb_page_cache_initialize(
+     libesedb_page_cache_t **page_cache,
+     libesedb_io_handle_t *io_handle,
+     int maximum_number_of_pages,
+     libcerror_error_t **error );
+
+int libesedb_page_cache_free(
+     libesedb_page_cache_t **page_cache,
+     libcerror_error_t **error );
+
+int libesedb_page_cache_empty(
+     libesedb_page_cache_t *page_cache,
+     libcerror_error_t **error );
+
+int libesedb_page_cache_get_page(
+     libesedb_page_cache_t *page_cache,
+     libbfio_handle_t *file_io_handle,
+     uint32_t page_number,
+     libesedb_page_t **page,
+     libcerror_error_t **error );
+
+int libesedb_page_cache_release_page(
+     libesedb_page_cache_t *page_cache,
+     libesedb_page_t **page,
+     libcerror_error_t **error );
+
+int libesedb_page_cache_get_statistics(
+     libesedb_page_cache_t *page_cache,
+     uint64_t *number_of_hits,
+     uint64_t *number_of_misses,
+     uint64_t *number_of_uncached_pages,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBESEDB_PAGE_CACHE_H ) */
+
@@ -192,8 +192,7 @@ int libesedb_page_header_read_data(
 	}
 	minimum_data_size = sizeof( esedb_page_header_t );
 
-	if( ( io_handle->format_revision >= LIBESEDB_FORMAT_REVISION_EXTENDED_PAGE_HEADER )
-	 && ( io_handle->page_size >= 16384 ) )
+	if( io_handle->has_extended_page_header != 0 )
 	{
 		minimum_data_size  += sizeof( esedb_extended_page_header_t );
 		has_extended_header = 1;
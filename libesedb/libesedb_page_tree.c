@@ -32,9 +32,9 @@
 #include "libesedb_libbfio.h"
 #include "libesedb_libcerror.h"
 #include "libesedb_libcnotify.h"
-#include "libesedb_libfcache.h"
-#include "libesedb_libfdata.h"
+#include "libesedb_libcthreads.h"
 #include "libesedb_page.h"
+#include "libesedb_page_cache.h"
 #include "libesedb_page_tree.h"
 #include "libesedb_page_tree_key.h"
 #include "libesedb_page_tree_value.h"
@@ -52,8 +52,7 @@
 int libesedb_page_tree_initialize(
      libesedb_page_tree_t **page_tree,
      libesedb_io_handle_t *io_handle,
-     libfdata_vector_t *pages_vector,
-     libfcache_cache_t *pages_cache,
+     libesedb_page_cache_t *page_cache,
      uint32_t object_identifier,
      uint32_t root_page_number,
      libesedb_table_definition_t *table_definition,
@@ -145,29 +144,31 @@ int libesedb_page_tree_initialize(
 
 		return( -1 );
 	}
-	if( libcdata_btree_initialize(
-	     &( ( *page_tree )->leaf_page_descriptors_tree ),
-	     257,
+	( *page_tree )->io_handle                 = io_handle;
+	( *page_tree )->page_cache                = page_cache;
+	( *page_tree )->object_identifier         = object_identifier;
+	( *page_tree )->root_page_number          = root_page_number;
+	( *page_tree )->table_definition          = table_definition;
+	( *page_tree )->template_table_definition = template_table_definition;
+	( *page_tree )->number_of_leaf_values     = -1;
+
+	( *page_tree )->estimated_number_of_leaf_values = -1;
+
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( ( *page_tree )->read_write_lock ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create leaf page descriptors B-tree.",
+		 "%s: unable to initialize read/write lock.",
 		 function );
 
 		goto on_error;
 	}
-	( *page_tree )->io_handle                 = io_handle;
-	( *page_tree )->pages_vector              = pages_vector;
-	( *page_tree )->pages_cache               = pages_cache;
-	( *page_tree )->object_identifier         = object_identifier;
-	( *page_tree )->root_page_number          = root_page_number;
-	( *page_tree )->table_definition          = table_definition;
-	( *page_tree )->template_table_definition = template_table_definition;
-	( *page_tree )->number_of_leaf_values     = -1;
-
+#endif
 	return( 1 );
 
 on_error:
@@ -204,7 +205,7 @@ int libesedb_page_tree_free(
 	}
 	if( *page_tree != NULL )
 	{
-		/* The io_handle, pages_vector, pages_cache, table_definition and template_table_definition references
+		/* The io_handle, page_cache, table_definition and template_table_definition references
 		 * are freed elsewhere
 		 */
 		if( ( *page_tree )->root_page_header != NULL )
@@ -223,20 +224,26 @@ int libesedb_page_tree_free(
 				result = -1;
 			}
 		}
-		if( libcdata_btree_free(
-		     &( ( *page_tree )->leaf_page_descriptors_tree ),
-		     (int (*)(intptr_t **, libcerror_error_t **)) &libesedb_leaf_page_descriptor_free,
+		if( ( *page_tree )->leaf_page_descriptors != NULL )
+		{
+			memory_free(
+			 ( *page_tree )->leaf_page_descriptors );
+		}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( ( *page_tree )->read_write_lock ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free leaf page descriptors B-tree.",
+			 "%s: unable to free read/write lock.",
 			 function );
 
 			result = -1;
 		}
+#endif
 		memory_free(
 		 *page_tree );
 
@@ -352,15 +359,20 @@ on_error:
 }
 
 /* Reads the space page trees
+ * The number of used pages is the number of owned pages minus the number of available pages
+ * or the initial number of pages if the page tree has no space trees
  * Returns 1 if successful or -1 on error
  */
 int libesedb_page_tree_read_space_trees(
      libesedb_page_tree_t *page_tree,
      libbfio_handle_t *file_io_handle,
+     uint64_t *number_of_used_pages,
      libcerror_error_t **error )
 {
-	libesedb_space_tree_t *space_tree = NULL;
-	static char *function             = "libesedb_page_tree_read_space_trees";
+	libesedb_space_tree_t *space_tree  = NULL;
+	static char *function              = "libesedb_page_tree_read_space_trees";
+	uint64_t number_of_available_pages = 0;
+	uint64_t number_of_owned_pages     = 0;
 
 	if( page_tree == NULL )
 	{
@@ -384,6 +396,19 @@ int libesedb_page_tree_read_space_trees(
 
 		return( -1 );
 	}
+	if( number_of_used_pages == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of used pages.",
+		 function );
+
+		return( -1 );
+	}
+	*number_of_used_pages = (uint64_t) page_tree->root_page_header->initial_number_of_pages;
+
 	/* Read the space tree pages
 	 */
 	if( page_tree->root_page_header->extent_space > 0 )
@@ -409,8 +434,7 @@ int libesedb_page_tree_read_space_trees(
 			     page_tree->io_handle,
 			     page_tree->object_identifier,
 			     page_tree->root_page_header->space_tree_page_number,
-			     page_tree->pages_vector,
-			     page_tree->pages_cache,
+			     page_tree->page_cache,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
@@ -436,6 +460,8 @@ int libesedb_page_tree_read_space_trees(
 
 				goto on_error;
 			}
+			number_of_owned_pages = space_tree->number_of_pages;
+
 			if( libesedb_space_tree_free(
 			     &space_tree,
 			     error ) != 1 )
@@ -456,8 +482,7 @@ int libesedb_page_tree_read_space_trees(
 			     page_tree->io_handle,
 			     page_tree->object_identifier,
 			     page_tree->root_page_header->space_tree_page_number + 1,
-			     page_tree->pages_vector,
-			     page_tree->pages_cache,
+			     page_tree->page_cache,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
@@ -483,6 +508,8 @@ int libesedb_page_tree_read_space_trees(
 
 				goto on_error;
 			}
+			number_of_available_pages = space_tree->number_of_pages;
+
 			if( libesedb_space_tree_free(
 			     &space_tree,
 			     error ) != 1 )
@@ -496,6 +523,14 @@ int libesedb_page_tree_read_space_trees(
 
 				goto on_error;
 			}
+			if( number_of_owned_pages > number_of_available_pages )
+			{
+				*number_of_used_pages = number_of_owned_pages - number_of_available_pages;
+			}
+			else
+			{
+				*number_of_used_pages = 0;
+			}
 		}
 	}
 	return( 1 );
@@ -1052,13 +1087,11 @@ int libesedb_page_tree_get_first_leaf_page_number_from_page(
 		if( ( child_page_number > 0 )
 		 && ( child_page_number <= page_tree->io_handle->last_page_number ) )
 		{
-			if( libfdata_vector_get_element_value_by_index(
-			     page_tree->pages_vector,
-			     (intptr_t *) file_io_handle,
-			     (libfdata_cache_t *) page_tree->pages_cache,
-			     (int) child_page_number - 1,
-			     (intptr_t **) &child_page,
-			     0,
+			if( libesedb_page_cache_get_page(
+			     page_tree->page_cache,
+			     file_io_handle,
+			     child_page_number,
+			     &child_page,
 			     error ) != 1 )
 			{
 				libcerror_error_set(
@@ -1102,6 +1135,21 @@ int libesedb_page_tree_get_first_leaf_page_number_from_page(
 
 				goto on_error;
 			}
+			if( libesedb_page_cache_release_page(
+			     page_tree->page_cache,
+			     &child_page,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to release page: %" PRIu32 ".",
+				 function,
+				 child_page_number );
+
+				goto on_error;
+			}
 		}
 		if( libesedb_page_tree_value_free(
 		     &page_tree_value,
@@ -1121,6 +1169,13 @@ int libesedb_page_tree_get_first_leaf_page_number_from_page(
 	return( 1 );
 
 on_error:
+	if( child_page != NULL )
+	{
+		libesedb_page_cache_release_page(
+		 page_tree->page_cache,
+		 &child_page,
+		 NULL );
+	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( page_value_key != NULL )
 	{
@@ -1154,6 +1209,10 @@ int libesedb_page_tree_get_get_first_leaf_page_number(
 	uint32_t safe_leaf_page_number = 0;
 	int recursion_depth            = 0;
 
+#if defined( HAVE_DEBUG_OUTPUT ) && defined( TODO )
+	uint64_t number_of_used_pages  = 0;
+#endif
+
 	if( page_tree == NULL )
 	{
 		libcerror_error_set(
@@ -1176,13 +1235,11 @@ int libesedb_page_tree_get_get_first_leaf_page_number(
 
 		return( -1 );
 	}
-	if( libfdata_vector_get_element_value_by_index(
-	     page_tree->pages_vector,
-	     (intptr_t *) file_io_handle,
-	     (libfdata_cache_t *) page_tree->pages_cache,
-	     (int) page_tree->root_page_number - 1,
-	     (intptr_t **) &page,
-	     0,
+	if( libesedb_page_cache_get_page(
+	     page_tree->page_cache,
+	     file_io_handle,
+	     page_tree->root_page_number,
+	     &page,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -1207,7 +1264,7 @@ int libesedb_page_tree_get_get_first_leaf_page_number(
 		 "%s: unable to retrieve page flags.",
 		 function );
 
-		return( -1 );
+		goto on_error;
 	}
 	/* Seen in temp.edb where is root flag is not set
 	 */
@@ -1224,7 +1281,7 @@ int libesedb_page_tree_get_get_first_leaf_page_number(
 			 "%s: unsupported root page.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
 	}
 #if defined( HAVE_DEBUG_OUTPUT ) && defined( TODO )
@@ -1242,11 +1299,12 @@ int libesedb_page_tree_get_get_first_leaf_page_number(
 			 "%s: unable to read root page header.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
 		if( libesedb_page_tree_read_space_trees(
 		     page_tree,
 		     file_io_handle,
+		     &number_of_used_pages,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -1256,7 +1314,7 @@ int libesedb_page_tree_get_get_first_leaf_page_number(
 			 "%s: unable to read space trees.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
 	}
 #endif
@@ -1276,7 +1334,22 @@ int libesedb_page_tree_get_get_first_leaf_page_number(
 		 function,
 		 page_tree->root_page_number );
 
-		return( -1 );
+		goto on_error;
+	}
+	if( libesedb_page_cache_release_page(
+	     page_tree->page_cache,
+	     &page,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release page: %" PRIu32 ".",
+		 function,
+		 page_tree->root_page_number );
+
+		goto on_error;
 	}
 	while( safe_leaf_page_number != 0 )
 	{
@@ -1289,7 +1362,7 @@ int libesedb_page_tree_get_get_first_leaf_page_number(
 			 "%s: invalid recursion depth value out of bounds.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
 #if ( SIZEOF_INT <= 4 )
 		if( safe_leaf_page_number > (uint32_t) INT_MAX )
@@ -1304,17 +1377,15 @@ int libesedb_page_tree_get_get_first_leaf_page_number(
 			 "%s: invalid leaf page number value out of bounds.",
 			 function );
 
-			return( -1 );
+			goto on_error;
 		}
 		last_leaf_page_number = safe_leaf_page_number;
 
-		if( libfdata_vector_get_element_value_by_index(
-		     page_tree->pages_vector,
-		     (intptr_t *) file_io_handle,
-		     (libfdata_cache_t *) page_tree->pages_cache,
-		     (int) safe_leaf_page_number - 1,
-		     (intptr_t **) &page,
-		     0,
+		if( libesedb_page_cache_get_page(
+		     page_tree->page_cache,
+		     file_io_handle,
+		     safe_leaf_page_number,
+		     &page,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
@@ -1325,7 +1396,7 @@ int libesedb_page_tree_get_get_first_leaf_page_number(
 			 function,
 			 safe_leaf_page_number );
 
-			return( -1 );
+			goto on_error;
 		}
 		if( libesedb_page_get_previous_page_number(
 		     page,
@@ -1340,13 +1411,38 @@ int libesedb_page_tree_get_get_first_leaf_page_number(
 			 function,
 			 safe_leaf_page_number );
 
-			return( -1 );
+			goto on_error;
+		}
+		if( libesedb_page_cache_release_page(
+		     page_tree->page_cache,
+		     &page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release page: %" PRIu32 ".",
+			 function,
+			 last_leaf_page_number );
+
+			goto on_error;
 		}
 		recursion_depth++;
 	}
 	*leaf_page_number = last_leaf_page_number;
 
 	return( 1 );
+
+on_error:
+	if( page != NULL )
+	{
+		libesedb_page_cache_release_page(
+		 page_tree->page_cache,
+		 &page,
+		 NULL );
+	}
+	return( -1 );
 }
 
 /* Determines the number of leaf values from a page
@@ -1510,24 +1606,20 @@ int libesedb_page_tree_get_number_of_leaf_values_from_leaf_page(
 	return( 1 );
 }
 
-/* Determines the number of leaf values
+/* Appends a leaf page descriptor
  * Returns 1 if successful or -1 on error
  */
-int libesedb_page_tree_get_number_of_leaf_values(
+int libesedb_page_tree_append_leaf_page_descriptor(
      libesedb_page_tree_t *page_tree,
-     libbfio_handle_t *file_io_handle,
-     int *number_of_leaf_values,
+     uint32_t page_number,
+     int first_leaf_value_index,
+     int last_leaf_value_index,
      libcerror_error_t **error )
 {
-	libcdata_tree_node_t *upper_node                               = NULL;
-	libesedb_leaf_page_descriptor_t *existing_leaf_page_descriptor = NULL;
-	libesedb_leaf_page_descriptor_t *leaf_page_descriptor          = NULL;
-	libesedb_page_t *page                                          = NULL;
-	static char *function                                          = "libesedb_page_tree_get_number_of_leaf_values";
-	uint32_t leaf_page_number                                      = 0;
-	int number_of_leaf_pages                                       = 0;
-	int safe_number_of_leaf_values                                 = 0;
-	int value_index                                                = 0;
+	libesedb_leaf_page_descriptor_t *leaf_page_descriptor = NULL;
+	void *reallocation                                    = NULL;
+	static char *function                                 = "libesedb_page_tree_append_leaf_page_descriptor";
+	int number_of_allocated_leaf_page_descriptors         = 0;
 
 	if( page_tree == NULL )
 	{
@@ -1540,194 +1632,70 @@ int libesedb_page_tree_get_number_of_leaf_values(
 
 		return( -1 );
 	}
-	if( number_of_leaf_values == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid number of leaf values.",
-		 function );
-
-		return( -1 );
-	}
-	if( page_tree->number_of_leaf_values == -1 )
+	if( page_tree->number_of_leaf_page_descriptors >= page_tree->number_of_allocated_leaf_page_descriptors )
 	{
-		page_tree->number_of_leaf_values = 0;
-
-		if( libesedb_page_tree_get_get_first_leaf_page_number(
-		     page_tree,
-		     file_io_handle,
-		     &leaf_page_number,
-		     error ) != 1 )
+		if( page_tree->number_of_allocated_leaf_page_descriptors == 0 )
+		{
+			number_of_allocated_leaf_page_descriptors = 64;
+		}
+		else
+		{
+			number_of_allocated_leaf_page_descriptors = page_tree->number_of_allocated_leaf_page_descriptors * 2;
+		}
+		if( (size_t) number_of_allocated_leaf_page_descriptors > ( (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE / sizeof( libesedb_leaf_page_descriptor_t ) ) )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve first leaf page number from page tree.",
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of allocated leaf page descriptors value exceeds maximum.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-		while( leaf_page_number != 0 )
-		{
-			if( number_of_leaf_pages > LIBESEDB_MAXIMUM_NUMBER_OF_LEAF_PAGES )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
-				 "%s: invalid number of leaf pages value exceeds maximum.",
-				 function );
-
-				goto on_error;
-			}
-#if ( SIZEOF_INT <= 4 )
-			if( leaf_page_number > (uint32_t) INT_MAX )
-#else
-			if( leaf_page_number > (unsigned int) INT_MAX )
-#endif
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-				 "%s: invalid leaf page number value out of bounds.",
-				 function );
-
-				goto on_error;
-			}
-			if( libfdata_vector_get_element_value_by_index(
-			     page_tree->pages_vector,
-			     (intptr_t *) file_io_handle,
-			     (libfdata_cache_t *) page_tree->pages_cache,
-			     (int) leaf_page_number - 1,
-			     (intptr_t **) &page,
-			     0,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve page: %" PRIu32 ".",
-				 function,
-				 leaf_page_number );
-
-				goto on_error;
-			}
-			if( libesedb_page_tree_get_number_of_leaf_values_from_leaf_page(
-			     page_tree,
-			     page,
-			     &safe_number_of_leaf_values,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to determine number of leaf values from page: %" PRIu32 ".",
-				 function,
-				 leaf_page_number );
-
-				goto on_error;
-			}
-			if( libesedb_leaf_page_descriptor_initialize(
-			     &leaf_page_descriptor,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-				 "%s: unable to create leaf page descriptor.",
-				 function );
-
-				goto on_error;
-			}
-			leaf_page_descriptor->page_number            = page->page_number;
-			leaf_page_descriptor->first_leaf_value_index = page_tree->number_of_leaf_values;
-			leaf_page_descriptor->last_leaf_value_index  = safe_number_of_leaf_values - 1;
-
-			if( libcdata_btree_insert_value(
-			     page_tree->leaf_page_descriptors_tree,
-			     &value_index,
-			     (intptr_t *) leaf_page_descriptor,
-			     (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &libesedb_leaf_page_descriptor_compare,
-			     &upper_node,
-			     (intptr_t **) &existing_leaf_page_descriptor,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-				 "%s: unable insert leaf page descriptor into tree.",
-				 function );
-
-				goto on_error;
-			}
-			leaf_page_descriptor = NULL;
-
-			if( libesedb_page_get_next_page_number(
-			     page,
-			     &leaf_page_number,
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-				 "%s: unable to retrieve next page number from page: %" PRIu32 ".",
-				 function,
-				 leaf_page_number );
+		reallocation = memory_reallocate(
+		                page_tree->leaf_page_descriptors,
+		                sizeof( libesedb_leaf_page_descriptor_t ) * number_of_allocated_leaf_page_descriptors );
 
-				goto on_error;
-			}
-			page_tree->number_of_leaf_values = safe_number_of_leaf_values;
+		if( reallocation == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+			 "%s: unable to resize leaf page descriptors.",
+			 function );
 
-			number_of_leaf_pages++;
+			return( -1 );
 		}
+		page_tree->leaf_page_descriptors                     = (libesedb_leaf_page_descriptor_t *) reallocation;
+		page_tree->number_of_allocated_leaf_page_descriptors = number_of_allocated_leaf_page_descriptors;
 	}
-	*number_of_leaf_values = page_tree->number_of_leaf_values;
+	leaf_page_descriptor = &( page_tree->leaf_page_descriptors[ page_tree->number_of_leaf_page_descriptors ] );
 
-	return( 1 );
+	leaf_page_descriptor->page_number            = page_number;
+	leaf_page_descriptor->first_leaf_value_index = first_leaf_value_index;
+	leaf_page_descriptor->last_leaf_value_index  = last_leaf_value_index;
 
-on_error:
-	if( leaf_page_descriptor != NULL )
-	{
-		libesedb_leaf_page_descriptor_free(
-		 &leaf_page_descriptor,
-		 NULL );
-	}
-	return( -1 );
+	page_tree->number_of_leaf_page_descriptors += 1;
+
+	return( 1 );
 }
 
-/* Retrieves a specific leaf value
- * This function creates a new data definition
- * Returns 1 if successful or -1 on error
+/* Sets the leaf page descriptors
+ * This function is used to restore previously read leaf page descriptors
+ * Returns 1 if successful, 0 if the leaf page descriptors were already read or -1 on error
  */
-int libesedb_page_tree_get_leaf_value_by_index_from_page(
+int libesedb_page_tree_set_leaf_page_descriptors(
      libesedb_page_tree_t *page_tree,
-     libbfio_handle_t *file_io_handle,
-     libesedb_page_t *page,
-     int leaf_value_index,
-     libesedb_data_definition_t **data_definition,
-     int *current_leaf_value_index,
-     int recursion_depth,
+     const libesedb_leaf_page_descriptor_t *leaf_page_descriptors,
+     int number_of_leaf_page_descriptors,
+     int number_of_leaf_values,
      libcerror_error_t **error )
 {
-	libesedb_page_t *child_page                 = NULL;
-	libesedb_page_tree_value_t *page_tree_value = NULL;
-	libesedb_page_value_t *page_value           = NULL;
-	libfcache_cache_t *child_page_cache         = NULL;
-	static char *function                       = "libesedb_page_tree_get_leaf_value_by_index_from_page";
-	uint32_t child_page_number                  = 0;
-	uint32_t page_flags                         = 0;
-	uint16_t data_offset                        = 0;
-	uint16_t number_of_page_values              = 0;
-	uint16_t page_value_index                   = 0;
+	static char *function          = "libesedb_page_tree_set_leaf_page_descriptors";
+	int leaf_page_descriptor_index = 0;
+	int result                     = 1;
 
 	if( page_tree == NULL )
 	{
@@ -1740,46 +1708,1093 @@ int libesedb_page_tree_get_leaf_value_by_index_from_page(
 
 		return( -1 );
 	}
-	if( page_tree->io_handle == NULL )
+	if( ( number_of_leaf_page_descriptors < 0 )
+	 || ( number_of_leaf_page_descriptors > LIBESEDB_MAXIMUM_NUMBER_OF_LEAF_PAGES ) )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid page tree - missing IO handle.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of leaf page descriptors value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	if( data_definition == NULL )
+	if( ( leaf_page_descriptors == NULL )
+	 && ( number_of_leaf_page_descriptors > 0 ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid data definition.",
+		 "%s: invalid leaf page descriptors.",
 		 function );
 
 		return( -1 );
 	}
-	if( current_leaf_value_index == NULL )
+	if( number_of_leaf_values < 0 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid current leaf value index.",
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of leaf values value out of bounds.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( recursion_depth < 0 )
-	 || ( recursion_depth > LIBESEDB_MAXIMUM_INDEX_NODE_RECURSION_DEPTH ) )
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     page_tree->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( page_tree->number_of_leaf_values == -1 )
+	{
+		for( leaf_page_descriptor_index = 0;
+		     leaf_page_descriptor_index < number_of_leaf_page_descriptors;
+		     leaf_page_descriptor_index++ )
+		{
+			if( libesedb_page_tree_append_leaf_page_descriptor(
+			     page_tree,
+			     leaf_page_descriptors[ leaf_page_descriptor_index ].page_number,
+			     leaf_page_descriptors[ leaf_page_descriptor_index ].first_leaf_value_index,
+			     leaf_page_descriptors[ leaf_page_descriptor_index ].last_leaf_value_index,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append leaf page descriptor: %d.",
+				 function,
+				 leaf_page_descriptor_index );
+
+				page_tree->number_of_leaf_page_descriptors = 0;
+
+				result = -1;
+
+				break;
+			}
+		}
+		if( result == 1 )
+		{
+			page_tree->number_of_leaf_values = number_of_leaf_values;
+			page_tree->next_leaf_page_number = 0;
+		}
+	}
+	else
+	{
+		result = 0;
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     page_tree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Reads the leaf page descriptors
+ * The leaf pages are read in order until the leaf page that contains the leaf value
+ * has been read or, if leaf_value_index is -1, until all leaf pages have been read
+ * The caller must hold the read/write lock of the page tree for writing
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_tree_read_leaf_page_descriptors(
+     libesedb_page_tree_t *page_tree,
+     libbfio_handle_t *file_io_handle,
+     int leaf_value_index,
+     libcerror_error_t **error )
+{
+	libesedb_page_t *page          = NULL;
+	static char *function          = "libesedb_page_tree_read_leaf_page_descriptors";
+	uint32_t leaf_page_number      = 0;
+	uint32_t next_leaf_page_number = 0;
+	int safe_number_of_leaf_values = 0;
+
+	if( page_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( leaf_value_index < -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid leaf value index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_tree->number_of_leaf_values == -1 )
+	{
+		if( libesedb_page_tree_get_get_first_leaf_page_number(
+		     page_tree,
+		     file_io_handle,
+		     &( page_tree->next_leaf_page_number ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve first leaf page number from page tree.",
+			 function );
+
+			return( -1 );
+		}
+		page_tree->number_of_leaf_values = 0;
+	}
+	while( page_tree->next_leaf_page_number != 0 )
+	{
+		if( ( leaf_value_index != -1 )
+		 && ( leaf_value_index < page_tree->number_of_leaf_values ) )
+		{
+			break;
+		}
+		leaf_page_number = page_tree->next_leaf_page_number;
+
+		if( page_tree->number_of_leaf_page_descriptors >= LIBESEDB_MAXIMUM_NUMBER_OF_LEAF_PAGES )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: invalid number of leaf pages value exceeds maximum.",
+			 function );
+
+			return( -1 );
+		}
+#if ( SIZEOF_INT <= 4 )
+		if( leaf_page_number > (uint32_t) INT_MAX )
+#else
+		if( leaf_page_number > (unsigned int) INT_MAX )
+#endif
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid leaf page number value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
+		if( libesedb_page_cache_get_page(
+		     page_tree->page_cache,
+		     file_io_handle,
+		     leaf_page_number,
+		     &page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve page: %" PRIu32 ".",
+			 function,
+			 leaf_page_number );
+
+			return( -1 );
+		}
+		safe_number_of_leaf_values = page_tree->number_of_leaf_values;
+
+		if( libesedb_page_tree_get_number_of_leaf_values_from_leaf_page(
+		     page_tree,
+		     page,
+		     &safe_number_of_leaf_values,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine number of leaf values from page: %" PRIu32 ".",
+			 function,
+			 leaf_page_number );
+
+			goto on_error;
+		}
+		if( libesedb_page_get_next_page_number(
+		     page,
+		     &next_leaf_page_number,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve next page number from page: %" PRIu32 ".",
+			 function,
+			 leaf_page_number );
+
+			goto on_error;
+		}
+		if( libesedb_page_cache_release_page(
+		     page_tree->page_cache,
+		     &page,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release page: %" PRIu32 ".",
+			 function,
+			 leaf_page_number );
+
+			goto on_error;
+		}
+		if( libesedb_page_tree_append_leaf_page_descriptor(
+		     page_tree,
+		     leaf_page_number,
+		     page_tree->number_of_leaf_values,
+		     safe_number_of_leaf_values - 1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append leaf page descriptor.",
+			 function );
+
+			goto on_error;
+		}
+		page_tree->number_of_leaf_values = safe_number_of_leaf_values;
+		page_tree->next_leaf_page_number = next_leaf_page_number;
+	}
+	return( 1 );
+
+on_error:
+	if( page != NULL )
+	{
+		libesedb_page_cache_release_page(
+		 page_tree->page_cache,
+		 &page,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Determines the number of leaf values
+ * All leaf pages are read, after which the leaf page descriptors and the number
+ * of leaf values of the page tree are no longer modified
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_tree_get_number_of_leaf_values(
+     libesedb_page_tree_t *page_tree,
+     libbfio_handle_t *file_io_handle,
+     int *number_of_leaf_values,
+     libcerror_error_t **error )
+{
+	static char *function          = "libesedb_page_tree_get_number_of_leaf_values";
+	int result                     = 1;
+	int safe_number_of_leaf_values = -1;
+
+	if( page_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_leaf_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of leaf values.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     page_tree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( page_tree->number_of_leaf_values != -1 )
+	 && ( page_tree->next_leaf_page_number == 0 ) )
+	{
+		safe_number_of_leaf_values = page_tree->number_of_leaf_values;
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     page_tree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( safe_number_of_leaf_values == -1 )
+	{
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_grab_for_write(
+		     page_tree->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for writing.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+		if( libesedb_page_tree_read_leaf_page_descriptors(
+		     page_tree,
+		     file_io_handle,
+		     -1,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read leaf page descriptors.",
+			 function );
+
+			result = -1;
+		}
+		else
+		{
+			safe_number_of_leaf_values = page_tree->number_of_leaf_values;
+		}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_release_for_write(
+		     page_tree->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for writing.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+	}
+	if( result == 1 )
+	{
+		*number_of_leaf_values = safe_number_of_leaf_values;
+	}
+	return( result );
+}
+
+/* Determines an estimate of the number of leaf values
+ * The estimate is based on the number of leaf values in the first leaf pages
+ * and the number of pages used by the page tree according to its space trees.
+ * If the space trees cannot be read the number of leaf values in the sampled
+ * leaf pages is used instead. The estimate is determined once and cached.
+ * If all leaf pages have been read the exact number of leaf values is returned
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_tree_get_estimated_number_of_leaf_values(
+     libesedb_page_tree_t *page_tree,
+     libbfio_handle_t *file_io_handle,
+     int *number_of_leaf_values,
+     libcerror_error_t **error )
+{
+	libesedb_page_t *root_page               = NULL;
+	static char *function                    = "libesedb_page_tree_get_estimated_number_of_leaf_values";
+	uint64_t estimated_number_of_leaf_values = 0;
+	uint64_t number_of_used_pages            = 0;
+	int safe_number_of_leaf_values           = -1;
+
+	if( page_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_leaf_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of leaf values.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     page_tree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( page_tree->number_of_leaf_values != -1 )
+	 && ( page_tree->next_leaf_page_number == 0 ) )
+	{
+		safe_number_of_leaf_values = page_tree->number_of_leaf_values;
+	}
+	else
+	{
+		safe_number_of_leaf_values = page_tree->estimated_number_of_leaf_values;
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     page_tree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( safe_number_of_leaf_values != -1 )
+	{
+		*number_of_leaf_values = safe_number_of_leaf_values;
+
+		return( 1 );
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     page_tree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	/* Another thread could have determined the estimate in the meantime
+	 */
+	if( page_tree->estimated_number_of_leaf_values != -1 )
+	{
+		estimated_number_of_leaf_values = (uint64_t) page_tree->estimated_number_of_leaf_values;
+	}
+	else
+	{
+		/* Sample the first leaf pages, reading a leaf value index equal to the number
+		 * of leaf values read so far forces the next leaf page to be read
+		 */
+		do
+		{
+			if( libesedb_page_tree_read_leaf_page_descriptors(
+			     page_tree,
+			     file_io_handle,
+			     page_tree->number_of_leaf_values < 0 ? 0 : page_tree->number_of_leaf_values,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_READ_FAILED,
+				 "%s: unable to read leaf page descriptors.",
+				 function );
+
+				goto on_error;
+			}
+		}
+		while( ( page_tree->next_leaf_page_number != 0 )
+		    && ( page_tree->number_of_leaf_page_descriptors < LIBESEDB_NUMBER_OF_SAMPLED_LEAF_PAGES ) );
+
+		if( ( page_tree->next_leaf_page_number == 0 )
+		 || ( page_tree->number_of_leaf_page_descriptors == 0 ) )
+		{
+			estimated_number_of_leaf_values = (uint64_t) page_tree->number_of_leaf_values;
+		}
+		else
+		{
+			if( page_tree->root_page_header == NULL )
+			{
+				if( libesedb_page_cache_get_page(
+				     page_tree->page_cache,
+				     file_io_handle,
+				     page_tree->root_page_number,
+				     &root_page,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+					 "%s: unable to retrieve page: %" PRIu32 ".",
+					 function,
+					 page_tree->root_page_number );
+
+					goto on_error;
+				}
+				if( libesedb_page_tree_read_root_page_header(
+				     page_tree,
+				     root_page,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_IO,
+					 LIBCERROR_IO_ERROR_READ_FAILED,
+					 "%s: unable to read root page header.",
+					 function );
+
+					goto on_error;
+				}
+				if( libesedb_page_cache_release_page(
+				     page_tree->page_cache,
+				     &root_page,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to release page: %" PRIu32 ".",
+					 function,
+					 page_tree->root_page_number );
+
+					goto on_error;
+				}
+			}
+			if( page_tree->root_page_header != NULL )
+			{
+				/* A corrupted space tree should not prevent an estimate, hence
+				 * the number of leaf values in the sampled leaf pages is used instead
+				 */
+				if( libesedb_page_tree_read_space_trees(
+				     page_tree,
+				     file_io_handle,
+				     &number_of_used_pages,
+				     error ) != 1 )
+				{
+#if defined( HAVE_DEBUG_OUTPUT )
+					if( libcnotify_verbose != 0 )
+					{
+						libcnotify_printf(
+						 "%s: unable to read space trees, using number of leaf values in sampled leaf pages.\n",
+						 function );
+					}
+#endif
+					libcerror_error_free(
+					 error );
+
+					number_of_used_pages = 0;
+				}
+			}
+			/* The used pages also contain the root and branch pages of the page tree
+			 * hence the estimate errs on the high side
+			 */
+			if( number_of_used_pages > (uint64_t) page_tree->number_of_leaf_page_descriptors )
+			{
+				estimated_number_of_leaf_values = ( (uint64_t) page_tree->number_of_leaf_values * number_of_used_pages )
+				                                / (uint64_t) page_tree->number_of_leaf_page_descriptors;
+			}
+			if( estimated_number_of_leaf_values < (uint64_t) page_tree->number_of_leaf_values )
+			{
+				estimated_number_of_leaf_values = (uint64_t) page_tree->number_of_leaf_values;
+			}
+			else if( estimated_number_of_leaf_values > (uint64_t) INT_MAX )
+			{
+				estimated_number_of_leaf_values = (uint64_t) INT_MAX;
+			}
+		}
+		page_tree->estimated_number_of_leaf_values = (int) estimated_number_of_leaf_values;
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     page_tree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*number_of_leaf_values = (int) estimated_number_of_leaf_values;
+
+	return( 1 );
+
+on_error:
+	if( root_page != NULL )
+	{
+		libesedb_page_cache_release_page(
+		 page_tree->page_cache,
+		 &root_page,
+		 NULL );
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	libcthreads_read_write_lock_release_for_write(
+	 page_tree->read_write_lock,
+	 NULL );
+#endif
+	return( -1 );
+}
+
+/* Retrieves the index of the leaf page descriptor that contains a specific leaf value
+ * The leaf page descriptors are read by libesedb_page_tree_read_leaf_page_descriptors
+ * The caller must hold the read/write lock of the page tree
+ * Returns 1 if successful, 0 if no such leaf page descriptor or -1 on error
+ */
+int libesedb_page_tree_get_leaf_page_descriptor_index(
+     libesedb_page_tree_t *page_tree,
+     int leaf_value_index,
+     int *leaf_page_descriptor_index,
+     libcerror_error_t **error )
+{
+	static char *function       = "libesedb_page_tree_get_leaf_page_descriptor_index";
+	int lower_descriptor_index  = 0;
+	int middle_descriptor_index = 0;
+	int upper_descriptor_index  = 0;
+
+	if( page_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( leaf_page_descriptor_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid leaf page descriptor index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( page_tree->leaf_page_descriptors == NULL )
+	 || ( leaf_value_index < 0 ) )
+	{
+		return( 0 );
+	}
+	/* Determine the last leaf page descriptor that starts at or before the leaf value.
+	 * Leaf pages without leaf values start at the same leaf value as the next leaf page
+	 * and are therefore skipped.
+	 */
+	upper_descriptor_index = page_tree->number_of_leaf_page_descriptors;
+
+	while( ( upper_descriptor_index - lower_descriptor_index ) > 1 )
+	{
+		middle_descriptor_index = lower_descriptor_index + ( ( upper_descriptor_index - lower_descriptor_index ) / 2 );
+
+		if( page_tree->leaf_page_descriptors[ middle_descriptor_index ].first_leaf_value_index <= leaf_value_index )
+		{
+			lower_descriptor_index = middle_descriptor_index;
+		}
+		else
+		{
+			upper_descriptor_index = middle_descriptor_index;
+		}
+	}
+	if( ( leaf_value_index < page_tree->leaf_page_descriptors[ lower_descriptor_index ].first_leaf_value_index )
+	 || ( leaf_value_index > page_tree->leaf_page_descriptors[ lower_descriptor_index ].last_leaf_value_index ) )
+	{
+		return( 0 );
+	}
+	*leaf_page_descriptor_index = lower_descriptor_index;
+
+	return( 1 );
+}
+
+/* Retrieves the first leaf value index of the first leaf page that starts at or after a specific leaf value
+ * All leaf page descriptors must have been read by libesedb_page_tree_get_number_of_leaf_values
+ * hence they are no longer modified and can be accessed without the read/write lock
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_tree_get_leaf_page_boundary(
+     libesedb_page_tree_t *page_tree,
+     int leaf_value_index,
+     int *boundary_leaf_value_index,
+     libcerror_error_t **error )
+{
+	static char *function              = "libesedb_page_tree_get_leaf_page_boundary";
+	int leaf_page_descriptor_index     = 0;
+	int result                         = 0;
+	int safe_boundary_leaf_value_index = 0;
+
+	if( page_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_tree->number_of_leaf_values < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page tree - number of leaf values value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_tree->next_leaf_page_number != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page tree - leaf page descriptors not fully read.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( leaf_value_index < 0 )
+	 || ( leaf_value_index > page_tree->number_of_leaf_values ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid leaf value index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( boundary_leaf_value_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid boundary leaf value index.",
+		 function );
+
+		return( -1 );
+	}
+	safe_boundary_leaf_value_index = page_tree->number_of_leaf_values;
+
+	if( ( leaf_value_index > 0 )
+	 && ( leaf_value_index < page_tree->number_of_leaf_values ) )
+	{
+		result = libesedb_page_tree_get_leaf_page_descriptor_index(
+		          page_tree,
+		          leaf_value_index,
+		          &leaf_page_descriptor_index,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve leaf page descriptor of leaf value: %d.",
+			 function,
+			 leaf_value_index );
+
+			return( -1 );
+		}
+		if( page_tree->leaf_page_descriptors[ leaf_page_descriptor_index ].first_leaf_value_index == leaf_value_index )
+		{
+			safe_boundary_leaf_value_index = leaf_value_index;
+		}
+		else if( ( leaf_page_descriptor_index + 1 ) < page_tree->number_of_leaf_page_descriptors )
+		{
+			safe_boundary_leaf_value_index = page_tree->leaf_page_descriptors[ leaf_page_descriptor_index + 1 ].first_leaf_value_index;
+		}
+	}
+	else if( leaf_value_index == 0 )
+	{
+		safe_boundary_leaf_value_index = 0;
+	}
+	*boundary_leaf_value_index = safe_boundary_leaf_value_index;
+
+	return( 1 );
+}
+
+/* Retrieves a partition of the leaf values
+ * The leaf values are divided into contiguous partitions of approximately the same
+ * number of leaf values, where every partition starts at a leaf page boundary.
+ * All the leaf pages are read by libesedb_page_tree_get_number_of_leaf_values
+ * to determine the leaf page boundaries
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_tree_get_leaf_value_partition(
+     libesedb_page_tree_t *page_tree,
+     libbfio_handle_t *file_io_handle,
+     int partition_index,
+     int number_of_partitions,
+     int *first_leaf_value_index,
+     int *number_of_leaf_values,
+     libcerror_error_t **error )
+{
+	static char *function      = "libesedb_page_tree_get_leaf_value_partition";
+	int first_boundary         = 0;
+	int last_boundary          = 0;
+	int total_number_of_values = 0;
+
+	if( page_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_partitions <= 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of partitions value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( partition_index < 0 )
+	 || ( partition_index >= number_of_partitions ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid partition index value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( first_leaf_value_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid first leaf value index.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_leaf_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of leaf values.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_page_tree_get_number_of_leaf_values(
+	     page_tree,
+	     file_io_handle,
+	     &total_number_of_values,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve number of leaf values.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_page_tree_get_leaf_page_boundary(
+	     page_tree,
+	     (int) ( ( (int64_t) total_number_of_values * partition_index ) / number_of_partitions ),
+	     &first_boundary,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve first leaf page boundary of partition: %d.",
+		 function,
+		 partition_index );
+
+		return( -1 );
+	}
+	if( libesedb_page_tree_get_leaf_page_boundary(
+	     page_tree,
+	     (int) ( ( (int64_t) total_number_of_values * ( partition_index + 1 ) ) / number_of_partitions ),
+	     &last_boundary,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve last leaf page boundary of partition: %d.",
+		 function,
+		 partition_index );
+
+		return( -1 );
+	}
+	*first_leaf_value_index = first_boundary;
+	*number_of_leaf_values  = last_boundary - first_boundary;
+
+	return( 1 );
+}
+
+/* Retrieves a specific leaf value
+ * This function creates a new data definition
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_tree_get_leaf_value_by_index_from_page(
+     libesedb_page_tree_t *page_tree,
+     libbfio_handle_t *file_io_handle,
+     libesedb_page_t *page,
+     int leaf_value_index,
+     libesedb_data_definition_t **data_definition,
+     int *current_leaf_value_index,
+     int recursion_depth,
+     libcerror_error_t **error )
+{
+	libesedb_page_t *child_page                 = NULL;
+	libesedb_page_tree_value_t *page_tree_value = NULL;
+	libesedb_page_value_t *page_value           = NULL;
+	static char *function                       = "libesedb_page_tree_get_leaf_value_by_index_from_page";
+	uint32_t child_page_number                  = 0;
+	uint32_t page_flags                         = 0;
+	uint16_t data_offset                        = 0;
+	uint16_t number_of_page_values              = 0;
+	uint16_t page_value_index                   = 0;
+
+	if( page_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( page_tree->io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid page tree - missing IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( current_leaf_value_index == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid current leaf value index.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( recursion_depth < 0 )
+	 || ( recursion_depth > LIBESEDB_MAXIMUM_INDEX_NODE_RECURSION_DEPTH ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
 		 "%s: invalid recursion depth value out of bounds.",
 		 function );
 
@@ -1817,23 +2832,6 @@ int libesedb_page_tree_get_leaf_value_by_index_from_page(
 
 		goto on_error;
 	}
-        /* Use a local cache to prevent cache invalidation of the page
-         * when reading child pages.
-         */
-	if( libfcache_cache_initialize(
-	     &child_page_cache,
-	     1,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create child page cache.",
-		 function );
-
-		goto on_error;
-	}
 	for( page_value_index = 1;
 	     page_value_index < number_of_page_values;
 	     page_value_index++ )
@@ -2043,13 +3041,11 @@ int libesedb_page_tree_get_leaf_value_by_index_from_page(
 			if( ( child_page_number > 0 )
 			 && ( child_page_number <= page_tree->io_handle->last_page_number ) )
 			{
-				if( libfdata_vector_get_element_value_by_index(
-				     page_tree->pages_vector,
-				     (intptr_t *) file_io_handle,
-				     (libfdata_cache_t *) child_page_cache,
-				     (int) child_page_number - 1,
-				     (intptr_t **) &child_page,
-				     0,
+				if( libesedb_page_cache_get_page(
+				     page_tree->page_cache,
+				     file_io_handle,
+				     child_page_number,
+				     &child_page,
 				     error ) != 1 )
 				{
 					libcerror_error_set(
@@ -2094,41 +3090,326 @@ int libesedb_page_tree_get_leaf_value_by_index_from_page(
 					 leaf_value_index,
 					 child_page_number );
 
-					goto on_error;
-				}
+					goto on_error;
+				}
+				if( libesedb_page_cache_release_page(
+				     page_tree->page_cache,
+				     &child_page,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to release page: %" PRIu32 ".",
+					 function,
+					 child_page_number );
+
+					goto on_error;
+				}
+			}
+		}
+		if( libesedb_page_tree_value_free(
+		     &page_tree_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free page tree value.",
+			 function );
+
+			goto on_error;
+		}
+		if( *current_leaf_value_index > leaf_value_index )
+		{
+			break;
+		}
+	}
+	return( 1 );
+
+on_error:
+	if( *data_definition != NULL )
+	{
+		libesedb_data_definition_free(
+		 data_definition,
+		 NULL );
+	}
+	if( page_tree_value != NULL )
+	{
+		libesedb_page_tree_value_free(
+		 &page_tree_value,
+		 NULL );
+	}
+	if( child_page != NULL )
+	{
+		libesedb_page_cache_release_page(
+		 page_tree->page_cache,
+		 &child_page,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves a specific leaf value
+ * This function creates a new data definition
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_page_tree_get_leaf_value_by_index(
+     libesedb_page_tree_t *page_tree,
+     libbfio_handle_t *file_io_handle,
+     int leaf_value_index,
+     libesedb_data_definition_t **data_definition,
+     libcerror_error_t **error )
+{
+	libesedb_page_t *base_page     = NULL;
+	static char *function          = "libesedb_page_tree_get_leaf_value_by_index";
+	uint32_t base_page_number      = 0;
+	int current_leaf_value_index   = 0;
+	int leaf_page_descriptor_index = 0;
+	int leaf_page_descriptors_read = 0;
+	int result                     = 0;
+
+	if( page_tree == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( leaf_value_index < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid leaf value index value out of bounds.",
+		 function );
+
+		goto on_error;
+	}
+	if( data_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data definition.",
+		 function );
+
+		return( -1 );
+	}
+	base_page_number = page_tree->root_page_number;
+
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     page_tree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( ( page_tree->number_of_leaf_values != -1 )
+	 && ( ( page_tree->next_leaf_page_number == 0 )
+	  || ( leaf_value_index < page_tree->number_of_leaf_values ) ) )
+	{
+		result = libesedb_page_tree_get_leaf_page_descriptor_index(
+		          page_tree,
+		          leaf_value_index,
+		          &leaf_page_descriptor_index,
+		          error );
+
+		if( result == 1 )
+		{
+			current_leaf_value_index = page_tree->leaf_page_descriptors[ leaf_page_descriptor_index ].first_leaf_value_index;
+			base_page_number         = page_tree->leaf_page_descriptors[ leaf_page_descriptor_index ].page_number;
+		}
+		leaf_page_descriptors_read = 1;
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     page_tree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( leaf_page_descriptors_read == 0 )
+	{
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_grab_for_write(
+		     page_tree->read_write_lock,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab read/write lock for writing.",
+			 function );
+
+			return( -1 );
+		}
+#endif
+		/* Only the leaf pages up to the one that contains the leaf value are read,
+		 * so that the first leaf values can be retrieved without reading all leaf pages
+		 */
+		result = libesedb_page_tree_read_leaf_page_descriptors(
+		          page_tree,
+		          file_io_handle,
+		          leaf_value_index,
+		          error );
+
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read leaf page descriptors.",
+			 function );
+		}
+		else
+		{
+			result = libesedb_page_tree_get_leaf_page_descriptor_index(
+			          page_tree,
+			          leaf_value_index,
+			          &leaf_page_descriptor_index,
+			          error );
+
+			if( result == 1 )
+			{
+				current_leaf_value_index = page_tree->leaf_page_descriptors[ leaf_page_descriptor_index ].first_leaf_value_index;
+				base_page_number         = page_tree->leaf_page_descriptors[ leaf_page_descriptor_index ].page_number;
 			}
 		}
-		if( libesedb_page_tree_value_free(
-		     &page_tree_value,
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_release_for_write(
+		     page_tree->read_write_lock,
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free page tree value.",
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release read/write lock for writing.",
 			 function );
 
-			goto on_error;
+			return( -1 );
 		}
-		if( *current_leaf_value_index > leaf_value_index )
+#endif
+	}
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve leaf page descriptor of leaf value: %d.",
+		 function,
+		 leaf_value_index );
+
+		goto on_error;
+	}
+	if( libesedb_page_cache_get_page(
+	     page_tree->page_cache,
+	     file_io_handle,
+	     base_page_number,
+	     &base_page,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve page: %" PRIu32 ".",
+		 function,
+		 base_page_number );
+
+		goto on_error;
+	}
+	if( base_page_number == page_tree->root_page_number )
+	{
+		if( libesedb_page_validate_root_page(
+		     base_page,
+		     error ) != 1 )
 		{
-			break;
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unsupported root page.",
+			 function );
+
+			goto on_error;
 		}
 	}
-	if( libfcache_cache_free(
-	     &child_page_cache,
+	if( libesedb_page_tree_get_leaf_value_by_index_from_page(
+	     page_tree,
+	     file_io_handle,
+	     base_page,
+	     leaf_value_index,
+	     data_definition,
+	     &current_leaf_value_index,
+	     0,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free child page cache.",
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve leaf value: %d from page: %" PRIu32 ".",
+		 function,
+		 leaf_value_index,
+		 base_page_number );
+
+		goto on_error;
+	}
+	if( current_leaf_value_index != ( leaf_value_index + 1 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid current leaf value index value out of bounds.",
 		 function );
 
 		goto on_error;
 	}
+	if( libesedb_page_cache_release_page(
+	     page_tree->page_cache,
+	     &base_page,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to release page: %" PRIu32 ".",
+		 function,
+		 base_page_number );
+
+		goto on_error;
+	}
 	return( 1 );
 
 on_error:
@@ -2138,42 +3419,42 @@ on_error:
 		 data_definition,
 		 NULL );
 	}
-	if( page_tree_value != NULL )
-	{
-		libesedb_page_tree_value_free(
-		 &page_tree_value,
-		 NULL );
-	}
-	if( child_page_cache != NULL )
+	if( base_page != NULL )
 	{
-		libfcache_cache_free(
-		 &child_page_cache,
+		libesedb_page_cache_release_page(
+		 page_tree->page_cache,
+		 &base_page,
 		 NULL );
 	}
 	return( -1 );
 }
 
-/* Retrieves a specific leaf value
- * This function creates a new data definition
+/* Determines the index of the first branch page value that can contain a specific key
+ * The page values of a branch page are sorted by key, hence a binary search is used
+ * that only reads the keys of the page values that are probed. Defunct page values
+ * are skipped. The page value index is set to the number of page values if no such
+ * page value was found
  * Returns 1 if successful or -1 on error
  */
-int libesedb_page_tree_get_leaf_value_by_index(
+int libesedb_page_tree_get_first_branch_value_index_by_key(
      libesedb_page_tree_t *page_tree,
-     libbfio_handle_t *file_io_handle,
-     int leaf_value_index,
-     libesedb_data_definition_t **data_definition,
+     libesedb_page_t *page,
+     uint32_t page_flags,
+     libesedb_page_value_t *header_page_value,
+     libesedb_page_tree_value_t *page_tree_value,
+     libesedb_page_tree_key_t *leaf_value_key,
+     uint16_t *page_value_index,
      libcerror_error_t **error )
 {
-	libcdata_tree_node_t *upper_node                               = NULL;
-	libesedb_leaf_page_descriptor_t *existing_leaf_page_descriptor = NULL;
-	libesedb_leaf_page_descriptor_t *leaf_page_descriptor          = NULL;
-	libesedb_page_t *base_page                                     = NULL;
-	libfcache_cache_t *base_page_cache                             = NULL;
-	static char *function                                          = "libesedb_page_tree_get_leaf_value_by_index";
-	uint32_t base_page_number                                      = 0;
-	int current_leaf_value_index                                   = 0;
-	int number_of_leaf_values                                      = 0;
-	int result                                                     = 0;
+	libesedb_page_value_t *page_value = NULL;
+	const uint8_t *common_key_data    = NULL;
+	static char *function             = "libesedb_page_tree_get_first_branch_value_index_by_key";
+	uint16_t high_page_value_index    = 0;
+	uint16_t low_page_value_index     = 0;
+	uint16_t middle_page_value_index  = 0;
+	uint16_t number_of_page_values    = 0;
+	uint16_t probe_page_value_index   = 0;
+	int compare_result                = 0;
 
 	if( page_tree == NULL )
 	{
@@ -2186,234 +3467,203 @@ int libesedb_page_tree_get_leaf_value_by_index(
 
 		return( -1 );
 	}
-	if( leaf_value_index < 0 )
+	if( ( page_flags & LIBESEDB_PAGE_FLAG_IS_LEAF ) != 0 )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid leaf value index value out of bounds.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported page flags - page is not a branch page.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	if( data_definition == NULL )
+	if( header_page_value == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid data definition.",
+		 "%s: invalid header page value.",
 		 function );
 
 		return( -1 );
 	}
-	if( page_tree->number_of_leaf_values == -1 )
+	if( page_tree_value == NULL )
 	{
-		/* libesedb_page_tree_get_number_of_leaf_values is called to build the leaf_page_descriptors_tree
-		 */
-		if( libesedb_page_tree_get_number_of_leaf_values(
-		     page_tree,
-		     file_io_handle,
-		     &number_of_leaf_values,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve number of leaf values from page: %" PRIu32 ".",
-			 function,
-			 page_tree->root_page_number );
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page tree value.",
+		 function );
 
-			goto on_error;
-		}
+		return( -1 );
 	}
-	base_page_number = page_tree->root_page_number;
-
-	if( libesedb_leaf_page_descriptor_initialize(
-	     &leaf_page_descriptor,
-	     error ) != 1 )
+	if( page_value_index == NULL )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create leaf page descriptor.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page value index.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	leaf_page_descriptor->first_leaf_value_index = leaf_value_index;
-	leaf_page_descriptor->last_leaf_value_index  = leaf_value_index;
-
-	result = libcdata_btree_get_value_by_value(
-	          page_tree->leaf_page_descriptors_tree,
-	          (intptr_t *) leaf_page_descriptor,
-	          (int (*)(intptr_t *, intptr_t *, libcerror_error_t **)) &libesedb_leaf_page_descriptor_compare,
-	          &upper_node,
-	          (intptr_t **) &existing_leaf_page_descriptor,
-	          error );
-
-	if( result == -1 )
+	if( libesedb_page_get_number_of_values(
+	     page,
+	     &number_of_page_values,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve leaf page descriptor from tree.",
+		 "%s: unable to retrieve number of page values.",
 		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	else if( result != 0 )
+	/* Page value 0 contains the page header hence the search starts at page value 1.
+	 * The search determines the first page value for which the key is not greater
+	 * than the key of the page value, within [low, high).
+	 */
+	low_page_value_index  = 1;
+	high_page_value_index = number_of_page_values;
+
+	while( low_page_value_index < high_page_value_index )
 	{
-		if( existing_leaf_page_descriptor == NULL )
+		middle_page_value_index = low_page_value_index + ( ( high_page_value_index - low_page_value_index ) / 2 );
+
+		for( probe_page_value_index = middle_page_value_index;
+		     probe_page_value_index < high_page_value_index;
+		     probe_page_value_index++ )
+		{
+			if( libesedb_page_get_value_by_index(
+			     page,
+			     probe_page_value_index,
+			     &page_value,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve page value: %" PRIu16 ".",
+				 function,
+				 probe_page_value_index );
+
+				return( -1 );
+			}
+			if( page_value == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+				 "%s: missing page value: %" PRIu16 ".",
+				 function,
+				 probe_page_value_index );
+
+				return( -1 );
+			}
+			if( ( page_value->flags & LIBESEDB_PAGE_TAG_FLAG_IS_DEFUNCT ) == 0 )
+			{
+				break;
+			}
+		}
+		/* All the page values in [middle, high) are defunct
+		 */
+		if( probe_page_value_index >= high_page_value_index )
+		{
+			high_page_value_index = middle_page_value_index;
+
+			continue;
+		}
+		if( ( page_flags & LIBESEDB_PAGE_FLAG_IS_ROOT ) != 0 )
+		{
+			if( ( page_value->flags & LIBESEDB_PAGE_TAG_FLAG_HAS_COMMON_KEY_SIZE ) != 0 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+				 "%s: unsupported page - root flag is set and page value: %" PRIu16 " has common key.",
+				 function,
+				 probe_page_value_index );
+
+				return( -1 );
+			}
+		}
+		if( libesedb_page_tree_value_read_data(
+		     page_tree_value,
+		     page_value->data,
+		     (size_t) page_value->size,
+		     page_value->flags,
+		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: missing existing leaf page descriptor.",
-			 function );
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read page tree value: %" PRIu16 ".",
+			 function,
+			 probe_page_value_index );
 
-			goto on_error;
+			return( -1 );
 		}
-		current_leaf_value_index = existing_leaf_page_descriptor->first_leaf_value_index;
-		base_page_number         = existing_leaf_page_descriptor->page_number;
-	}
-	if( libesedb_leaf_page_descriptor_free(
-	     &leaf_page_descriptor,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free leaf page descriptor.",
-		 function );
+		common_key_data = NULL;
 
-		goto on_error;
-	}
-        /* Use a local cache to prevent cache invalidation of the root page
-         * when reading child pages.
-         */
-	if( libfcache_cache_initialize(
-	     &base_page_cache,
-	     1,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create base page cache.",
-		 function );
+		if( page_tree_value->common_key_size > 0 )
+		{
+			if( page_tree_value->common_key_size > header_page_value->size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: common key size of page value: %" PRIu16 " exceeds header page value size.",
+				 function,
+				 probe_page_value_index );
 
-		goto on_error;
-	}
-	if( libfdata_vector_get_element_value_by_index(
-	     page_tree->pages_vector,
-	     (intptr_t *) file_io_handle,
-	     (libfdata_cache_t *) base_page_cache,
-	     (int) base_page_number - 1,
-	     (intptr_t **) &base_page,
-	     0,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve page: %" PRIu32 ".",
-		 function,
-		 base_page_number );
+				return( -1 );
+			}
+			common_key_data = header_page_value->data;
+		}
+		compare_result = libesedb_page_tree_key_compare_data(
+		                  leaf_value_key,
+		                  common_key_data,
+		                  (size_t) page_tree_value->common_key_size,
+		                  page_tree_value->local_key,
+		                  (size_t) page_tree_value->local_key_size,
+		                  LIBESEDB_KEY_TYPE_BRANCH,
+		                  error );
 
-		goto on_error;
-	}
-	if( base_page_number == page_tree->root_page_number )
-	{
-		if( libesedb_page_validate_root_page(
-		     base_page,
-		     error ) != 1 )
+		if( compare_result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-			 "%s: unsupported root page.",
-			 function );
+			 LIBCERROR_RUNTIME_ERROR_GENERIC,
+			 "%s: unable to compare page value: %" PRIu16 " and leaf value keys.",
+			 function,
+			 probe_page_value_index );
 
-			goto on_error;
+			return( -1 );
+		}
+		if( compare_result == LIBFDATA_COMPARE_GREATER )
+		{
+			low_page_value_index = probe_page_value_index + 1;
+		}
+		else
+		{
+			high_page_value_index = middle_page_value_index;
 		}
 	}
-	if( libesedb_page_tree_get_leaf_value_by_index_from_page(
-	     page_tree,
-	     file_io_handle,
-	     base_page,
-	     leaf_value_index,
-	     data_definition,
-	     &current_leaf_value_index,
-	     0,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve leaf value: %d from page: %" PRIu32 ".",
-		 function,
-		 leaf_value_index,
-		 base_page_number );
-
-		goto on_error;
-	}
-	if( current_leaf_value_index != ( leaf_value_index + 1 ) )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
-		 "%s: invalid current leaf value index value out of bounds.",
-		 function );
-
-		goto on_error;
-	}
-	if( libfcache_cache_free(
-	     &base_page_cache,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free base page cache.",
-		 function );
+	*page_value_index = low_page_value_index;
 
-		goto on_error;
-	}
 	return( 1 );
-
-on_error:
-	if( *data_definition != NULL )
-	{
-		libesedb_data_definition_free(
-		 data_definition,
-		 NULL );
-	}
-	if( leaf_page_descriptor != NULL )
-	{
-		libesedb_leaf_page_descriptor_free(
-		 &leaf_page_descriptor,
-		 NULL );
-	}
-	if( base_page_cache != NULL )
-	{
-		libfcache_cache_free(
-		 &base_page_cache,
-		 NULL );
-	}
-	return( -1 );
 }
 
 /* Retrieves a specific leaf value
@@ -2429,17 +3679,19 @@ int libesedb_page_tree_get_leaf_value_by_key_from_page(
      int recursion_depth,
      libcerror_error_t **error )
 {
-	libesedb_page_tree_key_t *page_value_key    = NULL;
 	libesedb_page_t *child_page                 = NULL;
 	libesedb_page_tree_value_t *page_tree_value = NULL;
+	libesedb_page_value_t *header_page_value    = NULL;
 	libesedb_page_value_t *page_value           = NULL;
-	libfcache_cache_t *child_page_cache         = NULL;
+	const uint8_t *common_key_data              = NULL;
 	static char *function                       = "libesedb_page_tree_get_leaf_value_by_key_from_page";
 	uint32_t child_page_number                  = 0;
 	uint32_t page_flags                         = 0;
 	uint16_t data_offset                        = 0;
+	uint16_t first_page_value_index             = 1;
 	uint16_t number_of_page_values              = 0;
 	uint16_t page_value_index                   = 0;
+	uint8_t key_type                            = 0;
 	int compare_result                          = 0;
 	int result                                  = 0;
 
@@ -2520,24 +3772,83 @@ int libesedb_page_tree_get_leaf_value_by_key_from_page(
 
 		goto on_error;
 	}
-        /* Use a local cache to prevent cache invalidation of the page
-         * when reading child pages.
-         */
-	if( libfcache_cache_initialize(
-	     &child_page_cache,
-	     1,
+	if( ( page_flags & LIBESEDB_PAGE_FLAG_IS_LEAF ) != 0 )
+	{
+		key_type = LIBESEDB_KEY_TYPE_LEAF;
+	}
+	else
+	{
+		key_type = LIBESEDB_KEY_TYPE_BRANCH;
+	}
+	/* The common key data of the page values is stored in the page header value
+	 * and is compared in place together with the local key of the page value.
+	 */
+	if( libesedb_page_get_value_by_index(
+	     page,
+	     0,
+	     &header_page_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve page value: 0.",
+		 function );
+
+		goto on_error;
+	}
+	if( header_page_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: missing page value: 0.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_page_tree_value_initialize(
+	     &page_tree_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create child page cache.",
+		 "%s: unable to create page tree value.",
 		 function );
 
 		goto on_error;
 	}
-	for( page_value_index = 1;
+	/* On a branch page the first page value that can contain the key is determined
+	 * using a binary search. The remaining page values are checked sequentially since
+	 * the key can be stored in a subsequent child page.
+	 */
+	if( key_type == LIBESEDB_KEY_TYPE_BRANCH )
+	{
+		if( libesedb_page_tree_get_first_branch_value_index_by_key(
+		     page_tree,
+		     page,
+		     page_flags,
+		     header_page_value,
+		     page_tree_value,
+		     leaf_value_key,
+		     &first_page_value_index,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve first branch page value index.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	for( page_value_index = first_page_value_index;
 	     page_value_index < number_of_page_values;
 	     page_value_index++ )
 	{
@@ -2602,19 +3913,6 @@ int libesedb_page_tree_get_leaf_value_by_key_from_page(
 				goto on_error;
 			}
 		}
-		if( libesedb_page_tree_value_initialize(
-		     &page_tree_value,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create page tree value.",
-			 function );
-
-			goto on_error;
-		}
 		if( libesedb_page_tree_value_read_data(
 		     page_tree_value,
 		     page_value->data,
@@ -2632,28 +3930,31 @@ int libesedb_page_tree_get_leaf_value_by_key_from_page(
 
 			goto on_error;
 		}
-		if( libesedb_page_tree_get_key(
-		     page_tree,
-		     page_tree_value,
-		     page,
-		     page_flags,
-		     page_value_index,
-		     &page_value_key,
-		     error ) != 1 )
+		common_key_data = NULL;
+
+		if( page_tree_value->common_key_size > 0 )
 		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-			 "%s: unable to retrieve key of page value: %" PRIu16 ".",
-			 function,
-			 page_value_index );
+			if( page_tree_value->common_key_size > header_page_value->size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: common key size of page value: %" PRIu16 " exceeds header page value size.",
+				 function,
+				 page_value_index );
 
-			goto on_error;
+				goto on_error;
+			}
+			common_key_data = header_page_value->data;
 		}
-		compare_result = libesedb_page_tree_key_compare(
+		compare_result = libesedb_page_tree_key_compare_data(
 		                  leaf_value_key,
-		                  page_value_key,
+		                  common_key_data,
+		                  (size_t) page_tree_value->common_key_size,
+		                  page_tree_value->local_key,
+		                  (size_t) page_tree_value->local_key_size,
+		                  key_type,
 		                  error );
 
 		if( compare_result == -1 )
@@ -2780,13 +4081,11 @@ int libesedb_page_tree_get_leaf_value_by_key_from_page(
 			if( ( child_page_number > 0 )
 			 && ( child_page_number <= page_tree->io_handle->last_page_number ) )
 			{
-				if( libfdata_vector_get_element_value_by_index(
-				     page_tree->pages_vector,
-				     (intptr_t *) file_io_handle,
-				     (libfdata_cache_t *) child_page_cache,
-				     (int) child_page_number - 1,
-				     (intptr_t **) &child_page,
-				     0,
+				if( libesedb_page_cache_get_page(
+				     page_tree->page_cache,
+				     file_io_handle,
+				     child_page_number,
+				     &child_page,
 				     error ) != 1 )
 				{
 					libcerror_error_set(
@@ -2833,48 +4132,37 @@ int libesedb_page_tree_get_leaf_value_by_key_from_page(
 
 					goto on_error;
 				}
-			}
-		}
-		if( libesedb_page_tree_key_free(
-		     &page_value_key,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free page value key.",
-			 function );
-
-			goto on_error;
-		}
-		if( libesedb_page_tree_value_free(
-		     &page_tree_value,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free page tree value.",
-			 function );
+				if( libesedb_page_cache_release_page(
+				     page_tree->page_cache,
+				     &child_page,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to release page: %" PRIu32 ".",
+					 function,
+					 child_page_number );
 
-			goto on_error;
+					goto on_error;
+				}
+			}
 		}
 		if( result != 0 )
 		{
 			break;
 		}
 	}
-	if( libfcache_cache_free(
-	     &child_page_cache,
+	if( libesedb_page_tree_value_free(
+	     &page_tree_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free child page cache.",
+		 "%s: unable to free page tree value.",
 		 function );
 
 		goto on_error;
@@ -2888,22 +4176,17 @@ on_error:
 		 data_definition,
 		 NULL );
 	}
-	if( page_value_key != NULL )
-	{
-		libesedb_page_tree_key_free(
-		 &page_value_key,
-		 NULL );
-	}
 	if( page_tree_value != NULL )
 	{
 		libesedb_page_tree_value_free(
 		 &page_tree_value,
 		 NULL );
 	}
-	if( child_page_cache != NULL )
+	if( child_page != NULL )
 	{
-		libfcache_cache_free(
-		 &child_page_cache,
+		libesedb_page_cache_release_page(
+		 page_tree->page_cache,
+		 &child_page,
 		 NULL );
 	}
 	return( -1 );
@@ -2920,10 +4203,9 @@ int libesedb_page_tree_get_leaf_value_by_key(
      libesedb_data_definition_t **data_definition,
      libcerror_error_t **error )
 {
-	libesedb_page_t *root_page         = NULL;
-	libfcache_cache_t *root_page_cache = NULL;
-	static char *function              = "libesedb_page_tree_get_leaf_value_by_key";
-	int result                         = 0;
+	libesedb_page_t *root_page = NULL;
+	static char *function      = "libesedb_page_tree_get_leaf_value_by_key";
+	int result                 = 0;
 
 	if( page_tree == NULL )
 	{
@@ -2936,30 +4218,11 @@ int libesedb_page_tree_get_leaf_value_by_key(
 
 		return( -1 );
 	}
-	/* Use a local cache to prevent cache invalidation of the root page
-	 * when reading child pages.
-	 */
-	if( libfcache_cache_initialize(
-	     &root_page_cache,
-	     1,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create root page cache.",
-		 function );
-
-		goto on_error;
-	}
-	if( libfdata_vector_get_element_value_by_index(
-	     page_tree->pages_vector,
-	     (intptr_t *) file_io_handle,
-	     (libfdata_cache_t *) root_page_cache,
-	     (int) page_tree->root_page_number - 1,
-	     (intptr_t **) &root_page,
-	     0,
+	if( libesedb_page_cache_get_page(
+	     page_tree->page_cache,
+	     file_io_handle,
+	     page_tree->root_page_number,
+	     &root_page,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -2986,12 +4249,29 @@ int libesedb_page_tree_get_leaf_value_by_key(
 		goto on_error;
 	}
 #if defined( HAVE_DEBUG_OUTPUT )
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     page_tree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
 	if( page_tree->root_page_header == NULL )
 	{
-		if( libesedb_page_tree_read_root_page_header(
-		     page_tree,
-		     root_page,
-		     error ) != 1 )
+		result = libesedb_page_tree_read_root_page_header(
+		          page_tree,
+		          root_page,
+		          error );
+
+		if( result != 1 )
 		{
 			libcerror_error_set(
 			 error,
@@ -2999,10 +4279,27 @@ int libesedb_page_tree_get_leaf_value_by_key(
 			 LIBCERROR_IO_ERROR_READ_FAILED,
 			 "%s: unable to read root page header.",
 			 function );
-
-			goto on_error;
 		}
 	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     page_tree->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	if( result == -1 )
+	{
+		goto on_error;
+	}
 #endif
 	result = libesedb_page_tree_get_leaf_value_by_key_from_page(
 	          page_tree,
@@ -3025,26 +4322,29 @@ int libesedb_page_tree_get_leaf_value_by_key(
 
 		goto on_error;
 	}
-	if( libfcache_cache_free(
-	     &root_page_cache,
+	if( libesedb_page_cache_release_page(
+	     page_tree->page_cache,
+	     &root_page,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free root page cache.",
-		 function );
+		 "%s: unable to release page: %" PRIu32 ".",
+		 function,
+		 page_tree->root_page_number );
 
 		goto on_error;
 	}
 	return( result );
 
 on_error:
-	if( root_page_cache != NULL )
+	if( root_page != NULL )
 	{
-		libfcache_cache_free(
-		 &root_page_cache,
+		libesedb_page_cache_release_page(
+		 page_tree->page_cache,
+		 &root_page,
 		 NULL );
 	}
 	return( -1 );
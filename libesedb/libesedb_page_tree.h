@@ -27,12 +27,12 @@
 
 #include "libesedb_data_definition.h"
 #include "libesedb_io_handle.h"
+#include "libesedb_leaf_page_descriptor.h"
 #include "libesedb_libbfio.h"
-#include "libesedb_libcdata.h"
 #include "libesedb_libcerror.h"
-#include "libesedb_libfcache.h"
-#include "libesedb_libfdata.h"
+#include "libesedb_libcthreads.h"
 #include "libesedb_page.h"
+#include "libesedb_page_cache.h"
 #include "libesedb_page_tree_key.h"
 #include "libesedb_page_tree_value.h"
 #include "libesedb_page_value.h"
@@ -67,32 +67,51 @@ struct libesedb_page_tree
 	 */
 	libesedb_table_definition_t *template_table_definition;
 
-	/* The pages vector
+	/* The page cache
 	 */
-	libfdata_vector_t *pages_vector;
-
-	/* The pages cache
-	 */
-	libfcache_cache_t *pages_cache;
+	libesedb_page_cache_t *page_cache;
 
 	/* The root page header
 	 */
 	libesedb_root_page_header_t *root_page_header;
 
-	/* The leaf page descriptors tree
+	/* The leaf page descriptors, stored in leaf page order
+	 */
+	libesedb_leaf_page_descriptor_t *leaf_page_descriptors;
+
+	/* The number of leaf page descriptors
 	 */
-	libcdata_btree_t *leaf_page_descriptors_tree;
+	int number_of_leaf_page_descriptors;
+
+	/* The number of allocated leaf page descriptors
+	 */
+	int number_of_allocated_leaf_page_descriptors;
 
 	/* The number of leaf values
 	 */
 	int number_of_leaf_values;
+
+	/* The number of the next leaf page to read
+	 */
+	uint32_t next_leaf_page_number;
+
+	/* The estimated number of leaf values, or -1 if not yet determined
+	 */
+	int estimated_number_of_leaf_values;
+
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	/* The read/write lock that protects the root page header, the leaf page descriptors,
+	 * the number of leaf values and its estimate, which are read on demand. Pages are
+	 * retrieved from the page cache without holding the lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
 };
 
 int libesedb_page_tree_initialize(
      libesedb_page_tree_t **page_tree,
      libesedb_io_handle_t *io_handle,
-     libfdata_vector_t *pages_vector,
-     libfcache_cache_t *pages_cache,
+     libesedb_page_cache_t *page_cache,
      uint32_t object_identifier,
      uint32_t root_page_number,
      libesedb_table_definition_t *table_definition,
@@ -111,6 +130,7 @@ int libesedb_page_tree_read_root_page_header(
 int libesedb_page_tree_read_space_trees(
      libesedb_page_tree_t *page_tree,
      libbfio_handle_t *file_io_handle,
+     uint64_t *number_of_used_pages,
      libcerror_error_t **error );
 
 int libesedb_page_tree_get_key(
@@ -142,12 +162,59 @@ int libesedb_page_tree_get_number_of_leaf_values_from_leaf_page(
      int *number_of_leaf_values,
      libcerror_error_t **error );
 
+int libesedb_page_tree_append_leaf_page_descriptor(
+     libesedb_page_tree_t *page_tree,
+     uint32_t page_number,
+     int first_leaf_value_index,
+     int last_leaf_value_index,
+     libcerror_error_t **error );
+
+int libesedb_page_tree_set_leaf_page_descriptors(
+     libesedb_page_tree_t *page_tree,
+     const libesedb_leaf_page_descriptor_t *leaf_page_descriptors,
+     int number_of_leaf_page_descriptors,
+     int number_of_leaf_values,
+     libcerror_error_t **error );
+
+int libesedb_page_tree_read_leaf_page_descriptors(
+     libesedb_page_tree_t *page_tree,
+     libbfio_handle_t *file_io_handle,
+     int leaf_value_index,
+     libcerror_error_t **error );
+
 int libesedb_page_tree_get_number_of_leaf_values(
      libesedb_page_tree_t *page_tree,
      libbfio_handle_t *file_io_handle,
      int *number_of_leaf_values,
      libcerror_error_t **error );
 
+int libesedb_page_tree_get_estimated_number_of_leaf_values(
+     libesedb_page_tree_t *page_tree,
+     libbfio_handle_t *file_io_handle,
+     int *number_of_leaf_values,
+     libcerror_error_t **error );
+
+int libesedb_page_tree_get_leaf_page_descriptor_index(
+     libesedb_page_tree_t *page_tree,
+     int leaf_value_index,
+     int *leaf_page_descriptor_index,
+     libcerror_error_t **error );
+
+int libesedb_page_tree_get_leaf_page_boundary(
+     libesedb_page_tree_t *page_tree,
+     int leaf_value_index,
+     int *boundary_leaf_value_index,
+     libcerror_error_t **error );
+
+int libesedb_page_tree_get_leaf_value_partition(
+     libesedb_page_tree_t *page_tree,
+     libbfio_handle_t *file_io_handle,
+     int partition_index,
+     int number_of_partitions,
+     int *first_leaf_value_index,
+     int *number_of_leaf_values,
+     libcerror_error_t **error );
+
 int libesedb_page_tree_get_leaf_value_by_index_from_page(
      libesedb_page_tree_t *page_tree,
      libbfio_handle_t *file_io_handle,
@@ -165,6 +232,16 @@ int libesedb_page_tree_get_leaf_value_by_index(
      libesedb_data_definition_t **data_definition,
      libcerror_error_t **error );
 
+int libesedb_page_tree_get_first_branch_value_index_by_key(
+     libesedb_page_tree_t *page_tree,
+     libesedb_page_t *page,
+     uint32_t page_flags,
+     libesedb_page_value_t *header_page_value,
+     libesedb_page_tree_value_t *page_tree_value,
+     libesedb_page_tree_key_t *leaf_value_key,
+     uint16_t *page_value_index,
+     libcerror_error_t **error );
+
 int libesedb_page_tree_get_leaf_value_by_key_from_page(
      libesedb_page_tree_t *page_tree,
      libbfio_handle_t *file_io_handle,
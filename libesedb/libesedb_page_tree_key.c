@@ -332,107 +332,197 @@ int libesedb_page_tree_key_compare(
      libesedb_page_tree_key_t *second_page_tree_key,
      libcerror_error_t **error )
 {
-	static char *function                  = "libesedb_page_tree_key_compare";
-	size_t compare_data_size               = 0;
-	size_t first_page_tree_key_data_index  = 0;
-	size_t second_page_tree_key_data_index = 0;
-	int16_t compare_result                 = -1;
-	uint8_t first_page_tree_key_data       = 0;
-	int result                             = -1;
+	static char *function = "libesedb_page_tree_key_compare";
+	int result            = 0;
+
+	if( second_page_tree_key == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid second page tree key.",
+		 function );
+
+		return( -1 );
+	}
+	result = libesedb_page_tree_key_compare_data(
+	          first_page_tree_key,
+	          NULL,
+	          0,
+	          second_page_tree_key->data,
+	          second_page_tree_key->data_size,
+	          second_page_tree_key->type,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GENERIC,
+		 "%s: unable to compare page tree keys.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Compares a page tree key with the key data of a page value
+ * The key data of the page value consists of the common key data, that is
+ * stored in the page header value, followed by the local key data. Both are
+ * compared in place to prevent having to reconstruct the page value key
+ * Returns LIBFDATA_COMPARE_LESS, LIBFDATA_COMPARE_EQUAL, LIBFDATA_COMPARE_GREATER,
+ * LIBFDATA_COMPARE_GREATER_EQUAL if successful or -1 on error
+ */
+int libesedb_page_tree_key_compare_data(
+     libesedb_page_tree_key_t *page_tree_key,
+     const uint8_t *common_key_data,
+     size_t common_key_data_size,
+     const uint8_t *local_key_data,
+     size_t local_key_data_size,
+     uint8_t key_type,
+     libcerror_error_t **error )
+{
+	static char *function           = "libesedb_page_tree_key_compare_data";
+	size_t compare_data_size        = 0;
+	size_t key_data_index           = 0;
+	size_t key_data_size            = 0;
+	size_t page_tree_key_data_index = 0;
+	int16_t compare_result          = -1;
+	uint8_t key_data                = 0;
+	uint8_t page_tree_key_data      = 0;
+	int result                      = -1;
 
 #if defined( HAVE_DEBUG_OUTPUT )
-	uint8_t *page_tree_key_data            = NULL;
-	size_t page_tree_key_data_size         = 0;
-	uint8_t is_flexible_match              = 0;
+	const uint8_t *debug_key_data   = NULL;
+	size_t debug_key_data_size      = 0;
+	uint8_t is_flexible_match       = 0;
 #endif
 
-	if( first_page_tree_key == NULL )
+	if( page_tree_key == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid first page tree key.",
+		 "%s: invalid page tree key.",
 		 function );
 
 		return( -1 );
 	}
-	if( first_page_tree_key->data == NULL )
+	if( page_tree_key->data == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid first page tree key - missing data.",
+		 "%s: invalid page tree key - missing data.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( first_page_tree_key->type != LIBESEDB_KEY_TYPE_INDEX_VALUE )
-	 && ( first_page_tree_key->type != LIBESEDB_KEY_TYPE_LONG_VALUE )
-	 && ( first_page_tree_key->type != LIBESEDB_KEY_TYPE_LONG_VALUE_SEGMENT ) )
+	if( ( page_tree_key->type != LIBESEDB_KEY_TYPE_INDEX_VALUE )
+	 && ( page_tree_key->type != LIBESEDB_KEY_TYPE_LONG_VALUE )
+	 && ( page_tree_key->type != LIBESEDB_KEY_TYPE_LONG_VALUE_SEGMENT ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported first page tree key type.",
+		 "%s: unsupported page tree key type.",
 		 function );
 
 		return( -1 );
 	}
-	if( second_page_tree_key == NULL )
+	if( ( common_key_data == NULL )
+	 && ( common_key_data_size > 0 ) )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid second page tree key.",
+		 "%s: invalid common key data.",
 		 function );
 
 		return( -1 );
 	}
-	if( ( second_page_tree_key->type != LIBESEDB_KEY_TYPE_BRANCH )
-	 && ( second_page_tree_key->type != LIBESEDB_KEY_TYPE_LEAF ) )
+	if( common_key_data_size > (size_t) SSIZE_MAX )
 	{
 		libcerror_error_set(
 		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
-		 "%s: unsupported second page tree key type.",
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid common key data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( local_key_data == NULL )
+	 && ( local_key_data_size > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid local key data.",
+		 function );
+
+		return( -1 );
+	}
+	if( local_key_data_size > (size_t) SSIZE_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_EXCEEDS_MAXIMUM,
+		 "%s: invalid local key data size value exceeds maximum.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( key_type != LIBESEDB_KEY_TYPE_BRANCH )
+	 && ( key_type != LIBESEDB_KEY_TYPE_LEAF ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported key type.",
 		 function );
 
 		return( -1 );
 	}
+	key_data_size = common_key_data_size + local_key_data_size;
+
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
 		libcnotify_printf(
-		 "%s: first page tree key\t\t\t: ",
+		 "%s: page tree key\t\t\t\t: ",
 		 function );
 
-		page_tree_key_data      = first_page_tree_key->data;
-		page_tree_key_data_size = first_page_tree_key->data_size;
+		debug_key_data      = page_tree_key->data;
+		debug_key_data_size = page_tree_key->data_size;
 
-		while( page_tree_key_data_size > 0 )
+		while( debug_key_data_size > 0 )
 		{
-			if( libcnotify_verbose != 0 )
-			{
-				libcnotify_printf(
-				 "%02" PRIx8 " ",
-				 *page_tree_key_data );
-			}
-			page_tree_key_data++;
-			page_tree_key_data_size--;
+			libcnotify_printf(
+			 "%02" PRIx8 " ",
+			 *debug_key_data );
+
+			debug_key_data++;
+			debug_key_data_size--;
 		}
 		libcnotify_printf(
 		 "\n" );
 
 		libcnotify_printf(
-		 "%s: first page tree key type\t\t: ",
+		 "%s: page tree key type\t\t\t: ",
 		 function );
 
-		switch( first_page_tree_key->type )
+		switch( page_tree_key->type )
 		{
 			case LIBESEDB_KEY_TYPE_INDEX_VALUE:
 				libcnotify_printf(
@@ -458,31 +548,33 @@ int libesedb_page_tree_key_compare(
 		 "\n" );
 
 		libcnotify_printf(
-		 "%s: second page tree key\t\t\t: ",
+		 "%s: key data\t\t\t\t\t: ",
 		 function );
 
-		page_tree_key_data      = second_page_tree_key->data;
-		page_tree_key_data_size = second_page_tree_key->data_size;
-
-		while( page_tree_key_data_size > 0 )
+		for( key_data_index = 0;
+		     key_data_index < key_data_size;
+		     key_data_index++ )
 		{
-			if( libcnotify_verbose != 0 )
+			if( key_data_index < common_key_data_size )
 			{
-				libcnotify_printf(
-				 "%02" PRIx8 " ",
-				 *page_tree_key_data );
+				key_data = common_key_data[ key_data_index ];
+			}
+			else
+			{
+				key_data = local_key_data[ key_data_index - common_key_data_size ];
 			}
-			page_tree_key_data++;
-			page_tree_key_data_size--;
+			libcnotify_printf(
+			 "%02" PRIx8 " ",
+			 key_data );
 		}
 		libcnotify_printf(
 		 "\n" );
 
 		libcnotify_printf(
-		 "%s: second page tree key type\t\t: ",
+		 "%s: key type\t\t\t\t\t: ",
 		 function );
 
-		switch( second_page_tree_key->type )
+		switch( key_type )
 		{
 			case LIBESEDB_KEY_TYPE_BRANCH:
 				libcnotify_printf(
@@ -504,78 +596,71 @@ int libesedb_page_tree_key_compare(
 	}
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
 
-	/* Check if the page tree key is empty, therefore has no upper bound
-	 * and thus the first page tree key will be greater than the second page tree key
+	/* Check if the key data is empty, therefore has no upper bound
+	 * and thus the page tree key will be greater than the key data
 	 */
-	if( second_page_tree_key->data_size > 0 )
+	if( key_data_size > 0 )
 	{
-		if( second_page_tree_key->data == NULL )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-			 "%s: invalid second page tree key - missing data.",
-			 function );
-
-			return( -1 );
-		}
-		if( first_page_tree_key->data_size <= second_page_tree_key->data_size )
+		if( page_tree_key->data_size <= key_data_size )
 		{
-			compare_data_size = first_page_tree_key->data_size;
+			compare_data_size = page_tree_key->data_size;
 		}
 		else
 		{
-			compare_data_size = second_page_tree_key->data_size;
+			compare_data_size = key_data_size;
 		}
-#if defined( HAVE_DEBUG_OUTPUT )
-		is_flexible_match = 0;
-#endif
-
 		/* The long value page_tree_key is stored reversed
 		 */
-		if( first_page_tree_key->type == LIBESEDB_KEY_TYPE_LONG_VALUE )
+		if( page_tree_key->type == LIBESEDB_KEY_TYPE_LONG_VALUE )
 		{
-			first_page_tree_key_data_index = first_page_tree_key->data_size - 1;
+			page_tree_key_data_index = page_tree_key->data_size - 1;
 		}
 		else
 		{
-			first_page_tree_key_data_index = 0;
+			page_tree_key_data_index = 0;
 		}
-		for( second_page_tree_key_data_index = 0;
-		     second_page_tree_key_data_index < compare_data_size;
-		     second_page_tree_key_data_index++ )
+		for( key_data_index = 0;
+		     key_data_index < compare_data_size;
+		     key_data_index++ )
 		{
-			first_page_tree_key_data = first_page_tree_key->data[ first_page_tree_key_data_index ];
+			if( key_data_index < common_key_data_size )
+			{
+				key_data = common_key_data[ key_data_index ];
+			}
+			else
+			{
+				key_data = local_key_data[ key_data_index - common_key_data_size ];
+			}
+			page_tree_key_data = page_tree_key->data[ page_tree_key_data_index ];
 
-			if( ( first_page_tree_key->type == LIBESEDB_KEY_TYPE_INDEX_VALUE )
-			 && ( second_page_tree_key->type == LIBESEDB_KEY_TYPE_LEAF ) )
+			if( ( page_tree_key->type == LIBESEDB_KEY_TYPE_INDEX_VALUE )
+			 && ( key_type == LIBESEDB_KEY_TYPE_LEAF ) )
 			{
 /* TODO does not hold for branch page_tree_keys in Win XP search database */
-				if( ( first_page_tree_key_data_index == 1 )
-				 && ( ( first_page_tree_key_data & 0x80 ) != 0 )
-				 && ( ( first_page_tree_key_data & 0x7f ) == second_page_tree_key->data[ second_page_tree_key_data_index ] ) )
+				if( ( page_tree_key_data_index == 1 )
+				 && ( ( page_tree_key_data & 0x80 ) != 0 )
+				 && ( ( page_tree_key_data & 0x7f ) == key_data ) )
 				{
-					first_page_tree_key_data &= 0x7f;
+					page_tree_key_data &= 0x7f;
 
 #if defined( HAVE_DEBUG_OUTPUT )
 					is_flexible_match = 1;
 #endif
 				}
 			}
-			compare_result = (int16_t) first_page_tree_key_data - (int16_t) second_page_tree_key->data[ second_page_tree_key_data_index ];
+			compare_result = (int16_t) page_tree_key_data - (int16_t) key_data;
 
 			if( compare_result != 0 )
 			{
 				break;
 			}
-			if( first_page_tree_key->type == LIBESEDB_KEY_TYPE_LONG_VALUE )
+			if( page_tree_key->type == LIBESEDB_KEY_TYPE_LONG_VALUE )
 			{
-				first_page_tree_key_data_index--;
+				page_tree_key_data_index--;
 			}
 			else
 			{
-				first_page_tree_key_data_index++;
+				page_tree_key_data_index++;
 			}
 		}
 	}
@@ -583,11 +668,11 @@ int libesedb_page_tree_key_compare(
 	{
 		result = LIBFDATA_COMPARE_GREATER;
 	}
-	else if( second_page_tree_key->type == LIBESEDB_KEY_TYPE_BRANCH )
+	else if( key_type == LIBESEDB_KEY_TYPE_BRANCH )
 	{
-		if( first_page_tree_key->type == LIBESEDB_KEY_TYPE_INDEX_VALUE )
+		if( page_tree_key->type == LIBESEDB_KEY_TYPE_INDEX_VALUE )
 		{
-			/* If the page_tree_key exactly matches the branch page_tree_key,
+			/* If the page_tree_key exactly matches the branch key,
 			 * the leaf value is in the next branch node
 			 */
 			if( compare_result == 0 )
@@ -599,14 +684,14 @@ int libesedb_page_tree_key_compare(
 				result = LIBFDATA_COMPARE_EQUAL;
 			}
 		}
-		else if( ( first_page_tree_key->type == LIBESEDB_KEY_TYPE_LONG_VALUE )
-		      || ( first_page_tree_key->type == LIBESEDB_KEY_TYPE_LONG_VALUE_SEGMENT ) )
+		else if( ( page_tree_key->type == LIBESEDB_KEY_TYPE_LONG_VALUE )
+		      || ( page_tree_key->type == LIBESEDB_KEY_TYPE_LONG_VALUE_SEGMENT ) )
 		{
-			/* If the page_tree_key matches the branch page_tree_key but is longer,
+			/* If the page_tree_key matches the branch key but is longer,
 			 * the leaf value is in the next branch node
 			 */
 			if( ( compare_result == 0 )
-			 && ( first_page_tree_key->data_size > second_page_tree_key->data_size ) )
+			 && ( page_tree_key->data_size > key_data_size ) )
 			{
 				result = LIBFDATA_COMPARE_GREATER;
 			}
@@ -621,17 +706,17 @@ int libesedb_page_tree_key_compare(
 			result = LIBFDATA_COMPARE_EQUAL;
 		}
 	}
-	else if( second_page_tree_key->type == LIBESEDB_KEY_TYPE_LEAF )
+	else if( key_type == LIBESEDB_KEY_TYPE_LEAF )
 	{
 		if( compare_result < 0 )
 		{
 			result = LIBFDATA_COMPARE_LESS;
 		}
-		else if( first_page_tree_key->data_size < second_page_tree_key->data_size )
+		else if( page_tree_key->data_size < key_data_size )
 		{
 			result = LIBFDATA_COMPARE_LESS;
 		}
-		else if( first_page_tree_key->data_size > second_page_tree_key->data_size )
+		else if( page_tree_key->data_size > key_data_size )
 		{
 			result = LIBFDATA_COMPARE_GREATER;
 		}
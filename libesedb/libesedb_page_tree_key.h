@@ -73,6 +73,15 @@ int libesedb_page_tree_key_compare(
      libesedb_page_tree_key_t *second_page_tree_key,
      libcerror_error_t **error );
 
+int libesedb_page_tree_key_compare_data(
+     libesedb_page_tree_key_t *page_tree_key,
+     const uint8_t *common_key_data,
+     size_t common_key_data_size,
+     const uint8_t *local_key_data,
+     size_t local_key_data_size,
+     uint8_t key_type,
+     libcerror_error_t **error );
+
 #if defined( __cplusplus )
 }
 #endif
@@ -223,6 +223,10 @@ int libesedb_page_tree_value_read_data(
 		}
 #endif
 	}
+	else
+	{
+		page_tree_value->common_key_size = 0;
+	}
 	byte_stream_copy_to_uint16_little_endian(
 	 &( data[ data_offset ] ),
 	 page_tree_value->local_key_size );
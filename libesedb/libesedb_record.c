@@ -32,7 +32,7 @@
 #include "libesedb_libcdata.h"
 #include "libesedb_libcerror.h"
 #include "libesedb_libcnotify.h"
-#include "libesedb_libfcache.h"
+#include "libesedb_libcthreads.h"
 #include "libesedb_libfdata.h"
 #include "libesedb_libfvalue.h"
 #include "libesedb_long_value.h"
@@ -54,10 +54,7 @@ int libesedb_record_initialize(
      libesedb_io_handle_t *io_handle,
      libesedb_table_definition_t *table_definition,
      libesedb_table_definition_t *template_table_definition,
-     libfdata_vector_t *pages_vector,
-     libfcache_cache_t *pages_cache,
-     libfdata_vector_t *long_values_pages_vector,
-     libfcache_cache_t *long_values_pages_cache,
+     libesedb_page_cache_t *page_cache,
      libesedb_data_definition_t *data_definition,
      libesedb_page_tree_t *long_values_page_tree,
      libcerror_error_t **error )
@@ -158,8 +155,7 @@ int libesedb_record_initialize(
 	     data_definition,
 	     file_io_handle,
 	     io_handle,
-	     pages_vector,
-	     pages_cache,
+	     page_cache,
 	     table_definition,
 	     template_table_definition,
 	     internal_record->values_array,
@@ -179,13 +175,25 @@ int libesedb_record_initialize(
 	internal_record->io_handle                 = io_handle;
 	internal_record->table_definition          = table_definition;
 	internal_record->template_table_definition = template_table_definition;
-	internal_record->pages_vector              = pages_vector;
-	internal_record->pages_cache               = pages_cache;
-	internal_record->long_values_pages_vector  = long_values_pages_vector;
-	internal_record->long_values_pages_cache   = long_values_pages_cache;
+	internal_record->page_cache                = page_cache;
 	internal_record->data_definition           = data_definition;
 	internal_record->long_values_page_tree     = long_values_page_tree;
 
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( internal_record->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
 	*record = (libesedb_record_t *) internal_record;
 
 	return( 1 );
@@ -236,9 +244,8 @@ int libesedb_record_free(
 		internal_record = (libesedb_internal_record_t *) *record;
 		*record         = NULL;
 
-		/* The io_handle, file_io_handle, table_definition, template_table_definition, pages_vector,
-		 * pages_cache, * long_values_pages_vector, long_values_pages_cache and long_values_page_tree
-		 * references are freed elsewhere
+		/* The io_handle, file_io_handle, table_definition, template_table_definition, page_cache
+		 * and long_values_page_tree references are freed elsewhere
 		 */
 		if( internal_record->data_definition != NULL )
 		{
@@ -270,6 +277,21 @@ int libesedb_record_free(
 
 			result = -1;
 		}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( internal_record->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
 		memory_free(
 		 internal_record );
 	}
@@ -407,6 +429,213 @@ int libesedb_record_get_column_catalog_definition(
 	return( 1 );
 }
 
+/* Reads the tagged data type value of a specific entry and stores it in the values array
+ * This function is not multi-thread safe acquire write lock before call
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_record_read_record_value(
+     libesedb_internal_record_t *internal_record,
+     int value_entry,
+     libfvalue_value_t **record_value,
+     libcerror_error_t **error )
+{
+	libesedb_catalog_definition_t *column_catalog_definition = NULL;
+	libfvalue_value_t *safe_record_value                     = NULL;
+	static char *function                                    = "libesedb_record_read_record_value";
+
+	if( internal_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record value.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_record_get_column_catalog_definition(
+	     internal_record,
+	     value_entry,
+	     &column_catalog_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve column catalog definition: %d.",
+		 function,
+		 value_entry );
+
+		goto on_error;
+	}
+	if( libesedb_data_definition_read_tagged_data_type_value(
+	     internal_record->data_definition,
+	     internal_record->io_handle,
+	     column_catalog_definition,
+	     &safe_record_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_READ_FAILED,
+		 "%s: unable to read tagged data type value: %d.",
+		 function,
+		 value_entry );
+
+		goto on_error;
+	}
+	if( libcdata_array_set_entry_by_index(
+	     internal_record->values_array,
+	     value_entry,
+	     (intptr_t *) safe_record_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set value: %d in values array.",
+		 function,
+		 value_entry );
+
+		goto on_error;
+	}
+	*record_value = safe_record_value;
+
+	return( 1 );
+
+on_error:
+	if( safe_record_value != NULL )
+	{
+		libfvalue_value_free(
+		 &safe_record_value,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Retrieves the record value of a specific entry
+ * Tagged data type values are read on demand
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_record_get_record_value(
+     libesedb_internal_record_t *internal_record,
+     int value_entry,
+     libfvalue_value_t **record_value,
+     libcerror_error_t **error )
+{
+	libfvalue_value_t *safe_record_value = NULL;
+	static char *function                = "libesedb_record_get_record_value";
+	int result                           = 1;
+
+	if( internal_record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record value.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     internal_record->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libcdata_array_get_entry_by_index(
+	     internal_record->values_array,
+	     value_entry,
+	     (intptr_t **) &safe_record_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve value: %d from values array.",
+		 function,
+		 value_entry );
+
+		result = -1;
+	}
+	else if( safe_record_value == NULL )
+	{
+		if( libesedb_record_read_record_value(
+		     internal_record,
+		     value_entry,
+		     &safe_record_value,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read record value: %d.",
+			 function,
+			 value_entry );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     internal_record->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( result == 1 )
+	{
+		*record_value = safe_record_value;
+	}
+	return( result );
+}
+
 /* Retrieves the column identifier of the specific entry
  * Returns 1 if successful or -1 on error
  */
@@ -852,10 +1081,10 @@ int libesedb_record_get_value(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -943,10 +1172,10 @@ int libesedb_record_get_value_data_flags(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -1005,10 +1234,10 @@ int libesedb_record_get_value_data_size(
 	}
 	internal_record = (libesedb_internal_record_t *) record;
 
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -1066,10 +1295,10 @@ int libesedb_record_get_value_data(
 	}
 	internal_record = (libesedb_internal_record_t *) record;
 
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -1171,10 +1400,10 @@ int libesedb_record_get_value_boolean(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -1294,10 +1523,10 @@ int libesedb_record_get_value_8bit(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -1418,10 +1647,10 @@ int libesedb_record_get_value_16bit(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -1542,10 +1771,10 @@ int libesedb_record_get_value_32bit(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -1667,10 +1896,10 @@ int libesedb_record_get_value_64bit(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -1790,10 +2019,10 @@ int libesedb_record_get_value_filetime(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -1915,10 +2144,10 @@ int libesedb_record_get_value_floating_point_32bit(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -2038,10 +2267,10 @@ int libesedb_record_get_value_floating_point_64bit(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -2163,10 +2392,10 @@ int libesedb_record_get_value_utf8_string_size(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -2273,10 +2502,10 @@ int libesedb_record_get_value_utf8_string(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -2382,10 +2611,10 @@ int libesedb_record_get_value_utf16_string_size(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -2492,10 +2721,10 @@ int libesedb_record_get_value_utf16_string(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -2605,10 +2834,10 @@ int libesedb_record_get_value_binary_data_size(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -2779,10 +3008,10 @@ int libesedb_record_get_value_binary_data(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -2903,10 +3132,10 @@ int libesedb_record_is_long_value(
 	}
 	internal_record = (libesedb_internal_record_t *) record;
 
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -2963,10 +3192,10 @@ int libesedb_record_is_multi_value(
 	}
 	internal_record = (libesedb_internal_record_t *) record;
 
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -3148,8 +3377,7 @@ int libesedb_record_get_long_value_data_segments_list(
 	if( libesedb_data_definition_read_long_value(
 	     data_definition,
 	     internal_record->file_io_handle,
-	     internal_record->long_values_pages_vector,
-	     internal_record->long_values_pages_cache,
+	     internal_record->page_cache,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -3241,8 +3469,7 @@ int libesedb_record_get_long_value_data_segments_list(
 			     data_definition,
 			     internal_record->file_io_handle,
 			     internal_record->io_handle,
-			     internal_record->long_values_pages_vector,
-			     internal_record->long_values_pages_cache,
+			     internal_record->page_cache,
 			     long_value_segment_offset,
 			     *data_segments_list,
 			     error ) != 1 )
@@ -3383,10 +3610,10 @@ int libesedb_record_get_long_value(
 
 		goto on_error;
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -3613,10 +3840,10 @@ int libesedb_record_get_multi_value(
 
 		return( -1 );
 	}
-	if( libcdata_array_get_entry_by_index(
-	     internal_record->values_array,
+	if( libesedb_record_get_record_value(
+	     internal_record,
 	     value_entry,
-	     (intptr_t **) &record_value,
+	     &record_value,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -31,8 +31,10 @@
 #include "libesedb_libbfio.h"
 #include "libesedb_libcdata.h"
 #include "libesedb_libcerror.h"
-#include "libesedb_libfcache.h"
+#include "libesedb_libcthreads.h"
 #include "libesedb_libfdata.h"
+#include "libesedb_libfvalue.h"
+#include "libesedb_page_cache.h"
 #include "libesedb_page_tree.h"
 #include "libesedb_table_definition.h"
 #include "libesedb_types.h"
@@ -61,21 +63,9 @@ struct libesedb_internal_record
 	 */
 	libesedb_table_definition_t *template_table_definition;
 
-	/* The pages vector
+	/* The page cache
 	 */
-	libfdata_vector_t *pages_vector;
-
-	/* The pages cache
-	 */
-	libfcache_cache_t *pages_cache;
-
-	/* The long values pages vector
-	 */
-	libfdata_vector_t *long_values_pages_vector;
-
-	/* The long values pages cache
-	 */
-	libfcache_cache_t *long_values_pages_cache;
+	libesedb_page_cache_t *page_cache;
 
 	/* The data definition
 	 */
@@ -92,6 +82,12 @@ struct libesedb_internal_record
 	/* The (record) flags 
 	 */
 	uint8_t flags;
+
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
 };
 
 int libesedb_record_initialize(
@@ -100,10 +96,7 @@ int libesedb_record_initialize(
      libesedb_io_handle_t *io_handle,
      libesedb_table_definition_t *table_definition,
      libesedb_table_definition_t *template_table_definition,
-     libfdata_vector_t *pages_vector,
-     libfcache_cache_t *pages_cache,
-     libfdata_vector_t *long_values_pages_vector,
-     libfcache_cache_t *long_values_pages_cache,
+     libesedb_page_cache_t *page_cache,
      libesedb_data_definition_t *data_definition,
      libesedb_page_tree_t *long_values_page_tree,
      libcerror_error_t **error );
@@ -125,6 +118,18 @@ int libesedb_record_get_column_catalog_definition(
      libesedb_catalog_definition_t **column_catalog_definition,
      libcerror_error_t **error );
 
+int libesedb_record_read_record_value(
+     libesedb_internal_record_t *internal_record,
+     int value_entry,
+     libfvalue_value_t **record_value,
+     libcerror_error_t **error );
+
+int libesedb_record_get_record_value(
+     libesedb_internal_record_t *internal_record,
+     int value_entry,
+     libfvalue_value_t **record_value,
+     libcerror_error_t **error );
+
 LIBESEDB_EXTERN \
 int libesedb_record_get_column_identifier(
      libesedb_record_t *record,
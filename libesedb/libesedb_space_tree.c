@@ -28,8 +28,6 @@
 #include "libesedb_libbfio.h"
 #include "libesedb_libcerror.h"
 #include "libesedb_libcnotify.h"
-#include "libesedb_libfcache.h"
-#include "libesedb_libfdata.h"
 #include "libesedb_page.h"
 #include "libesedb_page_value.h"
 #include "libesedb_page_tree.h"
@@ -46,8 +44,7 @@ int libesedb_space_tree_initialize(
      libesedb_io_handle_t *io_handle,
      uint32_t object_identifier,
      uint32_t root_page_number,
-     libfdata_vector_t *pages_vector,
-     libfcache_cache_t *pages_cache,
+     libesedb_page_cache_t *page_cache,
      libcerror_error_t **error )
 {
 	static char *function = "libesedb_space_tree_initialize";
@@ -110,8 +107,7 @@ int libesedb_space_tree_initialize(
 	if( libesedb_page_tree_initialize(
 	     &( ( *space_tree )->page_tree ),
 	     io_handle,
-	     pages_vector,
-	     pages_cache,
+	     page_cache,
 	     object_identifier,
 	     root_page_number,
 	     NULL,
@@ -199,7 +195,6 @@ int libesedb_space_tree_read_values_from_page(
 	libesedb_page_tree_value_t *page_tree_value   = NULL;
 	libesedb_page_value_t *page_value             = NULL;
 	libesedb_space_tree_value_t *space_tree_value = NULL;
-	libfcache_cache_t *child_page_cache           = NULL;
 	static char *function                         = "libesedb_space_tree_read_values_from_page";
 	uint32_t child_page_number                    = 0;
 	uint32_t page_flags                           = 0;
@@ -375,23 +370,6 @@ int libesedb_space_tree_read_values_from_page(
 	}
 #endif /* defined( HAVE_DEBUG_OUTPUT ) */
 
-        /* Use a local cache to prevent cache invalidation of the page
-         * when reading child pages.
-         */
-	if( libfcache_cache_initialize(
-	     &child_page_cache,
-	     1,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create child page cache.",
-		 function );
-
-		goto on_error;
-	}
 	for( page_value_index = 1;
 	     page_value_index < number_of_page_values;
 	     page_value_index++ )
@@ -506,7 +484,8 @@ int libesedb_space_tree_read_values_from_page(
 
 				goto on_error;
 			}
-			total_number_of_pages += space_tree_value->number_of_pages;
+			total_number_of_pages       += space_tree_value->number_of_pages;
+			space_tree->number_of_pages += space_tree_value->number_of_pages;
 
 			if( libesedb_space_tree_value_free(
 			     &space_tree_value,
@@ -602,13 +581,11 @@ int libesedb_space_tree_read_values_from_page(
 			if( ( child_page_number > 0 )
 			 && ( child_page_number <= space_tree->page_tree->io_handle->last_page_number ) )
 			{
-				if( libfdata_vector_get_element_value_by_index(
-				     space_tree->page_tree->pages_vector,
-				     (intptr_t *) file_io_handle,
-				     (libfdata_cache_t *) child_page_cache,
-				     (int) child_page_number - 1,
-				     (intptr_t **) &child_page,
-				     0,
+				if( libesedb_page_cache_get_page(
+				     space_tree->page_tree->page_cache,
+				     file_io_handle,
+				     child_page_number,
+				     &child_page,
 				     error ) != 1 )
 				{
 					libcerror_error_set(
@@ -652,6 +629,21 @@ int libesedb_space_tree_read_values_from_page(
 
 					goto on_error;
 				}
+				if( libesedb_page_cache_release_page(
+				     space_tree->page_tree->page_cache,
+				     &child_page,
+				     error ) != 1 )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+					 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+					 "%s: unable to release page: %" PRIu32 ".",
+					 function,
+					 child_page_number );
+
+					goto on_error;
+				}
 			}
 		}
 		if( libesedb_page_tree_value_free(
@@ -668,19 +660,6 @@ int libesedb_space_tree_read_values_from_page(
 			goto on_error;
 		}
 	}
-	if( libfcache_cache_free(
-	     &child_page_cache,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free child page cache.",
-		 function );
-
-		goto on_error;
-	}
 #if defined( HAVE_DEBUG_OUTPUT )
 	if( libcnotify_verbose != 0 )
 	{
@@ -708,10 +687,11 @@ on_error:
 		 &space_tree_value,
 		 NULL );
 	}
-	if( child_page_cache != NULL )
+	if( child_page != NULL )
 	{
-		libfcache_cache_free(
-		 &child_page_cache,
+		libesedb_page_cache_release_page(
+		 space_tree->page_tree->page_cache,
+		 &child_page,
 		 NULL );
 	}
 	return( -1 );
@@ -725,10 +705,9 @@ int libesedb_space_tree_read_file_io_handle(
      libbfio_handle_t *file_io_handle,
      libcerror_error_t **error )
 {
-	libesedb_page_t *root_page         = NULL;
-	libfcache_cache_t *root_page_cache = NULL;
-	static char *function              = "libesedb_space_tree_read_file_io_handle";
-	int current_leaf_value_index       = 0;
+	libesedb_page_t *root_page   = NULL;
+	static char *function        = "libesedb_space_tree_read_file_io_handle";
+	int current_leaf_value_index = 0;
 
 	if( space_tree == NULL )
 	{
@@ -752,30 +731,13 @@ int libesedb_space_tree_read_file_io_handle(
 
 		return( -1 );
 	}
-        /* Use a local cache to prevent cache invalidation of the root page
-         * when reading child pages.
-         */
-	if( libfcache_cache_initialize(
-	     &root_page_cache,
-	     1,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create root page cache.",
-		 function );
+	space_tree->number_of_pages = 0;
 
-		goto on_error;
-	}
-	if( libfdata_vector_get_element_value_by_index(
-	     space_tree->page_tree->pages_vector,
-	     (intptr_t *) file_io_handle,
-	     (libfdata_cache_t *) root_page_cache,
-	     (int) space_tree->page_tree->root_page_number - 1,
-	     (intptr_t **) &root_page,
-	     0,
+	if( libesedb_page_cache_get_page(
+	     space_tree->page_tree->page_cache,
+	     file_io_handle,
+	     space_tree->page_tree->root_page_number,
+	     &root_page,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
@@ -834,26 +796,29 @@ int libesedb_space_tree_read_file_io_handle(
 
 		goto on_error;
 	}
-	if( libfcache_cache_free(
-	     &root_page_cache,
+	if( libesedb_page_cache_release_page(
+	     space_tree->page_tree->page_cache,
+	     &root_page,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-		 "%s: unable to free root page cache.",
-		 function );
+		 "%s: unable to release page: %" PRIu32 ".",
+		 function,
+		 space_tree->page_tree->root_page_number );
 
 		goto on_error;
 	}
 	return( 1 );
 
 on_error:
-	if( root_page_cache != NULL )
+	if( root_page != NULL )
 	{
-		libfcache_cache_free(
-		 &root_page_cache,
+		libesedb_page_cache_release_page(
+		 space_tree->page_tree->page_cache,
+		 &root_page,
 		 NULL );
 	}
 	return( -1 );
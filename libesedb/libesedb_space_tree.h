@@ -28,8 +28,7 @@
 #include "libesedb_io_handle.h"
 #include "libesedb_libbfio.h"
 #include "libesedb_libcerror.h"
-#include "libesedb_libfcache.h"
-#include "libesedb_libfdata.h"
+#include "libesedb_page_cache.h"
 #include "libesedb_page_tree.h"
 
 #if defined( __cplusplus )
@@ -43,6 +42,10 @@ struct libesedb_space_tree
 	/* The page tree
 	 */
 	libesedb_page_tree_t *page_tree;
+
+	/* The total number of pages in the extents
+	 */
+	uint64_t number_of_pages;
 };
 
 int libesedb_space_tree_initialize(
@@ -50,8 +53,7 @@ int libesedb_space_tree_initialize(
      libesedb_io_handle_t *io_handle,
      uint32_t object_identifier,
      uint32_t root_page_number,
-     libfdata_vector_t *pages_vector,
-     libfcache_cache_t *pages_cache,
+     libesedb_page_cache_t *page_cache,
      libcerror_error_t **error );
 
 int libesedb_space_tree_free(
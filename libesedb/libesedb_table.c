@@ -31,29 +31,31 @@
 #include "libesedb_libbfio.h"
 #include "libesedb_libcdata.h"
 #include "libesedb_libcerror.h"
-#include "libesedb_libfcache.h"
-#include "libesedb_libfdata.h"
+#include "libesedb_libcthreads.h"
+#include "libesedb_metadata_cache.h"
 #include "libesedb_page_tree.h"
 #include "libesedb_record.h"
 #include "libesedb_table.h"
 #include "libesedb_table_definition.h"
+#include "libesedb_table_state.h"
 #include "libesedb_types.h"
+#include "libesedb_unused.h"
 
 /* Creates a table
  * Make sure the value table is referencing, is set to NULL
+ * The table takes over a reference to the table state, which is released when the table is freed
  * Returns 1 if successful or -1 on error
  */
 int libesedb_table_initialize(
      libesedb_table_t **table,
      libbfio_handle_t *file_io_handle,
      libesedb_io_handle_t *io_handle,
-     libesedb_table_definition_t *table_definition,
-     libesedb_table_definition_t *template_table_definition,
+     libesedb_table_state_t *table_state,
+     libesedb_metadata_cache_t *metadata_cache,
      libcerror_error_t **error )
 {
 	libesedb_internal_table_t *internal_table = NULL;
 	static char *function                     = "libesedb_table_initialize";
-	int segment_index                         = 0;
 
 	if( table == NULL )
 	{
@@ -88,24 +90,24 @@ int libesedb_table_initialize(
 
 		return( -1 );
 	}
-	if( table_definition == NULL )
+	if( table_state == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
 		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid table definition.",
+		 "%s: invalid table state.",
 		 function );
 
 		return( -1 );
 	}
-	if( table_definition->table_catalog_definition == NULL )
+	if( table_state->table_definition == NULL )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
-		 "%s: invalid table definition - missing table catalog definition.",
+		 "%s: invalid table state - missing table definition.",
 		 function );
 
 		return( -1 );
@@ -141,161 +143,57 @@ int libesedb_table_initialize(
 
 		return( -1 );
 	}
-	/* TODO add clone function ?
-	 */
-	if( libfdata_vector_initialize(
-	     &( internal_table->pages_vector ),
-	     (size64_t) io_handle->page_size,
-	     (intptr_t *) io_handle,
-	     NULL,
-	     NULL,
-	     (int (*)(intptr_t *, intptr_t *, libfdata_vector_t *, libfdata_cache_t *, int, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libesedb_io_handle_read_page,
-	     NULL,
-	     LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
+	internal_table->io_handle                 = io_handle;
+	internal_table->file_io_handle            = file_io_handle;
+	internal_table->table_definition          = table_state->table_definition;
+	internal_table->template_table_definition = table_state->template_table_definition;
+	internal_table->page_cache                = table_state->page_cache;
+	internal_table->table_page_tree           = table_state->table_page_tree;
+	internal_table->long_values_page_tree     = table_state->long_values_page_tree;
+	internal_table->metadata_cache            = metadata_cache;
+
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( internal_table->read_write_lock ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create pages vector.",
-		 function );
-
-		goto on_error;
-	}
-	if( libfdata_vector_append_segment(
-	     internal_table->pages_vector,
-	     &segment_index,
-	     0,
-	     io_handle->pages_data_offset,
-	     io_handle->pages_data_size,
-	     0,
-	     error ) != 1 )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-		 "%s: unable to append segment to pages vector.",
+		 "%s: unable to initialize read/write lock.",
 		 function );
 
 		goto on_error;
 	}
-	if( libfcache_cache_initialize(
-	     &( internal_table->pages_cache ),
-	     LIBESEDB_MAXIMUM_CACHE_ENTRIES_PAGES,
+	if( libcthreads_mutex_initialize(
+	     &( internal_table->record_requests_mutex ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create pages cache.",
+		 "%s: unable to initialize record requests mutex.",
 		 function );
 
 		goto on_error;
 	}
-	if( libesedb_page_tree_initialize(
-	     &( internal_table->table_page_tree ),
-	     io_handle,
-	     internal_table->pages_vector,
-	     internal_table->pages_cache,
-	     table_definition->table_catalog_definition->identifier,
-	     table_definition->table_catalog_definition->father_data_page_number,
-	     table_definition,
-	     template_table_definition,
+	if( libcthreads_condition_initialize(
+	     &( internal_table->record_requests_condition ),
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create table page tree.",
+		 "%s: unable to initialize record requests condition.",
 		 function );
 
 		goto on_error;
 	}
-	if( table_definition->long_value_catalog_definition != NULL )
-	{
-		/* TODO add clone function ?
-		 */
-		if( libfdata_vector_initialize(
-		     &( internal_table->long_values_pages_vector ),
-		     (size64_t) io_handle->page_size,
-		     (intptr_t *) io_handle,
-		     NULL,
-		     NULL,
-		     (int (*)(intptr_t *, intptr_t *, libfdata_vector_t *, libfdata_cache_t *, int, int, off64_t, size64_t, uint32_t, uint8_t, libcerror_error_t **)) &libesedb_io_handle_read_page,
-		     NULL,
-		     LIBFDATA_DATA_HANDLE_FLAG_NON_MANAGED,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create long values pages vector.",
-			 function );
-
-			goto on_error;
-		}
-		if( libfdata_vector_append_segment(
-		     internal_table->long_values_pages_vector,
-		     &segment_index,
-		     0,
-		     io_handle->pages_data_offset,
-		     io_handle->pages_data_size,
-		     0,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
-			 "%s: unable to append segment to long values pages vector.",
-			 function );
-
-			goto on_error;
-		}
-		if( libfcache_cache_initialize(
-		     &( internal_table->long_values_pages_cache ),
-		     LIBESEDB_MAXIMUM_CACHE_ENTRIES_PAGES,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create long values pages cache.",
-			 function );
-
-			goto on_error;
-		}
-		if( libesedb_page_tree_initialize(
-		     &( internal_table->long_values_page_tree ),
-		     io_handle,
-		     internal_table->long_values_pages_vector,
-		     internal_table->long_values_pages_cache,
-		     table_definition->long_value_catalog_definition->identifier,
-		     table_definition->long_value_catalog_definition->father_data_page_number,
-		     table_definition,
-		     template_table_definition,
-		     error ) != 1 )
-		{
-			libcerror_error_set(
-			 error,
-			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-			 "%s: unable to create long value page tree.",
-			 function );
-
-			goto on_error;
-		}
-	}
-	internal_table->io_handle                 = io_handle;
-	internal_table->file_io_handle            = file_io_handle;
-	internal_table->table_definition          = table_definition;
-	internal_table->template_table_definition = template_table_definition;
+#endif
+	internal_table->table_state = table_state;
 
 	*table = (libesedb_table_t *) internal_table;
 
@@ -304,42 +202,20 @@ int libesedb_table_initialize(
 on_error:
 	if( internal_table != NULL )
 	{
-		if( internal_table->long_values_pages_cache != NULL )
-		{
-			libfcache_cache_free(
-			 &( internal_table->long_values_pages_cache ),
-			 NULL );
-		}
-		if( internal_table->long_values_pages_vector != NULL )
-		{
-			libfdata_vector_free(
-			 &( internal_table->long_values_pages_vector ),
-			 NULL );
-		}
-		if( internal_table->long_values_page_tree != NULL )
-		{
-			libesedb_page_tree_free(
-			 &( internal_table->long_values_page_tree ),
-			 NULL );
-		}
-		if( internal_table->table_page_tree != NULL )
-		{
-			libesedb_page_tree_free(
-			 &( internal_table->table_page_tree ),
-			 NULL );
-		}
-		if( internal_table->pages_cache != NULL )
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+		if( internal_table->record_requests_mutex != NULL )
 		{
-			libfcache_cache_free(
-			 &( internal_table->pages_cache ),
+			libcthreads_mutex_free(
+			 &( internal_table->record_requests_mutex ),
 			 NULL );
 		}
-		if( internal_table->pages_vector != NULL )
+		if( internal_table->read_write_lock != NULL )
 		{
-			libfdata_vector_free(
-			 &( internal_table->pages_vector ),
+			libcthreads_read_write_lock_free(
+			 &( internal_table->read_write_lock ),
 			 NULL );
 		}
+#endif
 		memory_free(
 		 internal_table );
 	}
@@ -370,99 +246,144 @@ int libesedb_table_free(
 	}
 	if( *table != NULL )
 	{
-		internal_table = (libesedb_internal_table_t *) *table;
-		*table         = NULL;
-
-		/* The io_handle, file_io_handle and table_definition references
-		 * are freed elsewhere
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+		/* A record request callback function cannot free the table
+		 * since the table would have to wait for its own worker thread
 		 */
-		if( libfdata_vector_free(
-		     &( internal_table->pages_vector ),
-		     error ) != 1 )
+		result = libesedb_table_is_record_request_callback_thread(
+		          *table,
+		          error );
+
+		if( result == -1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free pages vector.",
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to determine if the current thread is a record request callback thread.",
 			 function );
 
-			result = -1;
+			return( -1 );
 		}
-		if( libfcache_cache_free(
-		     &( internal_table->pages_cache ),
-		     error ) != 1 )
+		else if( result != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+			 "%s: unable to free table from its record request callback function.",
+			 function );
+
+			return( -1 );
+		}
+		/* Wait for the outstanding record requests before the table is freed
+		 */
+		result = libesedb_table_wait_for_record_requests(
+		          *table,
+		          error );
+
+		if( result != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free pages cache.",
+			 "%s: unable to wait for record requests.",
 			 function );
 
 			result = -1;
 		}
-		if( internal_table->long_values_pages_vector != NULL )
+#endif
+		internal_table = (libesedb_internal_table_t *) *table;
+		*table         = NULL;
+
+		/* The io_handle, table_definition and metadata_cache references are freed elsewhere
+		 * as is the file_io_handle unless it was created for the table
+		 * The page cache and page trees are part of the table state
+		 */
+		if( internal_table->file_io_handle_created_in_library != 0 )
 		{
-			if( libfdata_vector_free(
-			     &( internal_table->long_values_pages_vector ),
-			     error ) != 1 )
+			if( libbfio_handle_close(
+			     internal_table->file_io_handle,
+			     error ) != 0 )
 			{
 				libcerror_error_set(
 				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free long values pages vector.",
+				 LIBCERROR_ERROR_DOMAIN_IO,
+				 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+				 "%s: unable to close file IO handle.",
 				 function );
 
 				result = -1;
 			}
-		}
-		if( internal_table->long_values_pages_cache != NULL )
-		{
-			if( libfcache_cache_free(
-			     &( internal_table->long_values_pages_cache ),
+			if( libbfio_handle_free(
+			     &( internal_table->file_io_handle ),
 			     error ) != 1 )
 			{
 				libcerror_error_set(
 				 error,
 				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free long values pages cache.",
+				 "%s: unable to free file IO handle.",
 				 function );
 
 				result = -1;
 			}
 		}
-		if( internal_table->long_values_page_tree != NULL )
+		if( libesedb_table_state_release(
+		     &( internal_table->table_state ),
+		     error ) != 1 )
 		{
-			if( libesedb_page_tree_free(
-			     &( internal_table->long_values_page_tree ),
-			     error ) != 1 )
-			{
-				libcerror_error_set(
-				 error,
-				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-				 "%s: unable to free long values page tree.",
-				 function );
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to release table state.",
+			 function );
 
-				result = -1;
-			}
+			result = -1;
+		}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+		if( libcthreads_condition_free(
+		     &( internal_table->record_requests_condition ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free record requests condition.",
+			 function );
+
+			result = -1;
+		}
+		if( libcthreads_mutex_free(
+		     &( internal_table->record_requests_mutex ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free record requests mutex.",
+			 function );
+
+			result = -1;
 		}
-		if( libesedb_page_tree_free(
-		     &( internal_table->table_page_tree ),
+		if( libcthreads_read_write_lock_free(
+		     &( internal_table->read_write_lock ),
 		     error ) != 1 )
 		{
 			libcerror_error_set(
 			 error,
 			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
-			 "%s: unable to free table page tree.",
+			 "%s: unable to free read/write lock.",
 			 function );
 
 			result = -1;
 		}
+#endif
 		memory_free(
 		 internal_table );
 	}
@@ -1341,6 +1262,7 @@ int libesedb_table_get_index(
 	libesedb_internal_table_t *internal_table               = NULL;
 	libesedb_catalog_definition_t *index_catalog_definition = NULL;
 	static char *function                                   = "libesedb_table_get_index";
+	int result                                              = 1;
 
 	if( table == NULL )
 	{
@@ -1377,6 +1299,21 @@ int libesedb_table_get_index(
 
 		return( -1 );
 	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_table->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
 	if( libesedb_table_definition_get_index_catalog_definition_by_index(
 	     internal_table->table_definition,
 	     index_entry,
@@ -1390,22 +1327,19 @@ int libesedb_table_get_index(
 		 "%s: unable to retrieve index catalog definition.",
 		 function );
 
-		return( -1 );
+		result = -1;
 	}
-	if( libesedb_index_initialize(
-	     index,
-	     internal_table->file_io_handle,
-	     internal_table->io_handle,
-	     internal_table->table_definition,
-	     internal_table->template_table_definition,
-	     index_catalog_definition,
-	     internal_table->pages_vector,
-	     internal_table->pages_cache,
-	     internal_table->long_values_pages_vector,
-	     internal_table->long_values_pages_cache,
-	     internal_table->table_page_tree,
-	     internal_table->long_values_page_tree,
-	     error ) != 1 )
+	else if( libesedb_index_initialize(
+	          index,
+	          internal_table->file_io_handle,
+	          internal_table->io_handle,
+	          internal_table->table_definition,
+	          internal_table->template_table_definition,
+	          index_catalog_definition,
+	          internal_table->page_cache,
+	          internal_table->table_page_tree,
+	          internal_table->long_values_page_tree,
+	          error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
@@ -1414,9 +1348,24 @@ int libesedb_table_get_index(
 		 "%s: unable to create index.",
 		 function );
 
+		result = -1;
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_table->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
 		return( -1 );
 	}
-	return( 1 );
+#endif
+	return( result );
 }
 
 /* Retrieves the number of records in the table
@@ -1429,6 +1378,7 @@ int libesedb_table_get_number_of_records(
 {
 	libesedb_internal_table_t *internal_table = NULL;
 	static char *function                     = "libesedb_table_get_number_of_records";
+	int result                                = 1;
 
 	if( table == NULL )
 	{
@@ -1443,6 +1393,21 @@ int libesedb_table_get_number_of_records(
 	}
 	internal_table = (libesedb_internal_table_t *) table;
 
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_table->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
 	if( libesedb_page_tree_get_number_of_leaf_values(
 	     internal_table->table_page_tree,
 	     internal_table->file_io_handle,
@@ -1456,23 +1421,56 @@ int libesedb_table_get_number_of_records(
 		 "%s: unable to retrieve number of leaf values from table page tree.",
 		 function );
 
+		result = -1;
+	}
+	else if( internal_table->metadata_cache != NULL )
+	{
+		if( libesedb_metadata_cache_set_leaf_page_descriptors(
+		     internal_table->metadata_cache,
+		     internal_table->table_page_tree,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set leaf page descriptors of table page tree in metadata cache.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_table->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
 		return( -1 );
 	}
-	return( 1 );
+#endif
+	return( result );
 }
 
-/* Retrieves a specific record
+/* Retrieves an estimate of the number of records in the table
+ * The estimate is based on a sample of the first leaf pages and the number of pages
+ * used by the table, it is exact for tables that span only a few leaf pages
  * Returns 1 if successful or -1 on error
  */
-int libesedb_table_get_record(
+int libesedb_table_get_estimated_number_of_records(
      libesedb_table_t *table,
-     int record_entry,
-     libesedb_record_t **record,
+     int *number_of_records,
      libcerror_error_t **error )
 {
-	libesedb_data_definition_t *record_data_definition = NULL;
-	libesedb_internal_table_t *internal_table          = NULL;
-	static char *function                              = "libesedb_table_get_record";
+	libesedb_internal_table_t *internal_table = NULL;
+	static char *function                     = "libesedb_table_get_estimated_number_of_records";
+	int result                                = 1;
 
 	if( table == NULL )
 	{
@@ -1487,78 +1485,833 @@ int libesedb_table_get_record(
 	}
 	internal_table = (libesedb_internal_table_t *) table;
 
-	if( record == NULL )
-	{
-		libcerror_error_set(
-		 error,
-		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
-		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
-		 "%s: invalid record.",
-		 function );
-
-		return( -1 );
-	}
-	if( *record != NULL )
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_table->read_write_lock,
+	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
-		 "%s: invalid record value already set.",
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
 		 function );
 
 		return( -1 );
 	}
-	if( libesedb_page_tree_get_leaf_value_by_index(
+#endif
+	if( libesedb_page_tree_get_estimated_number_of_leaf_values(
 	     internal_table->table_page_tree,
 	     internal_table->file_io_handle,
-	     record_entry,
-	     &record_data_definition,
+	     number_of_records,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
 		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
-		 "%s: unable to retrieve leaf value: %d from table values tree.",
-		 function,
-		 record_entry );
+		 "%s: unable to retrieve estimated number of leaf values from table page tree.",
+		 function );
 
-		goto on_error;
+		result = -1;
 	}
-	if( libesedb_record_initialize(
-	     record,
-	     internal_table->file_io_handle,
-	     internal_table->io_handle,
-	     internal_table->table_definition,
-	     internal_table->template_table_definition,
-	     internal_table->pages_vector,
-	     internal_table->pages_cache,
-	     internal_table->long_values_pages_vector,
-	     internal_table->long_values_pages_cache,
-	     record_data_definition,
-	     internal_table->long_values_page_tree,
+	else if( internal_table->metadata_cache != NULL )
+	{
+		if( libesedb_metadata_cache_set_leaf_page_descriptors(
+		     internal_table->metadata_cache,
+		     internal_table->table_page_tree,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set leaf page descriptors of table page tree in metadata cache.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_table->read_write_lock,
 	     error ) != 1 )
 	{
 		libcerror_error_set(
 		 error,
 		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
-		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
-		 "%s: unable to create record: %d.",
-		 function,
-		 record_entry );
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
 
-		goto on_error;
+		return( -1 );
 	}
-	return( 1 );
+#endif
+	return( result );
+}
 
-on_error:
-	if( record_data_definition != NULL )
-	{
-		libesedb_data_definition_free(
-		 &record_data_definition,
+/* Retrieves a partition of the records in the table
+ * The records are divided into contiguous partitions of approximately the same number
+ * of records, where every partition starts at a leaf page of the table page tree.
+ * All the leaf pages of the table page tree are read to determine the partitions
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_table_get_record_partition(
+     libesedb_table_t *table,
+     int partition_index,
+     int number_of_partitions,
+     int *first_record_entry,
+     int *number_of_records,
+     libcerror_error_t **error )
+{
+	libesedb_internal_table_t *internal_table = NULL;
+	static char *function                     = "libesedb_table_get_record_partition";
+	int result                                = 1;
+
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_table = (libesedb_internal_table_t *) table;
+
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_table->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libesedb_page_tree_get_leaf_value_partition(
+	     internal_table->table_page_tree,
+	     internal_table->file_io_handle,
+	     partition_index,
+	     number_of_partitions,
+	     first_record_entry,
+	     number_of_records,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve leaf value partition: %d from table page tree.",
+		 function,
+		 partition_index );
+
+		result = -1;
+	}
+	else if( internal_table->metadata_cache != NULL )
+	{
+		if( libesedb_metadata_cache_set_leaf_page_descriptors(
+		     internal_table->metadata_cache,
+		     internal_table->table_page_tree,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to set leaf page descriptors of table page tree in metadata cache.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_table->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Retrieves a specific record
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_table_get_record(
+     libesedb_table_t *table,
+     int record_entry,
+     libesedb_record_t **record,
+     libcerror_error_t **error )
+{
+	libesedb_data_definition_t *record_data_definition = NULL;
+	libesedb_internal_table_t *internal_table          = NULL;
+	static char *function                              = "libesedb_table_get_record";
+	int result                                         = 1;
+
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_table = (libesedb_internal_table_t *) table;
+
+	if( record == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record.",
+		 function );
+
+		return( -1 );
+	}
+	if( *record != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid record value already set.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     internal_table->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( libesedb_page_tree_get_leaf_value_by_index(
+	     internal_table->table_page_tree,
+	     internal_table->file_io_handle,
+	     record_entry,
+	     &record_data_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to retrieve leaf value: %d from table values tree.",
+		 function,
+		 record_entry );
+
+		result = -1;
+	}
+	else if( libesedb_record_initialize(
+	          record,
+	          internal_table->file_io_handle,
+	          internal_table->io_handle,
+	          internal_table->table_definition,
+	          internal_table->template_table_definition,
+	          internal_table->page_cache,
+	          record_data_definition,
+	          internal_table->long_values_page_tree,
+	          error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record: %d.",
+		 function,
+		 record_entry );
+
+		result = -1;
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     internal_table->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( result != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( record_data_definition != NULL )
+	{
+		libesedb_data_definition_free(
+		 &record_data_definition,
 		 NULL );
 	}
 	return( -1 );
 }
 
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+
+/* Determines if the current thread is a worker thread of the table that is calling
+ * a record request callback function
+ * This function is not multi-thread safe acquire the record requests mutex before call
+ * Returns 1 if the current thread is calling a record request callback function or 0 if not
+ */
+int libesedb_internal_table_is_record_request_callback_thread(
+     libesedb_internal_table_t *internal_table )
+{
+	libesedb_table_record_request_t *record_request = NULL;
+
+#if defined( WINAPI )
+	DWORD thread_identifier                         = 0;
+#else
+	pthread_t thread_identifier;
+#endif
+
+	if( internal_table == NULL )
+	{
+		return( 0 );
+	}
+#if defined( WINAPI )
+	thread_identifier = GetCurrentThreadId();
+#else
+	thread_identifier = pthread_self();
+#endif
+	for( record_request = internal_table->callback_record_requests;
+	     record_request != NULL;
+	     record_request = record_request->next_callback_record_request )
+	{
+#if defined( WINAPI )
+		if( record_request->thread_identifier == thread_identifier )
+#else
+		if( pthread_equal(
+		     record_request->thread_identifier,
+		     thread_identifier ) != 0 )
+#endif
+		{
+			return( 1 );
+		}
+	}
+	return( 0 );
+}
+
+/* Determines if the current thread is a worker thread of the table that is calling
+ * a record request callback function
+ * Returns 1 if the current thread is calling a record request callback function, 0 if not or -1 on error
+ */
+int libesedb_table_is_record_request_callback_thread(
+     libesedb_table_t *table,
+     libcerror_error_t **error )
+{
+	libesedb_internal_table_t *internal_table = NULL;
+	static char *function                     = "libesedb_table_is_record_request_callback_thread";
+	int result                                = 0;
+
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_table = (libesedb_internal_table_t *) table;
+
+	if( libcthreads_mutex_grab(
+	     internal_table->record_requests_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab record requests mutex.",
+		 function );
+
+		return( -1 );
+	}
+	result = libesedb_internal_table_is_record_request_callback_thread(
+	          internal_table );
+
+	if( libcthreads_mutex_release(
+	     internal_table->record_requests_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release record requests mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Processes a record request
+ * Callback function for the record requests thread pool
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_table_process_record_request(
+     libesedb_table_record_request_t *record_request,
+     void *arguments LIBESEDB_ATTRIBUTE_UNUSED )
+{
+	libesedb_table_record_request_t **callback_record_request = NULL;
+	libesedb_internal_table_t *internal_table                 = NULL;
+	libcerror_error_t *error                                  = NULL;
+	libesedb_record_t *record                                 = NULL;
+	uint8_t is_callback_record_request                        = 0;
+	int result                                                = 0;
+
+	LIBESEDB_UNREFERENCED_PARAMETER( arguments )
+
+	if( record_request == NULL )
+	{
+		return( -1 );
+	}
+	internal_table = (libesedb_internal_table_t *) record_request->table;
+
+#if defined( WINAPI )
+	record_request->thread_identifier = GetCurrentThreadId();
+#else
+	record_request->thread_identifier = pthread_self();
+#endif
+	record_request->next_callback_record_request = NULL;
+
+	/* The record request was taken from the queue hence its queue entry is available again
+	 * The record request is added to the record requests of which the callback function
+	 * is being called so that calls from the callback function that would deadlock are detected
+	 */
+	if( libcthreads_mutex_grab(
+	     internal_table->record_requests_mutex,
+	     NULL ) == 1 )
+	{
+		internal_table->number_of_queued_record_requests -= 1;
+
+		record_request->next_callback_record_request = internal_table->callback_record_requests;
+		internal_table->callback_record_requests     = record_request;
+
+		is_callback_record_request = 1;
+
+		libcthreads_condition_broadcast(
+		 internal_table->record_requests_condition,
+		 NULL );
+
+		libcthreads_mutex_release(
+		 internal_table->record_requests_mutex,
+		 NULL );
+	}
+	result = libesedb_table_get_record(
+	          record_request->table,
+	          record_request->record_entry,
+	          &record,
+	          &error );
+
+	/* The callback function takes over the record, the error is only valid
+	 * for the duration of the callback function
+	 */
+	record_request->callback_function(
+	 record_request->table,
+	 record_request->record_entry,
+	 record,
+	 error,
+	 record_request->callback_data );
+
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( is_callback_record_request != 0 )
+	{
+		/* The record request cannot be freed while it is referenced by the table
+		 */
+		if( libcthreads_mutex_grab(
+		     internal_table->record_requests_mutex,
+		     NULL ) != 1 )
+		{
+			return( -1 );
+		}
+		callback_record_request = &( internal_table->callback_record_requests );
+
+		while( *callback_record_request != NULL )
+		{
+			if( *callback_record_request == record_request )
+			{
+				*callback_record_request = record_request->next_callback_record_request;
+
+				break;
+			}
+			callback_record_request = &( ( *callback_record_request )->next_callback_record_request );
+		}
+		libcthreads_mutex_release(
+		 internal_table->record_requests_mutex,
+		 NULL );
+	}
+	memory_free(
+	 record_request );
+
+	return( result );
+}
+
+/* Retrieves a specific record asynchronously
+ * The record is retrieved by one of the worker threads of the table, that calls the callback function
+ * with the record or with the error if the record could not be retrieved
+ * If the maximum number of queued record requests is reached this function waits until a worker
+ * thread takes a record request, except when called from a record request callback function
+ * of the table, in which case an error is returned
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_table_get_record_async(
+     libesedb_table_t *table,
+     int record_entry,
+     void (*callback_function)(
+            libesedb_table_t *table,
+            int record_entry,
+            libesedb_record_t *record,
+            libcerror_error_t *error,
+            void *callback_data ),
+     void *callback_data,
+     libcerror_error_t **error )
+{
+	libesedb_internal_table_t *internal_table       = NULL;
+	libesedb_table_record_request_t *record_request = NULL;
+	static char *function                           = "libesedb_table_get_record_async";
+	int result                                      = 1;
+
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_table = (libesedb_internal_table_t *) table;
+
+	if( record_entry < 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid record entry value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( callback_function == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid callback function.",
+		 function );
+
+		return( -1 );
+	}
+	record_request = memory_allocate_structure(
+	                  libesedb_table_record_request_t );
+
+	if( record_request == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create record request.",
+		 function );
+
+		return( -1 );
+	}
+	record_request->table             = table;
+	record_request->record_entry      = record_entry;
+	record_request->callback_function = callback_function;
+	record_request->callback_data     = callback_data;
+
+	if( libcthreads_mutex_grab(
+	     internal_table->record_requests_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab record requests mutex.",
+		 function );
+
+		memory_free(
+		 record_request );
+
+		return( -1 );
+	}
+	/* A queue entry is reserved before the record request is pushed so that pushing
+	 * never blocks while the record requests mutex is held. A record request callback
+	 * function cannot wait for a queue entry since it would wait for its own worker thread
+	 */
+	while( internal_table->number_of_queued_record_requests >= LIBESEDB_MAXIMUM_NUMBER_OF_RECORD_REQUESTS )
+	{
+		if( libesedb_internal_table_is_record_request_callback_thread(
+		     internal_table ) != 0 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_EXCEEDS_MAXIMUM,
+			 "%s: maximum number of queued record requests reached.",
+			 function );
+
+			result = -1;
+
+			break;
+		}
+		if( libcthreads_condition_wait(
+		     internal_table->record_requests_condition,
+		     internal_table->record_requests_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to wait for record requests condition.",
+			 function );
+
+			result = -1;
+
+			break;
+		}
+	}
+	if( ( result == 1 )
+	 && ( internal_table->record_requests_thread_pool == NULL ) )
+	{
+		if( libcthreads_thread_pool_create(
+		     &( internal_table->record_requests_thread_pool ),
+		     NULL,
+		     LIBESEDB_NUMBER_OF_RECORD_REQUEST_THREADS,
+		     LIBESEDB_MAXIMUM_NUMBER_OF_RECORD_REQUESTS,
+		     (int (*)(intptr_t *, void *)) &libesedb_table_process_record_request,
+		     NULL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create record requests thread pool.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( result == 1 )
+	{
+		internal_table->number_of_queued_record_requests += 1;
+
+		if( libcthreads_thread_pool_push(
+		     internal_table->record_requests_thread_pool,
+		     (intptr_t *) record_request,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to push record request onto thread pool.",
+			 function );
+
+			internal_table->number_of_queued_record_requests -= 1;
+
+			result = -1;
+		}
+	}
+	if( result != 1 )
+	{
+		memory_free(
+		 record_request );
+	}
+	if( libcthreads_mutex_release(
+	     internal_table->record_requests_mutex,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release record requests mutex.",
+		 function );
+
+		return( -1 );
+	}
+	return( result );
+}
+
+/* Waits until all asynchronous record requests of the table have been processed
+ * including the record requests made while waiting, such as by the callback functions
+ * This function cannot be called from a record request callback function of the table
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_table_wait_for_record_requests(
+     libesedb_table_t *table,
+     libcerror_error_t **error )
+{
+	libcthreads_thread_pool_t *thread_pool    = NULL;
+	libesedb_internal_table_t *internal_table = NULL;
+	static char *function                     = "libesedb_table_wait_for_record_requests";
+	int has_thread_pool                       = 0;
+	int result                                = 0;
+
+	if( table == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table.",
+		 function );
+
+		return( -1 );
+	}
+	internal_table = (libesedb_internal_table_t *) table;
+
+	result = libesedb_table_is_record_request_callback_thread(
+	          table,
+	          error );
+
+	if( result == -1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+		 "%s: unable to determine if the current thread is a record request callback thread.",
+		 function );
+
+		return( -1 );
+	}
+	else if( result != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unable to wait for record requests from a record request callback function.",
+		 function );
+
+		return( -1 );
+	}
+	do
+	{
+		/* The thread pool is detached from the table before it is joined so that
+		 * the record requests mutex is not held while waiting for the worker threads.
+		 * Record requests made in the meantime create a new thread pool that is
+		 * joined in the next iteration
+		 */
+		if( libcthreads_mutex_grab(
+		     internal_table->record_requests_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to grab record requests mutex.",
+			 function );
+
+			return( -1 );
+		}
+		thread_pool = internal_table->record_requests_thread_pool;
+
+		internal_table->record_requests_thread_pool = NULL;
+
+		if( libcthreads_mutex_release(
+		     internal_table->record_requests_mutex,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to release record requests mutex.",
+			 function );
+
+			goto on_error;
+		}
+		/* Note that joining the thread pool sets thread_pool to NULL
+		 */
+		has_thread_pool = (int) ( thread_pool != NULL );
+
+		if( has_thread_pool != 0 )
+		{
+			if( libcthreads_thread_pool_join(
+			     &thread_pool,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to join record requests thread pool.",
+				 function );
+
+				return( -1 );
+			}
+		}
+	}
+	while( has_thread_pool != 0 );
+
+	return( 1 );
+
+on_error:
+	if( thread_pool != NULL )
+	{
+		libcthreads_thread_pool_join(
+		 &thread_pool,
+		 NULL );
+	}
+	return( -1 );
+}
+
+#endif /* defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT ) */
+
@@ -29,24 +29,74 @@
 #include "libesedb_io_handle.h"
 #include "libesedb_libbfio.h"
 #include "libesedb_libcerror.h"
-#include "libesedb_libfcache.h"
-#include "libesedb_libfdata.h"
+#include "libesedb_libcthreads.h"
+#include "libesedb_metadata_cache.h"
+#include "libesedb_page_cache.h"
 #include "libesedb_page_tree.h"
 #include "libesedb_table_definition.h"
+#include "libesedb_table_state.h"
 #include "libesedb_types.h"
 
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT ) && !defined( WINAPI )
+#include <pthread.h>
+#endif
+
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
 typedef struct libesedb_internal_table libesedb_internal_table_t;
 
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+typedef struct libesedb_table_record_request libesedb_table_record_request_t;
+
+struct libesedb_table_record_request
+{
+	/* The table
+	 */
+	libesedb_table_t *table;
+
+	/* The record entry
+	 */
+	int record_entry;
+
+	/* The callback function
+	 */
+	void (*callback_function)(
+	       libesedb_table_t *table,
+	       int record_entry,
+	       libesedb_record_t *record,
+	       libcerror_error_t *error,
+	       void *callback_data );
+
+	/* The callback data
+	 */
+	void *callback_data;
+
+	/* The identifier of the worker thread that calls the callback function
+	 */
+#if defined( WINAPI )
+	DWORD thread_identifier;
+#else
+	pthread_t thread_identifier;
+#endif
+
+	/* The next record request of which the callback function is being called
+	 */
+	libesedb_table_record_request_t *next_callback_record_request;
+};
+#endif
+
 struct libesedb_internal_table
 {
 	/* The file IO handle
 	 */
 	libbfio_handle_t *file_io_handle;
 
+	/* Value to indicate if the file IO handle was created inside the library
+	 */
+	uint8_t file_io_handle_created_in_library;
+
 	/* The IO handle
 	 */
 	libesedb_io_handle_t *io_handle;
@@ -59,21 +109,17 @@ struct libesedb_internal_table
 	 */
 	libesedb_table_definition_t *template_table_definition;
 
-	/* The pages vector
+	/* The table state
 	 */
-	libfdata_vector_t *pages_vector;
+	libesedb_table_state_t *table_state;
 
-	/* The pages cache
+	/* The page cache
 	 */
-	libfcache_cache_t *pages_cache;
+	libesedb_page_cache_t *page_cache;
 
-	/* The long values pages vector
+	/* The metadata cache
 	 */
-	libfdata_vector_t *long_values_pages_vector;
-
-	/* The long values pages cache
-	 */
-	libfcache_cache_t *long_values_pages_cache;
+	libesedb_metadata_cache_t *metadata_cache;
 
 	/* The table page tree
 	 */
@@ -82,14 +128,41 @@ struct libesedb_internal_table
 	/* The long values page tree
 	 */
 	libesedb_page_tree_t *long_values_page_tree;
+
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	/* The read/write lock
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+
+	/* The record requests thread pool
+	 */
+	libcthreads_thread_pool_t *record_requests_thread_pool;
+
+	/* The record requests mutex
+	 */
+	libcthreads_mutex_t *record_requests_mutex;
+
+	/* The record requests condition, that is signalled when a queued record request is taken by a worker thread
+	 */
+	libcthreads_condition_t *record_requests_condition;
+
+	/* The number of record requests that are queued and not yet taken by a worker thread
+	 */
+	int number_of_queued_record_requests;
+
+	/* The record requests of which the callback function is being called, which are
+	 * used to detect calls from a callback function that would deadlock
+	 */
+	libesedb_table_record_request_t *callback_record_requests;
+#endif
 };
 
 int libesedb_table_initialize(
      libesedb_table_t **table,
      libbfio_handle_t *file_io_handle,
      libesedb_io_handle_t *io_handle,
-     libesedb_table_definition_t *table_definition,
-     libesedb_table_definition_t *template_table_definition,
+     libesedb_table_state_t *table_state,
+     libesedb_metadata_cache_t *metadata_cache,
      libcerror_error_t **error );
 
 LIBESEDB_EXTERN \
@@ -189,6 +262,21 @@ int libesedb_table_get_number_of_records(
      int *number_of_records,
      libcerror_error_t **error );
 
+LIBESEDB_EXTERN \
+int libesedb_table_get_estimated_number_of_records(
+     libesedb_table_t *table,
+     int *number_of_records,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_table_get_record_partition(
+     libesedb_table_t *table,
+     int partition_index,
+     int number_of_partitions,
+     int *first_record_entry,
+     int *number_of_records,
+     libcerror_error_t **error );
+
 LIBESEDB_EXTERN \
 int libesedb_table_get_record(
      libesedb_table_t *table,
@@ -196,6 +284,39 @@ int libesedb_table_get_record(
      libesedb_record_t **record,
      libcerror_error_t **error );
 
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+
+int libesedb_internal_table_is_record_request_callback_thread(
+     libesedb_internal_table_t *internal_table );
+
+int libesedb_table_is_record_request_callback_thread(
+     libesedb_table_t *table,
+     libcerror_error_t **error );
+
+int libesedb_table_process_record_request(
+     libesedb_table_record_request_t *record_request,
+     void *arguments );
+
+LIBESEDB_EXTERN \
+int libesedb_table_get_record_async(
+     libesedb_table_t *table,
+     int record_entry,
+     void (*callback_function)(
+            libesedb_table_t *table,
+            int record_entry,
+            libesedb_record_t *record,
+            libcerror_error_t *error,
+            void *callback_data ),
+     void *callback_data,
+     libcerror_error_t **error );
+
+LIBESEDB_EXTERN \
+int libesedb_table_wait_for_record_requests(
+     libesedb_table_t *table,
+     libcerror_error_t **error );
+
+#endif /* defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT ) */
+
 #if defined( __cplusplus )
 }
 #endif
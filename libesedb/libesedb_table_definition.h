@@ -56,6 +56,22 @@ struct libesedb_table_definition
 	/* The index catalog definition array
 	 */
 	libcdata_array_t *index_catalog_definition_array;
+
+	/* The index of the table definition in the catalog
+	 */
+	int table_definition_index;
+
+	/* The number of the catalog leaf page that contains the table catalog definition
+	 */
+	uint32_t catalog_page_number;
+
+	/* The index of the catalog leaf page value of the table catalog definition
+	 */
+	uint16_t catalog_page_value_index;
+
+	/* Value to indicate the other catalog definitions of the table have not been read
+	 */
+	uint8_t has_deferred_catalog_definitions;
 };
 
 int libesedb_table_definition_initialize(
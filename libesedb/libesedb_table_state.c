@@ -0,0 +1,680 @@
+/*
+ * Table state functions
+ *
+ * Copyright (C) 2009-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#include "libesedb_definitions.h"
+#include "libesedb_io_handle.h"
+#include "libesedb_libcerror.h"
+#include "libesedb_libcthreads.h"
+#include "libesedb_metadata_cache.h"
+#include "libesedb_page_cache.h"
+#include "libesedb_page_tree.h"
+#include "libesedb_table_definition.h"
+#include "libesedb_table_state.h"
+
+/* Creates a table state
+ * Make sure the value table_state is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_table_state_initialize(
+     libesedb_table_state_t **table_state,
+     libesedb_io_handle_t *io_handle,
+     libesedb_table_definition_t *table_definition,
+     libesedb_table_definition_t *template_table_definition,
+     libesedb_metadata_cache_t *metadata_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_table_state_initialize";
+
+	if( table_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table state.",
+		 function );
+
+		return( -1 );
+	}
+	if( *table_state != NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_ALREADY_SET,
+		 "%s: invalid table state value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_definition->table_catalog_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_MISSING,
+		 "%s: invalid table definition - missing table catalog definition.",
+		 function );
+
+		return( -1 );
+	}
+	*table_state = memory_allocate_structure(
+	                libesedb_table_state_t );
+
+	if( *table_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create table state.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *table_state,
+	     0,
+	     sizeof( libesedb_table_state_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear table state.",
+		 function );
+
+		memory_free(
+		 *table_state );
+
+		*table_state = NULL;
+
+		return( -1 );
+	}
+	if( libesedb_page_cache_initialize(
+	     &( ( *table_state )->page_cache ),
+	     io_handle,
+	     LIBESEDB_MAXIMUM_CACHE_ENTRIES_PAGE_CACHE,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create page cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_page_tree_initialize(
+	     &( ( *table_state )->table_page_tree ),
+	     io_handle,
+	     ( *table_state )->page_cache,
+	     table_definition->table_catalog_definition->identifier,
+	     table_definition->table_catalog_definition->father_data_page_number,
+	     table_definition,
+	     template_table_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create table page tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( metadata_cache != NULL )
+	{
+		if( libesedb_metadata_cache_get_leaf_page_descriptors(
+		     metadata_cache,
+		     ( *table_state )->table_page_tree,
+		     error ) == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve leaf page descriptors of table page tree from metadata cache.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( table_definition->long_value_catalog_definition != NULL )
+	{
+		if( libesedb_page_tree_initialize(
+		     &( ( *table_state )->long_values_page_tree ),
+		     io_handle,
+		     ( *table_state )->page_cache,
+		     table_definition->long_value_catalog_definition->identifier,
+		     table_definition->long_value_catalog_definition->father_data_page_number,
+		     table_definition,
+		     template_table_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create long value page tree.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	( *table_state )->table_definition          = table_definition;
+	( *table_state )->template_table_definition = template_table_definition;
+
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_initialize(
+	     &( ( *table_state )->read_write_lock ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize read/write lock.",
+		 function );
+
+		goto on_error;
+	}
+#endif
+	return( 1 );
+
+on_error:
+	if( *table_state != NULL )
+	{
+		if( ( *table_state )->long_values_page_tree != NULL )
+		{
+			libesedb_page_tree_free(
+			 &( ( *table_state )->long_values_page_tree ),
+			 NULL );
+		}
+		if( ( *table_state )->table_page_tree != NULL )
+		{
+			libesedb_page_tree_free(
+			 &( ( *table_state )->table_page_tree ),
+			 NULL );
+		}
+		if( ( *table_state )->page_cache != NULL )
+		{
+			libesedb_page_cache_free(
+			 &( ( *table_state )->page_cache ),
+			 NULL );
+		}
+		memory_free(
+		 *table_state );
+
+		*table_state = NULL;
+	}
+	return( -1 );
+}
+
+/* Frees a table state
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_table_state_free(
+     libesedb_table_state_t **table_state,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_table_state_free";
+	int result            = 1;
+
+	if( table_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table state.",
+		 function );
+
+		return( -1 );
+	}
+	if( *table_state != NULL )
+	{
+		/* The table_definition and template_table_definition references are freed elsewhere
+		 */
+		if( ( *table_state )->long_values_page_tree != NULL )
+		{
+			if( libesedb_page_tree_free(
+			     &( ( *table_state )->long_values_page_tree ),
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+				 "%s: unable to free long values page tree.",
+				 function );
+
+				result = -1;
+			}
+		}
+		if( libesedb_page_tree_free(
+		     &( ( *table_state )->table_page_tree ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free table page tree.",
+			 function );
+
+			result = -1;
+		}
+		if( libesedb_page_cache_free(
+		     &( ( *table_state )->page_cache ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free page cache.",
+			 function );
+
+			result = -1;
+		}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+		if( libcthreads_read_write_lock_free(
+		     &( ( *table_state )->read_write_lock ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free read/write lock.",
+			 function );
+
+			result = -1;
+		}
+#endif
+		memory_free(
+		 *table_state );
+
+		*table_state = NULL;
+	}
+	return( result );
+}
+
+/* Retrieves the number of tables that reference the table state
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_table_state_get_number_of_references(
+     libesedb_table_state_t *table_state,
+     int *number_of_references,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_table_state_get_number_of_references";
+
+	if( table_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table state.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_references == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of references.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_read(
+	     table_state->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	*number_of_references = table_state->number_of_references;
+
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_read(
+	     table_state->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for reading.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( 1 );
+}
+
+/* Adds a reference to the table state
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_table_state_reference(
+     libesedb_table_state_t *table_state,
+     uint64_t last_referenced,
+     libcerror_error_t **error )
+{
+	static char *function = "libesedb_table_state_reference";
+	int result            = 1;
+
+	if( table_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table state.",
+		 function );
+
+		return( -1 );
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     table_state->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( table_state->number_of_references == INT_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid table state - number of references value out of bounds.",
+		 function );
+
+		result = -1;
+	}
+	else
+	{
+		table_state->number_of_references += 1;
+		table_state->last_referenced       = last_referenced;
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     table_state->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	return( result );
+}
+
+/* Detaches the table state from the file
+ * The table state is freed when it is no longer referenced, otherwise by the last table that releases it
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_table_state_detach(
+     libesedb_table_state_t **table_state,
+     libcerror_error_t **error )
+{
+	libesedb_table_state_t *safe_table_state = NULL;
+	static char *function                    = "libesedb_table_state_detach";
+	uint8_t free_table_state                 = 0;
+
+	if( table_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table state.",
+		 function );
+
+		return( -1 );
+	}
+	if( *table_state == NULL )
+	{
+		return( 1 );
+	}
+	safe_table_state = *table_state;
+	*table_state     = NULL;
+
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     safe_table_state->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( safe_table_state->number_of_references == 0 )
+	{
+		free_table_state = 1;
+	}
+	else
+	{
+		safe_table_state->is_detached = 1;
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     safe_table_state->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( free_table_state != 0 )
+	{
+		if( libesedb_table_state_free(
+		     &safe_table_state,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free table state.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Releases a reference to the table state
+ * A detached table state is freed when it is no longer referenced, otherwise
+ * the pages of its page cache are freed so that the table states retained
+ * by the file do not retain pages
+ * Returns 1 if successful or -1 on error
+ */
+int libesedb_table_state_release(
+     libesedb_table_state_t **table_state,
+     libcerror_error_t **error )
+{
+	libesedb_table_state_t *safe_table_state = NULL;
+	static char *function                    = "libesedb_table_state_release";
+	uint8_t free_table_state                 = 0;
+	int result                               = 1;
+
+	if( table_state == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table state.",
+		 function );
+
+		return( -1 );
+	}
+	if( *table_state == NULL )
+	{
+		return( 1 );
+	}
+	safe_table_state = *table_state;
+	*table_state     = NULL;
+
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_grab_for_write(
+	     safe_table_state->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to grab read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( safe_table_state->number_of_references > 0 )
+	{
+		safe_table_state->number_of_references -= 1;
+	}
+	if( safe_table_state->number_of_references == 0 )
+	{
+		if( safe_table_state->is_detached != 0 )
+		{
+			free_table_state = 1;
+		}
+		else if( libesedb_page_cache_empty(
+		          safe_table_state->page_cache,
+		          error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to empty page cache.",
+			 function );
+
+			result = -1;
+		}
+	}
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	if( libcthreads_read_write_lock_release_for_write(
+	     safe_table_state->read_write_lock,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to release read/write lock for writing.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	if( free_table_state != 0 )
+	{
+		if( libesedb_table_state_free(
+		     &safe_table_state,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free table state.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	return( result );
+}
+
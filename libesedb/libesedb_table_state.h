@@ -0,0 +1,121 @@
+/*
+ * Table state functions
+ *
+ * Copyright (C) 2009-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _LIBESEDB_TABLE_STATE_H )
+#define _LIBESEDB_TABLE_STATE_H
+
+#include <common.h>
+#include <types.h>
+
+#include "libesedb_io_handle.h"
+#include "libesedb_libcerror.h"
+#include "libesedb_libcthreads.h"
+#include "libesedb_metadata_cache.h"
+#include "libesedb_page_cache.h"
+#include "libesedb_page_tree.h"
+#include "libesedb_table_definition.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct libesedb_table_state libesedb_table_state_t;
+
+/* The state of a table that is shared by the tables of a file
+ * with the same table definition
+ */
+struct libesedb_table_state
+{
+	/* The table definition
+	 */
+	libesedb_table_definition_t *table_definition;
+
+	/* The template table definition
+	 */
+	libesedb_table_definition_t *template_table_definition;
+
+	/* The page cache that is shared by the table and long values page trees
+	 */
+	libesedb_page_cache_t *page_cache;
+
+	/* The table page tree
+	 */
+	libesedb_page_tree_t *table_page_tree;
+
+	/* The long values page tree
+	 */
+	libesedb_page_tree_t *long_values_page_tree;
+
+	/* The number of tables that reference the table state
+	 */
+	int number_of_references;
+
+	/* The value of the file table state counter when the table state was last referenced
+	 */
+	uint64_t last_referenced;
+
+	/* Value to indicate the table state is no longer managed by the file
+	 */
+	uint8_t is_detached;
+
+#if defined( HAVE_LIBESEDB_MULTI_THREAD_SUPPORT )
+	/* The read/write lock that protects the number of references
+	 */
+	libcthreads_read_write_lock_t *read_write_lock;
+#endif
+};
+
+int libesedb_table_state_initialize(
+     libesedb_table_state_t **table_state,
+     libesedb_io_handle_t *io_handle,
+     libesedb_table_definition_t *table_definition,
+     libesedb_table_definition_t *template_table_definition,
+     libesedb_metadata_cache_t *metadata_cache,
+     libcerror_error_t **error );
+
+int libesedb_table_state_free(
+     libesedb_table_state_t **table_state,
+     libcerror_error_t **error );
+
+int libesedb_table_state_get_number_of_references(
+     libesedb_table_state_t *table_state,
+     int *number_of_references,
+     libcerror_error_t **error );
+
+int libesedb_table_state_reference(
+     libesedb_table_state_t *table_state,
+     uint64_t last_referenced,
+     libcerror_error_t **error );
+
+int libesedb_table_state_detach(
+     libesedb_table_state_t **table_state,
+     libcerror_error_t **error );
+
+int libesedb_table_state_release(
+     libesedb_table_state_t **table_state,
+     libcerror_error_t **error );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _LIBESEDB_TABLE_STATE_H ) */
+
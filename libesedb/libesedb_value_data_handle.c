@@ -87,6 +87,17 @@ int libesedb_value_data_handle_read_value_entries(
 	}
 	if( ( data_flags & LIBESEDB_VALUE_FLAG_MULTI_VALUE ) != 0 )
 	{
+		if( data_size < 2 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+			 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+			 "%s: invalid data size value too small.",
+			 function );
+
+			return( -1 );
+		}
 #if defined( HAVE_DEBUG_OUTPUT )
 		if( libcnotify_verbose != 0 )
 		{
@@ -135,6 +146,20 @@ int libesedb_value_data_handle_read_value_entries(
 
 			return( -1 );
 		}
+		/* The value entry data is referenced directly by the multi value
+		 * functions, hence the offsets need to be within the data
+		 */
+		if( (size_t) value_entry_offset > data_size )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+			 "%s: invalid value offset: 0 value out of bounds.",
+			 function );
+
+			return( -1 );
+		}
 		for( value_entry_offset_index = 1;
 		     value_entry_offset_index < number_of_value_entry_offsets;
 		     value_entry_offset_index++ )
@@ -170,6 +195,18 @@ int libesedb_value_data_handle_read_value_entries(
 
 				return( -1 );
 			}
+			if( (size_t) value_16bit > data_size )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_VALUE_OUT_OF_BOUNDS,
+				 "%s: invalid value offset: %" PRIu16 " value out of bounds.",
+				 function,
+				 value_entry_offset_index );
+
+				return( -1 );
+			}
 			value_entry_size = value_16bit - value_entry_offset;
 
 			if( libfvalue_data_handle_append_value_entry(
@@ -45,6 +45,7 @@
 #include "pyesedb_python.h"
 #include "pyesedb_record.h"
 #include "pyesedb_records.h"
+#include "pyesedb_rows.h"
 #include "pyesedb_table.h"
 #include "pyesedb_tables.h"
 #include "pyesedb_unused.h"
@@ -803,6 +804,23 @@ PyMODINIT_FUNC initpyesedb(
 	 "records",
 	 (PyObject *) &pyesedb_records_type_object );
 
+	/* Setup the rows type object
+	 */
+	pyesedb_rows_type_object.tp_new = PyType_GenericNew;
+
+	if( PyType_Ready(
+	     &pyesedb_rows_type_object ) < 0 )
+	{
+		goto on_error;
+	}
+	Py_IncRef(
+	 (PyObject *) &pyesedb_rows_type_object );
+
+	PyModule_AddObject(
+	 module,
+	 "rows",
+	 (PyObject *) &pyesedb_rows_type_object );
+
 	/* Setup the table type object
 	 */
 	pyesedb_table_type_object.tp_new = PyType_GenericNew;
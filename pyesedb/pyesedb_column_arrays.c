@@ -0,0 +1,1382 @@
+/*
+ * Functions to read the values of the columns of a table into arrays
+ *
+ * Copyright (C) 2009-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <byte_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( HAVE_WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "pyesedb_column_arrays.h"
+#include "pyesedb_error.h"
+#include "pyesedb_libcerror.h"
+#include "pyesedb_libesedb.h"
+#include "pyesedb_python.h"
+#include "pyesedb_rows.h"
+
+#define PYESEDB_COLUMN_ARRAYS_DATA_FLAG_IS_SET		0x01
+#define PYESEDB_COLUMN_ARRAYS_DATA_FLAG_IS_STRING	0x02
+
+/* The number of days between 30 Dec 1899 and 1 Jan 1970
+ */
+#define PYESEDB_COLUMN_ARRAYS_FLOATINGTIME_UNIX_EPOCH	25569.0
+
+/* The number of micro seconds in a day
+ */
+#define PYESEDB_COLUMN_ARRAYS_MICRO_SECONDS_PER_DAY	86400000000.0
+
+/* Creates column arrays for the values of rows
+ * The column arrays contain fixed-size values as a bytearray that can be
+ * used as a NumPy buffer, other values are stored as binary data or UTF-8 strings
+ * Make sure the value column_arrays is referencing, is set to NULL
+ * Returns 1 if successful or -1 on error
+ */
+int pyesedb_column_arrays_initialize(
+     pyesedb_column_array_t **column_arrays,
+     pyesedb_rows_t *pyesedb_rows )
+{
+	pyesedb_column_array_t *column_array = NULL;
+	static char *function                = "pyesedb_column_arrays_initialize";
+	size_t values_size                   = 0;
+	int value_index                      = 0;
+
+	if( column_arrays == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid column arrays.",
+		 function );
+
+		return( -1 );
+	}
+	if( *column_arrays != NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid column arrays value already set.",
+		 function );
+
+		return( -1 );
+	}
+	if( pyesedb_rows == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid rows.",
+		 function );
+
+		return( -1 );
+	}
+	if( pyesedb_rows->number_of_values <= 0 )
+	{
+		return( 1 );
+	}
+	*column_arrays = (pyesedb_column_array_t *) PyMem_Malloc(
+	                                             sizeof( pyesedb_column_array_t ) * pyesedb_rows->number_of_values );
+
+	if( *column_arrays == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create column arrays.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *column_arrays,
+	     0,
+	     sizeof( pyesedb_column_array_t ) * pyesedb_rows->number_of_values ) == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to clear column arrays.",
+		 function );
+
+		PyMem_Free(
+		 *column_arrays );
+
+		*column_arrays = NULL;
+
+		return( -1 );
+	}
+	for( value_index = 0;
+	     value_index < pyesedb_rows->number_of_values;
+	     value_index++ )
+	{
+		column_array = &( ( *column_arrays )[ value_index ] );
+
+		column_array->column_type = pyesedb_rows->values[ value_index ].column_type;
+
+		/* Currency values are represented as unsigned integers to match
+		 * the values returned by get_value_data_as_integer
+		 */
+		switch( column_array->column_type )
+		{
+			case LIBESEDB_COLUMN_TYPE_BOOLEAN:
+				column_array->data_type  = "?";
+				column_array->value_size = 1;
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_INTEGER_8BIT_UNSIGNED:
+				column_array->data_type  = "u1";
+				column_array->value_size = 1;
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_SIGNED:
+				column_array->data_type  = "i2";
+				column_array->value_size = 2;
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_UNSIGNED:
+				column_array->data_type  = "u2";
+				column_array->value_size = 2;
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED:
+				column_array->data_type  = "i4";
+				column_array->value_size = 4;
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED:
+				column_array->data_type  = "u4";
+				column_array->value_size = 4;
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_CURRENCY:
+				column_array->data_type  = "u8";
+				column_array->value_size = 8;
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_INTEGER_64BIT_SIGNED:
+				column_array->data_type  = "i8";
+				column_array->value_size = 8;
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_FLOAT_32BIT:
+				column_array->data_type  = "f4";
+				column_array->value_size = 4;
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_DOUBLE_64BIT:
+				column_array->data_type  = "f8";
+				column_array->value_size = 8;
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_DATE_TIME:
+				column_array->data_type  = "datetime64[us]";
+				column_array->value_size = 8;
+				break;
+
+			default:
+				break;
+		}
+		if( column_array->data_type == NULL )
+		{
+			continue;
+		}
+		if( (size_t) pyesedb_rows->number_of_records > ( (size_t) PY_SSIZE_T_MAX / column_array->value_size ) )
+		{
+			PyErr_Format(
+			 PyExc_ValueError,
+			 "%s: invalid number of records value exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		values_size = (size_t) pyesedb_rows->number_of_records * column_array->value_size;
+
+		column_array->values_object = PyByteArray_FromStringAndSize(
+		                               NULL,
+		                               (Py_ssize_t) values_size );
+
+		if( column_array->values_object == NULL )
+		{
+			PyErr_Format(
+			 PyExc_MemoryError,
+			 "%s: unable to create column array: %d values.",
+			 function,
+			 value_index );
+
+			goto on_error;
+		}
+		column_array->values = (uint8_t *) PyByteArray_AsString(
+		                                    column_array->values_object );
+
+		column_array->mask_object = PyByteArray_FromStringAndSize(
+		                             NULL,
+		                             (Py_ssize_t) pyesedb_rows->number_of_records );
+
+		if( column_array->mask_object == NULL )
+		{
+			PyErr_Format(
+			 PyExc_MemoryError,
+			 "%s: unable to create column array: %d mask.",
+			 function,
+			 value_index );
+
+			goto on_error;
+		}
+		column_array->mask = (uint8_t *) PyByteArray_AsString(
+		                                  column_array->mask_object );
+
+		if( column_array->column_type == LIBESEDB_COLUMN_TYPE_DATE_TIME )
+		{
+			column_array->floatingtimes = (uint64_t *) PyMem_Malloc(
+			                                            sizeof( uint64_t ) * pyesedb_rows->number_of_records );
+
+			if( ( column_array->floatingtimes == NULL )
+			 && ( pyesedb_rows->number_of_records > 0 ) )
+			{
+				PyErr_Format(
+				 PyExc_MemoryError,
+				 "%s: unable to create column array: %d floatingtimes.",
+				 function,
+				 value_index );
+
+				goto on_error;
+			}
+		}
+	}
+	return( 1 );
+
+on_error:
+	pyesedb_column_arrays_free(
+	 column_arrays,
+	 pyesedb_rows->number_of_values,
+	 pyesedb_rows->number_of_records );
+
+	return( -1 );
+}
+
+/* Frees column arrays
+ */
+void pyesedb_column_arrays_free(
+      pyesedb_column_array_t **column_arrays,
+      int number_of_column_arrays,
+      int number_of_records )
+{
+	pyesedb_column_array_t *column_array = NULL;
+	int record_index                     = 0;
+	int value_index                      = 0;
+
+	if( column_arrays == NULL )
+	{
+		return;
+	}
+	if( *column_arrays == NULL )
+	{
+		return;
+	}
+	for( value_index = 0;
+	     value_index < number_of_column_arrays;
+	     value_index++ )
+	{
+		column_array = &( ( *column_arrays )[ value_index ] );
+
+		if( column_array->values_object != NULL )
+		{
+			Py_DecRef(
+			 column_array->values_object );
+		}
+		if( column_array->mask_object != NULL )
+		{
+			Py_DecRef(
+			 column_array->mask_object );
+		}
+		if( column_array->floatingtimes != NULL )
+		{
+			PyMem_Free(
+			 column_array->floatingtimes );
+		}
+		if( column_array->data != NULL )
+		{
+			for( record_index = 0;
+			     record_index < number_of_records;
+			     record_index++ )
+			{
+				if( column_array->data[ record_index ] != NULL )
+				{
+					memory_free(
+					 column_array->data[ record_index ] );
+				}
+			}
+			memory_free(
+			 column_array->data );
+		}
+		if( column_array->data_size != NULL )
+		{
+			memory_free(
+			 column_array->data_size );
+		}
+		if( column_array->data_flags != NULL )
+		{
+			memory_free(
+			 column_array->data_flags );
+		}
+	}
+	PyMem_Free(
+	 *column_arrays );
+
+	*column_arrays = NULL;
+}
+
+/* Reads the values of all the records into the column arrays
+ * This function does not use the Python API so that it can be called
+ * without holding the GIL
+ * Returns 1 if successful or -1 on error
+ */
+int pyesedb_column_arrays_read_records(
+     pyesedb_column_array_t *column_arrays,
+     pyesedb_rows_t *pyesedb_rows,
+     libcerror_error_t **error )
+{
+	byte_stream_float64_t timestamp;
+
+	pyesedb_column_array_t *column_array = NULL;
+	pyesedb_row_value_t *row_value       = NULL;
+	libesedb_record_t *record            = NULL;
+	uint8_t *value_data                  = NULL;
+	static char *function                = "pyesedb_column_arrays_read_records";
+	double floating_point_value          = 0.0;
+	float value_float                    = 0.0;
+	int64_t value_64bit                  = 0;
+	uint32_t value_32bit                 = 0;
+	uint16_t value_16bit                 = 0;
+	int record_index                     = 0;
+	int result                           = 0;
+	int value_index                      = 0;
+
+	if( pyesedb_rows == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid rows.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( column_arrays == NULL )
+	 && ( pyesedb_rows->number_of_values > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid column arrays.",
+		 function );
+
+		return( -1 );
+	}
+	for( record_index = 0;
+	     record_index < pyesedb_rows->number_of_records;
+	     record_index++ )
+	{
+		result = libesedb_table_get_record(
+		          pyesedb_rows->table,
+		          record_index,
+		          &record,
+		          error );
+
+		if( result == 1 )
+		{
+			result = pyesedb_rows_read_values(
+			          pyesedb_rows,
+			          record,
+			          error );
+		}
+		if( record != NULL )
+		{
+			if( libesedb_record_free(
+			     &record,
+			     ( result == 1 ) ? error : NULL ) != 1 )
+			{
+				result = -1;
+			}
+		}
+		if( result != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve record: %d.",
+			 function,
+			 record_index );
+
+			goto on_error;
+		}
+		for( value_index = 0;
+		     value_index < pyesedb_rows->number_of_values;
+		     value_index++ )
+		{
+			column_array = &( column_arrays[ value_index ] );
+			row_value    = &( pyesedb_rows->values[ value_index ] );
+
+			if( column_array->values != NULL )
+			{
+				value_data = &( column_array->values[ record_index * column_array->value_size ] );
+
+				if( memory_set(
+				     value_data,
+				     0,
+				     column_array->value_size ) == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+					 "%s: unable to clear column array: %d value: %d.",
+					 function,
+					 value_index,
+					 record_index );
+
+					goto on_error;
+				}
+				column_array->mask[ record_index ] = (uint8_t) ( row_value->is_set == 0 );
+
+				if( row_value->is_set == 0 )
+				{
+					column_array->number_of_unset_values += 1;
+
+					continue;
+				}
+			}
+			else if( row_value->is_set == 0 )
+			{
+				continue;
+			}
+			/* Long values and multi values are stored as binary data or UTF-8 strings
+			 * also for columns that otherwise contain fixed-size values
+			 */
+			if( ( row_value->is_string != 0 )
+			 || ( row_value->is_binary_data != 0 ) )
+			{
+				if( column_array->data == NULL )
+				{
+					column_array->data = (uint8_t **) memory_allocate(
+					                                   sizeof( uint8_t * ) * pyesedb_rows->number_of_records );
+
+					column_array->data_size = (size_t *) memory_allocate(
+					                                      sizeof( size_t ) * pyesedb_rows->number_of_records );
+
+					column_array->data_flags = (uint8_t *) memory_allocate(
+					                                        sizeof( uint8_t ) * pyesedb_rows->number_of_records );
+
+					if( ( column_array->data == NULL )
+					 || ( column_array->data_size == NULL )
+					 || ( column_array->data_flags == NULL ) )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_MEMORY,
+						 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+						 "%s: unable to create column array: %d data.",
+						 function,
+						 value_index );
+
+						goto on_error;
+					}
+					if( ( memory_set(
+					       column_array->data,
+					       0,
+					       sizeof( uint8_t * ) * pyesedb_rows->number_of_records ) == NULL )
+					 || ( memory_set(
+					       column_array->data_size,
+					       0,
+					       sizeof( size_t ) * pyesedb_rows->number_of_records ) == NULL )
+					 || ( memory_set(
+					       column_array->data_flags,
+					       0,
+					       sizeof( uint8_t ) * pyesedb_rows->number_of_records ) == NULL ) )
+					{
+						libcerror_error_set(
+						 error,
+						 LIBCERROR_ERROR_DOMAIN_MEMORY,
+						 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+						 "%s: unable to clear column array: %d data.",
+						 function,
+						 value_index );
+
+						goto on_error;
+					}
+				}
+				/* The column array takes over the data of the row value
+				 */
+				column_array->data[ record_index ]       = row_value->data;
+				column_array->data_size[ record_index ]  = row_value->data_size;
+				column_array->data_flags[ record_index ] = PYESEDB_COLUMN_ARRAYS_DATA_FLAG_IS_SET;
+
+				if( row_value->is_string != 0 )
+				{
+					column_array->data_flags[ record_index ] |= PYESEDB_COLUMN_ARRAYS_DATA_FLAG_IS_STRING;
+				}
+				row_value->data      = NULL;
+				row_value->data_size = 0;
+
+				continue;
+			}
+			if( column_array->values == NULL )
+			{
+				continue;
+			}
+			switch( column_array->column_type )
+			{
+				case LIBESEDB_COLUMN_TYPE_BOOLEAN:
+					value_data[ 0 ] = (uint8_t) ( row_value->value_64bit != 0 );
+					break;
+
+				case LIBESEDB_COLUMN_TYPE_INTEGER_8BIT_UNSIGNED:
+					value_data[ 0 ] = (uint8_t) row_value->value_64bit;
+					break;
+
+				case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_SIGNED:
+				case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_UNSIGNED:
+					value_16bit = (uint16_t) row_value->value_64bit;
+
+					memory_copy(
+					 value_data,
+					 &value_16bit,
+					 sizeof( uint16_t ) );
+
+					break;
+
+				case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED:
+				case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED:
+					value_32bit = (uint32_t) row_value->value_64bit;
+
+					memory_copy(
+					 value_data,
+					 &value_32bit,
+					 sizeof( uint32_t ) );
+
+					break;
+
+				case LIBESEDB_COLUMN_TYPE_CURRENCY:
+				case LIBESEDB_COLUMN_TYPE_INTEGER_64BIT_SIGNED:
+					memory_copy(
+					 value_data,
+					 &( row_value->value_64bit ),
+					 sizeof( uint64_t ) );
+
+					break;
+
+				case LIBESEDB_COLUMN_TYPE_FLOAT_32BIT:
+					value_float = (float) row_value->value_floating_point;
+
+					memory_copy(
+					 value_data,
+					 &value_float,
+					 sizeof( float ) );
+
+					break;
+
+				case LIBESEDB_COLUMN_TYPE_DOUBLE_64BIT:
+					memory_copy(
+					 value_data,
+					 &( row_value->value_floating_point ),
+					 sizeof( double ) );
+
+					break;
+
+				case LIBESEDB_COLUMN_TYPE_DATE_TIME:
+					/* Convert the floatingtime into the number of micro seconds
+					 * since 1 Jan 1970 as used by datetime64[us]
+					 */
+					column_array->floatingtimes[ record_index ] = row_value->value_64bit;
+
+					timestamp.integer = row_value->value_64bit;
+
+					floating_point_value = ( timestamp.floating_point - PYESEDB_COLUMN_ARRAYS_FLOATINGTIME_UNIX_EPOCH )
+					                     * PYESEDB_COLUMN_ARRAYS_MICRO_SECONDS_PER_DAY;
+
+					if( floating_point_value >= 0.0 )
+					{
+						floating_point_value += 0.5;
+					}
+					else
+					{
+						floating_point_value -= 0.5;
+					}
+					value_64bit = (int64_t) floating_point_value;
+
+					memory_copy(
+					 value_data,
+					 &value_64bit,
+					 sizeof( int64_t ) );
+
+					break;
+
+				default:
+					break;
+			}
+		}
+		pyesedb_rows_clear_values(
+		 pyesedb_rows );
+	}
+	return( 1 );
+
+on_error:
+	pyesedb_rows_clear_values(
+	 pyesedb_rows );
+
+	return( -1 );
+}
+
+/* Retrieves a specific value of a column array as a Python object
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyesedb_column_arrays_get_value_object(
+           pyesedb_column_array_t *column_array,
+           int record_index )
+{
+	pyesedb_row_value_t row_value;
+
+	uint8_t *value_data    = NULL;
+	static char *function  = "pyesedb_column_arrays_get_value_object";
+	float value_float      = 0.0;
+	uint32_t value_32bit   = 0;
+	uint16_t value_16bit   = 0;
+
+	if( column_array == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid column array.",
+		 function );
+
+		return( NULL );
+	}
+	if( memory_set(
+	     &row_value,
+	     0,
+	     sizeof( pyesedb_row_value_t ) ) == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to clear row value.",
+		 function );
+
+		return( NULL );
+	}
+	row_value.column_type = column_array->column_type;
+
+	if( ( column_array->data != NULL )
+	 && ( ( column_array->data_flags[ record_index ] & PYESEDB_COLUMN_ARRAYS_DATA_FLAG_IS_SET ) != 0 ) )
+	{
+		row_value.is_set    = 1;
+		row_value.data      = column_array->data[ record_index ];
+		row_value.data_size = column_array->data_size[ record_index ];
+
+		if( ( column_array->data_flags[ record_index ] & PYESEDB_COLUMN_ARRAYS_DATA_FLAG_IS_STRING ) != 0 )
+		{
+			row_value.is_string = 1;
+		}
+		else
+		{
+			row_value.is_binary_data = 1;
+		}
+	}
+	else if( ( column_array->values != NULL )
+	      && ( column_array->mask[ record_index ] == 0 ) )
+	{
+		row_value.is_set = 1;
+
+		value_data = &( column_array->values[ record_index * column_array->value_size ] );
+
+		switch( column_array->column_type )
+		{
+			case LIBESEDB_COLUMN_TYPE_BOOLEAN:
+			case LIBESEDB_COLUMN_TYPE_INTEGER_8BIT_UNSIGNED:
+				row_value.value_64bit = value_data[ 0 ];
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_SIGNED:
+			case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_UNSIGNED:
+				memory_copy(
+				 &value_16bit,
+				 value_data,
+				 sizeof( uint16_t ) );
+
+				row_value.value_64bit = value_16bit;
+
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED:
+			case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED:
+				memory_copy(
+				 &value_32bit,
+				 value_data,
+				 sizeof( uint32_t ) );
+
+				row_value.value_64bit = value_32bit;
+
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_CURRENCY:
+			case LIBESEDB_COLUMN_TYPE_INTEGER_64BIT_SIGNED:
+				memory_copy(
+				 &( row_value.value_64bit ),
+				 value_data,
+				 sizeof( uint64_t ) );
+
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_FLOAT_32BIT:
+				memory_copy(
+				 &value_float,
+				 value_data,
+				 sizeof( float ) );
+
+				row_value.value_floating_point = (double) value_float;
+
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_DOUBLE_64BIT:
+				memory_copy(
+				 &( row_value.value_floating_point ),
+				 value_data,
+				 sizeof( double ) );
+
+				break;
+
+			/* The original floatingtime is used since converting the rounded
+			 * micro seconds back into a floatingtime can result in a datetime
+			 * object that differs from the one returned by iter_rows
+			 */
+			case LIBESEDB_COLUMN_TYPE_DATE_TIME:
+				row_value.value_64bit = column_array->floatingtimes[ record_index ];
+				break;
+
+			default:
+				break;
+		}
+	}
+	return( pyesedb_rows_get_value_object(
+	         &row_value ) );
+}
+
+/* Retrieves the values of a column array as a list of Python objects
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyesedb_column_arrays_get_objects(
+           pyesedb_column_array_t *column_array,
+           int number_of_records )
+{
+	PyObject *list_object  = NULL;
+	PyObject *value_object = NULL;
+	static char *function  = "pyesedb_column_arrays_get_objects";
+	int record_index       = 0;
+
+	list_object = PyList_New(
+	               (Py_ssize_t) number_of_records );
+
+	if( list_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create list.",
+		 function );
+
+		return( NULL );
+	}
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		value_object = pyesedb_column_arrays_get_value_object(
+		                column_array,
+		                record_index );
+
+		if( value_object == NULL )
+		{
+			Py_DecRef(
+			 list_object );
+
+			return( NULL );
+		}
+		/* PyList_SET_ITEM steals the reference to the value object
+		 */
+		PyList_SET_ITEM(
+		 list_object,
+		 (Py_ssize_t) record_index,
+		 value_object );
+	}
+	return( list_object );
+}
+
+/* Retrieves the values of a column array as a NumPy array
+ * Fixed-size values are returned as an array backed by the column array
+ * buffer, where values that are not set are masked, other values are
+ * returned as an array of Python objects
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyesedb_column_arrays_get_numpy_array(
+           pyesedb_column_array_t *column_array,
+           int number_of_records,
+           PyObject *numpy_module )
+{
+	PyObject *array_object  = NULL;
+	PyObject *list_object   = NULL;
+	PyObject *mask_object   = NULL;
+	PyObject *masked_object = NULL;
+	PyObject *module_object = NULL;
+	static char *function   = "pyesedb_column_arrays_get_numpy_array";
+	Py_ssize_t list_index   = 0;
+
+	if( column_array == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid column array.",
+		 function );
+
+		return( NULL );
+	}
+	if( ( column_array->values_object != NULL )
+	 && ( column_array->data == NULL ) )
+	{
+		array_object = PyObject_CallMethod(
+		                numpy_module,
+		                "frombuffer",
+		                "Os",
+		                column_array->values_object,
+		                column_array->data_type );
+
+		if( ( array_object == NULL )
+		 || ( column_array->number_of_unset_values == 0 ) )
+		{
+			return( array_object );
+		}
+		mask_object = PyObject_CallMethod(
+		               numpy_module,
+		               "frombuffer",
+		               "Os",
+		               column_array->mask_object,
+		               "?" );
+
+		if( mask_object == NULL )
+		{
+			goto on_error;
+		}
+		module_object = PyObject_GetAttrString(
+		                 numpy_module,
+		                 "ma" );
+
+		if( module_object == NULL )
+		{
+			goto on_error;
+		}
+		masked_object = PyObject_CallMethod(
+		                 module_object,
+		                 "masked_array",
+		                 "OO",
+		                 array_object,
+		                 mask_object );
+
+		Py_DecRef(
+		 module_object );
+		Py_DecRef(
+		 mask_object );
+		Py_DecRef(
+		 array_object );
+
+		return( masked_object );
+	}
+	list_object = pyesedb_column_arrays_get_objects(
+	               column_array,
+	               number_of_records );
+
+	if( list_object == NULL )
+	{
+		goto on_error;
+	}
+	/* Fill an empty object array so that NumPy does not interpret
+	 * the values as nested sequences
+	 */
+	array_object = PyObject_CallMethod(
+	                numpy_module,
+	                "empty",
+	                "is",
+	                number_of_records,
+	                "O" );
+
+	if( array_object == NULL )
+	{
+		goto on_error;
+	}
+	for( list_index = 0;
+	     list_index < (Py_ssize_t) number_of_records;
+	     list_index++ )
+	{
+		if( PySequence_SetItem(
+		     array_object,
+		     list_index,
+		     PyList_GET_ITEM(
+		      list_object,
+		      list_index ) ) != 0 )
+		{
+			goto on_error;
+		}
+	}
+	Py_DecRef(
+	 list_object );
+
+	return( array_object );
+
+on_error:
+	if( mask_object != NULL )
+	{
+		Py_DecRef(
+		 mask_object );
+	}
+	if( list_object != NULL )
+	{
+		Py_DecRef(
+		 list_object );
+	}
+	if( array_object != NULL )
+	{
+		Py_DecRef(
+		 array_object );
+	}
+	return( NULL );
+}
+
+/* Retrieves the values of a column array as an Arrow array
+ * Fixed-size values are passed to Arrow as a NumPy array backed by
+ * the column array buffer, other values as a list of Python objects
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyesedb_column_arrays_get_arrow_array(
+           pyesedb_column_array_t *column_array,
+           int number_of_records,
+           PyObject *numpy_module,
+           PyObject *pyarrow_module )
+{
+	PyObject *arguments_object = NULL;
+	PyObject *array_function   = NULL;
+	PyObject *array_object     = NULL;
+	PyObject *keywords_object  = NULL;
+	PyObject *mask_object      = NULL;
+	PyObject *values_object    = NULL;
+	static char *function      = "pyesedb_column_arrays_get_arrow_array";
+
+	if( column_array == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid column array.",
+		 function );
+
+		return( NULL );
+	}
+	if( ( column_array->values_object == NULL )
+	 || ( column_array->data != NULL ) )
+	{
+		values_object = pyesedb_column_arrays_get_objects(
+		               column_array,
+		               number_of_records );
+	}
+	else
+	{
+		values_object = PyObject_CallMethod(
+		               numpy_module,
+		               "frombuffer",
+		               "Os",
+		               column_array->values_object,
+		               column_array->data_type );
+	}
+	if( values_object == NULL )
+	{
+		goto on_error;
+	}
+	if( ( column_array->values_object != NULL )
+	 && ( column_array->data == NULL )
+	 && ( column_array->number_of_unset_values > 0 ) )
+	{
+		mask_object = PyObject_CallMethod(
+		               numpy_module,
+		               "frombuffer",
+		               "Os",
+		               column_array->mask_object,
+		               "?" );
+
+		if( mask_object == NULL )
+		{
+			goto on_error;
+		}
+		keywords_object = PyDict_New();
+
+		if( keywords_object == NULL )
+		{
+			goto on_error;
+		}
+		if( PyDict_SetItemString(
+		     keywords_object,
+		     "mask",
+		     mask_object ) != 0 )
+		{
+			goto on_error;
+		}
+	}
+	array_function = PyObject_GetAttrString(
+	                  pyarrow_module,
+	                  "array" );
+
+	if( array_function == NULL )
+	{
+		goto on_error;
+	}
+	arguments_object = PyTuple_Pack(
+	                    1,
+	                    values_object );
+
+	if( arguments_object == NULL )
+	{
+		goto on_error;
+	}
+	array_object = PyObject_Call(
+	                array_function,
+	                arguments_object,
+	                keywords_object );
+
+on_error:
+	if( arguments_object != NULL )
+	{
+		Py_DecRef(
+		 arguments_object );
+	}
+	if( array_function != NULL )
+	{
+		Py_DecRef(
+		 array_function );
+	}
+	if( keywords_object != NULL )
+	{
+		Py_DecRef(
+		 keywords_object );
+	}
+	if( mask_object != NULL )
+	{
+		Py_DecRef(
+		 mask_object );
+	}
+	if( values_object != NULL )
+	{
+		Py_DecRef(
+		 values_object );
+	}
+	return( array_object );
+}
+
+/* Reads the values of the columns of all the records of a table
+ * The columns object contains a sequence of column indexes or names
+ * or Py_None to read all the columns of the table
+ * NumPy and pyarrow are imported at run-time so that they are only
+ * required when the functions are used
+ * Returns a dictionary of NumPy arrays, an Arrow table if as_arrow is set
+ * or NULL on error
+ */
+PyObject *pyesedb_column_arrays_read(
+           PyObject *parent_object,
+           libesedb_table_t *table,
+           PyObject *columns_object,
+           int as_arrow )
+{
+	libcerror_error_t *error               = NULL;
+	pyesedb_column_array_t *column_arrays  = NULL;
+	pyesedb_rows_t *pyesedb_rows           = NULL;
+	PyObject *array_object                 = NULL;
+	PyObject *arrays_object                = NULL;
+	PyObject *names_object                 = NULL;
+	PyObject *numpy_module                 = NULL;
+	PyObject *pyarrow_module               = NULL;
+	PyObject *result_object                = NULL;
+	PyObject *table_type_object            = NULL;
+	static char *function                  = "pyesedb_column_arrays_read";
+	int result                             = 0;
+	int value_index                        = 0;
+
+	numpy_module = PyImport_ImportModule(
+	                "numpy" );
+
+	if( numpy_module == NULL )
+	{
+		goto on_error;
+	}
+	if( as_arrow != 0 )
+	{
+		pyarrow_module = PyImport_ImportModule(
+		                  "pyarrow" );
+
+		if( pyarrow_module == NULL )
+		{
+			goto on_error;
+		}
+	}
+	pyesedb_rows = (pyesedb_rows_t *) pyesedb_rows_new(
+	                                   parent_object,
+	                                   table,
+	                                   columns_object,
+	                                   1,
+	                                   0 );
+
+	if( pyesedb_rows == NULL )
+	{
+		goto on_error;
+	}
+	if( pyesedb_column_arrays_initialize(
+	     &column_arrays,
+	     pyesedb_rows ) != 1 )
+	{
+		goto on_error;
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = pyesedb_column_arrays_read_records(
+	          column_arrays,
+	          pyesedb_rows,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyesedb_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to read records.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	if( as_arrow != 0 )
+	{
+		arrays_object = PyList_New(
+		                 (Py_ssize_t) pyesedb_rows->number_of_values );
+	}
+	else
+	{
+		arrays_object = PyDict_New();
+	}
+	if( arrays_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create arrays.",
+		 function );
+
+		goto on_error;
+	}
+	for( value_index = 0;
+	     value_index < pyesedb_rows->number_of_values;
+	     value_index++ )
+	{
+		if( as_arrow != 0 )
+		{
+			/* An Arrow array has a single type, hence it cannot contain both
+			 * the fixed-size values and the binary data of long or multi values
+			 */
+			if( ( column_arrays[ value_index ].values_object != NULL )
+			 && ( column_arrays[ value_index ].data != NULL ) )
+			{
+				PyErr_Format(
+				 PyExc_ValueError,
+				 "%s: unsupported column: %d contains both fixed-size values and long or multi values.",
+				 function,
+				 value_index );
+
+				goto on_error;
+			}
+			array_object = pyesedb_column_arrays_get_arrow_array(
+			                &( column_arrays[ value_index ] ),
+			                pyesedb_rows->number_of_records,
+			                numpy_module,
+			                pyarrow_module );
+		}
+		else
+		{
+			array_object = pyesedb_column_arrays_get_numpy_array(
+			                &( column_arrays[ value_index ] ),
+			                pyesedb_rows->number_of_records,
+			                numpy_module );
+		}
+		if( array_object == NULL )
+		{
+			goto on_error;
+		}
+		if( as_arrow != 0 )
+		{
+			/* PyList_SET_ITEM steals the reference to the array object
+			 */
+			PyList_SET_ITEM(
+			 arrays_object,
+			 (Py_ssize_t) value_index,
+			 array_object );
+		}
+		else
+		{
+			/* Columns with the same name would overwrite each other in the dictionary
+			 */
+			result = PyDict_Contains(
+			          arrays_object,
+			          PyTuple_GET_ITEM(
+			           pyesedb_rows->column_names,
+			           (Py_ssize_t) value_index ) );
+
+			if( result != 0 )
+			{
+				Py_DecRef(
+				 array_object );
+
+				if( result == 1 )
+				{
+					PyErr_Format(
+					 PyExc_ValueError,
+					 "%s: unsupported column: %d name already used by another column.",
+					 function,
+					 value_index );
+				}
+				goto on_error;
+			}
+			result = PyDict_SetItem(
+			          arrays_object,
+			          PyTuple_GET_ITEM(
+			           pyesedb_rows->column_names,
+			           (Py_ssize_t) value_index ),
+			          array_object );
+
+			Py_DecRef(
+			 array_object );
+
+			if( result != 0 )
+			{
+				goto on_error;
+			}
+		}
+	}
+	if( as_arrow != 0 )
+	{
+		names_object = PySequence_List(
+		                pyesedb_rows->column_names );
+
+		if( names_object == NULL )
+		{
+			goto on_error;
+		}
+		table_type_object = PyObject_GetAttrString(
+		                     pyarrow_module,
+		                     "Table" );
+
+		if( table_type_object == NULL )
+		{
+			goto on_error;
+		}
+		result_object = PyObject_CallMethod(
+		                 table_type_object,
+		                 "from_arrays",
+		                 "OO",
+		                 arrays_object,
+		                 names_object );
+
+		if( result_object == NULL )
+		{
+			goto on_error;
+		}
+		Py_DecRef(
+		 table_type_object );
+		Py_DecRef(
+		 names_object );
+		Py_DecRef(
+		 arrays_object );
+	}
+	else
+	{
+		result_object = arrays_object;
+	}
+	pyesedb_column_arrays_free(
+	 &column_arrays,
+	 pyesedb_rows->number_of_values,
+	 pyesedb_rows->number_of_records );
+
+	Py_DecRef(
+	 (PyObject *) pyesedb_rows );
+
+	if( pyarrow_module != NULL )
+	{
+		Py_DecRef(
+		 pyarrow_module );
+	}
+	Py_DecRef(
+	 numpy_module );
+
+	return( result_object );
+
+on_error:
+	if( table_type_object != NULL )
+	{
+		Py_DecRef(
+		 table_type_object );
+	}
+	if( names_object != NULL )
+	{
+		Py_DecRef(
+		 names_object );
+	}
+	if( arrays_object != NULL )
+	{
+		Py_DecRef(
+		 arrays_object );
+	}
+	if( column_arrays != NULL )
+	{
+		pyesedb_column_arrays_free(
+		 &column_arrays,
+		 pyesedb_rows->number_of_values,
+		 pyesedb_rows->number_of_records );
+	}
+	if( pyesedb_rows != NULL )
+	{
+		Py_DecRef(
+		 (PyObject *) pyesedb_rows );
+	}
+	if( pyarrow_module != NULL )
+	{
+		Py_DecRef(
+		 pyarrow_module );
+	}
+	if( numpy_module != NULL )
+	{
+		Py_DecRef(
+		 numpy_module );
+	}
+	return( NULL );
+}
+
@@ -0,0 +1,137 @@
+/*
+ * Functions to read the values of the columns of a table into arrays
+ *
+ * Copyright (C) 2009-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _PYESEDB_COLUMN_ARRAYS_H )
+#define _PYESEDB_COLUMN_ARRAYS_H
+
+#include <common.h>
+#include <types.h>
+
+#include "pyesedb_libcerror.h"
+#include "pyesedb_libesedb.h"
+#include "pyesedb_python.h"
+#include "pyesedb_rows.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct pyesedb_column_array pyesedb_column_array_t;
+
+/* The values of a column of all the records of a table
+ */
+struct pyesedb_column_array
+{
+	/* The column type
+	 */
+	uint32_t column_type;
+
+	/* The NumPy data type of the fixed-size values or NULL if not available
+	 */
+	const char *data_type;
+
+	/* The size of a fixed-size value
+	 */
+	size_t value_size;
+
+	/* The bytearray object that contains the fixed-size values
+	 */
+	PyObject *values_object;
+
+	/* The fixed-size values
+	 */
+	uint8_t *values;
+
+	/* The bytearray object that contains the mask of the fixed-size values
+	 */
+	PyObject *mask_object;
+
+	/* The mask of the fixed-size values, where 1 indicates the value is not set
+	 */
+	uint8_t *mask;
+
+	/* The number of fixed-size values that are not set
+	 */
+	int number_of_unset_values;
+
+	/* The floatingtime values of a date and time column, from which the datetime
+	 * objects are created, since the fixed-size values are rounded to micro seconds
+	 */
+	uint64_t *floatingtimes;
+
+	/* The binary data or UTF-8 strings of the values
+	 */
+	uint8_t **data;
+
+	/* The binary data or UTF-8 string sizes of the values
+	 */
+	size_t *data_size;
+
+	/* The binary data or UTF-8 string flags of the values
+	 */
+	uint8_t *data_flags;
+};
+
+int pyesedb_column_arrays_initialize(
+     pyesedb_column_array_t **column_arrays,
+     pyesedb_rows_t *pyesedb_rows );
+
+void pyesedb_column_arrays_free(
+      pyesedb_column_array_t **column_arrays,
+      int number_of_column_arrays,
+      int number_of_records );
+
+int pyesedb_column_arrays_read_records(
+     pyesedb_column_array_t *column_arrays,
+     pyesedb_rows_t *pyesedb_rows,
+     libcerror_error_t **error );
+
+PyObject *pyesedb_column_arrays_get_value_object(
+           pyesedb_column_array_t *column_array,
+           int record_index );
+
+PyObject *pyesedb_column_arrays_get_objects(
+           pyesedb_column_array_t *column_array,
+           int number_of_records );
+
+PyObject *pyesedb_column_arrays_get_numpy_array(
+           pyesedb_column_array_t *column_array,
+           int number_of_records,
+           PyObject *numpy_module );
+
+PyObject *pyesedb_column_arrays_get_arrow_array(
+           pyesedb_column_array_t *column_array,
+           int number_of_records,
+           PyObject *numpy_module,
+           PyObject *pyarrow_module );
+
+PyObject *pyesedb_column_arrays_read(
+           PyObject *parent_object,
+           libesedb_table_t *table,
+           PyObject *columns_object,
+           int as_arrow );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _PYESEDB_COLUMN_ARRAYS_H ) */
+
@@ -1192,9 +1192,13 @@ PyObject *pyesedb_file_get_table_by_index(
 on_error:
 	if( table != NULL )
 	{
+		Py_BEGIN_ALLOW_THREADS
+
 		libesedb_table_free(
 		 &table,
 		 NULL );
+
+		Py_END_ALLOW_THREADS
 	}
 	return( NULL );
 }
@@ -1379,9 +1383,13 @@ PyObject *pyesedb_file_get_table_by_name(
 on_error:
 	if( table != NULL )
 	{
+		Py_BEGIN_ALLOW_THREADS
+
 		libesedb_table_free(
 		 &table,
 		 NULL );
+
+		Py_END_ALLOW_THREADS
 	}
 	return( NULL );
 }
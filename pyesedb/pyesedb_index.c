@@ -641,9 +641,13 @@ PyObject *pyesedb_index_get_record_by_index(
 on_error:
 	if( record != NULL )
 	{
+		Py_BEGIN_ALLOW_THREADS
+
 		libesedb_record_free(
 		 &record,
 		 NULL );
+
+		Py_END_ALLOW_THREADS
 	}
 	return( NULL );
 }
@@ -378,18 +378,34 @@ PyObject *pyesedb_long_value_get_data(
 
 		goto on_error;
 	}
-	data = (uint8_t *) PyMem_Malloc(
-	                    sizeof( uint8_t ) * data_size );
-
-	if( data == NULL )
+	/* Read the data directly into the string object to prevent
+	 * an additional copy of the data
+	 */
+#if PY_MAJOR_VERSION >= 3
+	string_object = PyBytes_FromStringAndSize(
+	                 NULL,
+	                 (Py_ssize_t) data_size );
+#else
+	string_object = PyString_FromStringAndSize(
+	                 NULL,
+	                 (Py_ssize_t) data_size );
+#endif
+	if( string_object == NULL )
 	{
 		PyErr_Format(
-		 PyExc_IOError,
+		 PyExc_MemoryError,
 		 "%s: unable to create data.",
 		 function );
 
 		goto on_error;
 	}
+#if PY_MAJOR_VERSION >= 3
+	data = (uint8_t *) PyBytes_AsString(
+	                    string_object );
+#else
+	data = (uint8_t *) PyString_AsString(
+	                    string_object );
+#endif
 	Py_BEGIN_ALLOW_THREADS
 
 	result = libesedb_long_value_get_data(
@@ -413,25 +429,13 @@ PyObject *pyesedb_long_value_get_data(
 
 		goto on_error;
 	}
-#if PY_MAJOR_VERSION >= 3
-	string_object = PyBytes_FromStringAndSize(
-			 (char *) data,
-			 (Py_ssize_t) data_size );
-#else
-	string_object = PyString_FromStringAndSize(
-			 (char *) data,
-			 (Py_ssize_t) data_size );
-#endif
-	PyMem_Free(
-	 data );
-
 	return( string_object );
 
 on_error:
-	if( data != NULL )
+	if( string_object != NULL )
 	{
-		PyMem_Free(
-		 data );
+		Py_DecRef(
+		 string_object );
 	}
 	return( NULL );
 }
@@ -903,19 +903,35 @@ PyObject *pyesedb_record_get_value_data(
 
 		return( Py_None );
 	}
-	value_data = (uint8_t *) PyMem_Malloc(
-	                          sizeof( uint8_t ) * value_data_size );
-
-	if( value_data == NULL )
+	/* Read the data directly into the string object to prevent
+	 * an additional copy of the data
+	 */
+#if PY_MAJOR_VERSION >= 3
+	string_object = PyBytes_FromStringAndSize(
+	                 NULL,
+	                 (Py_ssize_t) value_data_size );
+#else
+	string_object = PyString_FromStringAndSize(
+	                 NULL,
+	                 (Py_ssize_t) value_data_size );
+#endif
+	if( string_object == NULL )
 	{
 		PyErr_Format(
-		 PyExc_IOError,
+		 PyExc_MemoryError,
 		 "%s: unable to create value: %d data.",
 		 function,
 		 value_entry );
 
 		goto on_error;
 	}
+#if PY_MAJOR_VERSION >= 3
+	value_data = (uint8_t *) PyBytes_AsString(
+	                          string_object );
+#else
+	value_data = (uint8_t *) PyString_AsString(
+	                          string_object );
+#endif
 	Py_BEGIN_ALLOW_THREADS
 
 	result = libesedb_record_get_value_data(
@@ -941,25 +957,13 @@ PyObject *pyesedb_record_get_value_data(
 
 		goto on_error;
 	}
-#if PY_MAJOR_VERSION >= 3
-	string_object = PyBytes_FromStringAndSize(
-			 (char *) value_data,
-			 (Py_ssize_t) value_data_size );
-#else
-	string_object = PyString_FromStringAndSize(
-			 (char *) value_data,
-			 (Py_ssize_t) value_data_size );
-#endif
-	PyMem_Free(
-	 value_data );
-
 	return( string_object );
 
 on_error:
-	if( value_data != NULL )
+	if( string_object != NULL )
 	{
-		PyMem_Free(
-		 value_data );
+		Py_DecRef(
+		 string_object );
 	}
 	return( NULL );
 }
@@ -1662,9 +1666,13 @@ PyObject *pyesedb_record_get_value_data_as_long_value(
 on_error:
 	if( long_value != NULL )
 	{
+		Py_BEGIN_ALLOW_THREADS
+
 		libesedb_long_value_free(
 		 &long_value,
 		 NULL );
+
+		Py_END_ALLOW_THREADS
 	}
 	return( NULL );
 }
@@ -0,0 +1,1606 @@
+/*
+ * Python object definition of the iterator object of rows
+ *
+ * Copyright (C) 2009-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( HAVE_WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "pyesedb_datetime.h"
+#include "pyesedb_error.h"
+#include "pyesedb_integer.h"
+#include "pyesedb_libcerror.h"
+#include "pyesedb_libesedb.h"
+#include "pyesedb_python.h"
+#include "pyesedb_rows.h"
+
+PyTypeObject pyesedb_rows_type_object = {
+	PyVarObject_HEAD_INIT( NULL, 0 )
+
+	/* tp_name */
+	"pyesedb.rows",
+	/* tp_basicsize */
+	sizeof( pyesedb_rows_t ),
+	/* tp_itemsize */
+	0,
+	/* tp_dealloc */
+	(destructor) pyesedb_rows_free,
+	/* tp_print */
+	0,
+	/* tp_getattr */
+	0,
+	/* tp_setattr */
+	0,
+	/* tp_compare */
+	0,
+	/* tp_repr */
+	0,
+	/* tp_as_number */
+	0,
+	/* tp_as_sequence */
+	0,
+	/* tp_as_mapping */
+	0,
+	/* tp_hash */
+	0,
+	/* tp_call */
+	0,
+	/* tp_str */
+	0,
+	/* tp_getattro */
+	0,
+	/* tp_setattro */
+	0,
+	/* tp_as_buffer */
+	0,
+	/* tp_flags */
+	Py_TPFLAGS_DEFAULT | Py_TPFLAGS_HAVE_ITER,
+	/* tp_doc */
+	"pyesedb iterator object of rows",
+	/* tp_traverse */
+	0,
+	/* tp_clear */
+	0,
+	/* tp_richcompare */
+	0,
+	/* tp_weaklistoffset */
+	0,
+	/* tp_iter */
+	(getiterfunc) pyesedb_rows_iter,
+	/* tp_iternext */
+	(iternextfunc) pyesedb_rows_iternext,
+	/* tp_methods */
+	0,
+	/* tp_members */
+	0,
+	/* tp_getset */
+	0,
+	/* tp_base */
+	0,
+	/* tp_dict */
+	0,
+	/* tp_descr_get */
+	0,
+	/* tp_descr_set */
+	0,
+	/* tp_dictoffset */
+	0,
+	/* tp_init */
+	(initproc) pyesedb_rows_init,
+	/* tp_alloc */
+	0,
+	/* tp_new */
+	0,
+	/* tp_free */
+	0,
+	/* tp_is_gc */
+	0,
+	/* tp_bases */
+	NULL,
+	/* tp_mro */
+	NULL,
+	/* tp_cache */
+	NULL,
+	/* tp_subclasses */
+	NULL,
+	/* tp_weaklist */
+	NULL,
+	/* tp_del */
+	0
+};
+
+/* Creates a new rows iterator object
+ * The columns object contains a sequence of column indexes or names
+ * or Py_None to return all the columns of the table
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyesedb_rows_new(
+           PyObject *parent_object,
+           libesedb_table_t *table,
+           PyObject *columns_object,
+           int as_dict,
+           int batch_size )
+{
+	libcerror_error_t *error          = NULL;
+	PyObject *column_name_object      = NULL;
+	PyObject *column_names_object     = NULL;
+	PyObject *fast_columns_object     = NULL;
+	PyObject *item_object             = NULL;
+	pyesedb_rows_t *pyesedb_rows      = NULL;
+	uint32_t *column_types            = NULL;
+	static char *function             = "pyesedb_rows_new";
+	long column_index                 = 0;
+	int column_entry                  = 0;
+	int number_of_columns             = 0;
+	int result                        = 0;
+	int value_index                   = 0;
+
+	if( parent_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid parent object.",
+		 function );
+
+		return( NULL );
+	}
+	if( table == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid table.",
+		 function );
+
+		return( NULL );
+	}
+	if( batch_size < 0 )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid batch size value less than zero.",
+		 function );
+
+		return( NULL );
+	}
+	/* PyObject_New does not invoke tp_init
+	 */
+	pyesedb_rows = PyObject_New(
+	                struct pyesedb_rows,
+	                &pyesedb_rows_type_object );
+
+	if( pyesedb_rows == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create rows object.",
+		 function );
+
+		goto on_error;
+	}
+	pyesedb_rows->parent_object     = parent_object;
+	pyesedb_rows->table             = table;
+	pyesedb_rows->value_entries     = NULL;
+	pyesedb_rows->values            = NULL;
+	pyesedb_rows->number_of_values  = 0;
+	pyesedb_rows->column_names      = NULL;
+	pyesedb_rows->batch_size        = batch_size;
+	pyesedb_rows->current_index     = 0;
+	pyesedb_rows->number_of_records = 0;
+	pyesedb_rows->is_busy           = 0;
+
+	Py_IncRef(
+	 (PyObject *) pyesedb_rows->parent_object );
+
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libesedb_table_get_number_of_records(
+	          table,
+	          &( pyesedb_rows->number_of_records ),
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyesedb_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve number of records.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libesedb_table_get_number_of_columns(
+	          table,
+	          &number_of_columns,
+	          0,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyesedb_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve number of columns.",
+		 function );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	/* Determine the names and types of all the columns once, since the names
+	 * are needed to look up columns by name and to create the dictionary keys
+	 */
+	column_names_object = PyTuple_New(
+	                       (Py_ssize_t) number_of_columns );
+
+	if( column_names_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create column names.",
+		 function );
+
+		goto on_error;
+	}
+	if( number_of_columns > 0 )
+	{
+		column_types = (uint32_t *) PyMem_Malloc(
+		                             sizeof( uint32_t ) * number_of_columns );
+
+		if( column_types == NULL )
+		{
+			PyErr_Format(
+			 PyExc_MemoryError,
+			 "%s: unable to create column types.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	for( column_entry = 0;
+	     column_entry < number_of_columns;
+	     column_entry++ )
+	{
+		column_name_object = pyesedb_rows_get_column_name(
+		                      table,
+		                      column_entry,
+		                      &( column_types[ column_entry ] ) );
+
+		if( column_name_object == NULL )
+		{
+			goto on_error;
+		}
+		/* PyTuple_SetItem steals the reference to the column name object
+		 */
+		if( PyTuple_SetItem(
+		     column_names_object,
+		     (Py_ssize_t) column_entry,
+		     column_name_object ) != 0 )
+		{
+			goto on_error;
+		}
+	}
+	if( ( columns_object == NULL )
+	 || ( columns_object == Py_None ) )
+	{
+		pyesedb_rows->number_of_values = number_of_columns;
+	}
+	else
+	{
+		fast_columns_object = PySequence_Fast(
+		                       columns_object,
+		                       "columns must be a sequence of column indexes or names" );
+
+		if( fast_columns_object == NULL )
+		{
+			goto on_error;
+		}
+		if( PySequence_Fast_GET_SIZE( fast_columns_object ) > (Py_ssize_t) INT_MAX )
+		{
+			PyErr_Format(
+			 PyExc_ValueError,
+			 "%s: invalid number of columns value exceeds maximum.",
+			 function );
+
+			goto on_error;
+		}
+		pyesedb_rows->number_of_values = (int) PySequence_Fast_GET_SIZE(
+		                                        fast_columns_object );
+	}
+	if( pyesedb_rows->number_of_values > 0 )
+	{
+		pyesedb_rows->value_entries = (int *) PyMem_Malloc(
+		                                       sizeof( int ) * pyesedb_rows->number_of_values );
+
+		if( pyesedb_rows->value_entries == NULL )
+		{
+			PyErr_Format(
+			 PyExc_MemoryError,
+			 "%s: unable to create value entries.",
+			 function );
+
+			goto on_error;
+		}
+		pyesedb_rows->values = (pyesedb_row_value_t *) PyMem_Malloc(
+		                                                sizeof( pyesedb_row_value_t ) * pyesedb_rows->number_of_values );
+
+		if( pyesedb_rows->values == NULL )
+		{
+			PyErr_Format(
+			 PyExc_MemoryError,
+			 "%s: unable to create values.",
+			 function );
+
+			goto on_error;
+		}
+		if( memory_set(
+		     pyesedb_rows->values,
+		     0,
+		     sizeof( pyesedb_row_value_t ) * pyesedb_rows->number_of_values ) == NULL )
+		{
+			PyErr_Format(
+			 PyExc_MemoryError,
+			 "%s: unable to clear values.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	for( value_index = 0;
+	     value_index < pyesedb_rows->number_of_values;
+	     value_index++ )
+	{
+		if( fast_columns_object == NULL )
+		{
+			column_entry = value_index;
+		}
+		else
+		{
+			item_object = PySequence_Fast_GET_ITEM(
+			               fast_columns_object,
+			               (Py_ssize_t) value_index );
+
+#if PY_MAJOR_VERSION >= 3
+			if( PyLong_Check(
+			     item_object ) )
+#else
+			if( PyLong_Check(
+			     item_object )
+			 || PyInt_Check(
+			     item_object ) )
+#endif
+			{
+#if PY_MAJOR_VERSION >= 3
+				column_index = PyLong_AsLong(
+				                item_object );
+#else
+				column_index = PyInt_AsLong(
+				                item_object );
+#endif
+				if( ( column_index == -1 )
+				 && ( PyErr_Occurred() != NULL ) )
+				{
+					goto on_error;
+				}
+				if( ( column_index < 0 )
+				 || ( column_index >= (long) number_of_columns ) )
+				{
+					PyErr_Format(
+					 PyExc_ValueError,
+					 "%s: invalid column index: %ld value out of bounds.",
+					 function,
+					 column_index );
+
+					goto on_error;
+				}
+				column_entry = (int) column_index;
+			}
+#if PY_MAJOR_VERSION >= 3
+			else if( PyUnicode_Check(
+			          item_object ) )
+#else
+			else if( PyUnicode_Check(
+			          item_object )
+			      || PyString_Check(
+			          item_object ) )
+#endif
+			{
+				result = 0;
+
+				for( column_entry = 0;
+				     column_entry < number_of_columns;
+				     column_entry++ )
+				{
+					result = PyObject_RichCompareBool(
+					          PyTuple_GET_ITEM(
+					           column_names_object,
+					           (Py_ssize_t) column_entry ),
+					          item_object,
+					          Py_EQ );
+
+					if( result != 0 )
+					{
+						break;
+					}
+				}
+				if( result == -1 )
+				{
+					goto on_error;
+				}
+				else if( result == 0 )
+				{
+					PyErr_Format(
+					 PyExc_ValueError,
+					 "%s: no such column: %d.",
+					 function,
+					 value_index );
+
+					goto on_error;
+				}
+			}
+			else
+			{
+				PyErr_Format(
+				 PyExc_TypeError,
+				 "%s: unsupported column: %d type, expected column index or name.",
+				 function,
+				 value_index );
+
+				goto on_error;
+			}
+		}
+		pyesedb_rows->value_entries[ value_index ]       = column_entry;
+		pyesedb_rows->values[ value_index ].column_type = column_types[ column_entry ];
+	}
+	if( as_dict != 0 )
+	{
+		pyesedb_rows->column_names = PyTuple_New(
+		                              (Py_ssize_t) pyesedb_rows->number_of_values );
+
+		if( pyesedb_rows->column_names == NULL )
+		{
+			PyErr_Format(
+			 PyExc_MemoryError,
+			 "%s: unable to create column names.",
+			 function );
+
+			goto on_error;
+		}
+		for( value_index = 0;
+		     value_index < pyesedb_rows->number_of_values;
+		     value_index++ )
+		{
+			column_name_object = PyTuple_GET_ITEM(
+			                      column_names_object,
+			                      (Py_ssize_t) pyesedb_rows->value_entries[ value_index ] );
+
+			Py_IncRef(
+			 column_name_object );
+
+			PyTuple_SET_ITEM(
+			 pyesedb_rows->column_names,
+			 (Py_ssize_t) value_index,
+			 column_name_object );
+		}
+	}
+	if( fast_columns_object != NULL )
+	{
+		Py_DecRef(
+		 fast_columns_object );
+	}
+	if( column_types != NULL )
+	{
+		PyMem_Free(
+		 column_types );
+	}
+	Py_DecRef(
+	 column_names_object );
+
+	return( (PyObject *) pyesedb_rows );
+
+on_error:
+	if( fast_columns_object != NULL )
+	{
+		Py_DecRef(
+		 fast_columns_object );
+	}
+	if( column_types != NULL )
+	{
+		PyMem_Free(
+		 column_types );
+	}
+	if( column_names_object != NULL )
+	{
+		Py_DecRef(
+		 column_names_object );
+	}
+	if( pyesedb_rows != NULL )
+	{
+		Py_DecRef(
+		 (PyObject *) pyesedb_rows );
+	}
+	return( NULL );
+}
+
+/* Retrieves the name and type of a specific column
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyesedb_rows_get_column_name(
+           libesedb_table_t *table,
+           int column_entry,
+           uint32_t *column_type )
+{
+	libcerror_error_t *error  = NULL;
+	libesedb_column_t *column = NULL;
+	PyObject *string_object   = NULL;
+	const char *errors        = NULL;
+	uint8_t *name             = NULL;
+	static char *function     = "pyesedb_rows_get_column_name";
+	size_t name_size          = 0;
+	int result                = 0;
+
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libesedb_table_get_column(
+	          table,
+	          column_entry,
+	          &column,
+	          0,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyesedb_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve column: %d.",
+		 function,
+		 column_entry );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libesedb_column_get_type(
+	          column,
+	          column_type,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyesedb_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve column: %d type.",
+		 function,
+		 column_entry );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libesedb_column_get_utf8_name_size(
+	          column,
+	          &name_size,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( ( result != 1 )
+	 || ( name_size == 0 ) )
+	{
+		pyesedb_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve column: %d name size.",
+		 function,
+		 column_entry );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	name = (uint8_t *) PyMem_Malloc(
+	                    sizeof( uint8_t ) * name_size );
+
+	if( name == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create column: %d name.",
+		 function,
+		 column_entry );
+
+		goto on_error;
+	}
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libesedb_column_get_utf8_name(
+	          column,
+	          name,
+	          name_size,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyesedb_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve column: %d name.",
+		 function,
+		 column_entry );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	/* Pass the string length to PyUnicode_DecodeUTF8
+	 * otherwise it makes the end of string character is part
+	 * of the string
+	 */
+	string_object = PyUnicode_DecodeUTF8(
+	                 (char *) name,
+	                 (Py_ssize_t) name_size - 1,
+	                 errors );
+
+	PyMem_Free(
+	 name );
+
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libesedb_column_free(
+	          &column,
+	          &error );
+
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyesedb_error_raise(
+		 error,
+		 PyExc_MemoryError,
+		 "%s: unable to free column: %d.",
+		 function,
+		 column_entry );
+
+		libcerror_error_free(
+		 &error );
+
+		if( string_object != NULL )
+		{
+			Py_DecRef(
+			 string_object );
+		}
+		return( NULL );
+	}
+	return( string_object );
+
+on_error:
+	if( name != NULL )
+	{
+		PyMem_Free(
+		 name );
+	}
+	if( column != NULL )
+	{
+		Py_BEGIN_ALLOW_THREADS
+
+		libesedb_column_free(
+		 &column,
+		 NULL );
+
+		Py_END_ALLOW_THREADS
+	}
+	return( NULL );
+}
+
+/* Initializes a rows iterator object
+ * Returns 0 if successful or -1 on error
+ */
+int pyesedb_rows_init(
+     pyesedb_rows_t *pyesedb_rows )
+{
+	static char *function = "pyesedb_rows_init";
+
+	if( pyesedb_rows == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid rows.",
+		 function );
+
+		return( -1 );
+	}
+	/* Make sure the rows values are initialized
+	 */
+	pyesedb_rows->parent_object     = NULL;
+	pyesedb_rows->table             = NULL;
+	pyesedb_rows->value_entries     = NULL;
+	pyesedb_rows->values            = NULL;
+	pyesedb_rows->number_of_values  = 0;
+	pyesedb_rows->column_names      = NULL;
+	pyesedb_rows->batch_size        = 0;
+	pyesedb_rows->current_index     = 0;
+	pyesedb_rows->number_of_records = 0;
+	pyesedb_rows->is_busy           = 0;
+
+	PyErr_Format(
+	 PyExc_NotImplementedError,
+	 "%s: initialize of rows not supported.",
+	 function );
+
+	return( -1 );
+}
+
+/* Frees a rows iterator object
+ */
+void pyesedb_rows_free(
+      pyesedb_rows_t *pyesedb_rows )
+{
+	struct _typeobject *ob_type = NULL;
+	static char *function       = "pyesedb_rows_free";
+
+	if( pyesedb_rows == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid rows.",
+		 function );
+
+		return;
+	}
+	ob_type = Py_TYPE(
+	           pyesedb_rows );
+
+	if( ob_type == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: missing ob_type.",
+		 function );
+
+		return;
+	}
+	if( ob_type->tp_free == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid ob_type - missing tp_free.",
+		 function );
+
+		return;
+	}
+	if( pyesedb_rows->values != NULL )
+	{
+		pyesedb_rows_clear_values(
+		 pyesedb_rows );
+
+		PyMem_Free(
+		 pyesedb_rows->values );
+	}
+	if( pyesedb_rows->value_entries != NULL )
+	{
+		PyMem_Free(
+		 pyesedb_rows->value_entries );
+	}
+	if( pyesedb_rows->column_names != NULL )
+	{
+		Py_DecRef(
+		 pyesedb_rows->column_names );
+	}
+	if( pyesedb_rows->parent_object != NULL )
+	{
+		Py_DecRef(
+		 pyesedb_rows->parent_object );
+	}
+	ob_type->tp_free(
+	 (PyObject*) pyesedb_rows );
+}
+
+/* Reads the values of a row from a record
+ * This function does not use the Python API so that it can be called
+ * without holding the GIL
+ * Returns 1 if successful or -1 on error
+ */
+int pyesedb_rows_read_values(
+     pyesedb_rows_t *pyesedb_rows,
+     libesedb_record_t *record,
+     libcerror_error_t **error )
+{
+	libesedb_long_value_t *long_value = NULL;
+	pyesedb_row_value_t *row_value    = NULL;
+	static char *function             = "pyesedb_rows_read_values";
+	size_t data_size                  = 0;
+	double value_double               = 0.0;
+	float value_float                 = 0.0;
+	uint32_t value_32bit              = 0;
+	uint16_t value_16bit              = 0;
+	uint8_t value_8bit                = 0;
+	uint8_t value_data_flags          = 0;
+	int result                        = 0;
+	int value_entry                   = 0;
+	int value_index                   = 0;
+
+	if( pyesedb_rows == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid rows.",
+		 function );
+
+		return( -1 );
+	}
+	for( value_index = 0;
+	     value_index < pyesedb_rows->number_of_values;
+	     value_index++ )
+	{
+		row_value   = &( pyesedb_rows->values[ value_index ] );
+		value_entry = pyesedb_rows->value_entries[ value_index ];
+
+		row_value->is_set               = 0;
+		row_value->is_string            = 0;
+		row_value->is_binary_data       = 0;
+		row_value->value_64bit          = 0;
+		row_value->value_floating_point = 0.0;
+
+		if( libesedb_record_get_value_data_flags(
+		     record,
+		     value_entry,
+		     &value_data_flags,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value: %d data flags.",
+			 function,
+			 value_entry );
+
+			goto on_error;
+		}
+		if( ( value_data_flags & LIBESEDB_VALUE_FLAG_LONG_VALUE ) != 0 )
+		{
+			result = libesedb_record_get_long_value(
+			          record,
+			          value_entry,
+			          &long_value,
+			          error );
+
+			if( result == 1 )
+			{
+				if( ( row_value->column_type == LIBESEDB_COLUMN_TYPE_TEXT )
+				 || ( row_value->column_type == LIBESEDB_COLUMN_TYPE_LARGE_TEXT ) )
+				{
+					row_value->is_string = 1;
+
+					result = libesedb_long_value_get_utf8_string_size(
+					          long_value,
+					          &data_size,
+					          error );
+				}
+				else
+				{
+					row_value->is_binary_data = 1;
+
+					result = libesedb_long_value_get_data_size(
+					          long_value,
+					          &data_size,
+					          error );
+				}
+			}
+			if( ( result == 1 )
+			 && ( data_size > 0 ) )
+			{
+				row_value->data = (uint8_t *) memory_allocate(
+				                               sizeof( uint8_t ) * data_size );
+
+				if( row_value->data == NULL )
+				{
+					libcerror_error_set(
+					 error,
+					 LIBCERROR_ERROR_DOMAIN_MEMORY,
+					 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+					 "%s: unable to create value: %d data.",
+					 function,
+					 value_entry );
+
+					goto on_error;
+				}
+				row_value->data_size = data_size;
+
+				if( row_value->is_string != 0 )
+				{
+					result = libesedb_long_value_get_utf8_string(
+					          long_value,
+					          row_value->data,
+					          row_value->data_size,
+					          error );
+				}
+				else
+				{
+					result = libesedb_long_value_get_data(
+					          long_value,
+					          row_value->data,
+					          row_value->data_size,
+					          error );
+				}
+			}
+			if( long_value != NULL )
+			{
+				if( libesedb_long_value_free(
+				     &long_value,
+				     error ) != 1 )
+				{
+					result = -1;
+				}
+			}
+			if( result == -1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve long value: %d.",
+				 function,
+				 value_entry );
+
+				goto on_error;
+			}
+			row_value->is_set = (uint8_t) ( ( result == 1 ) && ( data_size > 0 ) );
+
+			continue;
+		}
+		if( ( value_data_flags & LIBESEDB_VALUE_FLAG_MULTI_VALUE ) != 0 )
+		{
+			/* Multi values are returned as their binary data
+			 */
+			row_value->is_binary_data = 1;
+		}
+		else switch( row_value->column_type )
+		{
+			case LIBESEDB_COLUMN_TYPE_BOOLEAN:
+				result = libesedb_record_get_value_boolean(
+				          record,
+				          value_entry,
+				          &value_8bit,
+				          error );
+
+				row_value->value_64bit = value_8bit;
+
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_INTEGER_8BIT_UNSIGNED:
+				result = libesedb_record_get_value_8bit(
+				          record,
+				          value_entry,
+				          &value_8bit,
+				          error );
+
+				row_value->value_64bit = value_8bit;
+
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_SIGNED:
+			case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_UNSIGNED:
+				result = libesedb_record_get_value_16bit(
+				          record,
+				          value_entry,
+				          &value_16bit,
+				          error );
+
+				row_value->value_64bit = value_16bit;
+
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED:
+			case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED:
+				result = libesedb_record_get_value_32bit(
+				          record,
+				          value_entry,
+				          &value_32bit,
+				          error );
+
+				row_value->value_64bit = value_32bit;
+
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_CURRENCY:
+			case LIBESEDB_COLUMN_TYPE_DATE_TIME:
+			case LIBESEDB_COLUMN_TYPE_INTEGER_64BIT_SIGNED:
+				result = libesedb_record_get_value_64bit(
+				          record,
+				          value_entry,
+				          &( row_value->value_64bit ),
+				          error );
+
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_FLOAT_32BIT:
+				result = libesedb_record_get_value_floating_point_32bit(
+				          record,
+				          value_entry,
+				          &value_float,
+				          error );
+
+				row_value->value_floating_point = (double) value_float;
+
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_DOUBLE_64BIT:
+				result = libesedb_record_get_value_floating_point_64bit(
+				          record,
+				          value_entry,
+				          &value_double,
+				          error );
+
+				row_value->value_floating_point = value_double;
+
+				break;
+
+			case LIBESEDB_COLUMN_TYPE_TEXT:
+			case LIBESEDB_COLUMN_TYPE_LARGE_TEXT:
+				row_value->is_string = 1;
+
+				break;
+
+			default:
+				row_value->is_binary_data = 1;
+
+				break;
+		}
+		if( row_value->is_string != 0 )
+		{
+			result = libesedb_record_get_value_utf8_string_size(
+			          record,
+			          value_entry,
+			          &data_size,
+			          error );
+		}
+		else if( row_value->is_binary_data != 0 )
+		{
+			result = libesedb_record_get_value_data_size(
+			          record,
+			          value_entry,
+			          &data_size,
+			          error );
+		}
+		if( result == -1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+			 "%s: unable to retrieve value: %d.",
+			 function,
+			 value_entry );
+
+			goto on_error;
+		}
+		else if( result == 0 )
+		{
+			continue;
+		}
+		if( ( row_value->is_string != 0 )
+		 || ( row_value->is_binary_data != 0 ) )
+		{
+			if( data_size == 0 )
+			{
+				continue;
+			}
+			row_value->data = (uint8_t *) memory_allocate(
+			                               sizeof( uint8_t ) * data_size );
+
+			if( row_value->data == NULL )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_MEMORY,
+				 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+				 "%s: unable to create value: %d data.",
+				 function,
+				 value_entry );
+
+				goto on_error;
+			}
+			row_value->data_size = data_size;
+
+			if( row_value->is_string != 0 )
+			{
+				result = libesedb_record_get_value_utf8_string(
+				          record,
+				          value_entry,
+				          row_value->data,
+				          row_value->data_size,
+				          error );
+			}
+			else
+			{
+				result = libesedb_record_get_value_data(
+				          record,
+				          value_entry,
+				          row_value->data,
+				          row_value->data_size,
+				          error );
+			}
+			if( result != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_GET_FAILED,
+				 "%s: unable to retrieve value: %d data.",
+				 function,
+				 value_entry );
+
+				goto on_error;
+			}
+		}
+		row_value->is_set = 1;
+	}
+	return( 1 );
+
+on_error:
+	if( long_value != NULL )
+	{
+		libesedb_long_value_free(
+		 &long_value,
+		 NULL );
+	}
+	pyesedb_rows_clear_values(
+	 pyesedb_rows );
+
+	return( -1 );
+}
+
+/* Clears the values of a row
+ * This function does not use the Python API so that it can be called
+ * without holding the GIL
+ */
+void pyesedb_rows_clear_values(
+      pyesedb_rows_t *pyesedb_rows )
+{
+	int value_index = 0;
+
+	if( pyesedb_rows == NULL )
+	{
+		return;
+	}
+	for( value_index = 0;
+	     value_index < pyesedb_rows->number_of_values;
+	     value_index++ )
+	{
+		if( pyesedb_rows->values[ value_index ].data != NULL )
+		{
+			memory_free(
+			 pyesedb_rows->values[ value_index ].data );
+
+			pyesedb_rows->values[ value_index ].data = NULL;
+		}
+		pyesedb_rows->values[ value_index ].data_size = 0;
+		pyesedb_rows->values[ value_index ].is_set    = 0;
+	}
+}
+
+/* Converts a value of a row into a Python object
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyesedb_rows_get_value_object(
+           pyesedb_row_value_t *row_value )
+{
+	PyObject *value_object = NULL;
+	const char *errors     = NULL;
+	static char *function  = "pyesedb_rows_get_value_object";
+
+	if( row_value == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid row value.",
+		 function );
+
+		return( NULL );
+	}
+	if( row_value->is_set == 0 )
+	{
+		Py_IncRef(
+		 Py_None );
+
+		return( Py_None );
+	}
+	if( row_value->is_string != 0 )
+	{
+		/* Pass the string length to PyUnicode_DecodeUTF8
+		 * otherwise it makes the end of string character is part
+		 * of the string
+		 */
+		value_object = PyUnicode_DecodeUTF8(
+		                (char *) row_value->data,
+		                (Py_ssize_t) row_value->data_size - 1,
+		                errors );
+
+		return( value_object );
+	}
+	if( row_value->is_binary_data != 0 )
+	{
+#if PY_MAJOR_VERSION >= 3
+		value_object = PyBytes_FromStringAndSize(
+		                (char *) row_value->data,
+		                (Py_ssize_t) row_value->data_size );
+#else
+		value_object = PyString_FromStringAndSize(
+		                (char *) row_value->data,
+		                (Py_ssize_t) row_value->data_size );
+#endif
+		return( value_object );
+	}
+	switch( row_value->column_type )
+	{
+		case LIBESEDB_COLUMN_TYPE_BOOLEAN:
+			if( row_value->value_64bit != 0 )
+			{
+				value_object = Py_True;
+			}
+			else
+			{
+				value_object = Py_False;
+			}
+			Py_IncRef(
+			 value_object );
+
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_16BIT_SIGNED:
+			value_object = pyesedb_integer_signed_new_from_64bit(
+			                (int64_t) (int16_t) row_value->value_64bit );
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_SIGNED:
+			value_object = pyesedb_integer_signed_new_from_64bit(
+			                (int64_t) (int32_t) row_value->value_64bit );
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_INTEGER_64BIT_SIGNED:
+			value_object = pyesedb_integer_signed_new_from_64bit(
+			                (int64_t) row_value->value_64bit );
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_DATE_TIME:
+			value_object = pyesedb_datetime_new_from_floatingtime(
+			                row_value->value_64bit );
+			break;
+
+		case LIBESEDB_COLUMN_TYPE_FLOAT_32BIT:
+		case LIBESEDB_COLUMN_TYPE_DOUBLE_64BIT:
+			value_object = PyFloat_FromDouble(
+			                row_value->value_floating_point );
+			break;
+
+		default:
+			value_object = pyesedb_integer_unsigned_new_from_64bit(
+			                row_value->value_64bit );
+			break;
+	}
+	return( value_object );
+}
+
+/* Retrieves a specific row by index
+ * The values of the record are read without holding the GIL and are
+ * converted into Python objects afterwards
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyesedb_rows_get_row_by_index(
+           pyesedb_rows_t *pyesedb_rows,
+           int record_index )
+{
+	libcerror_error_t *error  = NULL;
+	libesedb_record_t *record = NULL;
+	PyObject *row_object      = NULL;
+	PyObject *value_object    = NULL;
+	static char *function     = "pyesedb_rows_get_row_by_index";
+	int result                = 0;
+	int value_index           = 0;
+
+	if( pyesedb_rows == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid rows.",
+		 function );
+
+		return( NULL );
+	}
+	/* The GIL is released while the values of the row are read, hence another
+	 * thread could use the same rows iterator in the meantime
+	 */
+	if( pyesedb_rows->is_busy != 0 )
+	{
+		PyErr_Format(
+		 PyExc_RuntimeError,
+		 "%s: invalid rows - iterator already in use by another thread.",
+		 function );
+
+		return( NULL );
+	}
+	pyesedb_rows->is_busy = 1;
+
+	Py_BEGIN_ALLOW_THREADS
+
+	result = libesedb_table_get_record(
+	          pyesedb_rows->table,
+	          record_index,
+	          &record,
+	          &error );
+
+	if( result == 1 )
+	{
+		result = pyesedb_rows_read_values(
+		          pyesedb_rows,
+		          record,
+		          &error );
+	}
+	if( record != NULL )
+	{
+		if( libesedb_record_free(
+		     &record,
+		     ( result == 1 ) ? &error : NULL ) != 1 )
+		{
+			result = -1;
+		}
+	}
+	Py_END_ALLOW_THREADS
+
+	if( result != 1 )
+	{
+		pyesedb_error_raise(
+		 error,
+		 PyExc_IOError,
+		 "%s: unable to retrieve record: %d.",
+		 function,
+		 record_index );
+
+		libcerror_error_free(
+		 &error );
+
+		goto on_error;
+	}
+	if( pyesedb_rows->column_names != NULL )
+	{
+		row_object = PyDict_New();
+	}
+	else
+	{
+		row_object = PyTuple_New(
+		              (Py_ssize_t) pyesedb_rows->number_of_values );
+	}
+	if( row_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create row: %d.",
+		 function,
+		 record_index );
+
+		goto on_error;
+	}
+	for( value_index = 0;
+	     value_index < pyesedb_rows->number_of_values;
+	     value_index++ )
+	{
+		value_object = pyesedb_rows_get_value_object(
+		                &( pyesedb_rows->values[ value_index ] ) );
+
+		if( value_object == NULL )
+		{
+			goto on_error;
+		}
+		if( pyesedb_rows->column_names != NULL )
+		{
+			result = PyDict_SetItem(
+			          row_object,
+			          PyTuple_GET_ITEM(
+			           pyesedb_rows->column_names,
+			           (Py_ssize_t) value_index ),
+			          value_object );
+
+			Py_DecRef(
+			 value_object );
+
+			if( result != 0 )
+			{
+				goto on_error;
+			}
+		}
+		else
+		{
+			/* PyTuple_SET_ITEM steals the reference to the value object
+			 */
+			PyTuple_SET_ITEM(
+			 row_object,
+			 (Py_ssize_t) value_index,
+			 value_object );
+		}
+	}
+	pyesedb_rows_clear_values(
+	 pyesedb_rows );
+
+	pyesedb_rows->is_busy = 0;
+
+	return( row_object );
+
+on_error:
+	if( row_object != NULL )
+	{
+		Py_DecRef(
+		 row_object );
+	}
+	pyesedb_rows_clear_values(
+	 pyesedb_rows );
+
+	pyesedb_rows->is_busy = 0;
+
+	return( NULL );
+}
+
+/* The rows iter() function
+ */
+PyObject *pyesedb_rows_iter(
+           pyesedb_rows_t *pyesedb_rows )
+{
+	static char *function = "pyesedb_rows_iter";
+
+	if( pyesedb_rows == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid rows.",
+		 function );
+
+		return( NULL );
+	}
+	Py_IncRef(
+	 (PyObject *) pyesedb_rows );
+
+	return( (PyObject *) pyesedb_rows );
+}
+
+/* The rows iternext() function
+ * Returns a row or a list of rows if a batch size was set
+ */
+PyObject *pyesedb_rows_iternext(
+           pyesedb_rows_t *pyesedb_rows )
+{
+	PyObject *batch_object = NULL;
+	PyObject *row_object   = NULL;
+	static char *function  = "pyesedb_rows_iternext";
+	int number_of_rows     = 0;
+	int row_index          = 0;
+
+	if( pyesedb_rows == NULL )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid rows.",
+		 function );
+
+		return( NULL );
+	}
+	if( pyesedb_rows->current_index < 0 )
+	{
+		PyErr_Format(
+		 PyExc_ValueError,
+		 "%s: invalid rows - invalid current index.",
+		 function );
+
+		return( NULL );
+	}
+	if( pyesedb_rows->current_index >= pyesedb_rows->number_of_records )
+	{
+		PyErr_SetNone(
+		 PyExc_StopIteration );
+
+		return( NULL );
+	}
+	if( pyesedb_rows->batch_size == 0 )
+	{
+		row_object = pyesedb_rows_get_row_by_index(
+		              pyesedb_rows,
+		              pyesedb_rows->current_index );
+
+		if( row_object != NULL )
+		{
+			pyesedb_rows->current_index++;
+		}
+		return( row_object );
+	}
+	number_of_rows = pyesedb_rows->number_of_records - pyesedb_rows->current_index;
+
+	if( number_of_rows > pyesedb_rows->batch_size )
+	{
+		number_of_rows = pyesedb_rows->batch_size;
+	}
+	batch_object = PyList_New(
+	                (Py_ssize_t) number_of_rows );
+
+	if( batch_object == NULL )
+	{
+		PyErr_Format(
+		 PyExc_MemoryError,
+		 "%s: unable to create batch.",
+		 function );
+
+		return( NULL );
+	}
+	for( row_index = 0;
+	     row_index < number_of_rows;
+	     row_index++ )
+	{
+		row_object = pyesedb_rows_get_row_by_index(
+		              pyesedb_rows,
+		              pyesedb_rows->current_index );
+
+		if( row_object == NULL )
+		{
+			Py_DecRef(
+			 batch_object );
+
+			return( NULL );
+		}
+		/* PyList_SET_ITEM steals the reference to the row object
+		 */
+		PyList_SET_ITEM(
+		 batch_object,
+		 (Py_ssize_t) row_index,
+		 row_object );
+
+		pyesedb_rows->current_index++;
+	}
+	return( batch_object );
+}
+
@@ -0,0 +1,171 @@
+/*
+ * Python object definition of the iterator object of rows
+ *
+ * Copyright (C) 2009-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#if !defined( _PYESEDB_ROWS_H )
+#define _PYESEDB_ROWS_H
+
+#include <common.h>
+#include <types.h>
+
+#include "pyesedb_libcerror.h"
+#include "pyesedb_libesedb.h"
+#include "pyesedb_python.h"
+
+#if defined( __cplusplus )
+extern "C" {
+#endif
+
+typedef struct pyesedb_row_value pyesedb_row_value_t;
+
+/* The value of a row as read from a record
+ */
+struct pyesedb_row_value
+{
+	/* The column type
+	 */
+	uint32_t column_type;
+
+	/* Value to indicate the value is set
+	 */
+	uint8_t is_set;
+
+	/* Value to indicate the data contains an UTF-8 string
+	 */
+	uint8_t is_string;
+
+	/* Value to indicate the data contains binary data
+	 */
+	uint8_t is_binary_data;
+
+	/* The integer, boolean or date and time value
+	 */
+	uint64_t value_64bit;
+
+	/* The floating point value
+	 */
+	double value_floating_point;
+
+	/* The binary data or UTF-8 string
+	 */
+	uint8_t *data;
+
+	/* The binary data or UTF-8 string size
+	 */
+	size_t data_size;
+};
+
+typedef struct pyesedb_rows pyesedb_rows_t;
+
+struct pyesedb_rows
+{
+	/* Python object initialization
+	 */
+	PyObject_HEAD
+
+	/* The parent (table) object
+	 */
+	PyObject *parent_object;
+
+	/* The libesedb table
+	 */
+	libesedb_table_t *table;
+
+	/* The value entries of the columns of a row
+	 */
+	int *value_entries;
+
+	/* The values of a row
+	 */
+	pyesedb_row_value_t *values;
+
+	/* The number of values of a row
+	 */
+	int number_of_values;
+
+	/* The names of the columns of a row or NULL if not returned as a dictionary
+	 */
+	PyObject *column_names;
+
+	/* The number of rows per batch or 0 if no batches are returned
+	 */
+	int batch_size;
+
+	/* The current index
+	 */
+	int current_index;
+
+	/* The number of records
+	 */
+	int number_of_records;
+
+	/* Value to indicate a row is being read, the values of a row are
+	 * read without holding the GIL and cannot be shared by another thread
+	 */
+	uint8_t is_busy;
+};
+
+extern PyTypeObject pyesedb_rows_type_object;
+
+PyObject *pyesedb_rows_new(
+           PyObject *parent_object,
+           libesedb_table_t *table,
+           PyObject *columns_object,
+           int as_dict,
+           int batch_size );
+
+PyObject *pyesedb_rows_get_column_name(
+           libesedb_table_t *table,
+           int column_entry,
+           uint32_t *column_type );
+
+int pyesedb_rows_init(
+     pyesedb_rows_t *pyesedb_rows );
+
+void pyesedb_rows_free(
+      pyesedb_rows_t *pyesedb_rows );
+
+int pyesedb_rows_read_values(
+     pyesedb_rows_t *pyesedb_rows,
+     libesedb_record_t *record,
+     libcerror_error_t **error );
+
+void pyesedb_rows_clear_values(
+      pyesedb_rows_t *pyesedb_rows );
+
+PyObject *pyesedb_rows_get_value_object(
+           pyesedb_row_value_t *row_value );
+
+PyObject *pyesedb_rows_get_row_by_index(
+           pyesedb_rows_t *pyesedb_rows,
+           int record_index );
+
+PyObject *pyesedb_rows_iter(
+           pyesedb_rows_t *pyesedb_rows );
+
+PyObject *pyesedb_rows_iternext(
+           pyesedb_rows_t *pyesedb_rows );
+
+#if defined( __cplusplus )
+}
+#endif
+
+#endif /* !defined( _PYESEDB_ROWS_H ) */
+
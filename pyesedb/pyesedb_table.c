@@ -27,6 +27,7 @@
 #endif
 
 #include "pyesedb_column.h"
+#include "pyesedb_column_arrays.h"
 #include "pyesedb_columns.h"
 #include "pyesedb_error.h"
 #include "pyesedb_file.h"
@@ -36,6 +37,7 @@
 #include "pyesedb_python.h"
 #include "pyesedb_record.h"
 #include "pyesedb_records.h"
+#include "pyesedb_rows.h"
 #include "pyesedb_table.h"
 #include "pyesedb_unused.h"
 
@@ -96,6 +98,37 @@ PyMethodDef pyesedb_table_object_methods[] = {
 	  "\n"
 	  "Retrieves a specific record" },
 
+	{ "iter_rows",
+	  (PyCFunction) pyesedb_table_iter_rows,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "iter_rows(columns=None, as_dict=False, batch_size=0) -> Object\n"
+	  "\n"
+	  "Retrieves an iterator of the rows of the table. A row contains the\n"
+	  "values of the columns, specified by index or name, as a tuple or,\n"
+	  "if as_dict is set, as a dictionary keyed by column name. If batch_size\n"
+	  "is set the iterator returns lists of up to batch_size rows." },
+
+	{ "to_numpy",
+	  (PyCFunction) pyesedb_table_to_numpy,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "to_numpy(columns=None) -> Dictionary\n"
+	  "\n"
+	  "Reads the values of the columns, specified by index or name, of all\n"
+	  "the records into NumPy arrays keyed by column name. Fixed-size values\n"
+	  "are returned as typed arrays, that are masked if values are not set,\n"
+	  "date and time values as datetime64[us] and other values as object\n"
+	  "arrays. The column names must be unique. Requires NumPy." },
+
+	{ "to_arrow",
+	  (PyCFunction) pyesedb_table_to_arrow,
+	  METH_VARARGS | METH_KEYWORDS,
+	  "to_arrow(columns=None) -> Object\n"
+	  "\n"
+	  "Reads the values of the columns, specified by index or name, of all\n"
+	  "the records into an Arrow table. Columns that contain both fixed-size\n"
+	  "values and long or multi values are not supported. Requires NumPy and\n"
+	  "pyarrow." },
+
 	/* Sentinel */
 	{ NULL, NULL, 0, NULL }
 };
@@ -798,9 +831,13 @@ PyObject *pyesedb_table_get_column_by_index(
 on_error:
 	if( column != NULL )
 	{
+		Py_BEGIN_ALLOW_THREADS
+
 		libesedb_column_free(
 		 &column,
 		 NULL );
+
+		Py_END_ALLOW_THREADS
 	}
 	return( NULL );
 }
@@ -1017,9 +1054,13 @@ PyObject *pyesedb_table_get_record_by_index(
 on_error:
 	if( record != NULL )
 	{
+		Py_BEGIN_ALLOW_THREADS
+
 		libesedb_record_free(
 		 &record,
 		 NULL );
+
+		Py_END_ALLOW_THREADS
 	}
 	return( NULL );
 }
@@ -1115,3 +1156,130 @@ PyObject *pyesedb_table_get_records(
 	return( records_object );
 }
 
+/* Retrieves a rows iterator object for the rows
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyesedb_table_iter_rows(
+           pyesedb_table_t *pyesedb_table,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	PyObject *as_dict_object    = NULL;
+	PyObject *columns_object    = NULL;
+	static char *function       = "pyesedb_table_iter_rows";
+	static char *keyword_list[] = { "columns", "as_dict", "batch_size", NULL };
+	int as_dict                 = 0;
+	int batch_size              = 0;
+
+	if( pyesedb_table == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid table.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "|OOi",
+	     keyword_list,
+	     &columns_object,
+	     &as_dict_object,
+	     &batch_size ) == 0 )
+	{
+		return( NULL );
+	}
+	if( as_dict_object != NULL )
+	{
+		as_dict = PyObject_IsTrue(
+		           as_dict_object );
+
+		if( as_dict == -1 )
+		{
+			return( NULL );
+		}
+	}
+	return( pyesedb_rows_new(
+	         (PyObject *) pyesedb_table,
+	         pyesedb_table->table,
+	         columns_object,
+	         as_dict,
+	         batch_size ) );
+}
+
+/* Reads the values of the columns into NumPy arrays
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyesedb_table_to_numpy(
+           pyesedb_table_t *pyesedb_table,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	PyObject *columns_object    = NULL;
+	static char *function       = "pyesedb_table_to_numpy";
+	static char *keyword_list[] = { "columns", NULL };
+
+	if( pyesedb_table == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid table.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "|O",
+	     keyword_list,
+	     &columns_object ) == 0 )
+	{
+		return( NULL );
+	}
+	return( pyesedb_column_arrays_read(
+	         (PyObject *) pyesedb_table,
+	         pyesedb_table->table,
+	         columns_object,
+	         0 ) );
+}
+
+/* Reads the values of the columns into an Arrow table
+ * Returns a Python object if successful or NULL on error
+ */
+PyObject *pyesedb_table_to_arrow(
+           pyesedb_table_t *pyesedb_table,
+           PyObject *arguments,
+           PyObject *keywords )
+{
+	PyObject *columns_object    = NULL;
+	static char *function       = "pyesedb_table_to_arrow";
+	static char *keyword_list[] = { "columns", NULL };
+
+	if( pyesedb_table == NULL )
+	{
+		PyErr_Format(
+		 PyExc_TypeError,
+		 "%s: invalid table.",
+		 function );
+
+		return( NULL );
+	}
+	if( PyArg_ParseTupleAndKeywords(
+	     arguments,
+	     keywords,
+	     "|O",
+	     keyword_list,
+	     &columns_object ) == 0 )
+	{
+		return( NULL );
+	}
+	return( pyesedb_column_arrays_read(
+	         (PyObject *) pyesedb_table,
+	         pyesedb_table->table,
+	         columns_object,
+	         1 ) );
+}
+
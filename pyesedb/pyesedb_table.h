@@ -108,6 +108,21 @@ PyObject *pyesedb_table_get_records(
            pyesedb_table_t *pyesedb_table,
            PyObject *arguments );
 
+PyObject *pyesedb_table_iter_rows(
+           pyesedb_table_t *pyesedb_table,
+           PyObject *arguments,
+           PyObject *keywords );
+
+PyObject *pyesedb_table_to_numpy(
+           pyesedb_table_t *pyesedb_table,
+           PyObject *arguments,
+           PyObject *keywords );
+
+PyObject *pyesedb_table_to_arrow(
+           pyesedb_table_t *pyesedb_table,
+           PyObject *arguments,
+           PyObject *keywords );
+
 #if defined( __cplusplus )
 }
 #endif
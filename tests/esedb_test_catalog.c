@@ -20,7 +20,9 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -37,10 +39,197 @@
 #include "esedb_test_unused.h"
 
 #include "../libesedb/libesedb_catalog.h"
+#include "../libesedb/libesedb_catalog_definition.h"
 #include "../libesedb/libesedb_io_handle.h"
+#include "../libesedb/libesedb_metadata_cache.h"
+#include "../libesedb/libesedb_page_cache.h"
+#include "../libesedb/libesedb_table_definition.h"
+
+/* Catalog definition: MSysObjects
+ */
+uint8_t esedb_test_catalog_table_definition_data[ 45 ] = {
+	0x08, 0x80, 0x20, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x02, 0x00, 0x00, 0x00, 0x04, 0x00,
+	0x00, 0x00, 0x50, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xc0, 0x14, 0x00, 0x00, 0x00, 0xff, 0x00,
+	0x0b, 0x00, 0x4d, 0x53, 0x79, 0x73, 0x4f, 0x62, 0x6a, 0x65, 0x63, 0x74, 0x73 };
+
+/* The number of table definitions of which the name hashes are appended,
+ * which exceeds the initial number of name hash buckets
+ */
+#define ESEDB_TEST_CATALOG_NUMBER_OF_NAME_HASHES	70
 
 #if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
 
+/* Writes a catalog page tree with a root page 1 and a leaf page 2 that contains:
+ * the table catalog definition of MSysObjects, a column catalog definition, a defunct
+ * column catalog definition, a second table catalog definition and a truncated column
+ * catalog definition
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_catalog_write_catalog(
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	uint8_t value_data[ 4 + 45 ];
+
+	int number_of_leaf_values[ 1 ] = { 0 };
+	uint8_t page_tag_flags[ 5 ]    = { 0, 0, 0x02, 0, 0 };
+	uint8_t value_types[ 5 ]       = { 0x01, 0x02, 0x02, 0x01, 0x02 };
+	uint16_t value_sizes[ 5 ]      = { 4 + 45, 4 + 45, 4 + 45, 4 + 45, 4 + 12 };
+	static char *function          = "esedb_test_catalog_write_catalog";
+	int value_index                = 0;
+
+	if( esedb_test_write_page_tree(
+	     data,
+	     data_size,
+	     4096,
+	     1,
+	     2,
+	     number_of_leaf_values,
+	     1,
+	     ESEDB_TEST_PAGE_TREE_LEAF_VALUE_TYPE_RECORD,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to write page tree.",
+		 function );
+
+		return( -1 );
+	}
+	/* Page 2 is the leaf page, of which the first page value contains the common key
+	 */
+	for( value_index = 0;
+	     value_index < 5;
+	     value_index++ )
+	{
+		byte_stream_copy_from_uint16_little_endian(
+		 value_data,
+		 2 );
+
+		byte_stream_copy_from_uint16_big_endian(
+		 &( value_data[ 2 ] ),
+		 (uint16_t) value_index );
+
+		if( memory_copy(
+		     &( value_data[ 4 ] ),
+		     esedb_test_catalog_table_definition_data,
+		     45 ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy catalog definition data.",
+			 function );
+
+			return( -1 );
+		}
+		value_data[ 4 + 8 ] = value_types[ value_index ];
+
+		if( esedb_test_append_page_value(
+		     &( data[ 3 * 4096 ] ),
+		     4096,
+		     value_data,
+		     value_sizes[ value_index ],
+		     page_tag_flags[ value_index ],
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append catalog value: %d.",
+			 function,
+			 value_index );
+
+			return( -1 );
+		}
+	}
+	return( 1 );
+}
+
+/* Opens the catalog source data
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_catalog_open_source(
+     libesedb_io_handle_t **io_handle,
+     libesedb_page_cache_t **page_cache,
+     libbfio_handle_t **file_io_handle,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "esedb_test_catalog_open_source";
+
+	if( esedb_test_catalog_write_catalog(
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to write catalog.",
+		 function );
+
+		return( -1 );
+	}
+	if( esedb_test_open_page_tree_source(
+	     io_handle,
+	     page_cache,
+	     file_io_handle,
+	     data,
+	     data_size,
+	     4096,
+	     8,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open page tree source.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Closes the catalog source data
+ * Returns 0 if successful or -1 on error
+ */
+int esedb_test_catalog_close_source(
+     libesedb_io_handle_t **io_handle,
+     libesedb_page_cache_t **page_cache,
+     libbfio_handle_t **file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "esedb_test_catalog_close_source";
+	int result            = 0;
+
+	if( esedb_test_close_page_tree_source(
+	     io_handle,
+	     page_cache,
+	     file_io_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close page tree source.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
 /* Tests the libesedb_catalog_initialize function
  * Returns 1 if successful or 0 if not
  */
@@ -87,7 +276,6 @@ int esedb_test_catalog_initialize(
 	          io_handle,
 	          1,
 	          NULL,
-	          NULL,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -127,7 +315,6 @@ int esedb_test_catalog_initialize(
 	          io_handle,
 	          1,
 	          NULL,
-	          NULL,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -149,7 +336,6 @@ int esedb_test_catalog_initialize(
 	          io_handle,
 	          1,
 	          NULL,
-	          NULL,
 	          &error );
 
 	catalog = NULL;
@@ -182,7 +368,6 @@ int esedb_test_catalog_initialize(
 		          io_handle,
 		          1,
 		          NULL,
-		          NULL,
 		          &error );
 
 		if( esedb_test_malloc_attempts_before_fail != -1 )
@@ -223,50 +408,1834 @@ int esedb_test_catalog_initialize(
 		 */
 		esedb_test_memset_attempts_before_fail = test_number;
 
-		result = libesedb_catalog_initialize(
-		          &catalog,
-		          io_handle,
-		          1,
-		          NULL,
-		          NULL,
-		          &error );
+		result = libesedb_catalog_initialize(
+		          &catalog,
+		          io_handle,
+		          1,
+		          NULL,
+		          &error );
+
+		if( esedb_test_memset_attempts_before_fail != -1 )
+		{
+			esedb_test_memset_attempts_before_fail = -1;
+
+			if( catalog != NULL )
+			{
+				libesedb_catalog_free(
+				 &catalog,
+				 NULL );
+			}
+		}
+		else
+		{
+			ESEDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			ESEDB_TEST_ASSERT_IS_NULL(
+			 "catalog",
+			 catalog );
+
+			ESEDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_ESEDB_TEST_MEMORY ) */
+
+	/* Clean up
+	 */
+	result = libesedb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( catalog != NULL )
+	{
+		libesedb_catalog_free(
+		 &catalog,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libesedb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_catalog_free function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_catalog_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_catalog_free(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Creates a table definition with a specific name for testing
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_catalog_initialize_table_definition(
+     libesedb_table_definition_t **table_definition,
+     const uint8_t *name,
+     size_t name_size,
+     libcerror_error_t **error )
+{
+	libesedb_catalog_definition_t *catalog_definition = NULL;
+	static char *function                             = "esedb_test_catalog_initialize_table_definition";
+
+	if( name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid name.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( name_size == 0 )
+	 || ( name_size > (size_t) MEMORY_MAXIMUM_ALLOCATION_SIZE ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid name size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_catalog_definition_initialize(
+	     &catalog_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create catalog definition.",
+		 function );
+
+		goto on_error;
+	}
+	catalog_definition->type = LIBESEDB_CATALOG_DEFINITION_TYPE_TABLE;
+
+	catalog_definition->name = (uint8_t *) memory_allocate(
+	                                        sizeof( uint8_t ) * name_size );
+
+	if( catalog_definition->name == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create name.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_copy(
+	     catalog_definition->name,
+	     name,
+	     name_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+		 "%s: unable to copy name.",
+		 function );
+
+		goto on_error;
+	}
+	catalog_definition->name_size = name_size;
+
+	if( libesedb_table_definition_initialize(
+	     table_definition,
+	     catalog_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create table definition.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( catalog_definition != NULL )
+	{
+		libesedb_catalog_definition_free(
+		 &catalog_definition,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Tests the libesedb_catalog_append_table_definition_name_hash function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_catalog_append_table_definition_name_hash(
+     void )
+{
+	libesedb_table_definition_t *table_definitions[ ESEDB_TEST_CATALOG_NUMBER_OF_NAME_HASHES ];
+	uint8_t name[ 4 ]                                 = { 'T', '0', '0', 0 };
+	libcerror_error_t *error                          = NULL;
+	libesedb_catalog_t *catalog                       = NULL;
+	libesedb_catalog_definition_t *catalog_definition = NULL;
+	libesedb_io_handle_t *io_handle                   = NULL;
+	size_t name_size                                  = 0;
+	int bucket_index                                  = 0;
+	int entry_index                                   = 0;
+	int result                                        = 0;
+	int table_definition_index                        = 0;
+
+	for( table_definition_index = 0;
+	     table_definition_index < ESEDB_TEST_CATALOG_NUMBER_OF_NAME_HASHES;
+	     table_definition_index++ )
+	{
+		table_definitions[ table_definition_index ] = NULL;
+	}
+	/* Initialize test
+	 */
+	result = libesedb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->format_revision = 0x0000000c;
+	io_handle->page_size       = 4096;
+
+	result = libesedb_catalog_initialize(
+	          &catalog,
+	          io_handle,
+	          1,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "catalog",
+	 catalog );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The last table definition has the same name as table definition 5
+	 */
+	for( table_definition_index = 0;
+	     table_definition_index < ESEDB_TEST_CATALOG_NUMBER_OF_NAME_HASHES;
+	     table_definition_index++ )
+	{
+		if( table_definition_index < ( ESEDB_TEST_CATALOG_NUMBER_OF_NAME_HASHES - 1 ) )
+		{
+			name[ 1 ] = (uint8_t) ( '0' + ( table_definition_index / 10 ) );
+			name[ 2 ] = (uint8_t) ( '0' + ( table_definition_index % 10 ) );
+		}
+		else
+		{
+			name[ 1 ] = (uint8_t) '0';
+			name[ 2 ] = (uint8_t) '5';
+		}
+		result = esedb_test_catalog_initialize_table_definition(
+		          &( table_definitions[ table_definition_index ] ),
+		          name,
+		          4,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test regular cases
+	 */
+	for( table_definition_index = 0;
+	     table_definition_index < ESEDB_TEST_CATALOG_NUMBER_OF_NAME_HASHES;
+	     table_definition_index++ )
+	{
+		result = libesedb_catalog_append_table_definition_name_hash(
+		          catalog,
+		          table_definitions[ table_definition_index ],
+		          table_definition_index,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "catalog->number_of_name_hashes",
+	 catalog->number_of_name_hashes,
+	 ESEDB_TEST_CATALOG_NUMBER_OF_NAME_HASHES );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "catalog->number_of_name_hash_buckets",
+	 catalog->number_of_name_hash_buckets,
+	 128 );
+
+	/* Test that every table definition can be found in the bucket of its name hash
+	 */
+	for( table_definition_index = 0;
+	     table_definition_index < ESEDB_TEST_CATALOG_NUMBER_OF_NAME_HASHES;
+	     table_definition_index++ )
+	{
+		bucket_index = (int) ( catalog->name_hashes[ table_definition_index ] & (uint32_t) ( catalog->number_of_name_hash_buckets - 1 ) );
+		entry_index  = catalog->name_hash_buckets[ bucket_index ];
+
+		while( ( entry_index != -1 )
+		    && ( entry_index != table_definition_index ) )
+		{
+			entry_index = catalog->name_hash_next_indexes[ entry_index ];
+		}
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "entry_index",
+		 entry_index,
+		 table_definition_index );
+	}
+	/* Test that the first table definition with a duplicate name is found first
+	 */
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "name_hash",
+	 catalog->name_hashes[ ESEDB_TEST_CATALOG_NUMBER_OF_NAME_HASHES - 1 ],
+	 catalog->name_hashes[ 5 ] );
+
+	bucket_index = (int) ( catalog->name_hashes[ 5 ] & (uint32_t) ( catalog->number_of_name_hash_buckets - 1 ) );
+	entry_index  = catalog->name_hash_buckets[ bucket_index ];
+
+	while( ( entry_index != -1 )
+	    && ( catalog->name_hashes[ entry_index ] != catalog->name_hashes[ 5 ] ) )
+	{
+		entry_index = catalog->name_hash_next_indexes[ entry_index ];
+	}
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "entry_index",
+	 entry_index,
+	 5 );
+
+	/* Test error cases
+	 */
+	result = libesedb_catalog_append_table_definition_name_hash(
+	          NULL,
+	          table_definitions[ 0 ],
+	          ESEDB_TEST_CATALOG_NUMBER_OF_NAME_HASHES,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_catalog_append_table_definition_name_hash(
+	          catalog,
+	          NULL,
+	          ESEDB_TEST_CATALOG_NUMBER_OF_NAME_HASHES,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the table definition index is not the next index
+	 */
+	result = libesedb_catalog_append_table_definition_name_hash(
+	          catalog,
+	          table_definitions[ 0 ],
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_catalog_append_table_definition_name_hash(
+	          catalog,
+	          table_definitions[ 0 ],
+	          ESEDB_TEST_CATALOG_NUMBER_OF_NAME_HASHES + 1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the table definition has no table catalog definition
+	 */
+	catalog_definition = table_definitions[ 0 ]->table_catalog_definition;
+
+	table_definitions[ 0 ]->table_catalog_definition = NULL;
+
+	result = libesedb_catalog_append_table_definition_name_hash(
+	          catalog,
+	          table_definitions[ 0 ],
+	          ESEDB_TEST_CATALOG_NUMBER_OF_NAME_HASHES,
+	          &error );
+
+	table_definitions[ 0 ]->table_catalog_definition = catalog_definition;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the name hash cannot be calculated
+	 */
+	name_size = catalog_definition->name_size;
+
+	catalog_definition->name_size = (size_t) SSIZE_MAX + 1;
+
+	result = libesedb_catalog_append_table_definition_name_hash(
+	          catalog,
+	          table_definitions[ 0 ],
+	          ESEDB_TEST_CATALOG_NUMBER_OF_NAME_HASHES,
+	          &error );
+
+	catalog_definition->name_size = name_size;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "catalog->number_of_name_hashes",
+	 catalog->number_of_name_hashes,
+	 ESEDB_TEST_CATALOG_NUMBER_OF_NAME_HASHES );
+
+	/* Clean up
+	 */
+	for( table_definition_index = 0;
+	     table_definition_index < ESEDB_TEST_CATALOG_NUMBER_OF_NAME_HASHES;
+	     table_definition_index++ )
+	{
+		result = libesedb_table_definition_free(
+		          &( table_definitions[ table_definition_index ] ),
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libesedb_catalog_free(
+	          &catalog,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "catalog",
+	 catalog );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	for( table_definition_index = 0;
+	     table_definition_index < ESEDB_TEST_CATALOG_NUMBER_OF_NAME_HASHES;
+	     table_definition_index++ )
+	{
+		if( table_definitions[ table_definition_index ] != NULL )
+		{
+			libesedb_table_definition_free(
+			 &( table_definitions[ table_definition_index ] ),
+			 NULL );
+		}
+	}
+	if( catalog != NULL )
+	{
+		libesedb_catalog_free(
+		 &catalog,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libesedb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_catalog_read_value_type function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_catalog_read_value_type(
+     void )
+{
+	uint8_t data[ 10 ] = {
+		0x08, 0x80, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00 };
+
+	libcerror_error_t *error = NULL;
+	uint16_t type            = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_catalog_read_value_type(
+	          data,
+	          10,
+	          &type,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT16(
+	 "type",
+	 type,
+	 (uint16_t) 0x0002 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_catalog_read_value_type(
+	          NULL,
+	          10,
+	          &type,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_catalog_read_value_type(
+	          data,
+	          9,
+	          &type,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_catalog_read_value_type(
+	          data,
+	          (size_t) SSIZE_MAX + 1,
+	          &type,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_catalog_read_value_type(
+	          data,
+	          10,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_catalog_read_file_io_handle function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_catalog_read_file_io_handle(
+     void )
+{
+	uint8_t data[ 4096 ];
+
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	libesedb_catalog_t *catalog      = NULL;
+	libesedb_io_handle_t *io_handle  = NULL;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->format_revision = 0x0000000c;
+	io_handle->page_size       = 4096;
+
+	result = libesedb_catalog_initialize(
+	          &catalog,
+	          io_handle,
+	          1,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "catalog",
+	 catalog );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Initialize file IO handle
+	 */
+	result = esedb_test_open_file_io_handle(
+	          &file_io_handle,
+	          data,
+	          4096,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+/* TODO implement */
+
+	/* Test error cases
+	 */
+	result = libesedb_catalog_read_file_io_handle(
+	          NULL,
+	          file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up file IO handle
+	 */
+	result = esedb_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = libesedb_catalog_free(
+	          &catalog,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "catalog",
+	 catalog );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( catalog != NULL )
+	{
+		libesedb_catalog_free(
+		 &catalog,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libesedb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_catalog_read_metadata_cache function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_catalog_read_metadata_cache(
+     void )
+{
+	uint8_t catalog_data[ 2 * ( 4 + 45 ) ];
+
+	libcerror_error_t *error                      = NULL;
+	libesedb_catalog_t *catalog                   = NULL;
+	libesedb_io_handle_t *io_handle               = NULL;
+	libesedb_metadata_cache_t *metadata_cache     = NULL;
+	libesedb_table_definition_t *table_definition = NULL;
+	int number_of_definitions                     = 0;
+	int result                                    = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->format_revision = 0x0000000c;
+	io_handle->page_size       = 4096;
+
+	result = libesedb_metadata_cache_initialize(
+	          &metadata_cache,
+	          io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "metadata_cache",
+	 metadata_cache );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_initialize(
+	          &catalog,
+	          io_handle,
+	          1,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "catalog",
+	 catalog );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The catalog data contains the table catalog definition of MSysObjects
+	 * followed by a column catalog definition
+	 */
+	byte_stream_copy_from_uint32_little_endian(
+	 catalog_data,
+	 45 );
+
+	memory_copy(
+	 &( catalog_data[ 4 ] ),
+	 esedb_test_catalog_table_definition_data,
+	 45 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( catalog_data[ 49 ] ),
+	 45 );
+
+	memory_copy(
+	 &( catalog_data[ 53 ] ),
+	 esedb_test_catalog_table_definition_data,
+	 45 );
+
+	catalog_data[ 53 + 8 ] = 0x02;
+
+	/* Test regular case where the metadata cache does not contain catalog data
+	 */
+	result = libesedb_catalog_read_metadata_cache(
+	          catalog,
+	          metadata_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular case where the metadata cache contains catalog data
+	 */
+	result = libesedb_metadata_cache_set_catalog_data(
+	          metadata_cache,
+	          catalog_data,
+	          2 * ( 4 + 45 ),
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_read_metadata_cache(
+	          catalog,
+	          metadata_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_get_number_of_table_definitions(
+	          catalog,
+	          &number_of_definitions,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_definitions",
+	 number_of_definitions,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_get_table_definition_by_index(
+	          catalog,
+	          0,
+	          &table_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "table_definition",
+	 table_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_table_definition_get_number_of_column_catalog_definitions(
+	          table_definition,
+	          &number_of_definitions,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_definitions",
+	 number_of_definitions,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_catalog_read_metadata_cache(
+	          NULL,
+	          metadata_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the catalog already contains table definitions
+	 */
+	result = libesedb_catalog_read_metadata_cache(
+	          catalog,
+	          metadata_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_catalog_free(
+	          &catalog,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_metadata_cache_free(
+	          &metadata_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error case where the catalog data is truncated
+	 */
+	result = libesedb_metadata_cache_initialize(
+	          &metadata_cache,
+	          io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_metadata_cache_set_catalog_data(
+	          metadata_cache,
+	          catalog_data,
+	          4 + 44,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_initialize(
+	          &catalog,
+	          io_handle,
+	          1,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_read_metadata_cache(
+	          catalog,
+	          metadata_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_catalog_free(
+	          &catalog,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "catalog",
+	 catalog );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_metadata_cache_free(
+	          &metadata_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "metadata_cache",
+	 metadata_cache );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( catalog != NULL )
+	{
+		libesedb_catalog_free(
+		 &catalog,
+		 NULL );
+	}
+	if( metadata_cache != NULL )
+	{
+		libesedb_metadata_cache_free(
+		 &metadata_cache,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libesedb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_catalog_write_metadata_cache function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_catalog_write_metadata_cache(
+     void )
+{
+	int number_of_leaf_values[ 2 ] = { 2, 1 };
+	uint8_t data[ 6 * 4096 ];
+
+	libbfio_handle_t *file_io_handle          = NULL;
+	libcerror_error_t *error                  = NULL;
+	libesedb_catalog_t *catalog               = NULL;
+	libesedb_io_handle_t *io_handle           = NULL;
+	libesedb_metadata_cache_t *metadata_cache = NULL;
+	libesedb_page_cache_t *page_cache         = NULL;
+	const uint8_t *catalog_data               = NULL;
+	size_t catalog_data_size                  = 0;
+	uint32_t value_data_size                  = 0;
+	int result                                = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 data,
+	 0,
+	 6 * 4096 );
+
+	result = esedb_test_write_page_tree(
+	          data,
+	          6 * 4096,
+	          4096,
+	          1,
+	          3,
+	          number_of_leaf_values,
+	          2,
+	          ESEDB_TEST_PAGE_TREE_LEAF_VALUE_TYPE_RECORD,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->format_version    = 0x00000620;
+	io_handle->format_revision   = 0x0000000c;
+	io_handle->page_size         = 4096;
+	io_handle->pages_data_offset = 2 * 4096;
+	io_handle->pages_data_size   = 4 * 4096;
+	io_handle->last_page_number  = 4;
+
+	result = esedb_test_open_file_io_handle(
+	          &file_io_handle,
+	          data,
+	          6 * 4096,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_cache_initialize(
+	          &page_cache,
+	          io_handle,
+	          8,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "page_cache",
+	 page_cache );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_metadata_cache_initialize(
+	          &metadata_cache,
+	          io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "metadata_cache",
+	 metadata_cache );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_initialize(
+	          &catalog,
+	          io_handle,
+	          1,
+	          page_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "catalog",
+	 catalog );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_catalog_write_metadata_cache(
+	          catalog,
+	          file_io_handle,
+	          metadata_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_metadata_cache_get_catalog_data(
+	          metadata_cache,
+	          &catalog_data,
+	          &catalog_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "catalog_data",
+	 catalog_data );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The catalog data contains the 3 leaf values of the page tree
+	 */
+	byte_stream_copy_to_uint32_little_endian(
+	 catalog_data,
+	 value_data_size );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "catalog_data_size",
+	 catalog_data_size,
+	 (size_t) ( 3 * ( 4 + value_data_size ) ) );
+
+	/* Test error cases
+	 */
+	result = libesedb_catalog_write_metadata_cache(
+	          NULL,
+	          file_io_handle,
+	          metadata_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_catalog_free(
+	          &catalog,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "catalog",
+	 catalog );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_metadata_cache_free(
+	          &metadata_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "metadata_cache",
+	 metadata_cache );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_cache_free(
+	          &page_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "page_cache",
+	 page_cache );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( catalog != NULL )
+	{
+		libesedb_catalog_free(
+		 &catalog,
+		 NULL );
+	}
+	if( metadata_cache != NULL )
+	{
+		libesedb_metadata_cache_free(
+		 &metadata_cache,
+		 NULL );
+	}
+	if( page_cache != NULL )
+	{
+		libesedb_page_cache_free(
+		 &page_cache,
+		 NULL );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libesedb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_catalog_read_deferred_table_definition function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_catalog_read_deferred_table_definition(
+     void )
+{
+	uint8_t data[ 4 * 4096 ];
+
+	libbfio_handle_t *file_io_handle                     = NULL;
+	libcerror_error_t *error                             = NULL;
+	libesedb_catalog_t *catalog                          = NULL;
+	libesedb_io_handle_t *io_handle                      = NULL;
+	libesedb_page_cache_t *page_cache                    = NULL;
+	libesedb_table_definition_t *first_table_definition  = NULL;
+	libesedb_table_definition_t *second_table_definition = NULL;
+	int number_of_definitions                            = 0;
+	int result                                           = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_catalog_open_source(
+	          &io_handle,
+	          &page_cache,
+	          &file_io_handle,
+	          data,
+	          4 * 4096,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_initialize(
+	          &catalog,
+	          io_handle,
+	          1,
+	          page_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "catalog",
+	 catalog );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	catalog->read_on_demand = 1;
+
+	/* Only the table catalog definitions are read when the catalog is read on demand
+	 */
+	result = libesedb_catalog_read_file_io_handle(
+	          catalog,
+	          file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_get_number_of_table_definitions(
+	          catalog,
+	          &number_of_definitions,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_definitions",
+	 number_of_definitions,
+	 2 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_catalog_get_table_definition_by_index(
+	          catalog,
+	          0,
+	          &first_table_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "first_table_definition",
+	 first_table_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT8(
+	 "first_table_definition->has_deferred_catalog_definitions",
+	 first_table_definition->has_deferred_catalog_definitions,
+	 1 );
+
+	result = libesedb_catalog_get_table_definition_by_index(
+	          catalog,
+	          1,
+	          &second_table_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-		if( esedb_test_memset_attempts_before_fail != -1 )
-		{
-			esedb_test_memset_attempts_before_fail = -1;
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "second_table_definition",
+	 second_table_definition );
 
-			if( catalog != NULL )
-			{
-				libesedb_catalog_free(
-				 &catalog,
-				 NULL );
-			}
-		}
-		else
-		{
-			ESEDB_TEST_ASSERT_EQUAL_INT(
-			 "result",
-			 result,
-			 -1 );
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-			ESEDB_TEST_ASSERT_IS_NULL(
-			 "catalog",
-			 catalog );
+	/* Test regular cases
+	 */
+	result = libesedb_catalog_read_deferred_table_definition(
+	          catalog,
+	          file_io_handle,
+	          first_table_definition,
+	          &error );
 
-			ESEDB_TEST_ASSERT_IS_NOT_NULL(
-			 "error",
-			 error );
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-			libcerror_error_free(
-			 &error );
-		}
-	}
-#endif /* defined( HAVE_ESEDB_TEST_MEMORY ) */
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	/* Clean up
+	ESEDB_TEST_ASSERT_EQUAL_UINT8(
+	 "first_table_definition->has_deferred_catalog_definitions",
+	 first_table_definition->has_deferred_catalog_definitions,
+	 0 );
+
+	/* The defunct column catalog definition is skipped and the second table
+	 * catalog definition ends the catalog definitions of the first table
 	 */
-	result = libesedb_io_handle_free(
-	          &io_handle,
+	result = libesedb_table_definition_get_number_of_column_catalog_definitions(
+	          first_table_definition,
+	          &number_of_definitions,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -274,50 +2243,57 @@ int esedb_test_catalog_initialize(
 	 result,
 	 1 );
 
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_definitions",
+	 number_of_definitions,
+	 1 );
+
 	ESEDB_TEST_ASSERT_IS_NULL(
-	 "io_handle",
-	 io_handle );
+	 "error",
+	 error );
+
+	/* Test regular case where the catalog definitions were already read
+	 */
+	result = libesedb_catalog_read_deferred_table_definition(
+	          catalog,
+	          file_io_handle,
+	          first_table_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
 	ESEDB_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	return( 1 );
+	result = libesedb_table_definition_get_number_of_column_catalog_definitions(
+	          first_table_definition,
+	          &number_of_definitions,
+	          &error );
 
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	if( catalog != NULL )
-	{
-		libesedb_catalog_free(
-		 &catalog,
-		 NULL );
-	}
-	if( io_handle != NULL )
-	{
-		libesedb_io_handle_free(
-		 &io_handle,
-		 NULL );
-	}
-	return( 0 );
-}
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-/* Tests the libesedb_catalog_free function
- * Returns 1 if successful or 0 if not
- */
-int esedb_test_catalog_free(
-     void )
-{
-	libcerror_error_t *error = NULL;
-	int result               = 0;
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_definitions",
+	 number_of_definitions,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
 	/* Test error cases
 	 */
-	result = libesedb_catalog_free(
+	result = libesedb_catalog_read_deferred_table_definition(
 	          NULL,
+	          file_io_handle,
+	          first_table_definition,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -332,59 +2308,53 @@ int esedb_test_catalog_free(
 	libcerror_error_free(
 	 &error );
 
-	return( 1 );
+	result = libesedb_catalog_read_deferred_table_definition(
+	          catalog,
+	          file_io_handle,
+	          NULL,
+	          &error );
 
-on_error:
-	if( error != NULL )
-	{
-		libcerror_error_free(
-		 &error );
-	}
-	return( 0 );
-}
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
 
-/* Tests the libesedb_catalog_read_file_io_handle function
- * Returns 1 if successful or 0 if not
- */
-int esedb_test_catalog_read_file_io_handle(
-     void )
-{
-	uint8_t data[ 4096 ];
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-	libbfio_handle_t *file_io_handle = NULL;
-	libcerror_error_t *error         = NULL;
-	libesedb_catalog_t *catalog      = NULL;
-	libesedb_io_handle_t *io_handle  = NULL;
-	int result                       = 0;
+	libcerror_error_free(
+	 &error );
 
-	/* Initialize test
+	/* Test error case where a catalog definition of the table is truncated,
+	 * after which the deferred read is rolled back so that it can be retried
 	 */
-	result = libesedb_io_handle_initialize(
-	          &io_handle,
+	result = libesedb_catalog_read_deferred_table_definition(
+	          catalog,
+	          file_io_handle,
+	          second_table_definition,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
+	 -1 );
 
 	ESEDB_TEST_ASSERT_IS_NOT_NULL(
-	 "io_handle",
-	 io_handle );
-
-	ESEDB_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	io_handle->format_revision = 0x0000000c;
-	io_handle->page_size       = 4096;
+	libcerror_error_free(
+	 &error );
 
-	result = libesedb_catalog_initialize(
-	          &catalog,
-	          io_handle,
-	          1,
-	          NULL,
-	          NULL,
+	ESEDB_TEST_ASSERT_EQUAL_UINT8(
+	 "second_table_definition->has_deferred_catalog_definitions",
+	 second_table_definition->has_deferred_catalog_definitions,
+	 1 );
+
+	result = libesedb_table_definition_get_number_of_column_catalog_definitions(
+	          second_table_definition,
+	          &number_of_definitions,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -392,20 +2362,17 @@ int esedb_test_catalog_read_file_io_handle(
 	 result,
 	 1 );
 
-	ESEDB_TEST_ASSERT_IS_NOT_NULL(
-	 "catalog",
-	 catalog );
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_definitions",
+	 number_of_definitions,
+	 0 );
 
 	ESEDB_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Initialize file IO handle
-	 */
-	result = esedb_test_open_file_io_handle(
-	          &file_io_handle,
-	          data,
-	          4096,
+	result = libesedb_catalog_free(
+	          &catalog,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -413,52 +2380,52 @@ int esedb_test_catalog_read_file_io_handle(
 	 result,
 	 1 );
 
-	ESEDB_TEST_ASSERT_IS_NOT_NULL(
-	 "file_io_handle",
-	 file_io_handle );
-
 	ESEDB_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	/* Test regular cases
-	 */
-/* TODO implement */
-
-	/* Test error cases
+	/* Test error case where abort was signalled while the catalog is read,
+	 * which otherwise succeeds when the catalog is read on demand
 	 */
-	result = libesedb_catalog_read_file_io_handle(
-	          NULL,
-	          file_io_handle,
+	result = libesedb_catalog_initialize(
+	          &catalog,
+	          io_handle,
+	          1,
+	          page_cache,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 -1 );
+	 1 );
 
-	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	ESEDB_TEST_ASSERT_IS_NULL(
 	 "error",
 	 error );
 
-	libcerror_error_free(
-	 &error );
+	catalog->read_on_demand = 1;
 
-	/* Clean up file IO handle
-	 */
-	result = esedb_test_close_file_io_handle(
-	          &file_io_handle,
+	io_handle->abort = 1;
+
+	result = libesedb_catalog_read_file_io_handle(
+	          catalog,
+	          file_io_handle,
 	          &error );
 
+	io_handle->abort = 0;
+
 	ESEDB_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 0 );
+	 -1 );
 
-	ESEDB_TEST_ASSERT_IS_NULL(
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
+	libcerror_error_free(
+	 &error );
+
 	/* Clean up
 	 */
 	result = libesedb_catalog_free(
@@ -478,18 +2445,16 @@ int esedb_test_catalog_read_file_io_handle(
 	 "error",
 	 error );
 
-	result = libesedb_io_handle_free(
+	result = esedb_test_catalog_close_source(
 	          &io_handle,
+	          &page_cache,
+	          &file_io_handle,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	ESEDB_TEST_ASSERT_IS_NULL(
-	 "io_handle",
-	 io_handle );
+	 0 );
 
 	ESEDB_TEST_ASSERT_IS_NULL(
 	 "error",
@@ -503,12 +2468,6 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
-	if( file_io_handle != NULL )
-	{
-		libbfio_handle_free(
-		 &file_io_handle,
-		 NULL );
-	}
 	if( catalog != NULL )
 	{
 		libesedb_catalog_free(
@@ -517,8 +2476,10 @@ on_error:
 	}
 	if( io_handle != NULL )
 	{
-		libesedb_io_handle_free(
+		esedb_test_catalog_close_source(
 		 &io_handle,
+		 &page_cache,
+		 &file_io_handle,
 		 NULL );
 	}
 	return( 0 );
@@ -1130,6 +3091,14 @@ int main(
 	 "libesedb_catalog_free",
 	 esedb_test_catalog_free );
 
+	ESEDB_TEST_RUN(
+	 "libesedb_catalog_append_table_definition_name_hash",
+	 esedb_test_catalog_append_table_definition_name_hash );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_catalog_read_value_type",
+	 esedb_test_catalog_read_value_type );
+
 /* TODO add test for libesedb_catalog_read_value_data */
 
 /* TODO add test for libesedb_catalog_read_values_from_page */
@@ -1138,6 +3107,18 @@ int main(
 	 "libesedb_catalog_read_file_io_handle",
 	 esedb_test_catalog_read_file_io_handle );
 
+	ESEDB_TEST_RUN(
+	 "libesedb_catalog_read_metadata_cache",
+	 esedb_test_catalog_read_metadata_cache );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_catalog_write_metadata_cache",
+	 esedb_test_catalog_write_metadata_cache );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_catalog_read_deferred_table_definition",
+	 esedb_test_catalog_read_deferred_table_definition );
+
 #if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
 
 	/* Initialize test
@@ -1167,7 +3148,6 @@ int main(
 	          io_handle,
 	          1,
 	          NULL,
-	          NULL,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
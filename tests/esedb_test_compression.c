@@ -64,6 +64,18 @@ uint16_t esedb_test_compression_7bit_uncompressed_utf16_string[ 56 ] = {
 	0x20, 0x69, 0x74, 0x65, 0x6d, 0x73, 0x29, 0x00
 };
 
+/* The sequence: "A\u0141" as UTF-16 little-endian compressed in 7-bit
+ * including leading byte 0x00
+ */
+uint8_t esedb_test_compression_7bit_utf16_compressed_data[ 5 ] = {
+	0x00, 0x41, 0x40, 0x30, 0x00 };
+
+uint8_t esedb_test_compression_7bit_utf16_uncompressed_utf8_string[ 4 ] = {
+	0x41, 0xc5, 0x81, 0x00 };
+
+uint16_t esedb_test_compression_7bit_utf16_uncompressed_utf16_string[ 3 ] = {
+	0x0041, 0x0141, 0x0000 };
+
 /* The sequence: abcdefghijklmnopqrstuvwxyz compressed in LZXpress
  * including leading byte 0x18 and uncompressed data size 0x001a
  */
@@ -72,46 +84,496 @@ uint8_t esedb_test_compression_lzxpress_compressed_data[ 33 ] = {
 	0x6a, 0x6b, 0x6c, 0x6d, 0x6e, 0x6f, 0x70, 0x71, 0x72, 0x73, 0x74, 0x75, 0x76, 0x77, 0x78, 0x79,
 	0x7a };
 
+/* The sequence: "abcdefgh" 12 times, "ESE" and "x" 40 times compressed in LZXpress
+ * including leading byte 0x18 and uncompressed data size 0x008b
+ * The matches use extended sizes that share a single size byte
+ */
+uint8_t esedb_test_compression_lzxpress_matches_compressed_data[ 26 ] = {
+	0x18, 0x8b, 0x00, 0xff, 0xff, 0x87, 0x00, 0x61, 0x62, 0x63, 0x64, 0x65, 0x66, 0x67, 0x68, 0x3f,
+	0x00, 0xff, 0x3f, 0x45, 0x53, 0x45, 0x78, 0x07, 0x00, 0x0e };
+
 #if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
 
-/* Tests the libesedb_compression_7bit_decompress_get_size function
- * Returns 1 if successful or 0 if not
- */
-int esedb_test_compression_7bit_decompress_get_size(
-     void )
-{
-	libcerror_error_t *error      = NULL;
-	size_t uncompressed_data_size = 0;
-	int result                    = 0;
+/* Tests the libesedb_compression_7bit_decompress_get_size function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_compression_7bit_decompress_get_size(
+     void )
+{
+	libcerror_error_t *error      = NULL;
+	size_t uncompressed_data_size = 0;
+	int result                    = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_compression_7bit_decompress_get_size(
+	          esedb_test_compression_7bit_compressed_data,
+	          50,
+	          &uncompressed_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "uncompressed_data_size",
+	 uncompressed_data_size,
+	 (size_t) 56 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_compression_7bit_decompress_get_size(
+	          NULL,
+	          50,
+	          &uncompressed_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_7bit_decompress_get_size(
+	          esedb_test_compression_7bit_compressed_data,
+	          (size_t) SSIZE_MAX + 1,
+	          &uncompressed_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_7bit_decompress_get_size(
+	          esedb_test_compression_7bit_compressed_data,
+	          0,
+	          &uncompressed_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_7bit_decompress_get_size(
+	          esedb_test_compression_7bit_compressed_data,
+	          50,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_7bit_decompress_get_size(
+	          esedb_test_compression_lzxpress_compressed_data,
+	          33,
+	          &uncompressed_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_compression_7bit_decompress function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_compression_7bit_decompress(
+     void )
+{
+	uint8_t uncompressed_data[ 64 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_compression_7bit_decompress(
+	          esedb_test_compression_7bit_compressed_data,
+	          50,
+	          uncompressed_data,
+	          64,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          uncompressed_data,
+	          esedb_test_compression_7bit_uncompressed_data,
+	          56 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libesedb_compression_7bit_decompress(
+	          NULL,
+	          50,
+	          uncompressed_data,
+	          64,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_7bit_decompress(
+	          esedb_test_compression_7bit_compressed_data,
+	          (size_t) SSIZE_MAX + 1,
+	          uncompressed_data,
+	          64,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_7bit_decompress(
+	          esedb_test_compression_7bit_compressed_data,
+	          0,
+	          uncompressed_data,
+	          64,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_7bit_decompress(
+	          esedb_test_compression_7bit_compressed_data,
+	          50,
+	          NULL,
+	          64,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_7bit_decompress(
+	          esedb_test_compression_7bit_compressed_data,
+	          50,
+	          uncompressed_data,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_7bit_decompress(
+	          esedb_test_compression_7bit_compressed_data,
+	          50,
+	          uncompressed_data,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_7bit_decompress(
+	          esedb_test_compression_lzxpress_compressed_data,
+	          33,
+	          uncompressed_data,
+	          64,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_compression_7bit_decompress_to_utf8_string function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_compression_7bit_decompress_to_utf8_string(
+     void )
+{
+	uint8_t utf8_string[ 64 ];
+
+	libcerror_error_t *error = NULL;
+	size_t utf8_string_size  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_compression_7bit_decompress_to_utf8_string(
+	          esedb_test_compression_7bit_compressed_data,
+	          50,
+	          NULL,
+	          0,
+	          &utf8_string_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 56 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_compression_7bit_decompress_to_utf8_string(
+	          esedb_test_compression_7bit_compressed_data,
+	          50,
+	          utf8_string,
+	          64,
+	          &utf8_string_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          esedb_test_compression_7bit_uncompressed_utf8_string,
+	          sizeof( uint8_t ) * 56 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libesedb_compression_7bit_decompress_to_utf8_string(
+	          esedb_test_compression_7bit_utf16_compressed_data,
+	          5,
+	          NULL,
+	          0,
+	          &utf8_string_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 4 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_compression_7bit_decompress_to_utf8_string(
+	          esedb_test_compression_7bit_utf16_compressed_data,
+	          5,
+	          utf8_string,
+	          64,
+	          &utf8_string_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          esedb_test_compression_7bit_utf16_uncompressed_utf8_string,
+	          sizeof( uint8_t ) * 4 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libesedb_compression_7bit_decompress_to_utf8_string(
+	          NULL,
+	          50,
+	          utf8_string,
+	          64,
+	          &utf8_string_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
 
-	/* Test regular cases
-	 */
-	result = libesedb_compression_7bit_decompress_get_size(
+	result = libesedb_compression_7bit_decompress_to_utf8_string(
 	          esedb_test_compression_7bit_compressed_data,
-	          50,
-	          &uncompressed_data_size,
+	          (size_t) SSIZE_MAX + 1,
+	          utf8_string,
+	          64,
+	          &utf8_string_size,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
 	 "result",
 	 result,
-	 1 );
-
-	ESEDB_TEST_ASSERT_EQUAL_SIZE(
-	 "uncompressed_data_size",
-	 uncompressed_data_size,
-	 (size_t) 56 );
+	 -1 );
 
-	ESEDB_TEST_ASSERT_IS_NULL(
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
 	 "error",
 	 error );
 
-	/* Test error cases
-	 */
-	result = libesedb_compression_7bit_decompress_get_size(
-	          NULL,
-	          50,
-	          &uncompressed_data_size,
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_7bit_decompress_to_utf8_string(
+	          esedb_test_compression_7bit_compressed_data,
+	          1,
+	          utf8_string,
+	          64,
+	          &utf8_string_size,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -126,10 +588,12 @@ int esedb_test_compression_7bit_decompress_get_size(
 	libcerror_error_free(
 	 &error );
 
-	result = libesedb_compression_7bit_decompress_get_size(
+	result = libesedb_compression_7bit_decompress_to_utf8_string(
 	          esedb_test_compression_7bit_compressed_data,
+	          50,
+	          utf8_string,
 	          (size_t) SSIZE_MAX + 1,
-	          &uncompressed_data_size,
+	          &utf8_string_size,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -144,10 +608,12 @@ int esedb_test_compression_7bit_decompress_get_size(
 	libcerror_error_free(
 	 &error );
 
-	result = libesedb_compression_7bit_decompress_get_size(
+	result = libesedb_compression_7bit_decompress_to_utf8_string(
 	          esedb_test_compression_7bit_compressed_data,
-	          0,
-	          &uncompressed_data_size,
+	          50,
+	          utf8_string,
+	          8,
+	          &utf8_string_size,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -162,9 +628,11 @@ int esedb_test_compression_7bit_decompress_get_size(
 	libcerror_error_free(
 	 &error );
 
-	result = libesedb_compression_7bit_decompress_get_size(
+	result = libesedb_compression_7bit_decompress_to_utf8_string(
 	          esedb_test_compression_7bit_compressed_data,
 	          50,
+	          utf8_string,
+	          64,
 	          NULL,
 	          &error );
 
@@ -180,10 +648,12 @@ int esedb_test_compression_7bit_decompress_get_size(
 	libcerror_error_free(
 	 &error );
 
-	result = libesedb_compression_7bit_decompress_get_size(
+	result = libesedb_compression_7bit_decompress_to_utf8_string(
 	          esedb_test_compression_lzxpress_compressed_data,
 	          33,
-	          &uncompressed_data_size,
+	          utf8_string,
+	          64,
+	          &utf8_string_size,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -209,24 +679,48 @@ on_error:
 	return( 0 );
 }
 
-/* Tests the libesedb_compression_7bit_decompress function
+/* Tests the libesedb_compression_7bit_decompress_to_utf16_string function
  * Returns 1 if successful or 0 if not
  */
-int esedb_test_compression_7bit_decompress(
+int esedb_test_compression_7bit_decompress_to_utf16_string(
      void )
 {
-	uint8_t uncompressed_data[ 64 ];
+	uint16_t utf16_string[ 64 ];
 
 	libcerror_error_t *error = NULL;
+	size_t utf16_string_size = 0;
 	int result               = 0;
 
 	/* Test regular cases
 	 */
-	result = libesedb_compression_7bit_decompress(
+	result = libesedb_compression_7bit_decompress_to_utf16_string(
 	          esedb_test_compression_7bit_compressed_data,
 	          50,
-	          uncompressed_data,
+	          NULL,
+	          0,
+	          &utf16_string_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "utf16_string_size",
+	 utf16_string_size,
+	 (size_t) 56 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_compression_7bit_decompress_to_utf16_string(
+	          esedb_test_compression_7bit_compressed_data,
+	          50,
+	          utf16_string,
 	          64,
+	          &utf16_string_size,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -239,9 +733,58 @@ int esedb_test_compression_7bit_decompress(
 	 error );
 
 	result = memory_compare(
-	          uncompressed_data,
-	          esedb_test_compression_7bit_uncompressed_data,
-	          56 );
+	          utf16_string,
+	          esedb_test_compression_7bit_uncompressed_utf16_string,
+	          sizeof( uint16_t ) * 56 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libesedb_compression_7bit_decompress_to_utf16_string(
+	          esedb_test_compression_7bit_utf16_compressed_data,
+	          5,
+	          NULL,
+	          0,
+	          &utf16_string_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "utf16_string_size",
+	 utf16_string_size,
+	 (size_t) 3 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_compression_7bit_decompress_to_utf16_string(
+	          esedb_test_compression_7bit_utf16_compressed_data,
+	          5,
+	          utf16_string,
+	          64,
+	          &utf16_string_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf16_string,
+	          esedb_test_compression_7bit_utf16_uncompressed_utf16_string,
+	          sizeof( uint16_t ) * 3 );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
 	 "result",
@@ -250,11 +793,12 @@ int esedb_test_compression_7bit_decompress(
 
 	/* Test error cases
 	 */
-	result = libesedb_compression_7bit_decompress(
+	result = libesedb_compression_7bit_decompress_to_utf16_string(
 	          NULL,
 	          50,
-	          uncompressed_data,
+	          utf16_string,
 	          64,
+	          &utf16_string_size,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -269,11 +813,12 @@ int esedb_test_compression_7bit_decompress(
 	libcerror_error_free(
 	 &error );
 
-	result = libesedb_compression_7bit_decompress(
+	result = libesedb_compression_7bit_decompress_to_utf16_string(
 	          esedb_test_compression_7bit_compressed_data,
 	          (size_t) SSIZE_MAX + 1,
-	          uncompressed_data,
+	          utf16_string,
 	          64,
+	          &utf16_string_size,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -288,11 +833,12 @@ int esedb_test_compression_7bit_decompress(
 	libcerror_error_free(
 	 &error );
 
-	result = libesedb_compression_7bit_decompress(
+	result = libesedb_compression_7bit_decompress_to_utf16_string(
 	          esedb_test_compression_7bit_compressed_data,
-	          0,
-	          uncompressed_data,
+	          1,
+	          utf16_string,
 	          64,
+	          &utf16_string_size,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -307,11 +853,12 @@ int esedb_test_compression_7bit_decompress(
 	libcerror_error_free(
 	 &error );
 
-	result = libesedb_compression_7bit_decompress(
+	result = libesedb_compression_7bit_decompress_to_utf16_string(
 	          esedb_test_compression_7bit_compressed_data,
 	          50,
-	          NULL,
-	          64,
+	          utf16_string,
+	          (size_t) SSIZE_MAX + 1,
+	          &utf16_string_size,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -326,11 +873,12 @@ int esedb_test_compression_7bit_decompress(
 	libcerror_error_free(
 	 &error );
 
-	result = libesedb_compression_7bit_decompress(
+	result = libesedb_compression_7bit_decompress_to_utf16_string(
 	          esedb_test_compression_7bit_compressed_data,
 	          50,
-	          uncompressed_data,
-	          (size_t) SSIZE_MAX + 1,
+	          utf16_string,
+	          8,
+	          &utf16_string_size,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -345,11 +893,12 @@ int esedb_test_compression_7bit_decompress(
 	libcerror_error_free(
 	 &error );
 
-	result = libesedb_compression_7bit_decompress(
+	result = libesedb_compression_7bit_decompress_to_utf16_string(
 	          esedb_test_compression_7bit_compressed_data,
 	          50,
-	          uncompressed_data,
-	          4,
+	          utf16_string,
+	          64,
+	          NULL,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -364,11 +913,12 @@ int esedb_test_compression_7bit_decompress(
 	libcerror_error_free(
 	 &error );
 
-	result = libesedb_compression_7bit_decompress(
+	result = libesedb_compression_7bit_decompress_to_utf16_string(
 	          esedb_test_compression_lzxpress_compressed_data,
 	          33,
-	          uncompressed_data,
+	          utf16_string,
 	          64,
+	          &utf16_string_size,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -535,10 +1085,11 @@ on_error:
 int esedb_test_compression_lzxpress_decompress(
      void )
 {
-	uint8_t uncompressed_data[ 64 ];
+	uint8_t uncompressed_data[ 160 ];
 
 	libcerror_error_t *error = NULL;
 	int result               = 0;
+	int data_index           = 0;
 
 	/* Test regular cases
 	 */
@@ -546,7 +1097,7 @@ int esedb_test_compression_lzxpress_decompress(
 	          esedb_test_compression_lzxpress_compressed_data,
 	          33,
 	          uncompressed_data,
-	          64,
+	          160,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -568,13 +1119,120 @@ int esedb_test_compression_lzxpress_decompress(
 	 result,
 	 0 );
 
+	result = libesedb_compression_lzxpress_decompress(
+	          esedb_test_compression_lzxpress_matches_compressed_data,
+	          26,
+	          uncompressed_data,
+	          139,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( data_index = 0;
+	     data_index < 96;
+	     data_index += 8 )
+	{
+		result = memory_compare(
+		          &( uncompressed_data[ data_index ] ),
+		          (uint8_t *) "abcdefgh",
+		          8 );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 0 );
+	}
+	result = memory_compare(
+	          &( uncompressed_data[ 96 ] ),
+	          (uint8_t *) "ESE",
+	          3 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	for( data_index = 99;
+	     data_index < 139;
+	     data_index++ )
+	{
+		ESEDB_TEST_ASSERT_EQUAL_UINT8(
+		 "uncompressed_data[ data_index ]",
+		 uncompressed_data[ data_index ],
+		 (uint8_t) 'x' );
+	}
+
 	/* Test error cases
 	 */
 	result = libesedb_compression_lzxpress_decompress(
 	          NULL,
 	          33,
 	          uncompressed_data,
-	          64,
+	          160,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_lzxpress_decompress(
+	          esedb_test_compression_lzxpress_compressed_data,
+	          33,
+	          NULL,
+	          160,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_lzxpress_decompress(
+	          esedb_test_compression_lzxpress_matches_compressed_data,
+	          26,
+	          uncompressed_data,
+	          16,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_compression_lzxpress_decompress(
+	          esedb_test_compression_lzxpress_matches_compressed_data,
+	          17,
+	          uncompressed_data,
+	          160,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -1416,6 +2074,14 @@ int main(
 	 "libesedb_compression_7bit_decompress",
 	 esedb_test_compression_7bit_decompress );
 
+	ESEDB_TEST_RUN(
+	 "libesedb_compression_7bit_decompress_to_utf8_string",
+	 esedb_test_compression_7bit_decompress_to_utf8_string );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_compression_7bit_decompress_to_utf16_string",
+	 esedb_test_compression_7bit_decompress_to_utf16_string );
+
 	ESEDB_TEST_RUN(
 	 "libesedb_compression_lzxpress_decompress_get_size",
 	 esedb_test_compression_lzxpress_decompress_get_size );
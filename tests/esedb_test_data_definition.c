@@ -34,6 +34,13 @@
 #include "esedb_test_unused.h"
 
 #include "../libesedb/libesedb_data_definition.h"
+#include "../libesedb/libesedb_io_handle.h"
+
+/* Tagged data types data with 2 tagged data types: 256 and 258
+ * where the second tagged data type has a flags byte
+ */
+uint8_t esedb_test_data_definition_tagged_data_types_data[ 15 ] = {
+	0x00, 0x01, 0x08, 0x00, 0x02, 0x01, 0x0c, 0x40, 0x61, 0x62, 0x63, 0x64, 0x00, 0x78, 0x79 };
 
 #if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
 
@@ -331,6 +338,322 @@ int esedb_test_data_definition_read_record(
 	          NULL,
 	          NULL,
 	          NULL,
+	          NULL,
+	          NULL,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_data_definition_set_tagged_data_types_data function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_data_definition_set_tagged_data_types_data(
+     void )
+{
+	libcerror_error_t *error                    = NULL;
+	libesedb_data_definition_t *data_definition = NULL;
+	libesedb_io_handle_t *io_handle             = NULL;
+	int result                                  = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->format_revision = 0x0000000c;
+	io_handle->page_size       = 8192;
+
+	result = libesedb_data_definition_initialize(
+	          &data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "data_definition",
+	 data_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_data_definition_set_tagged_data_types_data(
+	          data_definition,
+	          io_handle,
+	          esedb_test_data_definition_tagged_data_types_data,
+	          15,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT16(
+	 "data_definition->number_of_tagged_data_types",
+	 data_definition->number_of_tagged_data_types,
+	 (uint16_t) 2 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT8(
+	 "data_definition->tagged_data_types_are_sorted",
+	 data_definition->tagged_data_types_are_sorted,
+	 (uint8_t) 1 );
+
+	result = libesedb_data_definition_set_tagged_data_types_data(
+	          data_definition,
+	          io_handle,
+	          esedb_test_data_definition_tagged_data_types_data,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT16(
+	 "data_definition->number_of_tagged_data_types",
+	 data_definition->number_of_tagged_data_types,
+	 (uint16_t) 0 );
+
+	/* Test error cases
+	 */
+	result = libesedb_data_definition_set_tagged_data_types_data(
+	          NULL,
+	          io_handle,
+	          esedb_test_data_definition_tagged_data_types_data,
+	          15,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_data_definition_set_tagged_data_types_data(
+	          data_definition,
+	          NULL,
+	          esedb_test_data_definition_tagged_data_types_data,
+	          15,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_data_definition_set_tagged_data_types_data(
+	          data_definition,
+	          io_handle,
+	          NULL,
+	          15,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_data_definition_set_tagged_data_types_data(
+	          data_definition,
+	          io_handle,
+	          esedb_test_data_definition_tagged_data_types_data,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_data_definition_set_tagged_data_types_data(
+	          data_definition,
+	          io_handle,
+	          esedb_test_data_definition_tagged_data_types_data,
+	          2,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the tagged data type offsets exceed the data size
+	 */
+	result = libesedb_data_definition_set_tagged_data_types_data(
+	          data_definition,
+	          io_handle,
+	          esedb_test_data_definition_tagged_data_types_data,
+	          11,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_data_definition_free(
+	          &data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "data_definition",
+	 data_definition );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( data_definition != NULL )
+	{
+		libesedb_data_definition_free(
+		 &data_definition,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libesedb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_data_definition_read_tagged_data_type_value function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_data_definition_read_tagged_data_type_value(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_data_definition_read_tagged_data_type_value(
 	          NULL,
 	          NULL,
 	          NULL,
@@ -375,7 +698,6 @@ int esedb_test_data_definition_read_long_value(
 	          NULL,
 	          NULL,
 	          NULL,
-	          NULL,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -417,7 +739,6 @@ int esedb_test_data_definition_read_long_value_segment(
 	          NULL,
 	          NULL,
 	          NULL,
-	          NULL,
 	          0,
 	          NULL,
 	          &error );
@@ -480,6 +801,14 @@ int main(
 	 "libesedb_data_definition_read_record",
 	 esedb_test_data_definition_read_record );
 
+	ESEDB_TEST_RUN(
+	 "libesedb_data_definition_set_tagged_data_types_data",
+	 esedb_test_data_definition_set_tagged_data_types_data );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_data_definition_read_tagged_data_type_value",
+	 esedb_test_data_definition_read_tagged_data_type_value );
+
 	ESEDB_TEST_RUN(
 	 "libesedb_data_definition_read_long_value",
 	 esedb_test_data_definition_read_long_value );
@@ -83,7 +83,6 @@ int esedb_test_database_initialize(
 	          &database,
 	          io_handle,
 	          NULL,
-	          NULL,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -122,7 +121,6 @@ int esedb_test_database_initialize(
 	          NULL,
 	          io_handle,
 	          NULL,
-	          NULL,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -143,7 +141,6 @@ int esedb_test_database_initialize(
 	          &database,
 	          io_handle,
 	          NULL,
-	          NULL,
 	          &error );
 
 	database = NULL;
@@ -174,7 +171,6 @@ int esedb_test_database_initialize(
 		          &database,
 		          io_handle,
 		          NULL,
-		          NULL,
 		          &error );
 
 		if( esedb_test_malloc_attempts_before_fail != -1 )
@@ -219,7 +215,6 @@ int esedb_test_database_initialize(
 		          &database,
 		          io_handle,
 		          NULL,
-		          NULL,
 		          &error );
 
 		if( esedb_test_memset_attempts_before_fail != -1 )
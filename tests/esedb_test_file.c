@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <narrow_string.h>
 #include <system_string.h>
 #include <types.h>
@@ -33,12 +34,17 @@
 #include "esedb_test_functions.h"
 #include "esedb_test_getopt.h"
 #include "esedb_test_libbfio.h"
+#include "esedb_test_libcdata.h"
 #include "esedb_test_libcerror.h"
 #include "esedb_test_libesedb.h"
 #include "esedb_test_macros.h"
 #include "esedb_test_memory.h"
 
+#include "../libesedb/libesedb_catalog_definition.h"
+#include "../libesedb/libesedb_definitions.h"
 #include "../libesedb/libesedb_file.h"
+#include "../libesedb/libesedb_table_definition.h"
+#include "../libesedb/libesedb_table_state.h"
 
 #if defined( HAVE_WIDE_SYSTEM_CHARACTER ) && SIZEOF_WCHAR_T != 2 && SIZEOF_WCHAR_T != 4
 #error Unsupported size of wchar_t
@@ -48,6 +54,31 @@
 #define ESEDB_TEST_FILE_VERBOSE
  */
 
+/* Metadata cache with an entry of the page tree with root page 1
+ */
+uint8_t esedb_test_file_metadata_cache_data[ 104 ] = {
+	0x65, 0x73, 0x65, 0x64, 0x62, 0x6d, 0x63, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 };
+
+/* Catalog data of 2 catalog values
+ */
+uint8_t esedb_test_file_catalog_data[ 12 ] = {
+	0x03, 0x00, 0x00, 0x00, 0xaa, 0xbb, 0xcc, 0x01, 0x00, 0x00, 0x00, 0xdd };
+
+/* The name of the metadata cache file written by the tests
+ */
+#define ESEDB_TEST_FILE_METADATA_CACHE_FILENAME		"esedb_test_file.metadata_cache"
+
+/* The number of table definitions used to test the table states, which exceeds
+ * the maximum number of table states retained by the file by 1
+ */
+#define ESEDB_TEST_FILE_NUMBER_OF_TABLE_DEFINITIONS		( LIBESEDB_MAXIMUM_CACHE_ENTRIES_TABLE_STATES + 1 )
+
 #if !defined( LIBESEDB_HAVE_BFIO )
 
 LIBESEDB_EXTERN \
@@ -1452,62 +1483,2451 @@ on_error:
 	return( 0 );
 }
 
-/* The main program
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+/* Tests the libesedb_internal_file_read_metadata_cache_file_io_handle function
+ * Returns 1 if successful or 0 if not
  */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-int wmain(
-     int argc,
-     wchar_t * const argv[] )
-#else
-int main(
-     int argc,
-     char * const argv[] )
-#endif
+int esedb_test_internal_file_read_metadata_cache_file_io_handle(
+     void )
 {
 	libbfio_handle_t *file_io_handle = NULL;
 	libcerror_error_t *error         = NULL;
 	libesedb_file_t *file            = NULL;
-	system_character_t *source       = NULL;
-	system_integer_t option          = 0;
-	size_t string_length             = 0;
 	int result                       = 0;
 
-	while( ( option = esedb_test_getopt(
-	                   argc,
-	                   argv,
-	                   _SYSTEM_STRING( "" ) ) ) != (system_integer_t) -1 )
-	{
-		switch( option )
-		{
-			case (system_integer_t) '?':
-			default:
-				fprintf(
-				 stderr,
-				 "Invalid argument: %" PRIs_SYSTEM ".\n",
-				 argv[ optind - 1 ] );
+	/* Initialize test
+	 */
+	result = libesedb_file_initialize(
+	          &file,
+	          &error );
 
-				return( EXIT_FAILURE );
-		}
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_memory_range_initialize(
+	          &file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_memory_range_set(
+	          file_io_handle,
+	          esedb_test_file_metadata_cache_data,
+	          104,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_internal_file_read_metadata_cache_file_io_handle(
+	          (libesedb_internal_file_t *) file,
+	          file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The metadata cache data is kept until the file is opened
+	 */
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "internal_file->metadata_cache_data",
+	 ( (libesedb_internal_file_t *) file )->metadata_cache_data );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "internal_file->metadata_cache_data_size",
+	 ( (libesedb_internal_file_t *) file )->metadata_cache_data_size,
+	 (size_t) 104 );
+
+	/* Test regular case where the metadata cache data is replaced
+	 */
+	result = libesedb_internal_file_read_metadata_cache_file_io_handle(
+	          (libesedb_internal_file_t *) file,
+	          file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "internal_file->metadata_cache_data_size",
+	 ( (libesedb_internal_file_t *) file )->metadata_cache_data_size,
+	 (size_t) 104 );
+
+	/* Test error cases
+	 */
+	result = libesedb_internal_file_read_metadata_cache_file_io_handle(
+	          NULL,
+	          file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbfio_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_file_free(
+	          &file,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
 	}
-	if( optind < argc )
+	if( file_io_handle != NULL )
 	{
-		source = argv[ optind ];
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
 	}
-#if defined( HAVE_DEBUG_OUTPUT ) && defined( ESEDB_TEST_FILE_VERBOSE )
-	libesedb_notify_set_verbose(
+	if( file != NULL )
+	{
+		libesedb_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_internal_file_write_metadata_cache_file_io_handle function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_internal_file_write_metadata_cache_file_io_handle(
+     void )
+{
+	uint8_t data[ 104 ];
+
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	libesedb_file_t *file            = NULL;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_file_initialize(
+	          &file,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
 	 1 );
-	libesedb_notify_set_stream(
-	 stderr,
-	 NULL );
-#endif
 
-	ESEDB_TEST_RUN(
-	 "libesedb_file_initialize",
-	 esedb_test_file_initialize );
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
 
-	ESEDB_TEST_RUN(
-	 "libesedb_file_free",
-	 esedb_test_file_free );
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_memory_range_initialize(
+	          &file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_memory_range_set(
+	          file_io_handle,
+	          data,
+	          104,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_internal_file_write_metadata_cache_file_io_handle(
+	          NULL,
+	          file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the file is not open and has no metadata cache
+	 */
+	result = libesedb_internal_file_write_metadata_cache_file_io_handle(
+	          (libesedb_internal_file_t *) file,
+	          file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libbfio_handle_free(
+	          &file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_file_free(
+	          &file,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	if( file != NULL )
+	{
+		libesedb_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+
+/* Creates the metadata cache of a file that is not open for testing
+ * The metadata cache corresponds to a database file of 65536 bytes with a page size of 4096
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_file_initialize_metadata_cache(
+     libesedb_file_t *file,
+     libcerror_error_t **error )
+{
+	libesedb_internal_file_t *internal_file = NULL;
+	static char *function                   = "esedb_test_file_initialize_metadata_cache";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	internal_file = (libesedb_internal_file_t *) file;
+
+	internal_file->io_handle->database_time     = 0x10;
+	internal_file->io_handle->page_size         = 4096;
+	internal_file->io_handle->pages_data_offset = 2 * 4096;
+	internal_file->io_handle->pages_data_size   = 65536 - ( 2 * 4096 );
+	internal_file->io_handle->last_page_number  = ( 65536 / 4096 ) - 2;
+
+	if( libesedb_metadata_cache_initialize(
+	     &( internal_file->metadata_cache ),
+	     internal_file->io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create metadata cache.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Frees the metadata cache of a file that is not open
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_file_free_metadata_cache(
+     libesedb_file_t *file,
+     libcerror_error_t **error )
+{
+	static char *function = "esedb_test_file_free_metadata_cache";
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_metadata_cache_free(
+	     &( ( (libesedb_internal_file_t *) file )->metadata_cache ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free metadata cache.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Writes data to the metadata cache file for testing
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_file_write_metadata_cache_data(
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	FILE *file_stream     = NULL;
+	static char *function = "esedb_test_file_write_metadata_cache_data";
+	size_t write_count    = 0;
+
+	file_stream = file_stream_open(
+	               ESEDB_TEST_FILE_METADATA_CACHE_FILENAME,
+	               FILE_STREAM_BINARY_OPEN_WRITE );
+
+	if( file_stream == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open metadata cache file.",
+		 function );
+
+		return( -1 );
+	}
+	write_count = file_stream_write(
+	               file_stream,
+	               data,
+	               data_size );
+
+	if( file_stream_close(
+	     file_stream ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close metadata cache file.",
+		 function );
+
+		return( -1 );
+	}
+	if( write_count != data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_WRITE_FAILED,
+		 "%s: unable to write metadata cache file.",
+		 function );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Tests the libesedb_file_read_metadata_cache and libesedb_file_write_metadata_cache functions
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_file_read_write_metadata_cache(
+     void )
+{
+	uint8_t data[ 104 ];
+
+	libcerror_error_t *error         = NULL;
+	libesedb_file_t *file            = NULL;
+	libesedb_file_t *read_file       = NULL;
+	const uint8_t *catalog_data      = NULL;
+	size_t catalog_data_size         = 0;
+	uint64_t database_time           = 0;
+	size64_t file_size               = 0;
+	uint32_t page_size               = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_file_initialize(
+	          &file,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_file_initialize_metadata_cache(
+	          file,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_metadata_cache_set_catalog_data(
+	          ( (libesedb_internal_file_t *) file )->metadata_cache,
+	          esedb_test_file_catalog_data,
+	          12,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_file_initialize(
+	          &read_file,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "read_file",
+	 read_file );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_file_write_metadata_cache(
+	          file,
+	          ESEDB_TEST_FILE_METADATA_CACHE_FILENAME,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular case where the metadata cache is kept until the file is opened
+	 */
+	result = libesedb_file_read_metadata_cache(
+	          read_file,
+	          ESEDB_TEST_FILE_METADATA_CACHE_FILENAME,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "internal_file->metadata_cache_data",
+	 ( (libesedb_internal_file_t *) read_file )->metadata_cache_data );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "internal_file->metadata_cache_data_size",
+	 ( (libesedb_internal_file_t *) read_file )->metadata_cache_data_size,
+	 (size_t) 80 );
+
+	/* Test regular case where the metadata cache is read into the metadata cache of the file
+	 */
+	result = esedb_test_file_initialize_metadata_cache(
+	          read_file,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_file_read_metadata_cache(
+	          read_file,
+	          ESEDB_TEST_FILE_METADATA_CACHE_FILENAME,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_metadata_cache_get_catalog_data(
+	          ( (libesedb_internal_file_t *) read_file )->metadata_cache,
+	          &catalog_data,
+	          &catalog_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "catalog_data_size",
+	 catalog_data_size,
+	 (size_t) 12 );
+
+	result = memory_compare(
+	          catalog_data,
+	          esedb_test_file_catalog_data,
+	          12 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test regular case where the metadata cache does not exist
+	 */
+	result = libesedb_file_read_metadata_cache(
+	          read_file,
+	          "esedb_test_file.missing_metadata_cache",
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular case where the database time does not match
+	 */
+	database_time = ( (libesedb_internal_file_t *) read_file )->metadata_cache->database_time;
+
+	( (libesedb_internal_file_t *) read_file )->metadata_cache->database_time = database_time + 1;
+
+	result = libesedb_file_read_metadata_cache(
+	          read_file,
+	          ESEDB_TEST_FILE_METADATA_CACHE_FILENAME,
+	          &error );
+
+	( (libesedb_internal_file_t *) read_file )->metadata_cache->database_time = database_time;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular case where the file size does not match
+	 */
+	file_size = ( (libesedb_internal_file_t *) read_file )->metadata_cache->file_size;
+
+	( (libesedb_internal_file_t *) read_file )->metadata_cache->file_size = file_size + 4096;
+
+	result = libesedb_file_read_metadata_cache(
+	          read_file,
+	          ESEDB_TEST_FILE_METADATA_CACHE_FILENAME,
+	          &error );
+
+	( (libesedb_internal_file_t *) read_file )->metadata_cache->file_size = file_size;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular case where the page size does not match
+	 */
+	page_size = ( (libesedb_internal_file_t *) read_file )->metadata_cache->page_size;
+
+	( (libesedb_internal_file_t *) read_file )->metadata_cache->page_size = 8192;
+
+	result = libesedb_file_read_metadata_cache(
+	          read_file,
+	          ESEDB_TEST_FILE_METADATA_CACHE_FILENAME,
+	          &error );
+
+	( (libesedb_internal_file_t *) read_file )->metadata_cache->page_size = page_size;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_file_read_metadata_cache(
+	          NULL,
+	          ESEDB_TEST_FILE_METADATA_CACHE_FILENAME,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_file_read_metadata_cache(
+	          read_file,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_file_write_metadata_cache(
+	          NULL,
+	          ESEDB_TEST_FILE_METADATA_CACHE_FILENAME,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_file_write_metadata_cache(
+	          file,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the signature is invalid
+	 */
+	memory_copy(
+	 data,
+	 esedb_test_file_metadata_cache_data,
+	 104 );
+
+	data[ 0 ] = 0xff;
+
+	result = esedb_test_file_write_metadata_cache_data(
+	          data,
+	          104,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_file_read_metadata_cache(
+	          read_file,
+	          ESEDB_TEST_FILE_METADATA_CACHE_FILENAME,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the file is not open and has no metadata cache
+	 */
+	result = esedb_test_file_free_metadata_cache(
+	          file,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_file_write_metadata_cache(
+	          file,
+	          ESEDB_TEST_FILE_METADATA_CACHE_FILENAME,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	remove(
+	 ESEDB_TEST_FILE_METADATA_CACHE_FILENAME );
+
+	result = esedb_test_file_free_metadata_cache(
+	          read_file,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_file_free(
+	          &read_file,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "read_file",
+	 read_file );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_file_free(
+	          &file,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	remove(
+	 ESEDB_TEST_FILE_METADATA_CACHE_FILENAME );
+
+	if( read_file != NULL )
+	{
+		esedb_test_file_free_metadata_cache(
+		 read_file,
+		 NULL );
+		libesedb_file_free(
+		 &read_file,
+		 NULL );
+	}
+	if( file != NULL )
+	{
+		esedb_test_file_free_metadata_cache(
+		 file,
+		 NULL );
+		libesedb_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+/* Tests the libesedb_file_read_metadata_cache_wide and libesedb_file_write_metadata_cache_wide functions
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_file_read_write_metadata_cache_wide(
+     void )
+{
+	libcerror_error_t *error   = NULL;
+	libesedb_file_t *file      = NULL;
+	libesedb_file_t *read_file = NULL;
+	int result                 = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_file_initialize(
+	          &file,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file",
+	 file );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_file_initialize_metadata_cache(
+	          file,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_file_initialize(
+	          &read_file,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "read_file",
+	 read_file );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_file_initialize_metadata_cache(
+	          read_file,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_file_write_metadata_cache_wide(
+	          file,
+	          L"esedb_test_file.metadata_cache",
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_file_read_metadata_cache_wide(
+	          read_file,
+	          L"esedb_test_file.metadata_cache",
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular case where the database time does not match
+	 */
+	( (libesedb_internal_file_t *) read_file )->metadata_cache->database_time += 1;
+
+	result = libesedb_file_read_metadata_cache_wide(
+	          read_file,
+	          L"esedb_test_file.metadata_cache",
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_file_read_metadata_cache_wide(
+	          NULL,
+	          L"esedb_test_file.metadata_cache",
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_file_read_metadata_cache_wide(
+	          read_file,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_file_write_metadata_cache_wide(
+	          NULL,
+	          L"esedb_test_file.metadata_cache",
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_file_write_metadata_cache_wide(
+	          file,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	remove(
+	 ESEDB_TEST_FILE_METADATA_CACHE_FILENAME );
+
+	result = esedb_test_file_free_metadata_cache(
+	          read_file,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_file_free(
+	          &read_file,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "read_file",
+	 read_file );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_file_free_metadata_cache(
+	          file,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_file_free(
+	          &file,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	remove(
+	 ESEDB_TEST_FILE_METADATA_CACHE_FILENAME );
+
+	if( read_file != NULL )
+	{
+		esedb_test_file_free_metadata_cache(
+		 read_file,
+		 NULL );
+		libesedb_file_free(
+		 &read_file,
+		 NULL );
+	}
+	if( file != NULL )
+	{
+		esedb_test_file_free_metadata_cache(
+		 file,
+		 NULL );
+		libesedb_file_free(
+		 &file,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+
+/* Frees a file and table definitions initialized by esedb_test_file_initialize_table_states
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_file_free_table_states(
+     libesedb_file_t **file,
+     libesedb_table_definition_t **table_definitions,
+     libcerror_error_t **error )
+{
+	static char *function      = "esedb_test_file_free_table_states";
+	int result                 = 1;
+	int table_definition_index = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_definitions == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table definitions.",
+		 function );
+
+		return( -1 );
+	}
+	if( *file != NULL )
+	{
+		if( libesedb_internal_file_free_table_states(
+		     (libesedb_internal_file_t *) *file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free table states.",
+			 function );
+
+			result = -1;
+		}
+		if( libesedb_file_free(
+		     file,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free file.",
+			 function );
+
+			result = -1;
+		}
+	}
+	for( table_definition_index = 0;
+	     table_definition_index < ESEDB_TEST_FILE_NUMBER_OF_TABLE_DEFINITIONS;
+	     table_definition_index++ )
+	{
+		if( table_definitions[ table_definition_index ] == NULL )
+		{
+			continue;
+		}
+		if( libesedb_table_definition_free(
+		     &( table_definitions[ table_definition_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free table definition: %d.",
+			 function,
+			 table_definition_index );
+
+			result = -1;
+		}
+	}
+	return( result );
+}
+
+/* Initializes a file that is not open and table definitions to test the table states
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_file_initialize_table_states(
+     libesedb_file_t **file,
+     libesedb_table_definition_t **table_definitions,
+     libcerror_error_t **error )
+{
+	libesedb_catalog_definition_t *table_catalog_definition = NULL;
+	libesedb_internal_file_t *internal_file                 = NULL;
+	static char *function                                   = "esedb_test_file_initialize_table_states";
+	int table_definition_index                              = 0;
+
+	if( file == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file.",
+		 function );
+
+		return( -1 );
+	}
+	if( table_definitions == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid table definitions.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_file_initialize(
+	     file,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create file.",
+		 function );
+
+		goto on_error;
+	}
+	internal_file = (libesedb_internal_file_t *) *file;
+
+	internal_file->io_handle->format_revision   = 0x0000000c;
+	internal_file->io_handle->page_size         = 4096;
+	internal_file->io_handle->pages_data_offset = 2 * 4096;
+	internal_file->io_handle->pages_data_size   = 65536 - ( 2 * 4096 );
+	internal_file->io_handle->last_page_number  = ( 65536 / 4096 ) - 2;
+
+	/* The file is not open and has no catalog hence the table states array is created here
+	 */
+	if( libcdata_array_initialize(
+	     &( internal_file->table_states_array ),
+	     ESEDB_TEST_FILE_NUMBER_OF_TABLE_DEFINITIONS,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create table states array.",
+		 function );
+
+		goto on_error;
+	}
+	for( table_definition_index = 0;
+	     table_definition_index < ESEDB_TEST_FILE_NUMBER_OF_TABLE_DEFINITIONS;
+	     table_definition_index++ )
+	{
+		if( libesedb_catalog_definition_initialize(
+		     &table_catalog_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create table catalog definition: %d.",
+			 function,
+			 table_definition_index );
+
+			goto on_error;
+		}
+		table_catalog_definition->type                    = LIBESEDB_CATALOG_DEFINITION_TYPE_TABLE;
+		table_catalog_definition->father_data_page_number = 4;
+
+		if( libesedb_table_definition_initialize(
+		     &( table_definitions[ table_definition_index ] ),
+		     table_catalog_definition,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create table definition: %d.",
+			 function,
+			 table_definition_index );
+
+			goto on_error;
+		}
+		/* The table definition now manages the table catalog definition
+		 */
+		table_catalog_definition = NULL;
+
+		table_definitions[ table_definition_index ]->table_definition_index = table_definition_index;
+	}
+	return( 1 );
+
+on_error:
+	if( table_catalog_definition != NULL )
+	{
+		libesedb_catalog_definition_free(
+		 &table_catalog_definition,
+		 NULL );
+	}
+	esedb_test_file_free_table_states(
+	 file,
+	 table_definitions,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Tests the libesedb_internal_file_free_table_states function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_internal_file_free_table_states(
+     void )
+{
+	libesedb_table_definition_t *table_definitions[ ESEDB_TEST_FILE_NUMBER_OF_TABLE_DEFINITIONS ];
+
+	libcerror_error_t *error            = NULL;
+	libesedb_file_t *file               = NULL;
+	libesedb_table_state_t *table_state = NULL;
+	int number_of_references            = 0;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 table_definitions,
+	 0,
+	 sizeof( libesedb_table_definition_t * ) * ESEDB_TEST_FILE_NUMBER_OF_TABLE_DEFINITIONS );
+
+	result = esedb_test_file_initialize_table_states(
+	          &file,
+	          table_definitions,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_internal_file_get_table_state(
+	          (libesedb_internal_file_t *) file,
+	          table_definitions[ 0 ],
+	          NULL,
+	          &table_state,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "table_state",
+	 table_state );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_internal_file_free_table_states(
+	          (libesedb_internal_file_t *) file,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "internal_file->table_states_array",
+	 ( (libesedb_internal_file_t *) file )->table_states_array );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "internal_file->number_of_table_states",
+	 ( (libesedb_internal_file_t *) file )->number_of_table_states,
+	 0 );
+
+	/* The table state that is still referenced is detached from the file instead of freed
+	 */
+	ESEDB_TEST_ASSERT_EQUAL_UINT8(
+	 "table_state->is_detached",
+	 table_state->is_detached,
+	 1 );
+
+	result = libesedb_table_state_get_number_of_references(
+	          table_state,
+	          &number_of_references,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_references",
+	 number_of_references,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The detached table state is freed when the last reference is released
+	 */
+	result = libesedb_table_state_release(
+	          &table_state,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "table_state",
+	 table_state );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular case where the file has no table states
+	 */
+	result = libesedb_internal_file_free_table_states(
+	          (libesedb_internal_file_t *) file,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_internal_file_free_table_states(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = esedb_test_file_free_table_states(
+	          &file,
+	          table_definitions,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( table_state != NULL )
+	{
+		libesedb_table_state_release(
+		 &table_state,
+		 NULL );
+	}
+	esedb_test_file_free_table_states(
+	 &file,
+	 table_definitions,
+	 NULL );
+
+	return( 0 );
+}
+
+/* Tests the libesedb_internal_file_free_unreferenced_table_state function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_internal_file_free_unreferenced_table_state(
+     void )
+{
+	libesedb_table_definition_t *table_definitions[ ESEDB_TEST_FILE_NUMBER_OF_TABLE_DEFINITIONS ];
+	libesedb_table_state_t *table_states[ 2 ];
+
+	libcerror_error_t *error            = NULL;
+	libesedb_file_t *file               = NULL;
+	libesedb_table_state_t *table_state = NULL;
+	int result                          = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 table_definitions,
+	 0,
+	 sizeof( libesedb_table_definition_t * ) * ESEDB_TEST_FILE_NUMBER_OF_TABLE_DEFINITIONS );
+
+	memory_set(
+	 table_states,
+	 0,
+	 sizeof( libesedb_table_state_t * ) * 2 );
+
+	result = esedb_test_file_initialize_table_states(
+	          &file,
+	          table_definitions,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_internal_file_get_table_state(
+	          (libesedb_internal_file_t *) file,
+	          table_definitions[ 0 ],
+	          NULL,
+	          &( table_states[ 0 ] ),
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_internal_file_get_table_state(
+	          (libesedb_internal_file_t *) file,
+	          table_definitions[ 1 ],
+	          NULL,
+	          &( table_states[ 1 ] ),
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular case where all the table states are referenced
+	 */
+	result = libesedb_internal_file_free_unreferenced_table_state(
+	          (libesedb_internal_file_t *) file,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "internal_file->number_of_table_states",
+	 ( (libesedb_internal_file_t *) file )->number_of_table_states,
+	 2 );
+
+	/* Test regular case where the least recently referenced table state is freed
+	 */
+	result = libesedb_table_state_release(
+	          &( table_states[ 1 ] ),
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_table_state_release(
+	          &( table_states[ 0 ] ),
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_internal_file_free_unreferenced_table_state(
+	          (libesedb_internal_file_t *) file,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "internal_file->number_of_table_states",
+	 ( (libesedb_internal_file_t *) file )->number_of_table_states,
+	 1 );
+
+	result = libcdata_array_get_entry_by_index(
+	          ( (libesedb_internal_file_t *) file )->table_states_array,
+	          0,
+	          (intptr_t **) &table_state,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "table_state",
+	 table_state );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_get_entry_by_index(
+	          ( (libesedb_internal_file_t *) file )->table_states_array,
+	          1,
+	          (intptr_t **) &table_state,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "table_state",
+	 table_state );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	table_state = NULL;
+
+	/* Test error cases
+	 */
+	result = libesedb_internal_file_free_unreferenced_table_state(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = esedb_test_file_free_table_states(
+	          &file,
+	          table_definitions,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( table_states[ 1 ] != NULL )
+	{
+		libesedb_table_state_release(
+		 &( table_states[ 1 ] ),
+		 NULL );
+	}
+	if( table_states[ 0 ] != NULL )
+	{
+		libesedb_table_state_release(
+		 &( table_states[ 0 ] ),
+		 NULL );
+	}
+	esedb_test_file_free_table_states(
+	 &file,
+	 table_definitions,
+	 NULL );
+
+	return( 0 );
+}
+
+/* Tests the libesedb_internal_file_get_table_state function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_internal_file_get_table_state(
+     void )
+{
+	libesedb_table_definition_t *table_definitions[ ESEDB_TEST_FILE_NUMBER_OF_TABLE_DEFINITIONS ];
+
+	libcerror_error_t *error                      = NULL;
+	libesedb_file_t *file                         = NULL;
+	libesedb_table_state_t *last_table_state      = NULL;
+	libesedb_table_state_t *referenced_table_state = NULL;
+	libesedb_table_state_t *table_state           = NULL;
+	int number_of_references                      = 0;
+	int result                                    = 0;
+	int table_definition_index                    = 0;
+
+	/* Initialize test
+	 */
+	memory_set(
+	 table_definitions,
+	 0,
+	 sizeof( libesedb_table_definition_t * ) * ESEDB_TEST_FILE_NUMBER_OF_TABLE_DEFINITIONS );
+
+	result = esedb_test_file_initialize_table_states(
+	          &file,
+	          table_definitions,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_internal_file_get_table_state(
+	          (libesedb_internal_file_t *) file,
+	          table_definitions[ 0 ],
+	          NULL,
+	          &referenced_table_state,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "referenced_table_state",
+	 referenced_table_state );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "internal_file->number_of_table_states",
+	 ( (libesedb_internal_file_t *) file )->number_of_table_states,
+	 1 );
+
+	/* Test regular case where the table state of the same table definition is reused
+	 */
+	result = libesedb_internal_file_get_table_state(
+	          (libesedb_internal_file_t *) file,
+	          table_definitions[ 0 ],
+	          NULL,
+	          &table_state,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INTPTR(
+	 "table_state",
+	 (intptr_t) table_state,
+	 (intptr_t) referenced_table_state );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "internal_file->number_of_table_states",
+	 ( (libesedb_internal_file_t *) file )->number_of_table_states,
+	 1 );
+
+	result = libesedb_table_state_get_number_of_references(
+	          referenced_table_state,
+	          &number_of_references,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_references",
+	 number_of_references,
+	 2 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_table_state_release(
+	          &table_state,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular case where the table states that are not referenced are retained
+	 * up to the maximum number of table states
+	 */
+	for( table_definition_index = 1;
+	     table_definition_index < LIBESEDB_MAXIMUM_CACHE_ENTRIES_TABLE_STATES;
+	     table_definition_index++ )
+	{
+		result = libesedb_internal_file_get_table_state(
+		          (libesedb_internal_file_t *) file,
+		          table_definitions[ table_definition_index ],
+		          NULL,
+		          &table_state,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		if( table_definition_index == 1 )
+		{
+			last_table_state = table_state;
+		}
+		result = libesedb_table_state_release(
+		          &table_state,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "internal_file->number_of_table_states",
+	 ( (libesedb_internal_file_t *) file )->number_of_table_states,
+	 LIBESEDB_MAXIMUM_CACHE_ENTRIES_TABLE_STATES );
+
+	/* Test regular case where a table state that is not referenced is retained
+	 */
+	result = libesedb_internal_file_get_table_state(
+	          (libesedb_internal_file_t *) file,
+	          table_definitions[ 1 ],
+	          NULL,
+	          &table_state,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INTPTR(
+	 "table_state",
+	 (intptr_t) table_state,
+	 (intptr_t) last_table_state );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_table_state_release(
+	          &table_state,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	last_table_state = NULL;
+
+	/* Test regular case where the maximum number of table states is exceeded and
+	 * the least recently referenced table state that is not referenced is freed
+	 */
+	result = libesedb_internal_file_get_table_state(
+	          (libesedb_internal_file_t *) file,
+	          table_definitions[ LIBESEDB_MAXIMUM_CACHE_ENTRIES_TABLE_STATES ],
+	          NULL,
+	          &last_table_state,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "last_table_state",
+	 last_table_state );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "internal_file->number_of_table_states",
+	 ( (libesedb_internal_file_t *) file )->number_of_table_states,
+	 LIBESEDB_MAXIMUM_CACHE_ENTRIES_TABLE_STATES );
+
+	/* The table state of table definition 2 was least recently referenced
+	 */
+	result = libcdata_array_get_entry_by_index(
+	          ( (libesedb_internal_file_t *) file )->table_states_array,
+	          2,
+	          (intptr_t **) &table_state,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "table_state",
+	 table_state );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The table state that is still referenced survives
+	 */
+	result = libcdata_array_get_entry_by_index(
+	          ( (libesedb_internal_file_t *) file )->table_states_array,
+	          0,
+	          (intptr_t **) &table_state,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INTPTR(
+	 "table_state",
+	 (intptr_t) table_state,
+	 (intptr_t) referenced_table_state );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	table_state = NULL;
+
+	/* Test error cases
+	 */
+	result = libesedb_internal_file_get_table_state(
+	          NULL,
+	          table_definitions[ 0 ],
+	          NULL,
+	          &table_state,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_internal_file_get_table_state(
+	          (libesedb_internal_file_t *) file,
+	          NULL,
+	          NULL,
+	          &table_state,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_internal_file_get_table_state(
+	          (libesedb_internal_file_t *) file,
+	          table_definitions[ 0 ],
+	          NULL,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_table_state_release(
+	          &last_table_state,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_table_state_release(
+	          &referenced_table_state,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_file_free_table_states(
+	          &file,
+	          table_definitions,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "file",
+	 file );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( table_state != NULL )
+	{
+		libesedb_table_state_release(
+		 &table_state,
+		 NULL );
+	}
+	if( last_table_state != NULL )
+	{
+		libesedb_table_state_release(
+		 &last_table_state,
+		 NULL );
+	}
+	if( referenced_table_state != NULL )
+	{
+		libesedb_table_state_release(
+		 &referenced_table_state,
+		 NULL );
+	}
+	esedb_test_file_free_table_states(
+	 &file,
+	 table_definitions,
+	 NULL );
+
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc,
+     wchar_t * const argv[] )
+#else
+int main(
+     int argc,
+     char * const argv[] )
+#endif
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	libesedb_file_t *file            = NULL;
+	system_character_t *source       = NULL;
+	system_integer_t option          = 0;
+	size_t string_length             = 0;
+	int result                       = 0;
+
+	while( ( option = esedb_test_getopt(
+	                   argc,
+	                   argv,
+	                   _SYSTEM_STRING( "" ) ) ) != (system_integer_t) -1 )
+	{
+		switch( option )
+		{
+			case (system_integer_t) '?':
+			default:
+				fprintf(
+				 stderr,
+				 "Invalid argument: %" PRIs_SYSTEM ".\n",
+				 argv[ optind - 1 ] );
+
+				return( EXIT_FAILURE );
+		}
+	}
+	if( optind < argc )
+	{
+		source = argv[ optind ];
+	}
+#if defined( HAVE_DEBUG_OUTPUT ) && defined( ESEDB_TEST_FILE_VERBOSE )
+	libesedb_notify_set_verbose(
+	 1 );
+	libesedb_notify_set_stream(
+	 stderr,
+	 NULL );
+#endif
+
+	ESEDB_TEST_RUN(
+	 "libesedb_file_initialize",
+	 esedb_test_file_initialize );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_file_free",
+	 esedb_test_file_free );
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+	ESEDB_TEST_RUN(
+	 "libesedb_internal_file_read_metadata_cache_file_io_handle",
+	 esedb_test_internal_file_read_metadata_cache_file_io_handle );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_internal_file_write_metadata_cache_file_io_handle",
+	 esedb_test_internal_file_write_metadata_cache_file_io_handle );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_file_read_write_metadata_cache",
+	 esedb_test_file_read_write_metadata_cache );
+
+#if defined( HAVE_WIDE_CHARACTER_TYPE )
+
+	ESEDB_TEST_RUN(
+	 "libesedb_file_read_write_metadata_cache_wide",
+	 esedb_test_file_read_write_metadata_cache_wide );
+
+#endif /* defined( HAVE_WIDE_CHARACTER_TYPE ) */
+
+	ESEDB_TEST_RUN(
+	 "libesedb_internal_file_free_table_states",
+	 esedb_test_internal_file_free_table_states );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_internal_file_free_unreferenced_table_state",
+	 esedb_test_internal_file_free_unreferenced_table_state );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_internal_file_get_table_state",
+	 esedb_test_internal_file_get_table_state );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
 
 #if !defined( __BORLANDC__ ) || ( __BORLANDC__ >= 0x0560 )
 	if( source != NULL )
@@ -20,7 +20,9 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <narrow_string.h>
 #include <system_string.h>
 #include <types.h>
@@ -30,6 +32,7 @@
 #include <stdlib.h>
 #endif
 
+#include "esedb_test_functions.h"
 #include "esedb_test_libbfio.h"
 #include "esedb_test_libcerror.h"
 #include "esedb_test_libclocale.h"
@@ -560,3 +563,713 @@ int esedb_test_close_file_io_handle(
 	return( result );
 }
 
+
+/* Writes the header of a page that has no page values
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_write_page_header(
+     uint8_t *page_data,
+     size_t page_size,
+     uint32_t previous_page_number,
+     uint32_t next_page_number,
+     uint32_t page_flags,
+     libcerror_error_t **error )
+{
+	static char *function = "esedb_test_write_page_header";
+
+	if( page_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( page_size < ESEDB_TEST_PAGE_HEADER_SIZE )
+	 || ( page_size > (size_t) UINT16_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     page_data,
+	     0,
+	     page_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear page data.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 &( page_data[ 16 ] ),
+	 previous_page_number );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( page_data[ 20 ] ),
+	 next_page_number );
+
+	/* The available data size
+	 */
+	byte_stream_copy_from_uint16_little_endian(
+	 &( page_data[ 28 ] ),
+	 (uint16_t) ( page_size - ESEDB_TEST_PAGE_HEADER_SIZE ) );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( page_data[ 36 ] ),
+	 page_flags );
+
+	return( 1 );
+}
+
+/* Appends a page value to a page
+ * The page value data is stored after the previous page value and its page tag
+ * in front of the previous page tag, at the end of the page
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_append_page_value(
+     uint8_t *page_data,
+     size_t page_size,
+     const uint8_t *value_data,
+     uint16_t value_size,
+     uint8_t page_tag_flags,
+     libcerror_error_t **error )
+{
+	static char *function          = "esedb_test_append_page_value";
+	size_t page_tag_offset         = 0;
+	uint16_t available_data_offset = 0;
+	uint16_t available_data_size   = 0;
+	uint16_t number_of_page_tags   = 0;
+
+	if( page_data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page data.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( page_size < ESEDB_TEST_PAGE_HEADER_SIZE )
+	 || ( page_size > (size_t) UINT16_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( value_data == NULL )
+	 && ( value_size > 0 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid value data.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_to_uint16_little_endian(
+	 &( page_data[ 28 ] ),
+	 available_data_size );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 &( page_data[ 32 ] ),
+	 available_data_offset );
+
+	byte_stream_copy_to_uint16_little_endian(
+	 &( page_data[ 34 ] ),
+	 number_of_page_tags );
+
+	if( ( (size_t) value_size + 4 ) > (size_t) available_data_size )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid value size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_size > 0 )
+	{
+		if( memory_copy(
+		     &( page_data[ ESEDB_TEST_PAGE_HEADER_SIZE + available_data_offset ] ),
+		     value_data,
+		     (size_t) value_size ) == NULL )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_MEMORY,
+			 LIBCERROR_MEMORY_ERROR_COPY_FAILED,
+			 "%s: unable to copy value data.",
+			 function );
+
+			return( -1 );
+		}
+	}
+	/* The page tags are stored back to front, where the page tag offset
+	 * is relative to the end of the page header and its upper 3 bits contain the flags
+	 */
+	page_tag_offset = page_size - ( 4 * ( (size_t) number_of_page_tags + 1 ) );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( page_data[ page_tag_offset ] ),
+	 value_size );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( page_data[ page_tag_offset + 2 ] ),
+	 (uint16_t) ( ( (uint16_t) page_tag_flags << 13 ) | available_data_offset ) );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( page_data[ 28 ] ),
+	 available_data_size - ( value_size + 4 ) );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( page_data[ 32 ] ),
+	 available_data_offset + value_size );
+
+	byte_stream_copy_from_uint16_little_endian(
+	 &( page_data[ 34 ] ),
+	 number_of_page_tags + 1 );
+
+	return( 1 );
+}
+
+/* Writes a page tree that consists of a root branch page followed by a chain of leaf pages
+ * The root page header contains the initial number of pages and no space trees.
+ * The leaf values have a 2-byte big-endian key that contains their index. The data of a record
+ * leaf value is a record without values, the data of an index leaf value the key of the record
+ * in reverse order, as in an index on a descending column
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_write_page_tree(
+     uint8_t *data,
+     size_t data_size,
+     size_t page_size,
+     uint32_t root_page_number,
+     uint32_t initial_number_of_pages,
+     const int *number_of_leaf_values,
+     int number_of_leaf_pages,
+     uint8_t leaf_value_type,
+     libcerror_error_t **error )
+{
+	uint8_t root_page_header_data[ 16 ];
+	uint8_t value_data[ 8 ];
+
+	uint8_t *page_data            = NULL;
+	static char *function         = "esedb_test_write_page_tree";
+	uint32_t leaf_page_number     = 0;
+	uint32_t next_page_number     = 0;
+	uint32_t previous_page_number = 0;
+	int leaf_page_index           = 0;
+	int leaf_value_index          = 0;
+	int page_leaf_value_index     = 0;
+	int total_number_of_values    = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_leaf_values == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of leaf values.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( root_page_number == 0 )
+	 || ( number_of_leaf_pages <= 0 )
+	 || ( ( (size_t) root_page_number + number_of_leaf_pages + 1 ) > ( data_size / page_size ) ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of leaf pages value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( leaf_value_type != ESEDB_TEST_PAGE_TREE_LEAF_VALUE_TYPE_RECORD )
+	 && ( leaf_value_type != ESEDB_TEST_PAGE_TREE_LEAF_VALUE_TYPE_INDEX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: unsupported leaf value type.",
+		 function );
+
+		return( -1 );
+	}
+	for( leaf_page_index = 0;
+	     leaf_page_index < number_of_leaf_pages;
+	     leaf_page_index++ )
+	{
+		total_number_of_values += number_of_leaf_values[ leaf_page_index ];
+	}
+	if( total_number_of_values > (int) UINT16_MAX )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of leaf values value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	/* Page n is stored at offset ( n + 1 ) * page size, after the file header and its backup
+	 */
+	page_data = &( data[ ( root_page_number + 1 ) * page_size ] );
+
+	if( esedb_test_write_page_header(
+	     page_data,
+	     page_size,
+	     0,
+	     0,
+	     0x00000001UL | 0x00000004UL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to write root page header.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     root_page_header_data,
+	     0,
+	     16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear root page header data.",
+		 function );
+
+		return( -1 );
+	}
+	byte_stream_copy_from_uint32_little_endian(
+	 root_page_header_data,
+	 initial_number_of_pages );
+
+	if( esedb_test_append_page_value(
+	     page_data,
+	     page_size,
+	     root_page_header_data,
+	     16,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append root page header.",
+		 function );
+
+		return( -1 );
+	}
+	/* The key of a branch value is the key of the first leaf value of the next leaf page
+	 * and the key of the last branch value is greater than the key of any leaf value
+	 */
+	leaf_value_index = 0;
+
+	for( leaf_page_index = 0;
+	     leaf_page_index < number_of_leaf_pages;
+	     leaf_page_index++ )
+	{
+		leaf_value_index += number_of_leaf_values[ leaf_page_index ];
+		leaf_page_number  = root_page_number + 1 + (uint32_t) leaf_page_index;
+
+		byte_stream_copy_from_uint16_little_endian(
+		 value_data,
+		 2 );
+
+		if( leaf_page_index == ( number_of_leaf_pages - 1 ) )
+		{
+			byte_stream_copy_from_uint16_big_endian(
+			 &( value_data[ 2 ] ),
+			 0xffff );
+		}
+		else
+		{
+			byte_stream_copy_from_uint16_big_endian(
+			 &( value_data[ 2 ] ),
+			 (uint16_t) leaf_value_index );
+		}
+		byte_stream_copy_from_uint32_little_endian(
+		 &( value_data[ 4 ] ),
+		 leaf_page_number );
+
+		if( esedb_test_append_page_value(
+		     page_data,
+		     page_size,
+		     value_data,
+		     8,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append branch value: %d.",
+			 function,
+			 leaf_page_index );
+
+			return( -1 );
+		}
+	}
+	leaf_value_index = 0;
+
+	for( leaf_page_index = 0;
+	     leaf_page_index < number_of_leaf_pages;
+	     leaf_page_index++ )
+	{
+		leaf_page_number = root_page_number + 1 + (uint32_t) leaf_page_index;
+
+		if( leaf_page_index > 0 )
+		{
+			previous_page_number = leaf_page_number - 1;
+		}
+		else
+		{
+			previous_page_number = 0;
+		}
+		if( leaf_page_index < ( number_of_leaf_pages - 1 ) )
+		{
+			next_page_number = leaf_page_number + 1;
+		}
+		else
+		{
+			next_page_number = 0;
+		}
+		page_data = &( data[ ( leaf_page_number + 1 ) * page_size ] );
+
+		if( esedb_test_write_page_header(
+		     page_data,
+		     page_size,
+		     previous_page_number,
+		     next_page_number,
+		     0x00000002UL,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to write leaf page: %" PRIu32 " header.",
+			 function,
+			 leaf_page_number );
+
+			return( -1 );
+		}
+		/* The first page value of a leaf page contains the common key, which is empty
+		 */
+		if( esedb_test_append_page_value(
+		     page_data,
+		     page_size,
+		     NULL,
+		     0,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append common key of leaf page: %" PRIu32 ".",
+			 function,
+			 leaf_page_number );
+
+			return( -1 );
+		}
+		for( page_leaf_value_index = 0;
+		     page_leaf_value_index < number_of_leaf_values[ leaf_page_index ];
+		     page_leaf_value_index++ )
+		{
+			byte_stream_copy_from_uint16_little_endian(
+			 value_data,
+			 2 );
+
+			byte_stream_copy_from_uint16_big_endian(
+			 &( value_data[ 2 ] ),
+			 (uint16_t) leaf_value_index );
+
+			if( leaf_value_type == ESEDB_TEST_PAGE_TREE_LEAF_VALUE_TYPE_INDEX )
+			{
+				byte_stream_copy_from_uint16_big_endian(
+				 &( value_data[ 4 ] ),
+				 (uint16_t) ( total_number_of_values - 1 - leaf_value_index ) );
+
+				value_data[ 6 ] = 0;
+				value_data[ 7 ] = 0;
+			}
+			else
+			{
+				/* A record without values that consists of the last fixed size
+				 * and last variable size data types and the variable size data types offset
+				 */
+				value_data[ 4 ] = 0x00;
+				value_data[ 5 ] = 0x7f;
+				value_data[ 6 ] = 0x04;
+				value_data[ 7 ] = 0x00;
+			}
+			if( esedb_test_append_page_value(
+			     page_data,
+			     page_size,
+			     value_data,
+			     ( leaf_value_type == ESEDB_TEST_PAGE_TREE_LEAF_VALUE_TYPE_INDEX ) ? 6 : 8,
+			     0,
+			     error ) != 1 )
+			{
+				libcerror_error_set(
+				 error,
+				 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+				 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+				 "%s: unable to append leaf value: %d.",
+				 function,
+				 leaf_value_index );
+
+				return( -1 );
+			}
+			leaf_value_index++;
+		}
+	}
+	return( 1 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+/* Opens the IO handle, page cache and file IO handle of page tree test data
+ * The data must contain the file header, its backup and the pages, where page_cache is optional
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_open_page_tree_source(
+     libesedb_io_handle_t **io_handle,
+     libesedb_page_cache_t **page_cache,
+     libbfio_handle_t **file_io_handle,
+     uint8_t *data,
+     size_t data_size,
+     size_t page_size,
+     int maximum_number_of_cached_pages,
+     libcerror_error_t **error )
+{
+	static char *function = "esedb_test_open_page_tree_source";
+
+	if( io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( file_io_handle == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid file IO handle.",
+		 function );
+
+		return( -1 );
+	}
+	if( ( page_size == 0 )
+	 || ( page_size > (size_t) UINT32_MAX ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid page size value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+	if( data_size < ( 2 * page_size ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid data size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_io_handle_initialize(
+	     io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	/* The first 2 pages contain the file header and its backup
+	 */
+	( *io_handle )->format_version    = 0x00000620;
+	( *io_handle )->format_revision   = 0x0000000c;
+	( *io_handle )->page_size         = (uint32_t) page_size;
+	( *io_handle )->pages_data_offset = (off64_t) ( 2 * page_size );
+	( *io_handle )->pages_data_size   = (size64_t) ( data_size - ( 2 * page_size ) );
+	( *io_handle )->last_page_number  = (uint32_t) ( ( data_size / page_size ) - 2 );
+
+	if( page_cache != NULL )
+	{
+		if( libesedb_page_cache_initialize(
+		     page_cache,
+		     *io_handle,
+		     maximum_number_of_cached_pages,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create page cache.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( esedb_test_open_file_io_handle(
+	     file_io_handle,
+	     data,
+	     data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open file IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( ( page_cache != NULL )
+	 && ( *page_cache != NULL ) )
+	{
+		libesedb_page_cache_free(
+		 page_cache,
+		 NULL );
+	}
+	if( *io_handle != NULL )
+	{
+		libesedb_io_handle_free(
+		 io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Closes the IO handle, page cache and file IO handle opened by esedb_test_open_page_tree_source
+ * Returns 0 if successful or -1 on error
+ */
+int esedb_test_close_page_tree_source(
+     libesedb_io_handle_t **io_handle,
+     libesedb_page_cache_t **page_cache,
+     libbfio_handle_t **file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "esedb_test_close_page_tree_source";
+	int result            = 0;
+
+	if( esedb_test_close_file_io_handle(
+	     file_io_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close file IO handle.",
+		 function );
+
+		result = -1;
+	}
+	if( page_cache != NULL )
+	{
+		if( libesedb_page_cache_free(
+		     page_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free page cache.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( libesedb_io_handle_free(
+	     io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free IO handle.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
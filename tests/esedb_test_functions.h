@@ -28,10 +28,24 @@
 #include "esedb_test_libbfio.h"
 #include "esedb_test_libcerror.h"
 
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+#include "../libesedb/libesedb_io_handle.h"
+#include "../libesedb/libesedb_page_cache.h"
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
 #if defined( __cplusplus )
 extern "C" {
 #endif
 
+/* The size of the (non-extended) page header
+ */
+#define ESEDB_TEST_PAGE_HEADER_SIZE			40
+
+#define ESEDB_TEST_PAGE_TREE_LEAF_VALUE_TYPE_RECORD	1
+#define ESEDB_TEST_PAGE_TREE_LEAF_VALUE_TYPE_INDEX	2
+
 int esedb_test_get_narrow_source(
      const system_character_t *source,
      char *narrow_string,
@@ -58,6 +72,53 @@ int esedb_test_close_file_io_handle(
      libbfio_handle_t **file_io_handle,
      libcerror_error_t **error );
 
+int esedb_test_write_page_header(
+     uint8_t *page_data,
+     size_t page_size,
+     uint32_t previous_page_number,
+     uint32_t next_page_number,
+     uint32_t page_flags,
+     libcerror_error_t **error );
+
+int esedb_test_append_page_value(
+     uint8_t *page_data,
+     size_t page_size,
+     const uint8_t *value_data,
+     uint16_t value_size,
+     uint8_t page_tag_flags,
+     libcerror_error_t **error );
+
+int esedb_test_write_page_tree(
+     uint8_t *data,
+     size_t data_size,
+     size_t page_size,
+     uint32_t root_page_number,
+     uint32_t initial_number_of_pages,
+     const int *number_of_leaf_values,
+     int number_of_leaf_pages,
+     uint8_t leaf_value_type,
+     libcerror_error_t **error );
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+int esedb_test_open_page_tree_source(
+     libesedb_io_handle_t **io_handle,
+     libesedb_page_cache_t **page_cache,
+     libbfio_handle_t **file_io_handle,
+     uint8_t *data,
+     size_t data_size,
+     size_t page_size,
+     int maximum_number_of_cached_pages,
+     libcerror_error_t **error );
+
+int esedb_test_close_page_tree_source(
+     libesedb_io_handle_t **io_handle,
+     libesedb_page_cache_t **page_cache,
+     libbfio_handle_t **file_io_handle,
+     libcerror_error_t **error );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
 #if defined( __cplusplus )
 }
 #endif
@@ -21,33 +21,1581 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
 #include <stdlib.h>
 #endif
 
+#include "esedb_test_functions.h"
+#include "esedb_test_libbfio.h"
+#include "esedb_test_libcdata.h"
 #include "esedb_test_libcerror.h"
 #include "esedb_test_libesedb.h"
 #include "esedb_test_macros.h"
 #include "esedb_test_memory.h"
 #include "esedb_test_unused.h"
 
+#include "../libesedb/libesedb_catalog_definition.h"
+#include "../libesedb/libesedb_definitions.h"
 #include "../libesedb/libesedb_index.h"
+#include "../libesedb/libesedb_io_handle.h"
+#include "../libesedb/libesedb_page_tree_key.h"
+#include "../libesedb/libesedb_record.h"
+#include "../libesedb/libesedb_table_definition.h"
+#include "../libesedb/libesedb_table_state.h"
+
+#define ESEDB_TEST_INDEX_INDEX_ROOT_PAGE_NUMBER		5
+#define ESEDB_TEST_INDEX_NUMBER_OF_LEAF_PAGES		3
+#define ESEDB_TEST_INDEX_NUMBER_OF_PAGES		8
+#define ESEDB_TEST_INDEX_NUMBER_OF_RECORDS		100
+#define ESEDB_TEST_INDEX_PAGE_SIZE			4096
+#define ESEDB_TEST_INDEX_TABLE_ROOT_PAGE_NUMBER		1
+
+/* The number of records per table leaf page, including an empty leaf page
+ */
+int esedb_test_index_table_number_of_leaf_values[ ESEDB_TEST_INDEX_NUMBER_OF_LEAF_PAGES ] = {
+	40, 0, 60 };
+
+/* The number of index values per index leaf page
+ */
+int esedb_test_index_index_number_of_leaf_values[ ESEDB_TEST_INDEX_NUMBER_OF_LEAF_PAGES ] = {
+	30, 30, 40 };
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+/* Opens an index of ESEDB_TEST_INDEX_NUMBER_OF_RECORDS records without values
+ * The index is on a descending column, hence index value 0 references the last record of the table
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_index_open_source(
+     libesedb_index_t **index,
+     libesedb_catalog_definition_t **index_catalog_definition,
+     libesedb_table_state_t **table_state,
+     libesedb_table_definition_t **table_definition,
+     libesedb_io_handle_t **io_handle,
+     libbfio_handle_t **file_io_handle,
+     uint8_t **data,
+     libcerror_error_t **error )
+{
+	libesedb_catalog_definition_t *table_catalog_definition = NULL;
+	static char *function                                   = "esedb_test_index_open_source";
+	size_t data_size                                        = 0;
+
+	if( index_catalog_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index catalog definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	/* The first 2 pages contain the file header and its backup
+	 */
+	data_size = ( 2 + ESEDB_TEST_INDEX_NUMBER_OF_PAGES ) * ESEDB_TEST_INDEX_PAGE_SIZE;
+
+	*data = (uint8_t *) memory_allocate(
+	                     sizeof( uint8_t ) * data_size );
+
+	if( *data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *data,
+	     0,
+	     data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear data.",
+		 function );
+
+		goto on_error;
+	}
+	if( esedb_test_write_page_tree(
+	     *data,
+	     data_size,
+	     ESEDB_TEST_INDEX_PAGE_SIZE,
+	     ESEDB_TEST_INDEX_TABLE_ROOT_PAGE_NUMBER,
+	     1 + ESEDB_TEST_INDEX_NUMBER_OF_LEAF_PAGES,
+	     esedb_test_index_table_number_of_leaf_values,
+	     ESEDB_TEST_INDEX_NUMBER_OF_LEAF_PAGES,
+	     ESEDB_TEST_PAGE_TREE_LEAF_VALUE_TYPE_RECORD,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to write table page tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( esedb_test_write_page_tree(
+	     *data,
+	     data_size,
+	     ESEDB_TEST_INDEX_PAGE_SIZE,
+	     ESEDB_TEST_INDEX_INDEX_ROOT_PAGE_NUMBER,
+	     1 + ESEDB_TEST_INDEX_NUMBER_OF_LEAF_PAGES,
+	     esedb_test_index_index_number_of_leaf_values,
+	     ESEDB_TEST_INDEX_NUMBER_OF_LEAF_PAGES,
+	     ESEDB_TEST_PAGE_TREE_LEAF_VALUE_TYPE_INDEX,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to write index page tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( esedb_test_open_page_tree_source(
+	     io_handle,
+	     NULL,
+	     file_io_handle,
+	     *data,
+	     data_size,
+	     ESEDB_TEST_INDEX_PAGE_SIZE,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open page tree source.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_catalog_definition_initialize(
+	     &table_catalog_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create table catalog definition.",
+		 function );
+
+		goto on_error;
+	}
+	table_catalog_definition->type                    = LIBESEDB_CATALOG_DEFINITION_TYPE_TABLE;
+	table_catalog_definition->father_data_page_number = ESEDB_TEST_INDEX_TABLE_ROOT_PAGE_NUMBER;
+
+	if( libesedb_table_definition_initialize(
+	     table_definition,
+	     table_catalog_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create table definition.",
+		 function );
+
+		goto on_error;
+	}
+	/* The table definition now manages the table catalog definition
+	 */
+	table_catalog_definition = NULL;
+
+	if( libesedb_table_state_initialize(
+	     table_state,
+	     *io_handle,
+	     *table_definition,
+	     NULL,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create table state.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_catalog_definition_initialize(
+	     index_catalog_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create index catalog definition.",
+		 function );
+
+		goto on_error;
+	}
+	( *index_catalog_definition )->type                    = LIBESEDB_CATALOG_DEFINITION_TYPE_INDEX;
+	( *index_catalog_definition )->father_data_page_number = ESEDB_TEST_INDEX_INDEX_ROOT_PAGE_NUMBER;
+
+	if( libesedb_index_initialize(
+	     index,
+	     *file_io_handle,
+	     *io_handle,
+	     *table_definition,
+	     NULL,
+	     *index_catalog_definition,
+	     ( *table_state )->page_cache,
+	     ( *table_state )->table_page_tree,
+	     ( *table_state )->long_values_page_tree,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create index.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *index_catalog_definition != NULL )
+	{
+		libesedb_catalog_definition_free(
+		 index_catalog_definition,
+		 NULL );
+	}
+	if( *table_state != NULL )
+	{
+		libesedb_table_state_free(
+		 table_state,
+		 NULL );
+	}
+	if( *table_definition != NULL )
+	{
+		libesedb_table_definition_free(
+		 table_definition,
+		 NULL );
+	}
+	if( table_catalog_definition != NULL )
+	{
+		libesedb_catalog_definition_free(
+		 &table_catalog_definition,
+		 NULL );
+	}
+	if( *io_handle != NULL )
+	{
+		esedb_test_close_page_tree_source(
+		 io_handle,
+		 NULL,
+		 file_io_handle,
+		 NULL );
+	}
+	if( *data != NULL )
+	{
+		memory_free(
+		 *data );
+
+		*data = NULL;
+	}
+	return( -1 );
+}
+
+/* Closes an index opened by esedb_test_index_open_source
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_index_close_source(
+     libesedb_index_t **index,
+     libesedb_catalog_definition_t **index_catalog_definition,
+     libesedb_table_state_t **table_state,
+     libesedb_table_definition_t **table_definition,
+     libesedb_io_handle_t **io_handle,
+     libbfio_handle_t **file_io_handle,
+     uint8_t **data,
+     libcerror_error_t **error )
+{
+	static char *function = "esedb_test_index_close_source";
+	int result            = 1;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_index_free(
+	     index,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free index.",
+		 function );
+
+		result = -1;
+	}
+	if( libesedb_catalog_definition_free(
+	     index_catalog_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free index catalog definition.",
+		 function );
+
+		result = -1;
+	}
+	if( libesedb_table_state_free(
+	     table_state,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free table state.",
+		 function );
+
+		result = -1;
+	}
+	if( libesedb_table_definition_free(
+	     table_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free table definition.",
+		 function );
+
+		result = -1;
+	}
+	if( esedb_test_close_page_tree_source(
+	     io_handle,
+	     NULL,
+	     file_io_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close page tree source.",
+		 function );
+
+		result = -1;
+	}
+	if( *data != NULL )
+	{
+		memory_free(
+		 *data );
+
+		*data = NULL;
+	}
+	return( result );
+}
+
+/* Checks if the records are the table records referenced by a range of index values
+ * Index value n references the table record with key ESEDB_TEST_INDEX_NUMBER_OF_RECORDS - 1 - n
+ * Returns 1 if the records match, 0 if not or -1 on error
+ */
+int esedb_test_index_check_records(
+     libesedb_record_t **records,
+     int first_record_entry,
+     int number_of_records,
+     libcerror_error_t **error )
+{
+	libesedb_internal_record_t *internal_record = NULL;
+	static char *function                       = "esedb_test_index_check_records";
+	uint32_t expected_page_number               = 0;
+	uint16_t expected_page_value_index          = 0;
+	int leaf_page_index                         = 0;
+	int record_index                            = 0;
+	int table_record_index                      = 0;
+
+	if( records == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid records.",
+		 function );
+
+		return( -1 );
+	}
+	for( record_index = 0;
+	     record_index < number_of_records;
+	     record_index++ )
+	{
+		internal_record = (libesedb_internal_record_t *) records[ record_index ];
+
+		if( ( internal_record == NULL )
+		 || ( internal_record->data_definition == NULL ) )
+		{
+			return( 0 );
+		}
+		/* The first page value of a table leaf page contains the common key
+		 */
+		table_record_index = ESEDB_TEST_INDEX_NUMBER_OF_RECORDS - 1 - ( first_record_entry + record_index );
+
+		for( leaf_page_index = 0;
+		     leaf_page_index < ESEDB_TEST_INDEX_NUMBER_OF_LEAF_PAGES;
+		     leaf_page_index++ )
+		{
+			if( table_record_index < esedb_test_index_table_number_of_leaf_values[ leaf_page_index ] )
+			{
+				break;
+			}
+			table_record_index -= esedb_test_index_table_number_of_leaf_values[ leaf_page_index ];
+		}
+		expected_page_number      = ESEDB_TEST_INDEX_TABLE_ROOT_PAGE_NUMBER + 1 + (uint32_t) leaf_page_index;
+		expected_page_value_index = (uint16_t) ( table_record_index + 1 );
+
+		if( ( internal_record->data_definition->page_number != expected_page_number )
+		 || ( internal_record->data_definition->page_value_index != expected_page_value_index ) )
+		{
+			return( 0 );
+		}
+	}
+	return( 1 );
+}
+
+/* Creates an index bookmark of a key for testing
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_index_bookmark_initialize(
+     libesedb_index_bookmark_t **index_bookmark,
+     const uint8_t *key_data,
+     size_t key_data_size,
+     int record_index,
+     libcerror_error_t **error )
+{
+	static char *function = "esedb_test_index_bookmark_initialize";
+
+	if( index_bookmark == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid index bookmark.",
+		 function );
+
+		return( -1 );
+	}
+	*index_bookmark = memory_allocate_structure(
+	                   libesedb_index_bookmark_t );
+
+	if( *index_bookmark == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create index bookmark.",
+		 function );
+
+		return( -1 );
+	}
+	( *index_bookmark )->key          = NULL;
+	( *index_bookmark )->record_index = record_index;
+
+	if( libesedb_page_tree_key_initialize(
+	     &( ( *index_bookmark )->key ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create key.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_page_tree_key_set_data(
+	     ( *index_bookmark )->key,
+	     key_data,
+	     key_data_size,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set key data.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	libesedb_index_bookmark_free(
+	 index_bookmark,
+	 NULL );
+
+	return( -1 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
 
 /* Tests the libesedb_index_free function
  * Returns 1 if successful or 0 if not
  */
-int esedb_test_index_free(
-     void )
+int esedb_test_index_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_index_free(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+/* Tests the libesedb_index_bookmark_free function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_index_bookmark_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_index_bookmark_free(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_index_bookmark_compare function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_index_bookmark_compare(
+     void )
+{
+	uint8_t first_key_data[ 4 ]  = { 0x7f, 0x80, 0x00, 0x01 };
+	uint8_t second_key_data[ 4 ] = { 0x7f, 0x00, 0x00, 0x02 };
+
+	libesedb_index_bookmark_t first_index_bookmark;
+	libesedb_index_bookmark_t second_index_bookmark;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	first_index_bookmark.record_index  = 0;
+	first_index_bookmark.key           = NULL;
+	second_index_bookmark.record_index = 1;
+	second_index_bookmark.key          = NULL;
+
+	/* Initialize test
+	 */
+	result = libesedb_page_tree_key_initialize(
+	          &( first_index_bookmark.key ),
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_key_set_data(
+	          first_index_bookmark.key,
+	          first_key_data,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_key_initialize(
+	          &( second_index_bookmark.key ),
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_key_set_data(
+	          second_index_bookmark.key,
+	          second_key_data,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_index_bookmark_compare(
+	          &first_index_bookmark,
+	          &second_index_bookmark,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBCDATA_COMPARE_LESS );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_index_bookmark_compare(
+	          &second_index_bookmark,
+	          &first_index_bookmark,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBCDATA_COMPARE_GREATER );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_index_bookmark_compare(
+	          &first_index_bookmark,
+	          &first_index_bookmark,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBCDATA_COMPARE_EQUAL );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_index_bookmark_compare(
+	          NULL,
+	          &second_index_bookmark,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_index_bookmark_compare(
+	          &first_index_bookmark,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_page_tree_key_free(
+	          &( second_index_bookmark.key ),
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_key_free(
+	          &( first_index_bookmark.key ),
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( second_index_bookmark.key != NULL )
+	{
+		libesedb_page_tree_key_free(
+		 &( second_index_bookmark.key ),
+		 NULL );
+	}
+	if( first_index_bookmark.key != NULL )
+	{
+		libesedb_page_tree_key_free(
+		 &( first_index_bookmark.key ),
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_index_bookmarks_sort function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_index_bookmarks_sort(
+     void )
+{
+	uint8_t key_data[ 7 ][ 2 ] = {
+		{ 0x00, 0x30 },
+		{ 0x00, 0x10 },
+		{ 0x00, 0x30 },
+		{ 0x00, 0x90 },
+		{ 0x00, 0x20 },
+		{ 0x00, 0x00 },
+		{ 0x01, 0x00 } };
+
+	size_t key_data_size[ 7 ] = { 2, 2, 2, 2, 2, 1, 2 };
+
+	/* Bookmarks with the same key are sorted by record index and the 0x80 bit
+	 * of the second key byte is ignored
+	 */
+	int expected_record_index[ 7 ] = { 5, 1, 3, 4, 0, 2, 6 };
+
+	libesedb_index_bookmark_t *index_bookmarks[ 7 ];
+	libesedb_index_bookmark_t invalid_index_bookmark;
+
+	libesedb_index_bookmark_t *invalid_index_bookmarks[ 2 ];
+	libcerror_error_t *error   = NULL;
+	int index_bookmark_index   = 0;
+	int result                 = 0;
+
+	for( index_bookmark_index = 0;
+	     index_bookmark_index < 7;
+	     index_bookmark_index++ )
+	{
+		index_bookmarks[ index_bookmark_index ] = NULL;
+	}
+	/* Initialize test
+	 */
+	for( index_bookmark_index = 0;
+	     index_bookmark_index < 7;
+	     index_bookmark_index++ )
+	{
+		result = esedb_test_index_bookmark_initialize(
+		          &( index_bookmarks[ index_bookmark_index ] ),
+		          key_data[ index_bookmark_index ],
+		          key_data_size[ index_bookmark_index ],
+		          index_bookmark_index,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test regular cases
+	 */
+	result = libesedb_index_bookmarks_sort(
+	          index_bookmarks,
+	          7,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( index_bookmark_index = 0;
+	     index_bookmark_index < 7;
+	     index_bookmark_index++ )
+	{
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "index_bookmarks[ index_bookmark_index ]->record_index",
+		 index_bookmarks[ index_bookmark_index ]->record_index,
+		 expected_record_index[ index_bookmark_index ] );
+	}
+	/* Sorting sorted bookmarks does not change their order
+	 */
+	result = libesedb_index_bookmarks_sort(
+	          index_bookmarks,
+	          7,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( index_bookmark_index = 0;
+	     index_bookmark_index < 7;
+	     index_bookmark_index++ )
+	{
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "index_bookmarks[ index_bookmark_index ]->record_index",
+		 index_bookmarks[ index_bookmark_index ]->record_index,
+		 expected_record_index[ index_bookmark_index ] );
+	}
+	result = libesedb_index_bookmarks_sort(
+	          index_bookmarks,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_index_bookmarks_sort(
+	          NULL,
+	          7,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_index_bookmarks_sort(
+	          index_bookmarks,
+	          -1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test sort with a bookmark without a key
+	 */
+	invalid_index_bookmark.record_index = 0;
+	invalid_index_bookmark.key          = NULL;
+
+	invalid_index_bookmarks[ 0 ] = index_bookmarks[ 0 ];
+	invalid_index_bookmarks[ 1 ] = &invalid_index_bookmark;
+
+	result = libesedb_index_bookmarks_sort(
+	          invalid_index_bookmarks,
+	          2,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	for( index_bookmark_index = 0;
+	     index_bookmark_index < 7;
+	     index_bookmark_index++ )
+	{
+		result = libesedb_index_bookmark_free(
+		          &( index_bookmarks[ index_bookmark_index ] ),
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	for( index_bookmark_index = 0;
+	     index_bookmark_index < 7;
+	     index_bookmark_index++ )
+	{
+		if( index_bookmarks[ index_bookmark_index ] != NULL )
+		{
+			libesedb_index_bookmark_free(
+			 &( index_bookmarks[ index_bookmark_index ] ),
+			 NULL );
+		}
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_internal_index_get_bookmark function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_internal_index_get_bookmark(
+     libesedb_index_t *index )
+{
+	libcerror_error_t *error                  = NULL;
+	libesedb_index_bookmark_t *index_bookmark = NULL;
+	int result                                = 0;
+
+	/* Test regular cases
+	 * The data of the first index value contains the key of the last record
+	 */
+	result = libesedb_internal_index_get_bookmark(
+	          (libesedb_internal_index_t *) index,
+	          0,
+	          &index_bookmark,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "index_bookmark",
+	 index_bookmark );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "index_bookmark->record_index",
+	 index_bookmark->record_index,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "index_bookmark->key",
+	 index_bookmark->key );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT8(
+	 "index_bookmark->key->type",
+	 index_bookmark->key->type,
+	 LIBESEDB_KEY_TYPE_INDEX_VALUE );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "index_bookmark->key->data_size",
+	 index_bookmark->key->data_size,
+	 (size_t) 2 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT8(
+	 "index_bookmark->key->data[ 0 ]",
+	 index_bookmark->key->data[ 0 ],
+	 0x00 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT8(
+	 "index_bookmark->key->data[ 1 ]",
+	 index_bookmark->key->data[ 1 ],
+	 ESEDB_TEST_INDEX_NUMBER_OF_RECORDS - 1 );
+
+	/* Test error cases
+	 */
+	result = libesedb_internal_index_get_bookmark(
+	          (libesedb_internal_index_t *) index,
+	          1,
+	          &index_bookmark,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_index_bookmark_free(
+	          &index_bookmark,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_internal_index_get_bookmark(
+	          NULL,
+	          0,
+	          &index_bookmark,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_internal_index_get_bookmark(
+	          (libesedb_internal_index_t *) index,
+	          0,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_internal_index_get_bookmark(
+	          (libesedb_internal_index_t *) index,
+	          ESEDB_TEST_INDEX_NUMBER_OF_RECORDS,
+	          &index_bookmark,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "index_bookmark",
+	 index_bookmark );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( index_bookmark != NULL )
+	{
+		libesedb_index_bookmark_free(
+		 &index_bookmark,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_internal_index_get_records function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_internal_index_get_records(
+     libesedb_index_t *index )
+{
+	libesedb_record_t *records[ ESEDB_TEST_INDEX_NUMBER_OF_RECORDS ];
+
+	int first_record_entries[ 3 ] = { 0, 25, 90 };
+	int numbers_of_records[ 3 ]   = { ESEDB_TEST_INDEX_NUMBER_OF_RECORDS, 40, 10 };
+	libcerror_error_t *error      = NULL;
+	int range_index               = 0;
+	int record_index              = 0;
+	int result                    = 0;
+
+	for( record_index = 0;
+	     record_index < ESEDB_TEST_INDEX_NUMBER_OF_RECORDS;
+	     record_index++ )
+	{
+		records[ record_index ] = NULL;
+	}
+	/* Test regular cases
+	 * The ranges are all records, records in multiple index and table leaf pages
+	 * and the last records
+	 */
+	for( range_index = 0;
+	     range_index < 3;
+	     range_index++ )
+	{
+		result = libesedb_internal_index_get_records(
+		          (libesedb_internal_index_t *) index,
+		          first_record_entries[ range_index ],
+		          numbers_of_records[ range_index ],
+		          records,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = esedb_test_index_check_records(
+		          records,
+		          first_record_entries[ range_index ],
+		          numbers_of_records[ range_index ],
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		for( record_index = 0;
+		     record_index < numbers_of_records[ range_index ];
+		     record_index++ )
+		{
+			result = libesedb_record_free(
+			          &( records[ record_index ] ),
+			          &error );
+
+			ESEDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 1 );
+
+			ESEDB_TEST_ASSERT_IS_NULL(
+			 "error",
+			 error );
+		}
+	}
+	result = libesedb_internal_index_get_records(
+	          (libesedb_internal_index_t *) index,
+	          0,
+	          0,
+	          records,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_internal_index_get_records(
+	          NULL,
+	          0,
+	          1,
+	          records,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_internal_index_get_records(
+	          (libesedb_internal_index_t *) index,
+	          -1,
+	          1,
+	          records,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_internal_index_get_records(
+	          (libesedb_internal_index_t *) index,
+	          0,
+	          -1,
+	          records,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_internal_index_get_records(
+	          (libesedb_internal_index_t *) index,
+	          1,
+	          INT_MAX,
+	          records,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_internal_index_get_records(
+	          (libesedb_internal_index_t *) index,
+	          0,
+	          1,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test retrieving a range that exceeds the number of records
+	 * where the records that were retrieved are freed on error
+	 */
+	result = libesedb_internal_index_get_records(
+	          (libesedb_internal_index_t *) index,
+	          90,
+	          20,
+	          records,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	for( record_index = 0;
+	     record_index < 20;
+	     record_index++ )
+	{
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "records[ record_index ]",
+		 records[ record_index ] );
+	}
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	for( record_index = 0;
+	     record_index < ESEDB_TEST_INDEX_NUMBER_OF_RECORDS;
+	     record_index++ )
+	{
+		if( records[ record_index ] != NULL )
+		{
+			libesedb_record_free(
+			 &( records[ record_index ] ),
+			 NULL );
+		}
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_index_get_records function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_index_get_records(
+     libesedb_index_t *index )
 {
+	libesedb_record_t *records[ 50 ];
+
 	libcerror_error_t *error = NULL;
+	int record_index         = 0;
 	int result               = 0;
 
+	for( record_index = 0;
+	     record_index < 50;
+	     record_index++ )
+	{
+		records[ record_index ] = NULL;
+	}
+	/* Test regular cases
+	 */
+	result = libesedb_index_get_records(
+	          index,
+	          20,
+	          50,
+	          records,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_index_check_records(
+	          records,
+	          20,
+	          50,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( record_index = 0;
+	     record_index < 50;
+	     record_index++ )
+	{
+		result = libesedb_record_free(
+		          &( records[ record_index ] ),
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
 	/* Test error cases
 	 */
-	result = libesedb_index_free(
+	result = libesedb_index_get_records(
 	          NULL,
+	          20,
+	          50,
+	          records,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_index_get_records(
+	          index,
+	          ESEDB_TEST_INDEX_NUMBER_OF_RECORDS,
+	          1,
+	          records,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -62,6 +1610,10 @@ int esedb_test_index_free(
 	libcerror_error_free(
 	 &error );
 
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "records[ 0 ]",
+	 records[ 0 ] );
+
 	return( 1 );
 
 on_error:
@@ -70,11 +1622,20 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	for( record_index = 0;
+	     record_index < 50;
+	     record_index++ )
+	{
+		if( records[ record_index ] != NULL )
+		{
+			libesedb_record_free(
+			 &( records[ record_index ] ),
+			 NULL );
+		}
+	}
 	return( 0 );
 }
 
-#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
-
 #endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
 
 /* The main program
@@ -89,6 +1650,18 @@ int main(
      char * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
 #endif
 {
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+	libbfio_handle_t *file_io_handle                        = NULL;
+	libcerror_error_t *error                                = NULL;
+	libesedb_catalog_definition_t *index_catalog_definition = NULL;
+	libesedb_index_t *index                                 = NULL;
+	libesedb_io_handle_t *io_handle                         = NULL;
+	libesedb_table_definition_t *table_definition           = NULL;
+	libesedb_table_state_t *table_state                     = NULL;
+	uint8_t *data                                           = NULL;
+	int result                                              = 0;
+#endif
+
 	ESEDB_TEST_UNREFERENCED_PARAMETER( argc )
 	ESEDB_TEST_UNREFERENCED_PARAMETER( argv )
 
@@ -118,11 +1691,103 @@ int main(
 
 	/* TODO: add tests for libesedb_index_get_record */
 
+	ESEDB_TEST_RUN(
+	 "libesedb_index_bookmark_free",
+	 esedb_test_index_bookmark_free );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_index_bookmark_compare",
+	 esedb_test_index_bookmark_compare );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_index_bookmarks_sort",
+	 esedb_test_index_bookmarks_sort );
+
+	/* Initialize test
+	 */
+	result = esedb_test_index_open_source(
+	          &index,
+	          &index_catalog_definition,
+	          &table_state,
+	          &table_definition,
+	          &io_handle,
+	          &file_io_handle,
+	          &data,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "index",
+	 index );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_RUN_WITH_ARGS(
+	 "libesedb_internal_index_get_bookmark",
+	 esedb_test_internal_index_get_bookmark,
+	 index );
+
+	ESEDB_TEST_RUN_WITH_ARGS(
+	 "libesedb_internal_index_get_records",
+	 esedb_test_internal_index_get_records,
+	 index );
+
+	ESEDB_TEST_RUN_WITH_ARGS(
+	 "libesedb_index_get_records",
+	 esedb_test_index_get_records,
+	 index );
+
+	/* Clean up
+	 */
+	result = esedb_test_index_close_source(
+	          &index,
+	          &index_catalog_definition,
+	          &table_state,
+	          &table_definition,
+	          &io_handle,
+	          &file_io_handle,
+	          &data,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
 
 on_error:
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( index != NULL )
+	{
+		esedb_test_index_close_source(
+		 &index,
+		 &index_catalog_definition,
+		 &table_state,
+		 &table_definition,
+		 &io_handle,
+		 &file_io_handle,
+		 &data,
+		 NULL );
+	}
+#endif
 	return( EXIT_FAILURE );
 }
 
@@ -431,8 +431,6 @@ int main(
 
 	/* TODO: add tests for libesedb_io_handle_set_pages_data_range */
 
-	/* TODO: add tests for libesedb_io_handle_read_page */
-
 #endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
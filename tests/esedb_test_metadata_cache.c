@@ -0,0 +1,2484 @@
+/*
+ * Library metadata_cache type test program
+ *
+ * Copyright (C) 2009-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "esedb_test_functions.h"
+#include "esedb_test_libbfio.h"
+#include "esedb_test_libcdata.h"
+#include "esedb_test_libcerror.h"
+#include "esedb_test_libesedb.h"
+#include "esedb_test_macros.h"
+#include "esedb_test_memory.h"
+#include "esedb_test_unused.h"
+
+#include "../libesedb/libesedb_io_handle.h"
+#include "../libesedb/libesedb_leaf_page_descriptor.h"
+#include "../libesedb/libesedb_metadata_cache.h"
+#include "../libesedb/libesedb_page_tree.h"
+
+/* Metadata cache with an entry of the page tree with root page 1 and without catalog data
+ */
+uint8_t esedb_test_metadata_cache_data1[ 104 ] = {
+	0x65, 0x73, 0x65, 0x64, 0x62, 0x6d, 0x63, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00 };
+
+/* Metadata cache with an entry of the page tree with root page 1 and catalog data of 2 catalog values
+ */
+uint8_t esedb_test_metadata_cache_data2[ 116 ] = {
+	0x65, 0x73, 0x65, 0x64, 0x62, 0x6d, 0x63, 0x00, 0x02, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00,
+	0x0c, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0xaa, 0xbb, 0xcc, 0x01, 0x00, 0x00, 0x00, 0xdd,
+	0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x00 };
+
+/* The leaf page descriptors of the entry in the metadata cache data
+ */
+libesedb_leaf_page_descriptor_t esedb_test_metadata_cache_leaf_page_descriptors[ 2 ] = {
+	{ 2, 0, 1 },
+	{ 3, 2, 2 } };
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+/* Frees a metadata cache and an IO handle created for testing
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_metadata_cache_free_with_io_handle(
+     libesedb_io_handle_t **io_handle,
+     libesedb_metadata_cache_t **metadata_cache,
+     libcerror_error_t **error )
+{
+	static char *function = "esedb_test_metadata_cache_free_with_io_handle";
+	int result            = 1;
+
+	if( *metadata_cache != NULL )
+	{
+		if( libesedb_metadata_cache_free(
+		     metadata_cache,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free metadata cache.",
+			 function );
+
+			result = -1;
+		}
+	}
+	if( *io_handle != NULL )
+	{
+		if( libesedb_io_handle_free(
+		     io_handle,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to free IO handle.",
+			 function );
+
+			result = -1;
+		}
+	}
+	return( result );
+}
+
+/* Creates an IO handle and a metadata cache for testing
+ * The metadata cache is read from data if data is not NULL
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_metadata_cache_initialize_from_data(
+     libesedb_io_handle_t **io_handle,
+     libesedb_metadata_cache_t **metadata_cache,
+     const uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "esedb_test_metadata_cache_initialize_from_data";
+
+	if( libesedb_io_handle_initialize(
+	     io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create IO handle.",
+		 function );
+
+		goto on_error;
+	}
+	( *io_handle )->page_size         = 4096;
+	( *io_handle )->pages_data_offset = 0;
+	( *io_handle )->pages_data_size   = 65536;
+	( *io_handle )->database_time     = 0x10;
+	( *io_handle )->last_page_number  = 16;
+
+	if( libesedb_metadata_cache_initialize(
+	     metadata_cache,
+	     *io_handle,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create metadata cache.",
+		 function );
+
+		goto on_error;
+	}
+	if( data != NULL )
+	{
+		if( libesedb_metadata_cache_read_data(
+		     *metadata_cache,
+		     data,
+		     data_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_IO,
+			 LIBCERROR_IO_ERROR_READ_FAILED,
+			 "%s: unable to read metadata cache.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	return( 1 );
+
+on_error:
+	esedb_test_metadata_cache_free_with_io_handle(
+	 io_handle,
+	 metadata_cache,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Tests the libesedb_metadata_cache_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_metadata_cache_initialize(
+     void )
+{
+	libcerror_error_t *error                  = NULL;
+	libesedb_io_handle_t *io_handle           = NULL;
+	libesedb_metadata_cache_t *metadata_cache = NULL;
+	int result                                = 0;
+
+#if defined( HAVE_ESEDB_TEST_MEMORY )
+	int number_of_malloc_fail_tests           = 2;
+	int number_of_memset_fail_tests           = 1;
+	int test_number                           = 0;
+#endif
+
+	/* Initialize test
+	 */
+	result = libesedb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->page_size         = 4096;
+	io_handle->pages_data_offset = 0;
+	io_handle->pages_data_size   = 65536;
+	io_handle->database_time     = 0x10;
+	io_handle->last_page_number  = 16;
+
+	/* Test regular cases
+	 */
+	result = libesedb_metadata_cache_initialize(
+	          &metadata_cache,
+	          io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "metadata_cache",
+	 metadata_cache );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_metadata_cache_free(
+	          &metadata_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "metadata_cache",
+	 metadata_cache );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_metadata_cache_initialize(
+	          NULL,
+	          io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	metadata_cache = (libesedb_metadata_cache_t *) 0x12345678UL;
+
+	result = libesedb_metadata_cache_initialize(
+	          &metadata_cache,
+	          io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	metadata_cache = NULL;
+
+	result = libesedb_metadata_cache_initialize(
+	          &metadata_cache,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_ESEDB_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libesedb_metadata_cache_initialize with malloc failing
+		 */
+		esedb_test_malloc_attempts_before_fail = test_number;
+
+		result = libesedb_metadata_cache_initialize(
+		          &metadata_cache,
+		          io_handle,
+		          &error );
+
+		if( esedb_test_malloc_attempts_before_fail != -1 )
+		{
+			esedb_test_malloc_attempts_before_fail = -1;
+
+			if( metadata_cache != NULL )
+			{
+				libesedb_metadata_cache_free(
+				 &metadata_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			ESEDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			ESEDB_TEST_ASSERT_IS_NULL(
+			 "metadata_cache",
+			 metadata_cache );
+
+			ESEDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libesedb_metadata_cache_initialize with memset failing
+		 */
+		esedb_test_memset_attempts_before_fail = test_number;
+
+		result = libesedb_metadata_cache_initialize(
+		          &metadata_cache,
+		          io_handle,
+		          &error );
+
+		if( esedb_test_memset_attempts_before_fail != -1 )
+		{
+			esedb_test_memset_attempts_before_fail = -1;
+
+			if( metadata_cache != NULL )
+			{
+				libesedb_metadata_cache_free(
+				 &metadata_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			ESEDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			ESEDB_TEST_ASSERT_IS_NULL(
+			 "metadata_cache",
+			 metadata_cache );
+
+			ESEDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_ESEDB_TEST_MEMORY ) */
+
+	/* Clean up
+	 */
+	result = libesedb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( metadata_cache != NULL )
+	{
+		libesedb_metadata_cache_free(
+		 &metadata_cache,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libesedb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_metadata_cache_free function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_metadata_cache_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_metadata_cache_free(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_metadata_cache_get_entry_by_root_page_number function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_metadata_cache_get_entry_by_root_page_number(
+     void )
+{
+	libcerror_error_t *error                              = NULL;
+	libesedb_io_handle_t *io_handle                       = NULL;
+	libesedb_metadata_cache_t *metadata_cache             = NULL;
+	libesedb_metadata_cache_entry_t *metadata_cache_entry = NULL;
+	int result                                            = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_metadata_cache_initialize_from_data(
+	          &io_handle,
+	          &metadata_cache,
+	          esedb_test_metadata_cache_data1,
+	          104,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_metadata_cache_get_entry_by_root_page_number(
+	          metadata_cache,
+	          1,
+	          &metadata_cache_entry,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "metadata_cache_entry",
+	 metadata_cache_entry );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "metadata_cache_entry->root_page_number",
+	 metadata_cache_entry->root_page_number,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "metadata_cache_entry->number_of_leaf_page_descriptors",
+	 metadata_cache_entry->number_of_leaf_page_descriptors,
+	 2 );
+
+	metadata_cache_entry = NULL;
+
+	result = libesedb_metadata_cache_get_entry_by_root_page_number(
+	          metadata_cache,
+	          2,
+	          &metadata_cache_entry,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "metadata_cache_entry",
+	 metadata_cache_entry );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_metadata_cache_get_entry_by_root_page_number(
+	          NULL,
+	          1,
+	          &metadata_cache_entry,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_metadata_cache_get_entry_by_root_page_number(
+	          metadata_cache,
+	          1,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = esedb_test_metadata_cache_free_with_io_handle(
+	          &io_handle,
+	          &metadata_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	esedb_test_metadata_cache_free_with_io_handle(
+	 &io_handle,
+	 &metadata_cache,
+	 NULL );
+
+	return( 0 );
+}
+
+/* Tests the libesedb_metadata_cache_get_leaf_page_descriptors function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_metadata_cache_get_leaf_page_descriptors(
+     void )
+{
+	libcerror_error_t *error                  = NULL;
+	libesedb_io_handle_t *io_handle           = NULL;
+	libesedb_metadata_cache_t *metadata_cache = NULL;
+	libesedb_page_tree_t *page_tree           = NULL;
+	int result                                = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_metadata_cache_initialize_from_data(
+	          &io_handle,
+	          &metadata_cache,
+	          esedb_test_metadata_cache_data1,
+	          104,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_initialize(
+	          &page_tree,
+	          io_handle,
+	          NULL,
+	          0,
+	          1,
+	          NULL,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "page_tree",
+	 page_tree );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_metadata_cache_get_leaf_page_descriptors(
+	          metadata_cache,
+	          page_tree,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "page_tree->number_of_leaf_values",
+	 page_tree->number_of_leaf_values,
+	 3 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "page_tree->number_of_leaf_page_descriptors",
+	 page_tree->number_of_leaf_page_descriptors,
+	 2 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "page_tree->leaf_page_descriptors[ 1 ].page_number",
+	 page_tree->leaf_page_descriptors[ 1 ].page_number,
+	 3 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "page_tree->leaf_page_descriptors[ 1 ].first_leaf_value_index",
+	 page_tree->leaf_page_descriptors[ 1 ].first_leaf_value_index,
+	 2 );
+
+	/* Test regular case where the metadata cache has no entry of the page tree
+	 */
+	page_tree->root_page_number = 2;
+
+	result = libesedb_metadata_cache_get_leaf_page_descriptors(
+	          metadata_cache,
+	          page_tree,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	page_tree->root_page_number = 1;
+
+	/* Test error cases
+	 */
+	result = libesedb_metadata_cache_get_leaf_page_descriptors(
+	          NULL,
+	          page_tree,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_metadata_cache_get_leaf_page_descriptors(
+	          metadata_cache,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_page_tree_free(
+	          &page_tree,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "page_tree",
+	 page_tree );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_metadata_cache_free_with_io_handle(
+	          &io_handle,
+	          &metadata_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( page_tree != NULL )
+	{
+		libesedb_page_tree_free(
+		 &page_tree,
+		 NULL );
+	}
+	esedb_test_metadata_cache_free_with_io_handle(
+	 &io_handle,
+	 &metadata_cache,
+	 NULL );
+
+	return( 0 );
+}
+
+/* Tests the libesedb_metadata_cache_set_leaf_page_descriptors function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_metadata_cache_set_leaf_page_descriptors(
+     void )
+{
+	libcerror_error_t *error                              = NULL;
+	libesedb_io_handle_t *io_handle                       = NULL;
+	libesedb_metadata_cache_t *metadata_cache             = NULL;
+	libesedb_metadata_cache_entry_t *metadata_cache_entry = NULL;
+	libesedb_page_tree_t *page_tree                       = NULL;
+	int result                                            = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_metadata_cache_initialize_from_data(
+	          &io_handle,
+	          &metadata_cache,
+	          NULL,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_initialize(
+	          &page_tree,
+	          io_handle,
+	          NULL,
+	          0,
+	          1,
+	          NULL,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "page_tree",
+	 page_tree );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular case where the leaf page descriptors of the page tree have not been read
+	 */
+	result = libesedb_metadata_cache_set_leaf_page_descriptors(
+	          metadata_cache,
+	          page_tree,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_metadata_cache_get_entry_by_root_page_number(
+	          metadata_cache,
+	          1,
+	          &metadata_cache_entry,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular case where the leaf page descriptors of the page tree have been read
+	 */
+	result = libesedb_page_tree_set_leaf_page_descriptors(
+	          page_tree,
+	          esedb_test_metadata_cache_leaf_page_descriptors,
+	          2,
+	          3,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_metadata_cache_set_leaf_page_descriptors(
+	          metadata_cache,
+	          page_tree,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_metadata_cache_get_entry_by_root_page_number(
+	          metadata_cache,
+	          1,
+	          &metadata_cache_entry,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "metadata_cache_entry",
+	 metadata_cache_entry );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "metadata_cache_entry->number_of_leaf_values",
+	 metadata_cache_entry->number_of_leaf_values,
+	 3 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "metadata_cache_entry->number_of_leaf_page_descriptors",
+	 metadata_cache_entry->number_of_leaf_page_descriptors,
+	 2 );
+
+	/* Test error cases
+	 */
+	result = libesedb_metadata_cache_set_leaf_page_descriptors(
+	          NULL,
+	          page_tree,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_metadata_cache_set_leaf_page_descriptors(
+	          metadata_cache,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_page_tree_free(
+	          &page_tree,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "page_tree",
+	 page_tree );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_metadata_cache_free_with_io_handle(
+	          &io_handle,
+	          &metadata_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( page_tree != NULL )
+	{
+		libesedb_page_tree_free(
+		 &page_tree,
+		 NULL );
+	}
+	esedb_test_metadata_cache_free_with_io_handle(
+	 &io_handle,
+	 &metadata_cache,
+	 NULL );
+
+	return( 0 );
+}
+
+/* Tests the libesedb_metadata_cache_get_catalog_data and libesedb_metadata_cache_set_catalog_data functions
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_metadata_cache_catalog_data(
+     void )
+{
+	libcerror_error_t *error                  = NULL;
+	libesedb_io_handle_t *io_handle           = NULL;
+	libesedb_metadata_cache_t *metadata_cache = NULL;
+	const uint8_t *catalog_data               = NULL;
+	size_t catalog_data_size                  = 0;
+	int result                                = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_metadata_cache_initialize_from_data(
+	          &io_handle,
+	          &metadata_cache,
+	          NULL,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_metadata_cache_get_catalog_data(
+	          metadata_cache,
+	          &catalog_data,
+	          &catalog_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_metadata_cache_set_catalog_data(
+	          metadata_cache,
+	          &( esedb_test_metadata_cache_data2[ 68 ] ),
+	          12,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular case where the catalog data was already set
+	 */
+	result = libesedb_metadata_cache_set_catalog_data(
+	          metadata_cache,
+	          esedb_test_metadata_cache_data2,
+	          8,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_metadata_cache_get_catalog_data(
+	          metadata_cache,
+	          &catalog_data,
+	          &catalog_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "catalog_data",
+	 catalog_data );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "catalog_data_size",
+	 catalog_data_size,
+	 (size_t) 12 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          catalog_data,
+	          &( esedb_test_metadata_cache_data2[ 68 ] ),
+	          12 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libesedb_metadata_cache_get_catalog_data(
+	          NULL,
+	          &catalog_data,
+	          &catalog_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_metadata_cache_get_catalog_data(
+	          metadata_cache,
+	          NULL,
+	          &catalog_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_metadata_cache_get_catalog_data(
+	          metadata_cache,
+	          &catalog_data,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_metadata_cache_set_catalog_data(
+	          NULL,
+	          &( esedb_test_metadata_cache_data2[ 68 ] ),
+	          12,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_metadata_cache_set_catalog_data(
+	          metadata_cache,
+	          NULL,
+	          12,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_metadata_cache_set_catalog_data(
+	          metadata_cache,
+	          &( esedb_test_metadata_cache_data2[ 68 ] ),
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = esedb_test_metadata_cache_free_with_io_handle(
+	          &io_handle,
+	          &metadata_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	esedb_test_metadata_cache_free_with_io_handle(
+	 &io_handle,
+	 &metadata_cache,
+	 NULL );
+
+	return( 0 );
+}
+
+/* Tests the libesedb_metadata_cache_read_data function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_metadata_cache_read_data(
+     void )
+{
+	uint8_t data[ 104 ];
+
+	libcerror_error_t *error                              = NULL;
+	libesedb_io_handle_t *io_handle                       = NULL;
+	libesedb_metadata_cache_t *metadata_cache             = NULL;
+	libesedb_metadata_cache_entry_t *metadata_cache_entry = NULL;
+	const uint8_t *catalog_data                           = NULL;
+	size_t catalog_data_size                              = 0;
+	int number_of_entries                                 = 0;
+	int result                                            = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->page_size         = 4096;
+	io_handle->pages_data_offset = 0;
+	io_handle->pages_data_size   = 65536;
+	io_handle->database_time     = 0x10;
+	io_handle->last_page_number  = 16;
+
+	result = libesedb_metadata_cache_initialize(
+	          &metadata_cache,
+	          io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "metadata_cache",
+	 metadata_cache );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_metadata_cache_read_data(
+	          metadata_cache,
+	          esedb_test_metadata_cache_data1,
+	          104,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libcdata_array_get_number_of_entries(
+	          metadata_cache->entries_array,
+	          &number_of_entries,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_entries",
+	 number_of_entries,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_metadata_cache_get_entry_by_root_page_number(
+	          metadata_cache,
+	          1,
+	          &metadata_cache_entry,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "metadata_cache_entry",
+	 metadata_cache_entry );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "metadata_cache_entry->number_of_leaf_values",
+	 metadata_cache_entry->number_of_leaf_values,
+	 3 );
+
+	result = libesedb_metadata_cache_get_catalog_data(
+	          metadata_cache,
+	          &catalog_data,
+	          &catalog_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular case with catalog data
+	 */
+	result = libesedb_metadata_cache_read_data(
+	          metadata_cache,
+	          esedb_test_metadata_cache_data2,
+	          116,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_metadata_cache_get_catalog_data(
+	          metadata_cache,
+	          &catalog_data,
+	          &catalog_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "catalog_data",
+	 catalog_data );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "catalog_data_size",
+	 catalog_data_size,
+	 (size_t) 12 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          catalog_data,
+	          &( esedb_test_metadata_cache_data2[ 68 ] ),
+	          12 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test regular case where the metadata cache does not match the database file
+	 */
+	memory_copy(
+	 data,
+	 esedb_test_metadata_cache_data1,
+	 104 );
+
+	data[ 24 ] = 0x11;
+
+	result = libesedb_metadata_cache_read_data(
+	          metadata_cache,
+	          data,
+	          104,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular case where the file size does not match the database file
+	 */
+	data[ 18 ] = 0x02;
+	data[ 24 ] = 0x10;
+
+	result = libesedb_metadata_cache_read_data(
+	          metadata_cache,
+	          data,
+	          104,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular case where the page size does not match the database file
+	 */
+	data[ 18 ] = 0x01;
+	data[ 61 ] = 0x20;
+
+	result = libesedb_metadata_cache_read_data(
+	          metadata_cache,
+	          data,
+	          104,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	data[ 61 ] = 0x10;
+
+	/* Test error cases
+	 */
+	result = libesedb_metadata_cache_read_data(
+	          NULL,
+	          esedb_test_metadata_cache_data1,
+	          104,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_metadata_cache_read_data(
+	          metadata_cache,
+	          NULL,
+	          104,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_metadata_cache_read_data(
+	          metadata_cache,
+	          esedb_test_metadata_cache_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_metadata_cache_read_data(
+	          metadata_cache,
+	          esedb_test_metadata_cache_data1,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the signature is invalid
+	 */
+	data[ 0 ]  = 0xff;
+	data[ 24 ] = 0x10;
+
+	result = libesedb_metadata_cache_read_data(
+	          metadata_cache,
+	          data,
+	          104,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the format version is not supported
+	 */
+	data[ 0 ] = 0x65;
+	data[ 8 ] = 0x01;
+
+	result = libesedb_metadata_cache_read_data(
+	          metadata_cache,
+	          data,
+	          104,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the catalog data size exceeds the data
+	 */
+	data[ 8 ]  = 0x02;
+	data[ 64 ] = 0xff;
+
+	result = libesedb_metadata_cache_read_data(
+	          metadata_cache,
+	          data,
+	          104,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the number of entries exceeds the data
+	 */
+	data[ 64 ] = 0x00;
+	data[ 12 ] = 0x02;
+
+	result = libesedb_metadata_cache_read_data(
+	          metadata_cache,
+	          data,
+	          104,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the entry data is truncated
+	 */
+	data[ 12 ] = 0x01;
+
+	result = libesedb_metadata_cache_read_data(
+	          metadata_cache,
+	          data,
+	          100,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_metadata_cache_free(
+	          &metadata_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "metadata_cache",
+	 metadata_cache );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( metadata_cache != NULL )
+	{
+		libesedb_metadata_cache_free(
+		 &metadata_cache,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libesedb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_metadata_cache_read_file_io_handle function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_metadata_cache_read_file_io_handle(
+     void )
+{
+	libbfio_handle_t *file_io_handle                      = NULL;
+	libcerror_error_t *error                              = NULL;
+	libesedb_io_handle_t *io_handle                       = NULL;
+	libesedb_metadata_cache_t *metadata_cache             = NULL;
+	libesedb_metadata_cache_entry_t *metadata_cache_entry = NULL;
+	const uint8_t *catalog_data                           = NULL;
+	size_t catalog_data_size                              = 0;
+	int result                                            = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_metadata_cache_initialize_from_data(
+	          &io_handle,
+	          &metadata_cache,
+	          NULL,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_open_file_io_handle(
+	          &file_io_handle,
+	          esedb_test_metadata_cache_data2,
+	          116,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_metadata_cache_read_file_io_handle(
+	          metadata_cache,
+	          file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_metadata_cache_get_entry_by_root_page_number(
+	          metadata_cache,
+	          1,
+	          &metadata_cache_entry,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_metadata_cache_get_catalog_data(
+	          metadata_cache,
+	          &catalog_data,
+	          &catalog_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "catalog_data_size",
+	 catalog_data_size,
+	 (size_t) 12 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_metadata_cache_read_file_io_handle(
+	          NULL,
+	          file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_metadata_cache_read_file_io_handle(
+	          metadata_cache,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = esedb_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_metadata_cache_free_with_io_handle(
+	          &io_handle,
+	          &metadata_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	esedb_test_metadata_cache_free_with_io_handle(
+	 &io_handle,
+	 &metadata_cache,
+	 NULL );
+
+	return( 0 );
+}
+
+/* Tests the libesedb_metadata_cache_read_data_from_file_io_handle function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_metadata_cache_read_data_from_file_io_handle(
+     void )
+{
+	libbfio_handle_t *file_io_handle = NULL;
+	libcerror_error_t *error         = NULL;
+	uint8_t *data                    = NULL;
+	size_t data_size                 = 0;
+	int result                       = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_open_file_io_handle(
+	          &file_io_handle,
+	          esedb_test_metadata_cache_data2,
+	          116,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "file_io_handle",
+	 file_io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_metadata_cache_read_data_from_file_io_handle(
+	          file_io_handle,
+	          &data,
+	          &data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "data",
+	 data );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 (size_t) 116 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          data,
+	          esedb_test_metadata_cache_data2,
+	          116 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libesedb_metadata_cache_read_data_from_file_io_handle(
+	          file_io_handle,
+	          &data,
+	          &data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	memory_free(
+	 data );
+
+	data = NULL;
+
+	result = libesedb_metadata_cache_read_data_from_file_io_handle(
+	          NULL,
+	          &data,
+	          &data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_metadata_cache_read_data_from_file_io_handle(
+	          file_io_handle,
+	          NULL,
+	          &data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_metadata_cache_read_data_from_file_io_handle(
+	          file_io_handle,
+	          &data,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = esedb_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( data != NULL )
+	{
+		memory_free(
+		 data );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_metadata_cache_write_file_io_handle function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_metadata_cache_write_file_io_handle(
+     void )
+{
+	uint8_t data[ 116 ];
+
+	libbfio_handle_t *file_io_handle          = NULL;
+	libcerror_error_t *error                  = NULL;
+	libesedb_io_handle_t *io_handle           = NULL;
+	libesedb_metadata_cache_t *metadata_cache = NULL;
+	int result                                = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_metadata_cache_initialize_from_data(
+	          &io_handle,
+	          &metadata_cache,
+	          esedb_test_metadata_cache_data2,
+	          116,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_set(
+	 data,
+	 0,
+	 116 );
+
+	result = libbfio_memory_range_initialize(
+	          &file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_memory_range_set(
+	          file_io_handle,
+	          data,
+	          116,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libbfio_handle_open(
+	          file_io_handle,
+	          LIBBFIO_OPEN_READ_WRITE,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_metadata_cache_write_file_io_handle(
+	          metadata_cache,
+	          file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          data,
+	          esedb_test_metadata_cache_data2,
+	          116 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libesedb_metadata_cache_write_file_io_handle(
+	          NULL,
+	          file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_metadata_cache_write_file_io_handle(
+	          metadata_cache,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = esedb_test_close_file_io_handle(
+	          &file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_metadata_cache_free_with_io_handle(
+	          &io_handle,
+	          &metadata_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( file_io_handle != NULL )
+	{
+		libbfio_handle_free(
+		 &file_io_handle,
+		 NULL );
+	}
+	esedb_test_metadata_cache_free_with_io_handle(
+	 &io_handle,
+	 &metadata_cache,
+	 NULL );
+
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argc )
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+	ESEDB_TEST_RUN(
+	 "libesedb_metadata_cache_initialize",
+	 esedb_test_metadata_cache_initialize );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_metadata_cache_free",
+	 esedb_test_metadata_cache_free );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_metadata_cache_get_entry_by_root_page_number",
+	 esedb_test_metadata_cache_get_entry_by_root_page_number );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_metadata_cache_get_leaf_page_descriptors",
+	 esedb_test_metadata_cache_get_leaf_page_descriptors );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_metadata_cache_set_leaf_page_descriptors",
+	 esedb_test_metadata_cache_set_leaf_page_descriptors );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_metadata_cache_catalog_data",
+	 esedb_test_metadata_cache_catalog_data );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_metadata_cache_read_data",
+	 esedb_test_metadata_cache_read_data );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_metadata_cache_read_file_io_handle",
+	 esedb_test_metadata_cache_read_file_io_handle );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_metadata_cache_read_data_from_file_io_handle",
+	 esedb_test_metadata_cache_read_data_from_file_io_handle );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_metadata_cache_write_file_io_handle",
+	 esedb_test_metadata_cache_write_file_io_handle );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+}
+
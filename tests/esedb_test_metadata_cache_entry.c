@@ -0,0 +1,1036 @@
+/*
+ * Library metadata_cache_entry type test program
+ *
+ * Copyright (C) 2009-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "esedb_test_libcerror.h"
+#include "esedb_test_libesedb.h"
+#include "esedb_test_macros.h"
+#include "esedb_test_memory.h"
+#include "esedb_test_unused.h"
+
+#include "../libesedb/libesedb_leaf_page_descriptor.h"
+#include "../libesedb/libesedb_metadata_cache_entry.h"
+
+uint8_t esedb_test_metadata_cache_entry_data1[ 36 ] = {
+	0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x00 };
+
+/* Leaf page descriptors that do not cover the leaf values contiguously
+ */
+uint8_t esedb_test_metadata_cache_entry_data2[ 36 ] = {
+	0x01, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00,
+	0x02, 0x00, 0x00, 0x00 };
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+/* Tests the libesedb_metadata_cache_entry_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_metadata_cache_entry_initialize(
+     void )
+{
+	libcerror_error_t *error                              = NULL;
+	libesedb_metadata_cache_entry_t *metadata_cache_entry = NULL;
+	int result                                            = 0;
+
+#if defined( HAVE_ESEDB_TEST_MEMORY )
+	int number_of_malloc_fail_tests                       = 1;
+	int number_of_memset_fail_tests                       = 1;
+	int test_number                                       = 0;
+#endif
+
+	/* Test regular cases
+	 */
+	result = libesedb_metadata_cache_entry_initialize(
+	          &metadata_cache_entry,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "metadata_cache_entry",
+	 metadata_cache_entry );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_metadata_cache_entry_free(
+	          &metadata_cache_entry,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "metadata_cache_entry",
+	 metadata_cache_entry );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_metadata_cache_entry_initialize(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	metadata_cache_entry = (libesedb_metadata_cache_entry_t *) 0x12345678UL;
+
+	result = libesedb_metadata_cache_entry_initialize(
+	          &metadata_cache_entry,
+	          &error );
+
+	metadata_cache_entry = NULL;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_ESEDB_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libesedb_metadata_cache_entry_initialize with malloc failing
+		 */
+		esedb_test_malloc_attempts_before_fail = test_number;
+
+		result = libesedb_metadata_cache_entry_initialize(
+		          &metadata_cache_entry,
+		          &error );
+
+		if( esedb_test_malloc_attempts_before_fail != -1 )
+		{
+			esedb_test_malloc_attempts_before_fail = -1;
+
+			if( metadata_cache_entry != NULL )
+			{
+				libesedb_metadata_cache_entry_free(
+				 &metadata_cache_entry,
+				 NULL );
+			}
+		}
+		else
+		{
+			ESEDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			ESEDB_TEST_ASSERT_IS_NULL(
+			 "metadata_cache_entry",
+			 metadata_cache_entry );
+
+			ESEDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libesedb_metadata_cache_entry_initialize with memset failing
+		 */
+		esedb_test_memset_attempts_before_fail = test_number;
+
+		result = libesedb_metadata_cache_entry_initialize(
+		          &metadata_cache_entry,
+		          &error );
+
+		if( esedb_test_memset_attempts_before_fail != -1 )
+		{
+			esedb_test_memset_attempts_before_fail = -1;
+
+			if( metadata_cache_entry != NULL )
+			{
+				libesedb_metadata_cache_entry_free(
+				 &metadata_cache_entry,
+				 NULL );
+			}
+		}
+		else
+		{
+			ESEDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			ESEDB_TEST_ASSERT_IS_NULL(
+			 "metadata_cache_entry",
+			 metadata_cache_entry );
+
+			ESEDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_ESEDB_TEST_MEMORY ) */
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( metadata_cache_entry != NULL )
+	{
+		libesedb_metadata_cache_entry_free(
+		 &metadata_cache_entry,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_metadata_cache_entry_free function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_metadata_cache_entry_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_metadata_cache_entry_free(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_metadata_cache_entry_read_data function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_metadata_cache_entry_read_data(
+     void )
+{
+	libcerror_error_t *error                              = NULL;
+	libesedb_metadata_cache_entry_t *metadata_cache_entry = NULL;
+	int result                                            = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_metadata_cache_entry_initialize(
+	          &metadata_cache_entry,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "metadata_cache_entry",
+	 metadata_cache_entry );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_metadata_cache_entry_read_data(
+	          metadata_cache_entry,
+	          esedb_test_metadata_cache_entry_data1,
+	          36,
+	          16,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "metadata_cache_entry->root_page_number",
+	 metadata_cache_entry->root_page_number,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "metadata_cache_entry->number_of_leaf_values",
+	 metadata_cache_entry->number_of_leaf_values,
+	 3 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "metadata_cache_entry->number_of_leaf_page_descriptors",
+	 metadata_cache_entry->number_of_leaf_page_descriptors,
+	 2 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "metadata_cache_entry->leaf_page_descriptors[ 1 ].first_leaf_value_index",
+	 metadata_cache_entry->leaf_page_descriptors[ 1 ].first_leaf_value_index,
+	 2 );
+
+	/* Test error cases
+	 */
+	result = libesedb_metadata_cache_entry_read_data(
+	          NULL,
+	          esedb_test_metadata_cache_entry_data1,
+	          36,
+	          16,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_metadata_cache_entry_read_data(
+	          metadata_cache_entry,
+	          esedb_test_metadata_cache_entry_data1,
+	          36,
+	          16,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_metadata_cache_entry_free(
+	          &metadata_cache_entry,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "metadata_cache_entry",
+	 metadata_cache_entry );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Initialize test
+	 */
+	result = libesedb_metadata_cache_entry_initialize(
+	          &metadata_cache_entry,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "metadata_cache_entry",
+	 metadata_cache_entry );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_metadata_cache_entry_read_data(
+	          metadata_cache_entry,
+	          NULL,
+	          36,
+	          16,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_metadata_cache_entry_read_data(
+	          metadata_cache_entry,
+	          esedb_test_metadata_cache_entry_data1,
+	          (size_t) SSIZE_MAX + 1,
+	          16,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_metadata_cache_entry_read_data(
+	          metadata_cache_entry,
+	          esedb_test_metadata_cache_entry_data1,
+	          0,
+	          16,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the data is too small for the leaf page descriptors
+	 */
+	result = libesedb_metadata_cache_entry_read_data(
+	          metadata_cache_entry,
+	          esedb_test_metadata_cache_entry_data1,
+	          24,
+	          16,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the data is too small for the entry
+	 */
+	result = libesedb_metadata_cache_entry_read_data(
+	          metadata_cache_entry,
+	          esedb_test_metadata_cache_entry_data1,
+	          11,
+	          16,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the last leaf page descriptor is truncated
+	 */
+	result = libesedb_metadata_cache_entry_read_data(
+	          metadata_cache_entry,
+	          esedb_test_metadata_cache_entry_data1,
+	          35,
+	          16,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where a page number exceeds the last page number
+	 */
+	result = libesedb_metadata_cache_entry_read_data(
+	          metadata_cache_entry,
+	          esedb_test_metadata_cache_entry_data1,
+	          36,
+	          2,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the leaf page descriptors are not contiguous
+	 */
+	result = libesedb_metadata_cache_entry_read_data(
+	          metadata_cache_entry,
+	          esedb_test_metadata_cache_entry_data2,
+	          36,
+	          16,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_metadata_cache_entry_free(
+	          &metadata_cache_entry,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "metadata_cache_entry",
+	 metadata_cache_entry );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( metadata_cache_entry != NULL )
+	{
+		libesedb_metadata_cache_entry_free(
+		 &metadata_cache_entry,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_metadata_cache_entry_set_leaf_page_descriptors function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_metadata_cache_entry_set_leaf_page_descriptors(
+     void )
+{
+	libesedb_leaf_page_descriptor_t leaf_page_descriptors[ 2 ] = {
+		{ 2, 0, 1 },
+		{ 3, 2, 2 } };
+
+	libcerror_error_t *error                              = NULL;
+	libesedb_metadata_cache_entry_t *metadata_cache_entry = NULL;
+	size_t data_size                                      = 0;
+	int result                                            = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_metadata_cache_entry_initialize(
+	          &metadata_cache_entry,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "metadata_cache_entry",
+	 metadata_cache_entry );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_metadata_cache_entry_set_leaf_page_descriptors(
+	          metadata_cache_entry,
+	          leaf_page_descriptors,
+	          2,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "metadata_cache_entry->number_of_leaf_page_descriptors",
+	 metadata_cache_entry->number_of_leaf_page_descriptors,
+	 2 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "metadata_cache_entry->leaf_page_descriptors[ 1 ].page_number",
+	 metadata_cache_entry->leaf_page_descriptors[ 1 ].page_number,
+	 3 );
+
+	result = libesedb_metadata_cache_entry_get_data_size(
+	          metadata_cache_entry,
+	          &data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "data_size",
+	 data_size,
+	 (size_t) 36 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular case where the leaf page descriptors are replaced
+	 */
+	result = libesedb_metadata_cache_entry_set_leaf_page_descriptors(
+	          metadata_cache_entry,
+	          leaf_page_descriptors,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "metadata_cache_entry->number_of_leaf_page_descriptors",
+	 metadata_cache_entry->number_of_leaf_page_descriptors,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libesedb_metadata_cache_entry_set_leaf_page_descriptors(
+	          NULL,
+	          leaf_page_descriptors,
+	          2,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_metadata_cache_entry_set_leaf_page_descriptors(
+	          metadata_cache_entry,
+	          leaf_page_descriptors,
+	          -1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_metadata_cache_entry_set_leaf_page_descriptors(
+	          metadata_cache_entry,
+	          NULL,
+	          2,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_metadata_cache_entry_free(
+	          &metadata_cache_entry,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "metadata_cache_entry",
+	 metadata_cache_entry );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( metadata_cache_entry != NULL )
+	{
+		libesedb_metadata_cache_entry_free(
+		 &metadata_cache_entry,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_metadata_cache_entry_write_data function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_metadata_cache_entry_write_data(
+     void )
+{
+	uint8_t data[ 36 ];
+
+	libcerror_error_t *error                              = NULL;
+	libesedb_metadata_cache_entry_t *metadata_cache_entry = NULL;
+	int result                                            = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_metadata_cache_entry_initialize(
+	          &metadata_cache_entry,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "metadata_cache_entry",
+	 metadata_cache_entry );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_metadata_cache_entry_read_data(
+	          metadata_cache_entry,
+	          esedb_test_metadata_cache_entry_data1,
+	          36,
+	          16,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_metadata_cache_entry_write_data(
+	          metadata_cache_entry,
+	          data,
+	          36,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          data,
+	          esedb_test_metadata_cache_entry_data1,
+	          36 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libesedb_metadata_cache_entry_write_data(
+	          NULL,
+	          data,
+	          36,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_metadata_cache_entry_write_data(
+	          metadata_cache_entry,
+	          NULL,
+	          36,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_metadata_cache_entry_write_data(
+	          metadata_cache_entry,
+	          data,
+	          24,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_metadata_cache_entry_free(
+	          &metadata_cache_entry,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "metadata_cache_entry",
+	 metadata_cache_entry );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( metadata_cache_entry != NULL )
+	{
+		libesedb_metadata_cache_entry_free(
+		 &metadata_cache_entry,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argc )
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+	ESEDB_TEST_RUN(
+	 "libesedb_metadata_cache_entry_initialize",
+	 esedb_test_metadata_cache_entry_initialize );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_metadata_cache_entry_free",
+	 esedb_test_metadata_cache_entry_free );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_metadata_cache_entry_read_data",
+	 esedb_test_metadata_cache_entry_read_data );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_metadata_cache_entry_set_leaf_page_descriptors",
+	 esedb_test_metadata_cache_entry_set_leaf_page_descriptors );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_metadata_cache_entry_write_data",
+	 esedb_test_metadata_cache_entry_write_data );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
@@ -21,6 +21,7 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
@@ -29,25 +30,1382 @@
 
 #include "esedb_test_libcerror.h"
 #include "esedb_test_libesedb.h"
+#include "esedb_test_libfvalue.h"
 #include "esedb_test_macros.h"
 #include "esedb_test_memory.h"
 #include "esedb_test_unused.h"
 
+#include "../libesedb/libesedb_catalog_definition.h"
 #include "../libesedb/libesedb_multi_value.h"
 
+/* 3 little-endian 32-bit values: 1, 0x12345678 and 0xffffffff
+ */
+uint8_t esedb_test_multi_value_data1[ 12 ] = {
+	0x01, 0x00, 0x00, 0x00, 0x78, 0x56, 0x34, 0x12, 0xff, 0xff, 0xff, 0xff };
+
+/* 2 little-endian 64-bit values: 0x0123456789abcdef and 0x01cb3a623d0a17ce
+ */
+uint8_t esedb_test_multi_value_data2[ 16 ] = {
+	0xef, 0xcd, 0xab, 0x89, 0x67, 0x45, 0x23, 0x01, 0xce, 0x17, 0x0a, 0x3d, 0x62, 0x3a, 0xcb, 0x01 };
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+/* Creates a multi value of fixed-size values for testing
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_multi_value_initialize_from_data(
+     libesedb_multi_value_t **multi_value,
+     libesedb_catalog_definition_t **catalog_definition,
+     libfvalue_value_t **record_value,
+     uint32_t column_type,
+     const uint8_t *data,
+     size_t data_size,
+     size_t value_size,
+     libcerror_error_t **error )
+{
+	static char *function = "esedb_test_multi_value_initialize_from_data";
+	size_t data_offset    = 0;
+	int value_entry_index = 0;
+
+	if( catalog_definition == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid catalog definition.",
+		 function );
+
+		return( -1 );
+	}
+	if( record_value == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record value.",
+		 function );
+
+		return( -1 );
+	}
+	if( value_size == 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_TOO_SMALL,
+		 "%s: invalid value size value too small.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_catalog_definition_initialize(
+	     catalog_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create catalog definition.",
+		 function );
+
+		goto on_error;
+	}
+	( *catalog_definition )->column_type = column_type;
+
+	if( libfvalue_value_type_initialize(
+	     record_value,
+	     LIBFVALUE_VALUE_TYPE_BINARY_DATA,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create record value.",
+		 function );
+
+		goto on_error;
+	}
+	if( libfvalue_value_set_data(
+	     *record_value,
+	     data,
+	     data_size,
+	     LIBFVALUE_ENDIAN_LITTLE,
+	     LIBFVALUE_VALUE_DATA_FLAG_MANAGED,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set data in record value.",
+		 function );
+
+		goto on_error;
+	}
+	for( data_offset = 0;
+	     ( data_offset + value_size ) <= data_size;
+	     data_offset += value_size )
+	{
+		if( libfvalue_value_append_entry(
+		     *record_value,
+		     &value_entry_index,
+		     data_offset,
+		     value_size,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append value entry.",
+			 function );
+
+			goto on_error;
+		}
+	}
+	if( libesedb_multi_value_initialize(
+	     multi_value,
+	     *catalog_definition,
+	     *record_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create multi value.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *record_value != NULL )
+	{
+		libfvalue_value_free(
+		 record_value,
+		 NULL );
+	}
+	if( *catalog_definition != NULL )
+	{
+		libesedb_catalog_definition_free(
+		 catalog_definition,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Frees a multi value created for testing
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_multi_value_free_from_data(
+     libesedb_multi_value_t **multi_value,
+     libesedb_catalog_definition_t **catalog_definition,
+     libfvalue_value_t **record_value,
+     libcerror_error_t **error )
+{
+	static char *function = "esedb_test_multi_value_free_from_data";
+	int result            = 1;
+
+	if( libesedb_multi_value_free(
+	     multi_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free multi value.",
+		 function );
+
+		result = -1;
+	}
+	if( libfvalue_value_free(
+	     record_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free record value.",
+		 function );
+
+		result = -1;
+	}
+	if( libesedb_catalog_definition_free(
+	     catalog_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free catalog definition.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
 /* Tests the libesedb_multi_value_free function
  * Returns 1 if successful or 0 if not
  */
-int esedb_test_multi_value_free(
+int esedb_test_multi_value_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_multi_value_free(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+/* Tests the libesedb_multi_value_get_value_data_reference function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_multi_value_get_value_data_reference(
+     void )
+{
+	libcerror_error_t *error                          = NULL;
+	libesedb_catalog_definition_t *catalog_definition = NULL;
+	libesedb_multi_value_t *multi_value               = NULL;
+	libfvalue_value_t *record_value                   = NULL;
+	const uint8_t *value_data                         = NULL;
+	size_t value_data_size                            = 0;
+	int result                                        = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_multi_value_initialize_from_data(
+	          &multi_value,
+	          &catalog_definition,
+	          &record_value,
+	          LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED,
+	          esedb_test_multi_value_data1,
+	          12,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "multi_value",
+	 multi_value );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_multi_value_get_value_data_reference(
+	          multi_value,
+	          1,
+	          &value_data,
+	          &value_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "value_data",
+	 value_data );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "value_data_size",
+	 value_data_size,
+	 (size_t) 4 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          value_data,
+	          &( esedb_test_multi_value_data1[ 4 ] ),
+	          4 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libesedb_multi_value_get_value_data_reference(
+	          multi_value,
+	          2,
+	          &value_data,
+	          &value_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "value_data_size",
+	 value_data_size,
+	 (size_t) 4 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          value_data,
+	          &( esedb_test_multi_value_data1[ 8 ] ),
+	          4 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test error cases
+	 */
+	result = libesedb_multi_value_get_value_data_reference(
+	          NULL,
+	          0,
+	          &value_data,
+	          &value_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_multi_value_get_value_data_reference(
+	          multi_value,
+	          -1,
+	          &value_data,
+	          &value_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_multi_value_get_value_data_reference(
+	          multi_value,
+	          3,
+	          &value_data,
+	          &value_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_multi_value_get_value_data_reference(
+	          multi_value,
+	          0,
+	          NULL,
+	          &value_data_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_multi_value_get_value_data_reference(
+	          multi_value,
+	          0,
+	          &value_data,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = esedb_test_multi_value_free_from_data(
+	          &multi_value,
+	          &catalog_definition,
+	          &record_value,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "multi_value",
+	 multi_value );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	esedb_test_multi_value_free_from_data(
+	 &multi_value,
+	 &catalog_definition,
+	 &record_value,
+	 NULL );
+
+	return( 0 );
+}
+
+/* Tests the libesedb_multi_value_get_values_32bit function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_multi_value_get_values_32bit(
+     void )
+{
+	libcerror_error_t *error                          = NULL;
+	libesedb_catalog_definition_t *catalog_definition = NULL;
+	libesedb_multi_value_t *multi_value               = NULL;
+	libfvalue_value_t *record_value                   = NULL;
+	uint32_t values_32bit[ 6 ];
+	int result                                        = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_multi_value_initialize_from_data(
+	          &multi_value,
+	          &catalog_definition,
+	          &record_value,
+	          LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED,
+	          esedb_test_multi_value_data1,
+	          12,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "multi_value",
+	 multi_value );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_multi_value_get_values_32bit(
+	          multi_value,
+	          values_32bit,
+	          3,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "values_32bit[ 0 ]",
+	 values_32bit[ 0 ],
+	 (uint32_t) 0x00000001UL );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "values_32bit[ 1 ]",
+	 values_32bit[ 1 ],
+	 (uint32_t) 0x12345678UL );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "values_32bit[ 2 ]",
+	 values_32bit[ 2 ],
+	 (uint32_t) 0xffffffffUL );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_multi_value_get_values_32bit(
+	          NULL,
+	          values_32bit,
+	          3,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_multi_value_get_values_32bit(
+	          multi_value,
+	          NULL,
+	          3,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the array is too small
+	 */
+	result = libesedb_multi_value_get_values_32bit(
+	          multi_value,
+	          values_32bit,
+	          2,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_multi_value_get_values_32bit(
+	          multi_value,
+	          values_32bit,
+	          -1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = esedb_test_multi_value_free_from_data(
+	          &multi_value,
+	          &catalog_definition,
+	          &record_value,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "multi_value",
+	 multi_value );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error case where the column type is not supported
+	 */
+	result = esedb_test_multi_value_initialize_from_data(
+	          &multi_value,
+	          &catalog_definition,
+	          &record_value,
+	          LIBESEDB_COLUMN_TYPE_INTEGER_64BIT_SIGNED,
+	          esedb_test_multi_value_data1,
+	          12,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "multi_value",
+	 multi_value );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_multi_value_get_values_32bit(
+	          multi_value,
+	          values_32bit,
+	          3,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = esedb_test_multi_value_free_from_data(
+	          &multi_value,
+	          &catalog_definition,
+	          &record_value,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "multi_value",
+	 multi_value );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error case where the size of the values is not supported
+	 */
+	result = esedb_test_multi_value_initialize_from_data(
+	          &multi_value,
+	          &catalog_definition,
+	          &record_value,
+	          LIBESEDB_COLUMN_TYPE_INTEGER_32BIT_UNSIGNED,
+	          esedb_test_multi_value_data1,
+	          12,
+	          2,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "multi_value",
+	 multi_value );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_multi_value_get_values_32bit(
+	          multi_value,
+	          values_32bit,
+	          6,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = esedb_test_multi_value_free_from_data(
+	          &multi_value,
+	          &catalog_definition,
+	          &record_value,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "multi_value",
+	 multi_value );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	esedb_test_multi_value_free_from_data(
+	 &multi_value,
+	 &catalog_definition,
+	 &record_value,
+	 NULL );
+
+	return( 0 );
+}
+
+/* Tests the libesedb_multi_value_get_values_64bit function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_multi_value_get_values_64bit(
+     void )
+{
+	libcerror_error_t *error                          = NULL;
+	libesedb_catalog_definition_t *catalog_definition = NULL;
+	libesedb_multi_value_t *multi_value               = NULL;
+	libfvalue_value_t *record_value                   = NULL;
+	uint64_t values_64bit[ 4 ];
+	int result                                        = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_multi_value_initialize_from_data(
+	          &multi_value,
+	          &catalog_definition,
+	          &record_value,
+	          LIBESEDB_COLUMN_TYPE_INTEGER_64BIT_SIGNED,
+	          esedb_test_multi_value_data2,
+	          16,
+	          8,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "multi_value",
+	 multi_value );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_multi_value_get_values_64bit(
+	          multi_value,
+	          values_64bit,
+	          2,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT64(
+	 "values_64bit[ 0 ]",
+	 values_64bit[ 0 ],
+	 (uint64_t) 0x0123456789abcdefULL );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT64(
+	 "values_64bit[ 1 ]",
+	 values_64bit[ 1 ],
+	 (uint64_t) 0x01cb3a623d0a17ceULL );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_multi_value_get_values_64bit(
+	          NULL,
+	          values_64bit,
+	          2,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_multi_value_get_values_64bit(
+	          multi_value,
+	          NULL,
+	          2,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the array is too small
+	 */
+	result = libesedb_multi_value_get_values_64bit(
+	          multi_value,
+	          values_64bit,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_multi_value_get_values_64bit(
+	          multi_value,
+	          values_64bit,
+	          -1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = esedb_test_multi_value_free_from_data(
+	          &multi_value,
+	          &catalog_definition,
+	          &record_value,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "multi_value",
+	 multi_value );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error case where the column type is not supported
+	 */
+	result = esedb_test_multi_value_initialize_from_data(
+	          &multi_value,
+	          &catalog_definition,
+	          &record_value,
+	          LIBESEDB_COLUMN_TYPE_DATE_TIME,
+	          esedb_test_multi_value_data2,
+	          16,
+	          8,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "multi_value",
+	 multi_value );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_multi_value_get_values_64bit(
+	          multi_value,
+	          values_64bit,
+	          2,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = esedb_test_multi_value_free_from_data(
+	          &multi_value,
+	          &catalog_definition,
+	          &record_value,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "multi_value",
+	 multi_value );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error case where the size of the values is not supported
+	 */
+	result = esedb_test_multi_value_initialize_from_data(
+	          &multi_value,
+	          &catalog_definition,
+	          &record_value,
+	          LIBESEDB_COLUMN_TYPE_INTEGER_64BIT_SIGNED,
+	          esedb_test_multi_value_data2,
+	          16,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "multi_value",
+	 multi_value );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_multi_value_get_values_64bit(
+	          multi_value,
+	          values_64bit,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = esedb_test_multi_value_free_from_data(
+	          &multi_value,
+	          &catalog_definition,
+	          &record_value,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "multi_value",
+	 multi_value );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	esedb_test_multi_value_free_from_data(
+	 &multi_value,
+	 &catalog_definition,
+	 &record_value,
+	 NULL );
+
+	return( 0 );
+}
+
+/* Tests the libesedb_multi_value_get_values_filetime function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_multi_value_get_values_filetime(
      void )
 {
-	libcerror_error_t *error = NULL;
-	int result               = 0;
+	libcerror_error_t *error                          = NULL;
+	libesedb_catalog_definition_t *catalog_definition = NULL;
+	libesedb_multi_value_t *multi_value               = NULL;
+	libfvalue_value_t *record_value                   = NULL;
+	uint64_t values_filetime[ 4 ];
+	int result                                        = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_multi_value_initialize_from_data(
+	          &multi_value,
+	          &catalog_definition,
+	          &record_value,
+	          LIBESEDB_COLUMN_TYPE_DATE_TIME,
+	          esedb_test_multi_value_data2,
+	          16,
+	          8,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "multi_value",
+	 multi_value );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_multi_value_get_values_filetime(
+	          multi_value,
+	          values_filetime,
+	          2,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT64(
+	 "values_filetime[ 0 ]",
+	 values_filetime[ 0 ],
+	 (uint64_t) 0x0123456789abcdefULL );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT64(
+	 "values_filetime[ 1 ]",
+	 values_filetime[ 1 ],
+	 (uint64_t) 0x01cb3a623d0a17ceULL );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
 	/* Test error cases
 	 */
-	result = libesedb_multi_value_free(
+	result = libesedb_multi_value_get_values_filetime(
+	          NULL,
+	          values_filetime,
+	          2,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_multi_value_get_values_filetime(
+	          multi_value,
 	          NULL,
+	          2,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the array is too small
+	 */
+	result = libesedb_multi_value_get_values_filetime(
+	          multi_value,
+	          values_filetime,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_multi_value_get_values_filetime(
+	          multi_value,
+	          values_filetime,
+	          -1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = esedb_test_multi_value_free_from_data(
+	          &multi_value,
+	          &catalog_definition,
+	          &record_value,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "multi_value",
+	 multi_value );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error case where the column type is not supported
+	 */
+	result = esedb_test_multi_value_initialize_from_data(
+	          &multi_value,
+	          &catalog_definition,
+	          &record_value,
+	          LIBESEDB_COLUMN_TYPE_INTEGER_64BIT_SIGNED,
+	          esedb_test_multi_value_data2,
+	          16,
+	          8,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "multi_value",
+	 multi_value );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_multi_value_get_values_filetime(
+	          multi_value,
+	          values_filetime,
+	          2,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = esedb_test_multi_value_free_from_data(
+	          &multi_value,
+	          &catalog_definition,
+	          &record_value,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "multi_value",
+	 multi_value );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error case where the size of the values is not supported
+	 */
+	result = esedb_test_multi_value_initialize_from_data(
+	          &multi_value,
+	          &catalog_definition,
+	          &record_value,
+	          LIBESEDB_COLUMN_TYPE_DATE_TIME,
+	          esedb_test_multi_value_data2,
+	          16,
+	          4,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "multi_value",
+	 multi_value );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_multi_value_get_values_filetime(
+	          multi_value,
+	          values_filetime,
+	          4,
 	          &error );
 
 	ESEDB_TEST_ASSERT_EQUAL_INT(
@@ -62,6 +1420,27 @@ int esedb_test_multi_value_free(
 	libcerror_error_free(
 	 &error );
 
+	/* Clean up
+	 */
+	result = esedb_test_multi_value_free_from_data(
+	          &multi_value,
+	          &catalog_definition,
+	          &record_value,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "multi_value",
+	 multi_value );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	return( 1 );
 
 on_error:
@@ -70,11 +1449,15 @@ on_error:
 		libcerror_error_free(
 		 &error );
 	}
+	esedb_test_multi_value_free_from_data(
+	 &multi_value,
+	 &catalog_definition,
+	 &record_value,
+	 NULL );
+
 	return( 0 );
 }
 
-#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
-
 #endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
 
 /* The main program
@@ -112,6 +1495,10 @@ int main(
 
 	/* TODO: add tests for libesedb_multi_value_get_value_data */
 
+	ESEDB_TEST_RUN(
+	 "libesedb_multi_value_get_value_data_reference",
+	 esedb_test_multi_value_get_value_data_reference );
+
 	/* TODO: add tests for libesedb_multi_value_get_value */
 
 	/* TODO: add tests for libesedb_multi_value_get_value_8bit */
@@ -128,6 +1515,18 @@ int main(
 
 	/* TODO: add tests for libesedb_multi_value_get_value_filetime */
 
+	ESEDB_TEST_RUN(
+	 "libesedb_multi_value_get_values_32bit",
+	 esedb_test_multi_value_get_values_32bit );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_multi_value_get_values_64bit",
+	 esedb_test_multi_value_get_values_64bit );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_multi_value_get_values_filetime",
+	 esedb_test_multi_value_get_values_filetime );
+
 	/* TODO: add tests for libesedb_multi_value_get_value_utf8_string_size */
 
 	/* TODO: add tests for libesedb_multi_value_get_value_utf8_string */
@@ -0,0 +1,470 @@
+/*
+ * Library name hash functions test program
+ *
+ * Copyright (C) 2009-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "esedb_test_libcerror.h"
+#include "esedb_test_libesedb.h"
+#include "esedb_test_libuna.h"
+#include "esedb_test_macros.h"
+#include "esedb_test_unused.h"
+
+#include "../libesedb/libesedb_name_hash.h"
+
+uint8_t esedb_test_name_hash_byte_stream[ 9 ] = {
+	0x4d, 0x53, 0x79, 0x73, 0x4f, 0x62, 0x6a, 0xe9, 0x00 };
+
+uint8_t esedb_test_name_hash_utf8_string[ 9 ] = {
+	0x4d, 0x53, 0x79, 0x73, 0x4f, 0x62, 0x6a, 0xc3, 0xa9 };
+
+uint16_t esedb_test_name_hash_utf16_string[ 8 ] = {
+	0x004d, 0x0053, 0x0079, 0x0073, 0x004f, 0x0062, 0x006a, 0x00e9 };
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+/* Tests the libesedb_name_hash_calculate_from_byte_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_name_hash_calculate_from_byte_stream(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	uint32_t name_hash       = 0;
+	uint32_t other_name_hash = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_name_hash_calculate_from_byte_stream(
+	          &name_hash,
+	          esedb_test_name_hash_byte_stream,
+	          9,
+	          LIBUNA_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the end-of-string character is not part of the hash
+	 */
+	result = libesedb_name_hash_calculate_from_byte_stream(
+	          &other_name_hash,
+	          esedb_test_name_hash_byte_stream,
+	          8,
+	          LIBUNA_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "name_hash",
+	 name_hash,
+	 other_name_hash );
+
+	/* Test error cases
+	 */
+	result = libesedb_name_hash_calculate_from_byte_stream(
+	          NULL,
+	          esedb_test_name_hash_byte_stream,
+	          9,
+	          LIBUNA_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_name_hash_calculate_from_byte_stream(
+	          &name_hash,
+	          NULL,
+	          9,
+	          LIBUNA_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_name_hash_calculate_from_byte_stream(
+	          &name_hash,
+	          esedb_test_name_hash_byte_stream,
+	          (size_t) SSIZE_MAX + 1,
+	          LIBUNA_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Test error case where the byte stream cannot be decoded
+	 */
+	result = libesedb_name_hash_calculate_from_byte_stream(
+	          &name_hash,
+	          esedb_test_name_hash_byte_stream,
+	          9,
+	          -1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_name_hash_calculate_from_utf8_string function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_name_hash_calculate_from_utf8_string(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	uint32_t byte_stream_name_hash = 0;
+	uint32_t name_hash             = 0;
+	int result                     = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_name_hash_calculate_from_utf8_string(
+	          &name_hash,
+	          esedb_test_name_hash_utf8_string,
+	          9,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the hash matches that of the corresponding byte stream
+	 */
+	result = libesedb_name_hash_calculate_from_byte_stream(
+	          &byte_stream_name_hash,
+	          esedb_test_name_hash_byte_stream,
+	          9,
+	          LIBUNA_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "name_hash",
+	 name_hash,
+	 byte_stream_name_hash );
+
+	/* Test error cases
+	 */
+	result = libesedb_name_hash_calculate_from_utf8_string(
+	          NULL,
+	          esedb_test_name_hash_utf8_string,
+	          9,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_name_hash_calculate_from_utf8_string(
+	          &name_hash,
+	          NULL,
+	          9,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_name_hash_calculate_from_utf8_string(
+	          &name_hash,
+	          esedb_test_name_hash_utf8_string,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_name_hash_calculate_from_utf16_string function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_name_hash_calculate_from_utf16_string(
+     void )
+{
+	libcerror_error_t *error       = NULL;
+	uint32_t byte_stream_name_hash = 0;
+	uint32_t name_hash             = 0;
+	int result                     = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_name_hash_calculate_from_utf16_string(
+	          &name_hash,
+	          esedb_test_name_hash_utf16_string,
+	          8,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that the hash matches that of the corresponding byte stream
+	 */
+	result = libesedb_name_hash_calculate_from_byte_stream(
+	          &byte_stream_name_hash,
+	          esedb_test_name_hash_byte_stream,
+	          9,
+	          LIBUNA_CODEPAGE_WINDOWS_1252,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "name_hash",
+	 name_hash,
+	 byte_stream_name_hash );
+
+	/* Test error cases
+	 */
+	result = libesedb_name_hash_calculate_from_utf16_string(
+	          NULL,
+	          esedb_test_name_hash_utf16_string,
+	          8,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_name_hash_calculate_from_utf16_string(
+	          &name_hash,
+	          NULL,
+	          8,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_name_hash_calculate_from_utf16_string(
+	          &name_hash,
+	          esedb_test_name_hash_utf16_string,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argc )
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+	ESEDB_TEST_RUN(
+	 "libesedb_name_hash_calculate_from_byte_stream",
+	 esedb_test_name_hash_calculate_from_byte_stream );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_name_hash_calculate_from_utf8_string",
+	 esedb_test_name_hash_calculate_from_utf8_string );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_name_hash_calculate_from_utf16_string",
+	 esedb_test_name_hash_calculate_from_utf16_string );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+}
+
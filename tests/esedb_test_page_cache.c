@@ -0,0 +1,2549 @@
+/*
+ * Library page_cache type test program
+ *
+ * Copyright (C) 2009-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#if defined( HAVE_CLOCK_GETTIME ) || defined( HAVE_TIME )
+#include <time.h>
+#endif
+
+#include "esedb_test_functions.h"
+#include "esedb_test_libbfio.h"
+#include "esedb_test_libcerror.h"
+#include "esedb_test_libcthreads.h"
+#include "esedb_test_libesedb.h"
+#include "esedb_test_macros.h"
+#include "esedb_test_memory.h"
+#include "esedb_test_unused.h"
+
+#include "../libesedb/libesedb_io_handle.h"
+#include "../libesedb/libesedb_page.h"
+#include "../libesedb/libesedb_page_cache.h"
+
+#define ESEDB_TEST_PAGE_CACHE_NUMBER_OF_PAGES			256
+#define ESEDB_TEST_PAGE_CACHE_NUMBER_OF_PINNED_PAGES		4
+#define ESEDB_TEST_PAGE_CACHE_PAGE_SIZE				4096
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+typedef struct esedb_test_page_cache_thread_values esedb_test_page_cache_thread_values_t;
+
+/* The values of a thread that retrieves pages from the page cache
+ */
+struct esedb_test_page_cache_thread_values
+{
+	/* The page cache
+	 */
+	libesedb_page_cache_t *page_cache;
+
+	/* The file IO handle
+	 */
+	libbfio_handle_t *file_io_handle;
+
+	/* The seed of the pseudo random page numbers
+	 */
+	uint32_t seed;
+
+	/* The number of pages to retrieve
+	 */
+	int number_of_retrievals;
+
+	/* The result
+	 */
+	int result;
+};
+
+/* Opens a file IO handle of ESEDB_TEST_PAGE_CACHE_NUMBER_OF_PAGES pages and the corresponding IO handle
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_page_cache_open_source(
+     libesedb_io_handle_t **io_handle,
+     libbfio_handle_t **file_io_handle,
+     uint8_t **data,
+     libcerror_error_t **error )
+{
+	uint8_t page_header_data[ 16 ];
+
+	uint8_t *page_data    = NULL;
+	static char *function = "esedb_test_page_cache_open_source";
+	size_t data_size      = 0;
+	int page_index        = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	/* The first 2 pages contain the file header and its backup
+	 */
+	data_size = ( 2 + ESEDB_TEST_PAGE_CACHE_NUMBER_OF_PAGES ) * ESEDB_TEST_PAGE_CACHE_PAGE_SIZE;
+
+	*data = (uint8_t *) memory_allocate(
+	                     sizeof( uint8_t ) * data_size );
+
+	if( *data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *data,
+	     0,
+	     data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     page_header_data,
+	     0,
+	     16 ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear page header data.",
+		 function );
+
+		goto on_error;
+	}
+	for( page_index = 0;
+	     page_index < ESEDB_TEST_PAGE_CACHE_NUMBER_OF_PAGES;
+	     page_index++ )
+	{
+		page_data = &( ( *data )[ ( 2 + page_index ) * ESEDB_TEST_PAGE_CACHE_PAGE_SIZE ] );
+
+		if( esedb_test_write_page_header(
+		     page_data,
+		     ESEDB_TEST_PAGE_CACHE_PAGE_SIZE,
+		     0,
+		     0,
+		     LIBESEDB_PAGE_FLAG_IS_ROOT | LIBESEDB_PAGE_FLAG_IS_LEAF,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+			 "%s: unable to write page header: %d.",
+			 function,
+			 page_index );
+
+			goto on_error;
+		}
+		if( esedb_test_append_page_value(
+		     page_data,
+		     ESEDB_TEST_PAGE_CACHE_PAGE_SIZE,
+		     page_header_data,
+		     16,
+		     0,
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+			 "%s: unable to append page header value: %d.",
+			 function,
+			 page_index );
+
+			goto on_error;
+		}
+	}
+	if( esedb_test_open_page_tree_source(
+	     io_handle,
+	     NULL,
+	     file_io_handle,
+	     *data,
+	     data_size,
+	     ESEDB_TEST_PAGE_CACHE_PAGE_SIZE,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open page tree source.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *data != NULL )
+	{
+		memory_free(
+		 *data );
+
+		*data = NULL;
+	}
+	return( -1 );
+}
+
+/* Closes a file IO handle opened by esedb_test_page_cache_open_source
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_page_cache_close_source(
+     libesedb_io_handle_t **io_handle,
+     libbfio_handle_t **file_io_handle,
+     uint8_t **data,
+     libcerror_error_t **error )
+{
+	static char *function = "esedb_test_page_cache_close_source";
+	int result            = 1;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( esedb_test_close_page_tree_source(
+	     io_handle,
+	     NULL,
+	     file_io_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close page tree source.",
+		 function );
+
+		result = -1;
+	}
+	if( *data != NULL )
+	{
+		memory_free(
+		 *data );
+
+		*data = NULL;
+	}
+	return( result );
+}
+
+/* Determines the number of references of the cached pages
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_page_cache_get_number_of_references(
+     libesedb_page_cache_t *page_cache,
+     int *number_of_references,
+     libcerror_error_t **error )
+{
+	static char *function = "esedb_test_page_cache_get_number_of_references";
+	int entry_index       = 0;
+	int number_of_entries = 0;
+	int shard_index       = 0;
+
+	if( page_cache == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page cache.",
+		 function );
+
+		return( -1 );
+	}
+	if( number_of_references == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid number of references.",
+		 function );
+
+		return( -1 );
+	}
+	number_of_entries     = page_cache->number_of_sets * LIBESEDB_PAGE_CACHE_NUMBER_OF_WAYS;
+	*number_of_references = 0;
+
+	for( shard_index = 0;
+	     shard_index < LIBESEDB_PAGE_CACHE_NUMBER_OF_SHARDS;
+	     shard_index++ )
+	{
+		for( entry_index = 0;
+		     entry_index < number_of_entries;
+		     entry_index++ )
+		{
+			*number_of_references += page_cache->shards[ shard_index ].entries[ entry_index ].number_of_references;
+		}
+	}
+	return( 1 );
+}
+
+/* Retrieves pseudo random pages from the page cache while keeping
+ * ESEDB_TEST_PAGE_CACHE_NUMBER_OF_PINNED_PAGES pages referenced
+ * The page number of a referenced page must not change before it is released
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_page_cache_retrieve_pages(
+     esedb_test_page_cache_thread_values_t *thread_values )
+{
+	libesedb_page_t *pages[ ESEDB_TEST_PAGE_CACHE_NUMBER_OF_PINNED_PAGES ];
+	uint32_t page_numbers[ ESEDB_TEST_PAGE_CACHE_NUMBER_OF_PINNED_PAGES ];
+
+	libcerror_error_t *error = NULL;
+	uint32_t page_number     = 0;
+	uint32_t seed            = 0;
+	int page_index           = 0;
+	int retrieval_index      = 0;
+
+	if( thread_values == NULL )
+	{
+		return( -1 );
+	}
+	thread_values->result = -1;
+
+	for( page_index = 0;
+	     page_index < ESEDB_TEST_PAGE_CACHE_NUMBER_OF_PINNED_PAGES;
+	     page_index++ )
+	{
+		pages[ page_index ]        = NULL;
+		page_numbers[ page_index ] = 0;
+	}
+	seed = thread_values->seed;
+
+	for( retrieval_index = 0;
+	     retrieval_index < thread_values->number_of_retrievals;
+	     retrieval_index++ )
+	{
+		page_index = retrieval_index % ESEDB_TEST_PAGE_CACHE_NUMBER_OF_PINNED_PAGES;
+
+		if( pages[ page_index ] != NULL )
+		{
+			if( pages[ page_index ]->page_number != page_numbers[ page_index ] )
+			{
+				goto on_error;
+			}
+			if( libesedb_page_cache_release_page(
+			     thread_values->page_cache,
+			     &( pages[ page_index ] ),
+			     &error ) != 1 )
+			{
+				goto on_error;
+			}
+		}
+		seed        = ( seed * 1103515245UL ) + 12345;
+		page_number = 1 + ( ( seed >> 16 ) % ESEDB_TEST_PAGE_CACHE_NUMBER_OF_PAGES );
+
+		if( libesedb_page_cache_get_page(
+		     thread_values->page_cache,
+		     thread_values->file_io_handle,
+		     page_number,
+		     &( pages[ page_index ] ),
+		     &error ) != 1 )
+		{
+			goto on_error;
+		}
+		if( ( pages[ page_index ] == NULL )
+		 || ( pages[ page_index ]->page_number != page_number ) )
+		{
+			goto on_error;
+		}
+		page_numbers[ page_index ] = page_number;
+	}
+	thread_values->result = 1;
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	for( page_index = 0;
+	     page_index < ESEDB_TEST_PAGE_CACHE_NUMBER_OF_PINNED_PAGES;
+	     page_index++ )
+	{
+		if( pages[ page_index ] != NULL )
+		{
+			if( libesedb_page_cache_release_page(
+			     thread_values->page_cache,
+			     &( pages[ page_index ] ),
+			     NULL ) != 1 )
+			{
+				thread_values->result = -1;
+			}
+		}
+	}
+	return( thread_values->result );
+}
+
+/* Retrieves pages from the page cache using multiple threads
+ * Returns 1 if successful, 0 if a thread failed or -1 on error
+ */
+int esedb_test_page_cache_retrieve_pages_with_threads(
+     libesedb_page_cache_t *page_cache,
+     libbfio_handle_t *file_io_handle,
+     int number_of_threads,
+     int number_of_retrievals,
+     libcerror_error_t **error )
+{
+	esedb_test_page_cache_thread_values_t thread_values[ 64 ];
+
+#if defined( HAVE_ESEDB_TEST_MULTI_THREAD_SUPPORT )
+	libcthreads_thread_t *threads[ 64 ];
+#endif
+
+	static char *function = "esedb_test_page_cache_retrieve_pages_with_threads";
+	int result            = 1;
+	int thread_index      = 0;
+
+	if( ( number_of_threads <= 0 )
+	 || ( number_of_threads > 64 ) )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_VALUE_OUT_OF_BOUNDS,
+		 "%s: invalid number of threads value out of bounds.",
+		 function );
+
+		return( -1 );
+	}
+#if !defined( HAVE_ESEDB_TEST_MULTI_THREAD_SUPPORT )
+	if( number_of_threads != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_UNSUPPORTED_VALUE,
+		 "%s: multiple threads not supported.",
+		 function );
+
+		return( -1 );
+	}
+#endif
+	for( thread_index = 0;
+	     thread_index < number_of_threads;
+	     thread_index++ )
+	{
+		thread_values[ thread_index ].page_cache           = page_cache;
+		thread_values[ thread_index ].file_io_handle       = file_io_handle;
+		thread_values[ thread_index ].seed                 = (uint32_t) ( thread_index + 1 ) * 2654435761UL;
+		thread_values[ thread_index ].number_of_retrievals = number_of_retrievals;
+		thread_values[ thread_index ].result               = 0;
+	}
+#if defined( HAVE_ESEDB_TEST_MULTI_THREAD_SUPPORT )
+	for( thread_index = 0;
+	     thread_index < number_of_threads;
+	     thread_index++ )
+	{
+		threads[ thread_index ] = NULL;
+	}
+	for( thread_index = 0;
+	     thread_index < number_of_threads;
+	     thread_index++ )
+	{
+		if( libcthreads_thread_create(
+		     &( threads[ thread_index ] ),
+		     NULL,
+		     (int (*)(void *)) &esedb_test_page_cache_retrieve_pages,
+		     (void *) &( thread_values[ thread_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+			 "%s: unable to create thread: %d.",
+			 function,
+			 thread_index );
+
+			result = -1;
+
+			break;
+		}
+	}
+	for( thread_index = 0;
+	     thread_index < number_of_threads;
+	     thread_index++ )
+	{
+		if( threads[ thread_index ] == NULL )
+		{
+			continue;
+		}
+		if( libcthreads_thread_join(
+		     &( threads[ thread_index ] ),
+		     error ) != 1 )
+		{
+			libcerror_error_set(
+			 error,
+			 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+			 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+			 "%s: unable to join thread: %d.",
+			 function,
+			 thread_index );
+
+			result = -1;
+		}
+	}
+#else
+	esedb_test_page_cache_retrieve_pages(
+	 &( thread_values[ 0 ] ) );
+#endif
+	if( result != 1 )
+	{
+		return( result );
+	}
+	for( thread_index = 0;
+	     thread_index < number_of_threads;
+	     thread_index++ )
+	{
+		if( thread_values[ thread_index ].result != 1 )
+		{
+			result = 0;
+		}
+	}
+	return( result );
+}
+
+/* Tests the libesedb_page_cache_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_page_cache_initialize(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libesedb_io_handle_t *io_handle   = NULL;
+	libesedb_page_cache_t *page_cache = NULL;
+	int result                        = 0;
+
+#if defined( HAVE_ESEDB_TEST_MEMORY )
+	int number_of_malloc_fail_tests   = 2;
+	int number_of_memset_fail_tests   = 2;
+	int test_number                   = 0;
+#endif
+
+	/* Initialize test
+	 */
+	result = libesedb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_page_cache_initialize(
+	          &page_cache,
+	          io_handle,
+	          LIBESEDB_MAXIMUM_CACHE_ENTRIES_PAGE_CACHE,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "page_cache",
+	 page_cache );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "page_cache->number_of_sets",
+	 page_cache->number_of_sets,
+	 LIBESEDB_MAXIMUM_CACHE_ENTRIES_PAGE_CACHE / ( LIBESEDB_PAGE_CACHE_NUMBER_OF_SHARDS * LIBESEDB_PAGE_CACHE_NUMBER_OF_WAYS ) );
+
+	result = libesedb_page_cache_free(
+	          &page_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "page_cache",
+	 page_cache );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test a maximum number of pages smaller than a set of every shard
+	 */
+	result = libesedb_page_cache_initialize(
+	          &page_cache,
+	          io_handle,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "page_cache",
+	 page_cache );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "page_cache->number_of_sets",
+	 page_cache->number_of_sets,
+	 1 );
+
+	result = libesedb_page_cache_free(
+	          &page_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_page_cache_initialize(
+	          NULL,
+	          io_handle,
+	          LIBESEDB_MAXIMUM_CACHE_ENTRIES_PAGE_CACHE,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	page_cache = (libesedb_page_cache_t *) 0x12345678UL;
+
+	result = libesedb_page_cache_initialize(
+	          &page_cache,
+	          io_handle,
+	          LIBESEDB_MAXIMUM_CACHE_ENTRIES_PAGE_CACHE,
+	          &error );
+
+	page_cache = NULL;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_cache_initialize(
+	          &page_cache,
+	          NULL,
+	          LIBESEDB_MAXIMUM_CACHE_ENTRIES_PAGE_CACHE,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_cache_initialize(
+	          &page_cache,
+	          io_handle,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_ESEDB_TEST_MEMORY )
+
+	for( test_number = 0;
+	     test_number < number_of_malloc_fail_tests;
+	     test_number++ )
+	{
+		/* Test libesedb_page_cache_initialize with malloc failing
+		 */
+		esedb_test_malloc_attempts_before_fail = test_number;
+
+		result = libesedb_page_cache_initialize(
+		          &page_cache,
+		          io_handle,
+		          LIBESEDB_MAXIMUM_CACHE_ENTRIES_PAGE_CACHE,
+		          &error );
+
+		if( esedb_test_malloc_attempts_before_fail != -1 )
+		{
+			esedb_test_malloc_attempts_before_fail = -1;
+
+			if( page_cache != NULL )
+			{
+				libesedb_page_cache_free(
+				 &page_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			ESEDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			ESEDB_TEST_ASSERT_IS_NULL(
+			 "page_cache",
+			 page_cache );
+
+			ESEDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+	for( test_number = 0;
+	     test_number < number_of_memset_fail_tests;
+	     test_number++ )
+	{
+		/* Test libesedb_page_cache_initialize with memset failing
+		 */
+		esedb_test_memset_attempts_before_fail = test_number;
+
+		result = libesedb_page_cache_initialize(
+		          &page_cache,
+		          io_handle,
+		          LIBESEDB_MAXIMUM_CACHE_ENTRIES_PAGE_CACHE,
+		          &error );
+
+		if( esedb_test_memset_attempts_before_fail != -1 )
+		{
+			esedb_test_memset_attempts_before_fail = -1;
+
+			if( page_cache != NULL )
+			{
+				libesedb_page_cache_free(
+				 &page_cache,
+				 NULL );
+			}
+		}
+		else
+		{
+			ESEDB_TEST_ASSERT_EQUAL_INT(
+			 "result",
+			 result,
+			 -1 );
+
+			ESEDB_TEST_ASSERT_IS_NULL(
+			 "page_cache",
+			 page_cache );
+
+			ESEDB_TEST_ASSERT_IS_NOT_NULL(
+			 "error",
+			 error );
+
+			libcerror_error_free(
+			 &error );
+		}
+	}
+#endif /* defined( HAVE_ESEDB_TEST_MEMORY ) */
+
+	/* Clean up
+	 */
+	result = libesedb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( page_cache != NULL )
+	{
+		libesedb_page_cache_free(
+		 &page_cache,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libesedb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_page_cache_free function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_page_cache_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_page_cache_free(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_page_cache_empty function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_page_cache_empty(
+     void )
+{
+	libbfio_handle_t *file_io_handle  = NULL;
+	libcerror_error_t *error          = NULL;
+	libesedb_io_handle_t *io_handle   = NULL;
+	libesedb_page_cache_t *page_cache = NULL;
+	libesedb_page_t *page             = NULL;
+	libesedb_page_t *pinned_page      = NULL;
+	uint8_t *data                     = NULL;
+	uint64_t number_of_hits           = 0;
+	uint64_t number_of_misses         = 0;
+	uint64_t number_of_uncached_pages = 0;
+	int number_of_references          = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_page_cache_open_source(
+	          &io_handle,
+	          &file_io_handle,
+	          &data,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_cache_initialize(
+	          &page_cache,
+	          io_handle,
+	          LIBESEDB_MAXIMUM_CACHE_ENTRIES_PAGE_CACHE,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_cache_get_page(
+	          page_cache,
+	          file_io_handle,
+	          1,
+	          &pinned_page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_cache_get_page(
+	          page_cache,
+	          file_io_handle,
+	          2,
+	          &page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_cache_release_page(
+	          page_cache,
+	          &page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_page_cache_empty(
+	          page_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_page_cache_get_number_of_references(
+	          page_cache,
+	          &number_of_references,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_references",
+	 number_of_references,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The referenced page remains cached
+	 */
+	result = libesedb_page_cache_get_page(
+	          page_cache,
+	          file_io_handle,
+	          1,
+	          &page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INTPTR(
+	 "page",
+	 (intptr_t) page,
+	 (intptr_t) pinned_page );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_cache_release_page(
+	          page_cache,
+	          &page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The unreferenced page was freed and is read again
+	 */
+	result = libesedb_page_cache_get_page(
+	          page_cache,
+	          file_io_handle,
+	          2,
+	          &page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "page",
+	 page );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_cache_release_page(
+	          page_cache,
+	          &page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_cache_get_statistics(
+	          page_cache,
+	          &number_of_hits,
+	          &number_of_misses,
+	          &number_of_uncached_pages,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_hits",
+	 number_of_hits,
+	 (uint64_t) 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_misses",
+	 number_of_misses,
+	 (uint64_t) 3 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_page_cache_empty(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_page_cache_release_page(
+	          page_cache,
+	          &pinned_page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_cache_free(
+	          &page_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_page_cache_close_source(
+	          &io_handle,
+	          &file_io_handle,
+	          &data,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( page_cache != NULL )
+	{
+		libesedb_page_cache_release_page(
+		 page_cache,
+		 &page,
+		 NULL );
+
+		libesedb_page_cache_release_page(
+		 page_cache,
+		 &pinned_page,
+		 NULL );
+
+		libesedb_page_cache_free(
+		 &page_cache,
+		 NULL );
+	}
+	if( data != NULL )
+	{
+		esedb_test_page_cache_close_source(
+		 &io_handle,
+		 &file_io_handle,
+		 &data,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_page_cache_get_page function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_page_cache_get_page(
+     void )
+{
+	libesedb_page_t *pinned_pages[ LIBESEDB_PAGE_CACHE_NUMBER_OF_WAYS ];
+
+	libbfio_handle_t *file_io_handle  = NULL;
+	libcerror_error_t *error          = NULL;
+	libesedb_io_handle_t *io_handle   = NULL;
+	libesedb_page_cache_t *page_cache = NULL;
+	libesedb_page_t *page             = NULL;
+	libesedb_page_t *uncached_page    = NULL;
+	uint8_t *data                     = NULL;
+	uint64_t number_of_hits           = 0;
+	uint64_t number_of_misses         = 0;
+	uint64_t number_of_uncached_pages = 0;
+	int number_of_references          = 0;
+	int page_index                    = 0;
+	int result                        = 0;
+
+	for( page_index = 0;
+	     page_index < LIBESEDB_PAGE_CACHE_NUMBER_OF_WAYS;
+	     page_index++ )
+	{
+		pinned_pages[ page_index ] = NULL;
+	}
+	/* Initialize test
+	 */
+	result = esedb_test_page_cache_open_source(
+	          &io_handle,
+	          &file_io_handle,
+	          &data,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Use a page cache with a single set per shard
+	 */
+	result = libesedb_page_cache_initialize(
+	          &page_cache,
+	          io_handle,
+	          LIBESEDB_PAGE_CACHE_NUMBER_OF_SHARDS * LIBESEDB_PAGE_CACHE_NUMBER_OF_WAYS,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_page_cache_get_page(
+	          page_cache,
+	          file_io_handle,
+	          1,
+	          &page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "page",
+	 page );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "page->page_number",
+	 page->page_number,
+	 1 );
+
+	/* Retrieve the same page while it is referenced
+	 */
+	result = libesedb_page_cache_get_page(
+	          page_cache,
+	          file_io_handle,
+	          1,
+	          &( pinned_pages[ 0 ] ),
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INTPTR(
+	 "pinned_pages[ 0 ]",
+	 (intptr_t) pinned_pages[ 0 ],
+	 (intptr_t) page );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_page_cache_get_number_of_references(
+	          page_cache,
+	          &number_of_references,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_references",
+	 number_of_references,
+	 2 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_cache_release_page(
+	          page_cache,
+	          &page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "page",
+	 page );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Reference all the entries of the set of shard 1, which contains
+	 * the pages 1, 17, 33, ..., 113
+	 */
+	for( page_index = 1;
+	     page_index < LIBESEDB_PAGE_CACHE_NUMBER_OF_WAYS;
+	     page_index++ )
+	{
+		result = libesedb_page_cache_get_page(
+		          page_cache,
+		          file_io_handle,
+		          1 + ( page_index * LIBESEDB_PAGE_CACHE_NUMBER_OF_SHARDS ),
+		          &( pinned_pages[ page_index ] ),
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NOT_NULL(
+		 "pinned_pages[ page_index ]",
+		 pinned_pages[ page_index ] );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* The page is not cached since all the entries of its set are referenced
+	 */
+	result = libesedb_page_cache_get_page(
+	          page_cache,
+	          file_io_handle,
+	          1 + ( LIBESEDB_PAGE_CACHE_NUMBER_OF_WAYS * LIBESEDB_PAGE_CACHE_NUMBER_OF_SHARDS ),
+	          &uncached_page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "uncached_page",
+	 uncached_page );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "uncached_page->page_number",
+	 uncached_page->page_number,
+	 1 + ( LIBESEDB_PAGE_CACHE_NUMBER_OF_WAYS * LIBESEDB_PAGE_CACHE_NUMBER_OF_SHARDS ) );
+
+	for( page_index = 0;
+	     page_index < LIBESEDB_PAGE_CACHE_NUMBER_OF_WAYS;
+	     page_index++ )
+	{
+		ESEDB_TEST_ASSERT_EQUAL_UINT32(
+		 "pinned_pages[ page_index ]->page_number",
+		 pinned_pages[ page_index ]->page_number,
+		 1 + ( page_index * LIBESEDB_PAGE_CACHE_NUMBER_OF_SHARDS ) );
+	}
+	result = libesedb_page_cache_release_page(
+	          page_cache,
+	          &uncached_page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "uncached_page",
+	 uncached_page );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Once released the least recently used page is evicted
+	 */
+	for( page_index = 0;
+	     page_index < LIBESEDB_PAGE_CACHE_NUMBER_OF_WAYS;
+	     page_index++ )
+	{
+		result = libesedb_page_cache_release_page(
+		          page_cache,
+		          &( pinned_pages[ page_index ] ),
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libesedb_page_cache_get_page(
+	          page_cache,
+	          file_io_handle,
+	          1 + ( LIBESEDB_PAGE_CACHE_NUMBER_OF_WAYS * LIBESEDB_PAGE_CACHE_NUMBER_OF_SHARDS ),
+	          &page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_cache_release_page(
+	          page_cache,
+	          &page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Page 17 was retrieved after page 1 and hence remains cached
+	 */
+	result = libesedb_page_cache_get_page(
+	          page_cache,
+	          file_io_handle,
+	          1 + LIBESEDB_PAGE_CACHE_NUMBER_OF_SHARDS,
+	          &page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_cache_release_page(
+	          page_cache,
+	          &page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_cache_get_statistics(
+	          page_cache,
+	          &number_of_hits,
+	          &number_of_misses,
+	          &number_of_uncached_pages,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_hits",
+	 number_of_hits,
+	 (uint64_t) 2 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_misses",
+	 number_of_misses,
+	 (uint64_t) ( LIBESEDB_PAGE_CACHE_NUMBER_OF_WAYS + 2 ) );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_uncached_pages",
+	 number_of_uncached_pages,
+	 (uint64_t) 1 );
+
+	result = esedb_test_page_cache_get_number_of_references(
+	          page_cache,
+	          &number_of_references,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_references",
+	 number_of_references,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_page_cache_get_page(
+	          NULL,
+	          file_io_handle,
+	          1,
+	          &page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_cache_get_page(
+	          page_cache,
+	          file_io_handle,
+	          0,
+	          &page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_cache_get_page(
+	          page_cache,
+	          file_io_handle,
+	          ESEDB_TEST_PAGE_CACHE_NUMBER_OF_PAGES + 1,
+	          &page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_cache_get_page(
+	          page_cache,
+	          file_io_handle,
+	          1,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_page_cache_free(
+	          &page_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_page_cache_close_source(
+	          &io_handle,
+	          &file_io_handle,
+	          &data,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( page_cache != NULL )
+	{
+		for( page_index = 0;
+		     page_index < LIBESEDB_PAGE_CACHE_NUMBER_OF_WAYS;
+		     page_index++ )
+		{
+			libesedb_page_cache_release_page(
+			 page_cache,
+			 &( pinned_pages[ page_index ] ),
+			 NULL );
+		}
+		libesedb_page_cache_release_page(
+		 page_cache,
+		 &uncached_page,
+		 NULL );
+
+		libesedb_page_cache_release_page(
+		 page_cache,
+		 &page,
+		 NULL );
+
+		libesedb_page_cache_free(
+		 &page_cache,
+		 NULL );
+	}
+	if( data != NULL )
+	{
+		esedb_test_page_cache_close_source(
+		 &io_handle,
+		 &file_io_handle,
+		 &data,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_page_cache_release_page function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_page_cache_release_page(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libesedb_io_handle_t *io_handle   = NULL;
+	libesedb_page_cache_t *page_cache = NULL;
+	libesedb_page_t *page             = NULL;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_cache_initialize(
+	          &page_cache,
+	          io_handle,
+	          LIBESEDB_MAXIMUM_CACHE_ENTRIES_PAGE_CACHE,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_page_cache_release_page(
+	          page_cache,
+	          &page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_page_cache_release_page(
+	          NULL,
+	          &page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_cache_release_page(
+	          page_cache,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_page_cache_free(
+	          &page_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( page_cache != NULL )
+	{
+		libesedb_page_cache_free(
+		 &page_cache,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libesedb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_page_cache_get_statistics function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_page_cache_get_statistics(
+     void )
+{
+	libcerror_error_t *error          = NULL;
+	libesedb_io_handle_t *io_handle   = NULL;
+	libesedb_page_cache_t *page_cache = NULL;
+	uint64_t number_of_hits           = 0;
+	uint64_t number_of_misses         = 0;
+	uint64_t number_of_uncached_pages = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_cache_initialize(
+	          &page_cache,
+	          io_handle,
+	          LIBESEDB_MAXIMUM_CACHE_ENTRIES_PAGE_CACHE,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_page_cache_get_statistics(
+	          page_cache,
+	          &number_of_hits,
+	          &number_of_misses,
+	          &number_of_uncached_pages,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_hits",
+	 number_of_hits,
+	 (uint64_t) 0 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_misses",
+	 number_of_misses,
+	 (uint64_t) 0 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT64(
+	 "number_of_uncached_pages",
+	 number_of_uncached_pages,
+	 (uint64_t) 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_page_cache_get_statistics(
+	          NULL,
+	          &number_of_hits,
+	          &number_of_misses,
+	          &number_of_uncached_pages,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_cache_get_statistics(
+	          page_cache,
+	          NULL,
+	          &number_of_misses,
+	          &number_of_uncached_pages,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_cache_get_statistics(
+	          page_cache,
+	          &number_of_hits,
+	          NULL,
+	          &number_of_uncached_pages,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_cache_get_statistics(
+	          page_cache,
+	          &number_of_hits,
+	          &number_of_misses,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_page_cache_free(
+	          &page_cache,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( page_cache != NULL )
+	{
+		libesedb_page_cache_free(
+		 &page_cache,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libesedb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests retrieving pages from the page cache with 1 up to 64 threads
+ * where the number of pages exceeds the number of cache entries
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_page_cache_get_page_threaded(
+     void )
+{
+	libbfio_handle_t *file_io_handle  = NULL;
+	libcerror_error_t *error          = NULL;
+	libesedb_io_handle_t *io_handle   = NULL;
+	libesedb_page_cache_t *page_cache = NULL;
+	uint8_t *data                     = NULL;
+	uint64_t number_of_hits           = 0;
+	uint64_t number_of_misses         = 0;
+	uint64_t number_of_retrievals     = 0;
+	uint64_t number_of_uncached_pages = 0;
+	int number_of_references          = 0;
+	int number_of_threads             = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_page_cache_open_source(
+	          &io_handle,
+	          &file_io_handle,
+	          &data,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( HAVE_ESEDB_TEST_MULTI_THREAD_SUPPORT )
+	for( number_of_threads = 1;
+	     number_of_threads <= 64;
+	     number_of_threads *= 2 )
+#else
+	number_of_threads = 1;
+#endif
+	{
+		/* Use a page cache that can contain half of the pages
+		 */
+		result = libesedb_page_cache_initialize(
+		          &page_cache,
+		          io_handle,
+		          ESEDB_TEST_PAGE_CACHE_NUMBER_OF_PAGES / 2,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = esedb_test_page_cache_retrieve_pages_with_threads(
+		          page_cache,
+		          file_io_handle,
+		          number_of_threads,
+		          1024,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libesedb_page_cache_get_statistics(
+		          page_cache,
+		          &number_of_hits,
+		          &number_of_misses,
+		          &number_of_uncached_pages,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		number_of_retrievals = number_of_hits + number_of_misses;
+
+		ESEDB_TEST_ASSERT_EQUAL_UINT64(
+		 "number_of_retrievals",
+		 number_of_retrievals,
+		 (uint64_t) number_of_threads * 1024 );
+
+		result = esedb_test_page_cache_get_number_of_references(
+		          page_cache,
+		          &number_of_references,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "number_of_references",
+		 number_of_references,
+		 0 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libesedb_page_cache_free(
+		          &page_cache,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Clean up
+	 */
+	result = esedb_test_page_cache_close_source(
+	          &io_handle,
+	          &file_io_handle,
+	          &data,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( page_cache != NULL )
+	{
+		libesedb_page_cache_free(
+		 &page_cache,
+		 NULL );
+	}
+	if( data != NULL )
+	{
+		esedb_test_page_cache_close_source(
+		 &io_handle,
+		 &file_io_handle,
+		 &data,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Measures the number of pages per second that 1 up to 64 threads retrieve from the page cache
+ * The benchmark is only run when the ESEDB_TEST_PAGE_CACHE_BENCHMARK environment variable is set
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_page_cache_benchmark(
+     void )
+{
+#if defined( HAVE_CLOCK_GETTIME )
+	struct timespec end_time;
+	struct timespec start_time;
+#elif defined( HAVE_TIME )
+	time_t end_time                   = 0;
+	time_t start_time                 = 0;
+#endif
+
+	libbfio_handle_t *file_io_handle  = NULL;
+	libcerror_error_t *error          = NULL;
+	libesedb_io_handle_t *io_handle   = NULL;
+	libesedb_page_cache_t *page_cache = NULL;
+	uint8_t *data                     = NULL;
+	uint64_t number_of_hits           = 0;
+	uint64_t number_of_misses         = 0;
+	uint64_t number_of_uncached_pages = 0;
+	double elapsed_time               = 0.0;
+	int number_of_threads             = 0;
+	int result                        = 0;
+
+	if( getenv( "ESEDB_TEST_PAGE_CACHE_BENCHMARK" ) == NULL )
+	{
+		return( 1 );
+	}
+	/* Initialize test
+	 */
+	result = esedb_test_page_cache_open_source(
+	          &io_handle,
+	          &file_io_handle,
+	          &data,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( HAVE_ESEDB_TEST_MULTI_THREAD_SUPPORT )
+	for( number_of_threads = 1;
+	     number_of_threads <= 64;
+	     number_of_threads *= 2 )
+#else
+	number_of_threads = 1;
+#endif
+	{
+		result = libesedb_page_cache_initialize(
+		          &page_cache,
+		          io_handle,
+		          ESEDB_TEST_PAGE_CACHE_NUMBER_OF_PAGES / 2,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+#if defined( HAVE_CLOCK_GETTIME )
+		clock_gettime(
+		 CLOCK_MONOTONIC,
+		 &start_time );
+#elif defined( HAVE_TIME )
+		start_time = time(
+		              NULL );
+#endif
+		result = esedb_test_page_cache_retrieve_pages_with_threads(
+		          page_cache,
+		          file_io_handle,
+		          number_of_threads,
+		          1048576 / number_of_threads,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+#if defined( HAVE_CLOCK_GETTIME )
+		clock_gettime(
+		 CLOCK_MONOTONIC,
+		 &end_time );
+
+		elapsed_time = (double) ( end_time.tv_sec - start_time.tv_sec )
+		             + ( (double) ( end_time.tv_nsec - start_time.tv_nsec ) / 1000000000.0 );
+#elif defined( HAVE_TIME )
+		end_time = time(
+		            NULL );
+
+		elapsed_time = difftime(
+		                end_time,
+		                start_time );
+#endif
+		result = libesedb_page_cache_get_statistics(
+		          page_cache,
+		          &number_of_hits,
+		          &number_of_misses,
+		          &number_of_uncached_pages,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		fprintf(
+		 stdout,
+		 "Threads: %2d, hits: %" PRIu64 ", misses: %" PRIu64 ", uncached: %" PRIu64 ", seconds: %.3f",
+		 number_of_threads,
+		 number_of_hits,
+		 number_of_misses,
+		 number_of_uncached_pages,
+		 elapsed_time );
+
+		if( elapsed_time > 0.0 )
+		{
+			fprintf(
+			 stdout,
+			 ", pages per second: %.0f",
+			 (double) ( number_of_hits + number_of_misses ) / elapsed_time );
+		}
+		fprintf(
+		 stdout,
+		 "\n" );
+
+		result = libesedb_page_cache_free(
+		          &page_cache,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Clean up
+	 */
+	result = esedb_test_page_cache_close_source(
+	          &io_handle,
+	          &file_io_handle,
+	          &data,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( page_cache != NULL )
+	{
+		libesedb_page_cache_free(
+		 &page_cache,
+		 NULL );
+	}
+	if( data != NULL )
+	{
+		esedb_test_page_cache_close_source(
+		 &io_handle,
+		 &file_io_handle,
+		 &data,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argc )
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+	ESEDB_TEST_RUN(
+	 "libesedb_page_cache_initialize",
+	 esedb_test_page_cache_initialize );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_page_cache_free",
+	 esedb_test_page_cache_free );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_page_cache_empty",
+	 esedb_test_page_cache_empty );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_page_cache_get_page",
+	 esedb_test_page_cache_get_page );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_page_cache_release_page",
+	 esedb_test_page_cache_release_page );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_page_cache_get_statistics",
+	 esedb_test_page_cache_get_statistics );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_page_cache_get_page_threaded",
+	 esedb_test_page_cache_get_page_threaded );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_page_cache_benchmark",
+	 esedb_test_page_cache_benchmark );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
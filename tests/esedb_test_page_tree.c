@@ -20,24 +20,331 @@
  */
 
 #include <common.h>
+#include <byte_stream.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
 #include <stdlib.h>
 #endif
 
+#include "esedb_test_functions.h"
+#include "esedb_test_libbfio.h"
+#include "esedb_test_libcdata.h"
 #include "esedb_test_libcerror.h"
 #include "esedb_test_libesedb.h"
 #include "esedb_test_macros.h"
 #include "esedb_test_memory.h"
 #include "esedb_test_unused.h"
 
+#include "../libesedb/libesedb_data_definition.h"
+#include "../libesedb/libesedb_definitions.h"
 #include "../libesedb/libesedb_io_handle.h"
+#include "../libesedb/libesedb_leaf_page_descriptor.h"
+#include "../libesedb/libesedb_page.h"
+#include "../libesedb/libesedb_page_cache.h"
 #include "../libesedb/libesedb_page_tree.h"
+#include "../libesedb/libesedb_page_tree_key.h"
+#include "../libesedb/libesedb_page_tree_value.h"
+#include "../libesedb/libesedb_page_value.h"
+
+#define ESEDB_TEST_PAGE_TREE_NUMBER_OF_LEAF_PAGES	10
+#define ESEDB_TEST_PAGE_TREE_NUMBER_OF_LEAF_VALUES	100
+#define ESEDB_TEST_PAGE_TREE_NUMBER_OF_PAGES		12
+#define ESEDB_TEST_PAGE_TREE_PAGE_SIZE			4096
+#define ESEDB_TEST_PAGE_TREE_ROOT_PAGE_NUMBER		1
+
+/* The number of leaf values per leaf page, including an empty leaf page
+ */
+int esedb_test_page_tree_number_of_leaf_values[ ESEDB_TEST_PAGE_TREE_NUMBER_OF_LEAF_PAGES ] = {
+	10, 10, 10, 0, 10, 10, 10, 10, 10, 20 };
+
+/* The branch page values, without the page header value, that consist of
+ * a local key size, a 1-byte local key and a child page number
+ */
+uint8_t esedb_test_page_tree_branch_page_values_data[ 7 ][ 7 ] = {
+	{ 0x01, 0x00, 0x10, 0x02, 0x00, 0x00, 0x00 },
+	{ 0x01, 0x00, 0x20, 0x03, 0x00, 0x00, 0x00 },
+	{ 0x01, 0x00, 0x30, 0x04, 0x00, 0x00, 0x00 },
+	{ 0x01, 0x00, 0x40, 0x05, 0x00, 0x00, 0x00 },
+	{ 0x01, 0x00, 0x50, 0x06, 0x00, 0x00, 0x00 },
+	{ 0x01, 0x00, 0x60, 0x07, 0x00, 0x00, 0x00 },
+	{ 0x01, 0x00, 0x70, 0x08, 0x00, 0x00, 0x00 } };
+
+/* The flags of the branch page values, where the values with keys 0x20, 0x40, 0x50 and 0x70 are defunct
+ */
+uint8_t esedb_test_page_tree_branch_page_values_flags[ 7 ] = {
+	0, LIBESEDB_PAGE_TAG_FLAG_IS_DEFUNCT, 0, LIBESEDB_PAGE_TAG_FLAG_IS_DEFUNCT, LIBESEDB_PAGE_TAG_FLAG_IS_DEFUNCT, 0, LIBESEDB_PAGE_TAG_FLAG_IS_DEFUNCT };
 
 #if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
 
+/* Opens a page tree of ESEDB_TEST_PAGE_TREE_NUMBER_OF_LEAF_VALUES record leaf values
+ * The data must contain the file header, its backup and ESEDB_TEST_PAGE_TREE_NUMBER_OF_PAGES pages
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_page_tree_open_source(
+     libesedb_page_tree_t **page_tree,
+     libesedb_page_cache_t **page_cache,
+     libesedb_io_handle_t **io_handle,
+     libbfio_handle_t **file_io_handle,
+     uint8_t *data,
+     size_t data_size,
+     libcerror_error_t **error )
+{
+	static char *function = "esedb_test_page_tree_open_source";
+
+	if( memory_set(
+	     data,
+	     0,
+	     data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear data.",
+		 function );
+
+		return( -1 );
+	}
+	if( esedb_test_write_page_tree(
+	     data,
+	     data_size,
+	     ESEDB_TEST_PAGE_TREE_PAGE_SIZE,
+	     ESEDB_TEST_PAGE_TREE_ROOT_PAGE_NUMBER,
+	     1 + ESEDB_TEST_PAGE_TREE_NUMBER_OF_LEAF_PAGES,
+	     esedb_test_page_tree_number_of_leaf_values,
+	     ESEDB_TEST_PAGE_TREE_NUMBER_OF_LEAF_PAGES,
+	     ESEDB_TEST_PAGE_TREE_LEAF_VALUE_TYPE_RECORD,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to write page tree.",
+		 function );
+
+		return( -1 );
+	}
+	if( esedb_test_open_page_tree_source(
+	     io_handle,
+	     page_cache,
+	     file_io_handle,
+	     data,
+	     data_size,
+	     ESEDB_TEST_PAGE_TREE_PAGE_SIZE,
+	     4,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open page tree source.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_page_tree_initialize(
+	     page_tree,
+	     *io_handle,
+	     *page_cache,
+	     0,
+	     ESEDB_TEST_PAGE_TREE_ROOT_PAGE_NUMBER,
+	     NULL,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create page tree.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *io_handle != NULL )
+	{
+		esedb_test_close_page_tree_source(
+		 io_handle,
+		 page_cache,
+		 file_io_handle,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Closes a page tree opened by esedb_test_page_tree_open_source
+ * Returns 0 if successful or -1 on error
+ */
+int esedb_test_page_tree_close_source(
+     libesedb_page_tree_t **page_tree,
+     libesedb_page_cache_t **page_cache,
+     libesedb_io_handle_t **io_handle,
+     libbfio_handle_t **file_io_handle,
+     libcerror_error_t **error )
+{
+	static char *function = "esedb_test_page_tree_close_source";
+	int result            = 0;
+
+	if( libesedb_page_tree_free(
+	     page_tree,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free page tree.",
+		 function );
+
+		result = -1;
+	}
+	if( esedb_test_close_page_tree_source(
+	     io_handle,
+	     page_cache,
+	     file_io_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close page tree source.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
+/* Appends a page value to a page for testing
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_page_tree_append_page_value(
+     libesedb_page_t *page,
+     uint8_t *data,
+     uint16_t data_size,
+     uint8_t flags,
+     libcerror_error_t **error )
+{
+	libesedb_page_value_t *page_value = NULL;
+	static char *function             = "esedb_test_page_tree_append_page_value";
+	int entry_index                   = 0;
+
+	if( page == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid page.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_page_value_initialize(
+	     &page_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create page value.",
+		 function );
+
+		goto on_error;
+	}
+	page_value->data  = data;
+	page_value->size  = data_size;
+	page_value->flags = flags;
+
+	if( libcdata_array_append_entry(
+	     page->values_array,
+	     &entry_index,
+	     (intptr_t *) page_value,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_APPEND_FAILED,
+		 "%s: unable to append page value.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( page_value != NULL )
+	{
+		libesedb_page_value_free(
+		 &page_value,
+		 NULL );
+	}
+	return( -1 );
+}
+
+/* Creates an index value page tree key of a 1-byte key for testing
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_page_tree_initialize_branch_key(
+     libesedb_page_tree_key_t **page_tree_key,
+     const uint8_t *key_data,
+     libcerror_error_t **error )
+{
+	static char *function = "esedb_test_page_tree_initialize_branch_key";
+
+	if( libesedb_page_tree_key_initialize(
+	     page_tree_key,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create page tree key.",
+		 function );
+
+		goto on_error;
+	}
+	( *page_tree_key )->type = LIBESEDB_KEY_TYPE_INDEX_VALUE;
+
+	if( libesedb_page_tree_key_set_data(
+	     *page_tree_key,
+	     key_data,
+	     1,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to set page tree key data.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *page_tree_key != NULL )
+	{
+		libesedb_page_tree_key_free(
+		 page_tree_key,
+		 NULL );
+	}
+	return( -1 );
+}
+
 /* Tests the libesedb_page_tree_initialize function
  * Returns 1 if successful or 0 if not
  */
@@ -83,7 +390,6 @@ int esedb_test_page_tree_initialize(
 	          &page_tree,
 	          io_handle,
 	          NULL,
-	          NULL,
 	          0,
 	          1,
 	          NULL,
@@ -126,7 +432,6 @@ int esedb_test_page_tree_initialize(
 	          NULL,
 	          io_handle,
 	          NULL,
-	          NULL,
 	          0,
 	          1,
 	          NULL,
@@ -151,7 +456,6 @@ int esedb_test_page_tree_initialize(
 	          &page_tree,
 	          io_handle,
 	          NULL,
-	          NULL,
 	          0,
 	          1,
 	          NULL,
@@ -176,7 +480,6 @@ int esedb_test_page_tree_initialize(
 	          &page_tree,
 	          NULL,
 	          NULL,
-	          NULL,
 	          0,
 	          1,
 	          NULL,
@@ -209,7 +512,6 @@ int esedb_test_page_tree_initialize(
 		          &page_tree,
 		          io_handle,
 		          NULL,
-		          NULL,
 		          0,
 		          1,
 		          NULL,
@@ -258,7 +560,6 @@ int esedb_test_page_tree_initialize(
 		          &page_tree,
 		          io_handle,
 		          NULL,
-		          NULL,
 		          0,
 		          1,
 		          NULL,
@@ -416,48 +717,4242 @@ on_error:
 	return( 0 );
 }
 
-#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
-
-/* The main program
+/* Tests the libesedb_page_tree_get_leaf_page_descriptor_index function
+ * Returns 1 if successful or 0 if not
  */
-#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
-int wmain(
-     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
-     wchar_t * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
-#else
-int main(
-     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
-     char * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
-#endif
+int esedb_test_page_tree_get_leaf_page_descriptor_index(
+     void )
 {
-	ESEDB_TEST_UNREFERENCED_PARAMETER( argc )
-	ESEDB_TEST_UNREFERENCED_PARAMETER( argv )
+	libcerror_error_t *error        = NULL;
+	libesedb_io_handle_t *io_handle = NULL;
+	libesedb_page_tree_t *page_tree = NULL;
+	int leaf_page_descriptor_index  = 0;
+	int result                      = 0;
 
-#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+	/* Initialize test
+	 */
+	result = libesedb_io_handle_initialize(
+	          &io_handle,
+	          &error );
 
-	ESEDB_TEST_RUN(
-	 "libesedb_page_tree_initialize",
-	 esedb_test_page_tree_initialize );
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-	ESEDB_TEST_RUN(
-	 "libesedb_page_tree_free",
-	 esedb_test_page_tree_free );
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
 
-	ESEDB_TEST_RUN(
-	 "libesedb_page_tree_read_root_page_header",
-	 esedb_test_page_tree_read_root_page_header );
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
-	/* TODO: add tests for libesedb_page_tree_read_space_trees */
+	result = libesedb_page_tree_initialize(
+	          &page_tree,
+	          io_handle,
+	          NULL,
+	          0,
+	          1,
+	          NULL,
+	          NULL,
+	          &error );
 
-	/* TODO: add tests for libesedb_page_tree_get_key */
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-	/* TODO: add tests for libesedb_page_tree_get_number_of_leaf_values_from_page */
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "page_tree",
+	 page_tree );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Leaf page 11 does not contain leaf values
+	 */
+	result = libesedb_page_tree_append_leaf_page_descriptor(
+	          page_tree,
+	          10,
+	          0,
+	          9,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_append_leaf_page_descriptor(
+	          page_tree,
+	          11,
+	          10,
+	          9,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_append_leaf_page_descriptor(
+	          page_tree,
+	          12,
+	          10,
+	          19,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_page_tree_get_leaf_page_descriptor_index(
+	          page_tree,
+	          9,
+	          &leaf_page_descriptor_index,
+	          &error );
 
-	/* TODO: add tests for libesedb_page_tree_get_number_of_leaf_values */
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "leaf_page_descriptor_index",
+	 leaf_page_descriptor_index,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_get_leaf_page_descriptor_index(
+	          page_tree,
+	          10,
+	          &leaf_page_descriptor_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "leaf_page_descriptor_index",
+	 leaf_page_descriptor_index,
+	 2 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_get_leaf_page_descriptor_index(
+	          page_tree,
+	          20,
+	          &leaf_page_descriptor_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_page_tree_get_leaf_page_descriptor_index(
+	          NULL,
+	          10,
+	          &leaf_page_descriptor_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_tree_get_leaf_page_descriptor_index(
+	          page_tree,
+	          10,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
 
-	/* TODO: add tests for libesedb_page_tree_get_leaf_value_by_index_from_page */
+	libcerror_error_free(
+	 &error );
 
-	/* TODO: add tests for libesedb_page_tree_get_leaf_value_by_index */
+	/* Clean up
+	 */
+	result = libesedb_page_tree_free(
+	          &page_tree,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "page_tree",
+	 page_tree );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( page_tree != NULL )
+	{
+		libesedb_page_tree_free(
+		 &page_tree,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libesedb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_page_tree_append_leaf_page_descriptor function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_page_tree_append_leaf_page_descriptor(
+     void )
+{
+	libcerror_error_t *error        = NULL;
+	libesedb_io_handle_t *io_handle = NULL;
+	libesedb_page_tree_t *page_tree = NULL;
+	int leaf_page_descriptor_index  = 0;
+	int result                      = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->format_revision = 0x0000000c;
+	io_handle->page_size       = 4096;
+
+	result = libesedb_page_tree_initialize(
+	          &page_tree,
+	          io_handle,
+	          NULL,
+	          0,
+	          1,
+	          NULL,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "page_tree",
+	 page_tree );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+#if defined( HAVE_ESEDB_TEST_MEMORY )
+
+	/* Test libesedb_page_tree_append_leaf_page_descriptor with realloc failing
+	 */
+	esedb_test_realloc_attempts_before_fail = 0;
+
+	result = libesedb_page_tree_append_leaf_page_descriptor(
+	          page_tree,
+	          2,
+	          0,
+	          9,
+	          &error );
+
+	if( esedb_test_realloc_attempts_before_fail != -1 )
+	{
+		esedb_test_realloc_attempts_before_fail = -1;
+	}
+	else
+	{
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		ESEDB_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "page_tree->number_of_leaf_page_descriptors",
+		 page_tree->number_of_leaf_page_descriptors,
+		 0 );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "page_tree->number_of_allocated_leaf_page_descriptors",
+		 page_tree->number_of_allocated_leaf_page_descriptors,
+		 0 );
+	}
+#endif /* defined( HAVE_ESEDB_TEST_MEMORY ) */
+
+	/* Test regular cases
+	 */
+	for( leaf_page_descriptor_index = 0;
+	     leaf_page_descriptor_index < 64;
+	     leaf_page_descriptor_index++ )
+	{
+		result = libesedb_page_tree_append_leaf_page_descriptor(
+		          page_tree,
+		          (uint32_t) leaf_page_descriptor_index + 2,
+		          leaf_page_descriptor_index * 10,
+		          ( leaf_page_descriptor_index * 10 ) + 9,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "page_tree->number_of_leaf_page_descriptors",
+	 page_tree->number_of_leaf_page_descriptors,
+	 64 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "page_tree->number_of_allocated_leaf_page_descriptors",
+	 page_tree->number_of_allocated_leaf_page_descriptors,
+	 64 );
+
+	/* Test regular case where the leaf page descriptors grow past the initial allocation
+	 */
+	result = libesedb_page_tree_append_leaf_page_descriptor(
+	          page_tree,
+	          66,
+	          640,
+	          649,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "page_tree->number_of_leaf_page_descriptors",
+	 page_tree->number_of_leaf_page_descriptors,
+	 65 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "page_tree->number_of_allocated_leaf_page_descriptors",
+	 page_tree->number_of_allocated_leaf_page_descriptors,
+	 128 );
+
+	/* The leaf page descriptors appended before the reallocation are retained
+	 */
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "page_tree->leaf_page_descriptors[ 0 ].page_number",
+	 page_tree->leaf_page_descriptors[ 0 ].page_number,
+	 2 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "page_tree->leaf_page_descriptors[ 63 ].first_leaf_value_index",
+	 page_tree->leaf_page_descriptors[ 63 ].first_leaf_value_index,
+	 630 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "page_tree->leaf_page_descriptors[ 63 ].last_leaf_value_index",
+	 page_tree->leaf_page_descriptors[ 63 ].last_leaf_value_index,
+	 639 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "page_tree->leaf_page_descriptors[ 64 ].page_number",
+	 page_tree->leaf_page_descriptors[ 64 ].page_number,
+	 66 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "page_tree->leaf_page_descriptors[ 64 ].first_leaf_value_index",
+	 page_tree->leaf_page_descriptors[ 64 ].first_leaf_value_index,
+	 640 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "page_tree->leaf_page_descriptors[ 64 ].last_leaf_value_index",
+	 page_tree->leaf_page_descriptors[ 64 ].last_leaf_value_index,
+	 649 );
+
+	/* Test error cases
+	 */
+	result = libesedb_page_tree_append_leaf_page_descriptor(
+	          NULL,
+	          2,
+	          0,
+	          9,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_ESEDB_TEST_MEMORY )
+
+	/* Test libesedb_page_tree_append_leaf_page_descriptor with realloc failing
+	 * when the leaf page descriptors grow
+	 */
+	page_tree->number_of_leaf_page_descriptors = 128;
+
+	esedb_test_realloc_attempts_before_fail = 0;
+
+	result = libesedb_page_tree_append_leaf_page_descriptor(
+	          page_tree,
+	          130,
+	          1280,
+	          1289,
+	          &error );
+
+	if( esedb_test_realloc_attempts_before_fail != -1 )
+	{
+		esedb_test_realloc_attempts_before_fail = -1;
+	}
+	else
+	{
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		ESEDB_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "page_tree->number_of_leaf_page_descriptors",
+		 page_tree->number_of_leaf_page_descriptors,
+		 128 );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "page_tree->number_of_allocated_leaf_page_descriptors",
+		 page_tree->number_of_allocated_leaf_page_descriptors,
+		 128 );
+	}
+#endif /* defined( HAVE_ESEDB_TEST_MEMORY ) */
+
+	/* Clean up
+	 */
+	result = libesedb_page_tree_free(
+	          &page_tree,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "page_tree",
+	 page_tree );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( page_tree != NULL )
+	{
+		libesedb_page_tree_free(
+		 &page_tree,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libesedb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_page_tree_set_leaf_page_descriptors function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_page_tree_set_leaf_page_descriptors(
+     void )
+{
+	libcerror_error_t *error                               = NULL;
+	libesedb_io_handle_t *io_handle                        = NULL;
+	libesedb_leaf_page_descriptor_t *leaf_page_descriptors = NULL;
+	libesedb_page_tree_t *page_tree                        = NULL;
+	int leaf_page_descriptor_index                         = 0;
+	int result                                             = 0;
+
+	/* Initialize test
+	 */
+	leaf_page_descriptors = (libesedb_leaf_page_descriptor_t *) memory_allocate(
+	                                                             sizeof( libesedb_leaf_page_descriptor_t ) * ( LIBESEDB_MAXIMUM_NUMBER_OF_LEAF_PAGES + 1 ) );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "leaf_page_descriptors",
+	 leaf_page_descriptors );
+
+	for( leaf_page_descriptor_index = 0;
+	     leaf_page_descriptor_index < ( LIBESEDB_MAXIMUM_NUMBER_OF_LEAF_PAGES + 1 );
+	     leaf_page_descriptor_index++ )
+	{
+		leaf_page_descriptors[ leaf_page_descriptor_index ].page_number            = (uint32_t) leaf_page_descriptor_index + 2;
+		leaf_page_descriptors[ leaf_page_descriptor_index ].first_leaf_value_index = leaf_page_descriptor_index * 2;
+		leaf_page_descriptors[ leaf_page_descriptor_index ].last_leaf_value_index  = ( leaf_page_descriptor_index * 2 ) + 1;
+	}
+	result = libesedb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->format_revision = 0x0000000c;
+	io_handle->page_size       = 4096;
+
+	result = libesedb_page_tree_initialize(
+	          &page_tree,
+	          io_handle,
+	          NULL,
+	          0,
+	          1,
+	          NULL,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "page_tree",
+	 page_tree );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_page_tree_set_leaf_page_descriptors(
+	          NULL,
+	          leaf_page_descriptors,
+	          1,
+	          2,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_tree_set_leaf_page_descriptors(
+	          page_tree,
+	          NULL,
+	          1,
+	          2,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_tree_set_leaf_page_descriptors(
+	          page_tree,
+	          leaf_page_descriptors,
+	          -1,
+	          2,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* The number of leaf page descriptors cannot exceed the maximum number of leaf pages
+	 */
+	result = libesedb_page_tree_set_leaf_page_descriptors(
+	          page_tree,
+	          leaf_page_descriptors,
+	          LIBESEDB_MAXIMUM_NUMBER_OF_LEAF_PAGES + 1,
+	          ( LIBESEDB_MAXIMUM_NUMBER_OF_LEAF_PAGES + 1 ) * 2,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "page_tree->number_of_leaf_page_descriptors",
+	 page_tree->number_of_leaf_page_descriptors,
+	 0 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "page_tree->number_of_leaf_values",
+	 page_tree->number_of_leaf_values,
+	 -1 );
+
+	result = libesedb_page_tree_set_leaf_page_descriptors(
+	          page_tree,
+	          leaf_page_descriptors,
+	          1,
+	          -1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+#if defined( HAVE_ESEDB_TEST_MEMORY )
+
+	/* Test libesedb_page_tree_set_leaf_page_descriptors with realloc failing
+	 * when the leaf page descriptors grow past the initial allocation
+	 */
+	esedb_test_realloc_attempts_before_fail = 1;
+
+	result = libesedb_page_tree_set_leaf_page_descriptors(
+	          page_tree,
+	          leaf_page_descriptors,
+	          LIBESEDB_MAXIMUM_NUMBER_OF_LEAF_PAGES,
+	          LIBESEDB_MAXIMUM_NUMBER_OF_LEAF_PAGES * 2,
+	          &error );
+
+	if( esedb_test_realloc_attempts_before_fail != -1 )
+	{
+		esedb_test_realloc_attempts_before_fail = -1;
+	}
+	else
+	{
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 -1 );
+
+		ESEDB_TEST_ASSERT_IS_NOT_NULL(
+		 "error",
+		 error );
+
+		libcerror_error_free(
+		 &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "page_tree->number_of_leaf_page_descriptors",
+		 page_tree->number_of_leaf_page_descriptors,
+		 0 );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "page_tree->number_of_leaf_values",
+		 page_tree->number_of_leaf_values,
+		 -1 );
+	}
+#endif /* defined( HAVE_ESEDB_TEST_MEMORY ) */
+
+	/* Test regular cases
+	 */
+	result = libesedb_page_tree_set_leaf_page_descriptors(
+	          page_tree,
+	          leaf_page_descriptors,
+	          LIBESEDB_MAXIMUM_NUMBER_OF_LEAF_PAGES,
+	          LIBESEDB_MAXIMUM_NUMBER_OF_LEAF_PAGES * 2,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "page_tree->number_of_leaf_page_descriptors",
+	 page_tree->number_of_leaf_page_descriptors,
+	 LIBESEDB_MAXIMUM_NUMBER_OF_LEAF_PAGES );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "page_tree->number_of_leaf_values",
+	 page_tree->number_of_leaf_values,
+	 LIBESEDB_MAXIMUM_NUMBER_OF_LEAF_PAGES * 2 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "page_tree->next_leaf_page_number",
+	 page_tree->next_leaf_page_number,
+	 0 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "page_tree->leaf_page_descriptors[ LIBESEDB_MAXIMUM_NUMBER_OF_LEAF_PAGES - 1 ].page_number",
+	 page_tree->leaf_page_descriptors[ LIBESEDB_MAXIMUM_NUMBER_OF_LEAF_PAGES - 1 ].page_number,
+	 (uint32_t) LIBESEDB_MAXIMUM_NUMBER_OF_LEAF_PAGES + 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "page_tree->leaf_page_descriptors[ LIBESEDB_MAXIMUM_NUMBER_OF_LEAF_PAGES - 1 ].last_leaf_value_index",
+	 page_tree->leaf_page_descriptors[ LIBESEDB_MAXIMUM_NUMBER_OF_LEAF_PAGES - 1 ].last_leaf_value_index,
+	 ( LIBESEDB_MAXIMUM_NUMBER_OF_LEAF_PAGES * 2 ) - 1 );
+
+	/* Test regular case where the leaf page descriptors were already read
+	 */
+	result = libesedb_page_tree_set_leaf_page_descriptors(
+	          page_tree,
+	          leaf_page_descriptors,
+	          1,
+	          2,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "page_tree->number_of_leaf_page_descriptors",
+	 page_tree->number_of_leaf_page_descriptors,
+	 LIBESEDB_MAXIMUM_NUMBER_OF_LEAF_PAGES );
+
+	/* Clean up
+	 */
+	result = libesedb_page_tree_free(
+	          &page_tree,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "page_tree",
+	 page_tree );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	memory_free(
+	 leaf_page_descriptors );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( page_tree != NULL )
+	{
+		libesedb_page_tree_free(
+		 &page_tree,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libesedb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	if( leaf_page_descriptors != NULL )
+	{
+		memory_free(
+		 leaf_page_descriptors );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_page_tree_read_leaf_page_descriptors function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_page_tree_read_leaf_page_descriptors(
+     void )
+{
+	uint8_t data[ ( 2 + ESEDB_TEST_PAGE_TREE_NUMBER_OF_PAGES ) * ESEDB_TEST_PAGE_TREE_PAGE_SIZE ];
+
+	libbfio_handle_t *file_io_handle  = NULL;
+	libcerror_error_t *error          = NULL;
+	libesedb_io_handle_t *io_handle   = NULL;
+	libesedb_page_cache_t *page_cache = NULL;
+	libesedb_page_tree_t *page_tree   = NULL;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_page_tree_open_source(
+	          &page_tree,
+	          &page_cache,
+	          &io_handle,
+	          &file_io_handle,
+	          data,
+	          ( 2 + ESEDB_TEST_PAGE_TREE_NUMBER_OF_PAGES ) * ESEDB_TEST_PAGE_TREE_PAGE_SIZE,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = libesedb_page_tree_read_leaf_page_descriptors(
+	          page_tree,
+	          file_io_handle,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "page_tree->number_of_leaf_page_descriptors",
+	 page_tree->number_of_leaf_page_descriptors,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "page_tree->number_of_leaf_values",
+	 page_tree->number_of_leaf_values,
+	 10 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "page_tree->next_leaf_page_number",
+	 page_tree->next_leaf_page_number,
+	 3 );
+
+	/* Leaf values that have already been read do not cause leaf pages to be read
+	 */
+	result = libesedb_page_tree_read_leaf_page_descriptors(
+	          page_tree,
+	          file_io_handle,
+	          9,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "page_tree->number_of_leaf_page_descriptors",
+	 page_tree->number_of_leaf_page_descriptors,
+	 1 );
+
+	/* Leaf value 30 is stored in the leaf page after the empty leaf page
+	 */
+	result = libesedb_page_tree_read_leaf_page_descriptors(
+	          page_tree,
+	          file_io_handle,
+	          30,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "page_tree->number_of_leaf_page_descriptors",
+	 page_tree->number_of_leaf_page_descriptors,
+	 5 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "page_tree->number_of_leaf_values",
+	 page_tree->number_of_leaf_values,
+	 40 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "page_tree->leaf_page_descriptors[ 3 ].page_number",
+	 page_tree->leaf_page_descriptors[ 3 ].page_number,
+	 5 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "page_tree->leaf_page_descriptors[ 3 ].first_leaf_value_index",
+	 page_tree->leaf_page_descriptors[ 3 ].first_leaf_value_index,
+	 30 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "page_tree->leaf_page_descriptors[ 3 ].last_leaf_value_index",
+	 page_tree->leaf_page_descriptors[ 3 ].last_leaf_value_index,
+	 29 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "page_tree->leaf_page_descriptors[ 4 ].first_leaf_value_index",
+	 page_tree->leaf_page_descriptors[ 4 ].first_leaf_value_index,
+	 30 );
+
+	result = libesedb_page_tree_read_leaf_page_descriptors(
+	          page_tree,
+	          file_io_handle,
+	          -1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "page_tree->number_of_leaf_page_descriptors",
+	 page_tree->number_of_leaf_page_descriptors,
+	 ESEDB_TEST_PAGE_TREE_NUMBER_OF_LEAF_PAGES );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "page_tree->number_of_leaf_values",
+	 page_tree->number_of_leaf_values,
+	 ESEDB_TEST_PAGE_TREE_NUMBER_OF_LEAF_VALUES );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "page_tree->next_leaf_page_number",
+	 page_tree->next_leaf_page_number,
+	 0 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "page_tree->leaf_page_descriptors[ 9 ].last_leaf_value_index",
+	 page_tree->leaf_page_descriptors[ 9 ].last_leaf_value_index,
+	 ESEDB_TEST_PAGE_TREE_NUMBER_OF_LEAF_VALUES - 1 );
+
+	/* Test error cases
+	 */
+	result = libesedb_page_tree_read_leaf_page_descriptors(
+	          NULL,
+	          file_io_handle,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_tree_read_leaf_page_descriptors(
+	          page_tree,
+	          file_io_handle,
+	          -2,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = esedb_test_page_tree_close_source(
+	          &page_tree,
+	          &page_cache,
+	          &io_handle,
+	          &file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		esedb_test_page_tree_close_source(
+		 &page_tree,
+		 &page_cache,
+		 &io_handle,
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_page_tree_get_number_of_leaf_values function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_page_tree_get_number_of_leaf_values(
+     void )
+{
+	uint8_t data[ ( 2 + ESEDB_TEST_PAGE_TREE_NUMBER_OF_PAGES ) * ESEDB_TEST_PAGE_TREE_PAGE_SIZE ];
+
+	libbfio_handle_t *file_io_handle  = NULL;
+	libcerror_error_t *error          = NULL;
+	libesedb_io_handle_t *io_handle   = NULL;
+	libesedb_page_cache_t *page_cache = NULL;
+	libesedb_page_tree_t *page_tree   = NULL;
+	int number_of_leaf_values         = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_page_tree_open_source(
+	          &page_tree,
+	          &page_cache,
+	          &io_handle,
+	          &file_io_handle,
+	          data,
+	          ( 2 + ESEDB_TEST_PAGE_TREE_NUMBER_OF_PAGES ) * ESEDB_TEST_PAGE_TREE_PAGE_SIZE,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	number_of_leaf_values = 0;
+
+	result = libesedb_page_tree_get_estimated_number_of_leaf_values(
+	          page_tree,
+	          file_io_handle,
+	          &number_of_leaf_values,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_leaf_values",
+	 number_of_leaf_values,
+	 96 );
+
+	/* The exact number of leaf values is determined after it has been estimated
+	 */
+	number_of_leaf_values = 0;
+
+	result = libesedb_page_tree_get_number_of_leaf_values(
+	          page_tree,
+	          file_io_handle,
+	          &number_of_leaf_values,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_leaf_values",
+	 number_of_leaf_values,
+	 ESEDB_TEST_PAGE_TREE_NUMBER_OF_LEAF_VALUES );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "page_tree->number_of_leaf_page_descriptors",
+	 page_tree->number_of_leaf_page_descriptors,
+	 ESEDB_TEST_PAGE_TREE_NUMBER_OF_LEAF_PAGES );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "page_tree->next_leaf_page_number",
+	 page_tree->next_leaf_page_number,
+	 0 );
+
+	/* The number of leaf values is not determined again once all leaf pages have been read
+	 */
+	page_tree->number_of_leaf_values = 50;
+
+	number_of_leaf_values = 0;
+
+	result = libesedb_page_tree_get_number_of_leaf_values(
+	          page_tree,
+	          file_io_handle,
+	          &number_of_leaf_values,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_leaf_values",
+	 number_of_leaf_values,
+	 50 );
+
+	page_tree->number_of_leaf_values = ESEDB_TEST_PAGE_TREE_NUMBER_OF_LEAF_VALUES;
+
+	/* Test error cases
+	 */
+	result = libesedb_page_tree_get_number_of_leaf_values(
+	          NULL,
+	          file_io_handle,
+	          &number_of_leaf_values,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_tree_get_number_of_leaf_values(
+	          page_tree,
+	          file_io_handle,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = esedb_test_page_tree_close_source(
+	          &page_tree,
+	          &page_cache,
+	          &io_handle,
+	          &file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Initialize test
+	 */
+	result = esedb_test_page_tree_open_source(
+	          &page_tree,
+	          &page_cache,
+	          &io_handle,
+	          &file_io_handle,
+	          data,
+	          ( 2 + ESEDB_TEST_PAGE_TREE_NUMBER_OF_PAGES ) * ESEDB_TEST_PAGE_TREE_PAGE_SIZE,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular case where only the first leaf page has been read
+	 */
+	result = libesedb_page_tree_read_leaf_page_descriptors(
+	          page_tree,
+	          file_io_handle,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "page_tree->number_of_leaf_values",
+	 page_tree->number_of_leaf_values,
+	 10 );
+
+	number_of_leaf_values = 0;
+
+	result = libesedb_page_tree_get_number_of_leaf_values(
+	          page_tree,
+	          file_io_handle,
+	          &number_of_leaf_values,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_leaf_values",
+	 number_of_leaf_values,
+	 ESEDB_TEST_PAGE_TREE_NUMBER_OF_LEAF_VALUES );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "page_tree->number_of_leaf_page_descriptors",
+	 page_tree->number_of_leaf_page_descriptors,
+	 ESEDB_TEST_PAGE_TREE_NUMBER_OF_LEAF_PAGES );
+
+	/* Clean up
+	 */
+	result = esedb_test_page_tree_close_source(
+	          &page_tree,
+	          &page_cache,
+	          &io_handle,
+	          &file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		esedb_test_page_tree_close_source(
+		 &page_tree,
+		 &page_cache,
+		 &io_handle,
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_page_tree_get_estimated_number_of_leaf_values function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_page_tree_get_estimated_number_of_leaf_values(
+     void )
+{
+	uint8_t data[ ( 2 + ESEDB_TEST_PAGE_TREE_NUMBER_OF_PAGES ) * ESEDB_TEST_PAGE_TREE_PAGE_SIZE ];
+
+	libbfio_handle_t *file_io_handle  = NULL;
+	libcerror_error_t *error          = NULL;
+	libesedb_io_handle_t *io_handle   = NULL;
+	libesedb_page_cache_t *page_cache = NULL;
+	libesedb_page_tree_t *page_tree   = NULL;
+	uint8_t *root_page_header_data    = NULL;
+	int number_of_leaf_values         = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_page_tree_open_source(
+	          &page_tree,
+	          &page_cache,
+	          &io_handle,
+	          &file_io_handle,
+	          data,
+	          ( 2 + ESEDB_TEST_PAGE_TREE_NUMBER_OF_PAGES ) * ESEDB_TEST_PAGE_TREE_PAGE_SIZE,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	number_of_leaf_values = 0;
+
+	result = libesedb_page_tree_get_estimated_number_of_leaf_values(
+	          page_tree,
+	          file_io_handle,
+	          &number_of_leaf_values,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The first 8 leaf pages contain 70 leaf values and the page tree uses 11 pages
+	 */
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_leaf_values",
+	 number_of_leaf_values,
+	 96 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "page_tree->number_of_leaf_page_descriptors",
+	 page_tree->number_of_leaf_page_descriptors,
+	 8 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "page_tree->estimated_number_of_leaf_values",
+	 page_tree->estimated_number_of_leaf_values,
+	 96 );
+
+	/* The estimate is cached
+	 */
+	page_tree->estimated_number_of_leaf_values = 50;
+
+	number_of_leaf_values = 0;
+
+	result = libesedb_page_tree_get_estimated_number_of_leaf_values(
+	          page_tree,
+	          file_io_handle,
+	          &number_of_leaf_values,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_leaf_values",
+	 number_of_leaf_values,
+	 50 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "page_tree->number_of_leaf_page_descriptors",
+	 page_tree->number_of_leaf_page_descriptors,
+	 8 );
+
+	/* The exact number of leaf values is returned once all leaf pages have been read
+	 */
+	result = libesedb_page_tree_read_leaf_page_descriptors(
+	          page_tree,
+	          file_io_handle,
+	          -1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	number_of_leaf_values = 0;
+
+	result = libesedb_page_tree_get_estimated_number_of_leaf_values(
+	          page_tree,
+	          file_io_handle,
+	          &number_of_leaf_values,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_leaf_values",
+	 number_of_leaf_values,
+	 ESEDB_TEST_PAGE_TREE_NUMBER_OF_LEAF_VALUES );
+
+	/* Test error cases
+	 */
+	result = libesedb_page_tree_get_estimated_number_of_leaf_values(
+	          NULL,
+	          file_io_handle,
+	          &number_of_leaf_values,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_tree_get_estimated_number_of_leaf_values(
+	          page_tree,
+	          file_io_handle,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = esedb_test_page_tree_close_source(
+	          &page_tree,
+	          &page_cache,
+	          &io_handle,
+	          &file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Initialize test
+	 */
+	result = esedb_test_page_tree_open_source(
+	          &page_tree,
+	          &page_cache,
+	          &io_handle,
+	          &file_io_handle,
+	          data,
+	          ( 2 + ESEDB_TEST_PAGE_TREE_NUMBER_OF_PAGES ) * ESEDB_TEST_PAGE_TREE_PAGE_SIZE,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Point the space tree of the root page header at the unused and empty last page
+	 */
+	root_page_header_data = &( data[ ( ESEDB_TEST_PAGE_TREE_ROOT_PAGE_NUMBER + 1 ) * ESEDB_TEST_PAGE_TREE_PAGE_SIZE + ESEDB_TEST_PAGE_HEADER_SIZE ] );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( root_page_header_data[ 8 ] ),
+	 1 );
+
+	byte_stream_copy_from_uint32_little_endian(
+	 &( root_page_header_data[ 12 ] ),
+	 ESEDB_TEST_PAGE_TREE_NUMBER_OF_PAGES );
+
+	/* Test estimate falls back to the number of leaf values in the sampled leaf pages
+	 * if the space tree cannot be read
+	 */
+	number_of_leaf_values = 0;
+
+	result = libesedb_page_tree_get_estimated_number_of_leaf_values(
+	          page_tree,
+	          file_io_handle,
+	          &number_of_leaf_values,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_leaf_values",
+	 number_of_leaf_values,
+	 70 );
+
+	/* Clean up
+	 */
+	result = esedb_test_page_tree_close_source(
+	          &page_tree,
+	          &page_cache,
+	          &io_handle,
+	          &file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		esedb_test_page_tree_close_source(
+		 &page_tree,
+		 &page_cache,
+		 &io_handle,
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_page_tree_get_leaf_page_boundary function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_page_tree_get_leaf_page_boundary(
+     void )
+{
+	uint8_t data[ ( 2 + ESEDB_TEST_PAGE_TREE_NUMBER_OF_PAGES ) * ESEDB_TEST_PAGE_TREE_PAGE_SIZE ];
+
+	libbfio_handle_t *file_io_handle  = NULL;
+	libcerror_error_t *error          = NULL;
+	libesedb_io_handle_t *io_handle   = NULL;
+	libesedb_page_cache_t *page_cache = NULL;
+	libesedb_page_tree_t *page_tree   = NULL;
+	int boundary_leaf_value_index     = 0;
+	int number_of_leaf_values         = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_page_tree_open_source(
+	          &page_tree,
+	          &page_cache,
+	          &io_handle,
+	          &file_io_handle,
+	          data,
+	          ( 2 + ESEDB_TEST_PAGE_TREE_NUMBER_OF_PAGES ) * ESEDB_TEST_PAGE_TREE_PAGE_SIZE,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error case where not all leaf pages have been read
+	 */
+	result = libesedb_page_tree_get_leaf_page_boundary(
+	          page_tree,
+	          0,
+	          &boundary_leaf_value_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_tree_get_number_of_leaf_values(
+	          page_tree,
+	          file_io_handle,
+	          &number_of_leaf_values,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_leaf_values",
+	 number_of_leaf_values,
+	 ESEDB_TEST_PAGE_TREE_NUMBER_OF_LEAF_VALUES );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	boundary_leaf_value_index = -1;
+
+	result = libesedb_page_tree_get_leaf_page_boundary(
+	          page_tree,
+	          0,
+	          &boundary_leaf_value_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "boundary_leaf_value_index",
+	 boundary_leaf_value_index,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Leaf value 10 is the first leaf value of a leaf page
+	 */
+	boundary_leaf_value_index = -1;
+
+	result = libesedb_page_tree_get_leaf_page_boundary(
+	          page_tree,
+	          10,
+	          &boundary_leaf_value_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "boundary_leaf_value_index",
+	 boundary_leaf_value_index,
+	 10 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Leaf value 15 is in the middle of a leaf page, hence the boundary is the start
+	 * of the next leaf page
+	 */
+	boundary_leaf_value_index = -1;
+
+	result = libesedb_page_tree_get_leaf_page_boundary(
+	          page_tree,
+	          15,
+	          &boundary_leaf_value_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "boundary_leaf_value_index",
+	 boundary_leaf_value_index,
+	 20 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The leaf page after leaf value 25 is empty, hence the boundary is the start of
+	 * the leaf page after the empty leaf page
+	 */
+	boundary_leaf_value_index = -1;
+
+	result = libesedb_page_tree_get_leaf_page_boundary(
+	          page_tree,
+	          25,
+	          &boundary_leaf_value_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "boundary_leaf_value_index",
+	 boundary_leaf_value_index,
+	 30 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	boundary_leaf_value_index = -1;
+
+	result = libesedb_page_tree_get_leaf_page_boundary(
+	          page_tree,
+	          30,
+	          &boundary_leaf_value_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "boundary_leaf_value_index",
+	 boundary_leaf_value_index,
+	 30 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Leaf value 85 is in the last leaf page, hence the boundary is the end of the
+	 * leaf values
+	 */
+	boundary_leaf_value_index = -1;
+
+	result = libesedb_page_tree_get_leaf_page_boundary(
+	          page_tree,
+	          85,
+	          &boundary_leaf_value_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "boundary_leaf_value_index",
+	 boundary_leaf_value_index,
+	 ESEDB_TEST_PAGE_TREE_NUMBER_OF_LEAF_VALUES );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	boundary_leaf_value_index = -1;
+
+	result = libesedb_page_tree_get_leaf_page_boundary(
+	          page_tree,
+	          ESEDB_TEST_PAGE_TREE_NUMBER_OF_LEAF_VALUES,
+	          &boundary_leaf_value_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "boundary_leaf_value_index",
+	 boundary_leaf_value_index,
+	 ESEDB_TEST_PAGE_TREE_NUMBER_OF_LEAF_VALUES );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_page_tree_get_leaf_page_boundary(
+	          NULL,
+	          0,
+	          &boundary_leaf_value_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_tree_get_leaf_page_boundary(
+	          page_tree,
+	          -1,
+	          &boundary_leaf_value_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_tree_get_leaf_page_boundary(
+	          page_tree,
+	          ESEDB_TEST_PAGE_TREE_NUMBER_OF_LEAF_VALUES + 1,
+	          &boundary_leaf_value_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_tree_get_leaf_page_boundary(
+	          page_tree,
+	          0,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = esedb_test_page_tree_close_source(
+	          &page_tree,
+	          &page_cache,
+	          &io_handle,
+	          &file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		esedb_test_page_tree_close_source(
+		 &page_tree,
+		 &page_cache,
+		 &io_handle,
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_page_tree_get_leaf_value_partition function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_page_tree_get_leaf_value_partition(
+     void )
+{
+	uint8_t data[ ( 2 + ESEDB_TEST_PAGE_TREE_NUMBER_OF_PAGES ) * ESEDB_TEST_PAGE_TREE_PAGE_SIZE ];
+
+	libbfio_handle_t *file_io_handle  = NULL;
+	libcerror_error_t *error          = NULL;
+	libesedb_io_handle_t *io_handle   = NULL;
+	libesedb_page_cache_t *page_cache = NULL;
+	libesedb_page_tree_t *page_tree   = NULL;
+	int first_leaf_value_index        = 0;
+	int number_of_leaf_values         = 0;
+	int result                        = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_page_tree_open_source(
+	          &page_tree,
+	          &page_cache,
+	          &io_handle,
+	          &file_io_handle,
+	          data,
+	          ( 2 + ESEDB_TEST_PAGE_TREE_NUMBER_OF_PAGES ) * ESEDB_TEST_PAGE_TREE_PAGE_SIZE,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * The partitions start at the first leaf page boundary at or after
+	 * 0, 33 and 66 and all leaf pages are read on demand
+	 */
+	result = libesedb_page_tree_get_leaf_value_partition(
+	          page_tree,
+	          file_io_handle,
+	          0,
+	          3,
+	          &first_leaf_value_index,
+	          &number_of_leaf_values,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "first_leaf_value_index",
+	 first_leaf_value_index,
+	 0 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_leaf_values",
+	 number_of_leaf_values,
+	 40 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "page_tree->next_leaf_page_number",
+	 page_tree->next_leaf_page_number,
+	 0 );
+
+	result = libesedb_page_tree_get_leaf_value_partition(
+	          page_tree,
+	          file_io_handle,
+	          1,
+	          3,
+	          &first_leaf_value_index,
+	          &number_of_leaf_values,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "first_leaf_value_index",
+	 first_leaf_value_index,
+	 40 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_leaf_values",
+	 number_of_leaf_values,
+	 30 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_get_leaf_value_partition(
+	          page_tree,
+	          file_io_handle,
+	          2,
+	          3,
+	          &first_leaf_value_index,
+	          &number_of_leaf_values,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "first_leaf_value_index",
+	 first_leaf_value_index,
+	 70 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_leaf_values",
+	 number_of_leaf_values,
+	 30 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The partition after leaf value 25 starts after the empty leaf page
+	 */
+	result = libesedb_page_tree_get_leaf_value_partition(
+	          page_tree,
+	          file_io_handle,
+	          0,
+	          4,
+	          &first_leaf_value_index,
+	          &number_of_leaf_values,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "first_leaf_value_index",
+	 first_leaf_value_index,
+	 0 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_leaf_values",
+	 number_of_leaf_values,
+	 30 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_get_leaf_value_partition(
+	          page_tree,
+	          file_io_handle,
+	          1,
+	          4,
+	          &first_leaf_value_index,
+	          &number_of_leaf_values,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "first_leaf_value_index",
+	 first_leaf_value_index,
+	 30 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_leaf_values",
+	 number_of_leaf_values,
+	 20 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_get_leaf_value_partition(
+	          page_tree,
+	          file_io_handle,
+	          3,
+	          4,
+	          &first_leaf_value_index,
+	          &number_of_leaf_values,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "first_leaf_value_index",
+	 first_leaf_value_index,
+	 80 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_leaf_values",
+	 number_of_leaf_values,
+	 20 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A partition is empty if there are more partitions than leaf pages
+	 */
+	result = libesedb_page_tree_get_leaf_value_partition(
+	          page_tree,
+	          file_io_handle,
+	          199,
+	          200,
+	          &first_leaf_value_index,
+	          &number_of_leaf_values,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "first_leaf_value_index",
+	 first_leaf_value_index,
+	 ESEDB_TEST_PAGE_TREE_NUMBER_OF_LEAF_VALUES );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_leaf_values",
+	 number_of_leaf_values,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_get_leaf_value_partition(
+	          page_tree,
+	          file_io_handle,
+	          0,
+	          1,
+	          &first_leaf_value_index,
+	          &number_of_leaf_values,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "first_leaf_value_index",
+	 first_leaf_value_index,
+	 0 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_leaf_values",
+	 number_of_leaf_values,
+	 ESEDB_TEST_PAGE_TREE_NUMBER_OF_LEAF_VALUES );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_page_tree_get_leaf_value_partition(
+	          NULL,
+	          file_io_handle,
+	          0,
+	          3,
+	          &first_leaf_value_index,
+	          &number_of_leaf_values,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_tree_get_leaf_value_partition(
+	          page_tree,
+	          file_io_handle,
+	          0,
+	          0,
+	          &first_leaf_value_index,
+	          &number_of_leaf_values,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_tree_get_leaf_value_partition(
+	          page_tree,
+	          file_io_handle,
+	          -1,
+	          3,
+	          &first_leaf_value_index,
+	          &number_of_leaf_values,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_tree_get_leaf_value_partition(
+	          page_tree,
+	          file_io_handle,
+	          3,
+	          3,
+	          &first_leaf_value_index,
+	          &number_of_leaf_values,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_tree_get_leaf_value_partition(
+	          page_tree,
+	          file_io_handle,
+	          0,
+	          3,
+	          NULL,
+	          &number_of_leaf_values,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_tree_get_leaf_value_partition(
+	          page_tree,
+	          file_io_handle,
+	          0,
+	          3,
+	          &first_leaf_value_index,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = esedb_test_page_tree_close_source(
+	          &page_tree,
+	          &page_cache,
+	          &io_handle,
+	          &file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( io_handle != NULL )
+	{
+		esedb_test_page_tree_close_source(
+		 &page_tree,
+		 &page_cache,
+		 &io_handle,
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_page_tree_get_leaf_value_by_index_from_page function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_page_tree_get_leaf_value_by_index_from_page(
+     void )
+{
+	uint8_t data[ ( 2 + ESEDB_TEST_PAGE_TREE_NUMBER_OF_PAGES ) * ESEDB_TEST_PAGE_TREE_PAGE_SIZE ];
+
+	libbfio_handle_t *file_io_handle            = NULL;
+	libcerror_error_t *error                    = NULL;
+	libesedb_data_definition_t *data_definition = NULL;
+	libesedb_io_handle_t *io_handle             = NULL;
+	libesedb_page_cache_t *page_cache           = NULL;
+	libesedb_page_t *page                       = NULL;
+	libesedb_page_tree_t *page_tree             = NULL;
+	int current_leaf_value_index                = 0;
+	int result                                  = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_page_tree_open_source(
+	          &page_tree,
+	          &page_cache,
+	          &io_handle,
+	          &file_io_handle,
+	          data,
+	          ( 2 + ESEDB_TEST_PAGE_TREE_NUMBER_OF_PAGES ) * ESEDB_TEST_PAGE_TREE_PAGE_SIZE,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_cache_get_page(
+	          page_cache,
+	          file_io_handle,
+	          ESEDB_TEST_PAGE_TREE_ROOT_PAGE_NUMBER,
+	          &page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "page",
+	 page );
+
+	/* Test regular cases
+	 */
+	/* Leaf value 25 is stored in the third leaf page
+	 */
+	current_leaf_value_index = 0;
+
+	result = libesedb_page_tree_get_leaf_value_by_index_from_page(
+	          page_tree,
+	          file_io_handle,
+	          page,
+	          25,
+	          &data_definition,
+	          &current_leaf_value_index,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "data_definition",
+	 data_definition );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "data_definition->page_number",
+	 data_definition->page_number,
+	 4 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT16(
+	 "data_definition->page_value_index",
+	 data_definition->page_value_index,
+	 6 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "current_leaf_value_index",
+	 current_leaf_value_index,
+	 26 );
+
+	result = libesedb_data_definition_free(
+	          &data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Leaf value 30 is stored in the leaf page after the empty leaf page
+	 */
+	current_leaf_value_index = 0;
+
+	result = libesedb_page_tree_get_leaf_value_by_index_from_page(
+	          page_tree,
+	          file_io_handle,
+	          page,
+	          30,
+	          &data_definition,
+	          &current_leaf_value_index,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "data_definition",
+	 data_definition );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "data_definition->page_number",
+	 data_definition->page_number,
+	 6 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT16(
+	 "data_definition->page_value_index",
+	 data_definition->page_value_index,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "current_leaf_value_index",
+	 current_leaf_value_index,
+	 31 );
+
+	result = libesedb_data_definition_free(
+	          &data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_cache_release_page(
+	          page_cache,
+	          &page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular case where the leaf value is retrieved from a leaf page
+	 */
+	result = libesedb_page_cache_get_page(
+	          page_cache,
+	          file_io_handle,
+	          6,
+	          &page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "page",
+	 page );
+
+	current_leaf_value_index = 30;
+
+	result = libesedb_page_tree_get_leaf_value_by_index_from_page(
+	          page_tree,
+	          file_io_handle,
+	          page,
+	          32,
+	          &data_definition,
+	          &current_leaf_value_index,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "data_definition",
+	 data_definition );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "data_definition->page_number",
+	 data_definition->page_number,
+	 6 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT16(
+	 "data_definition->page_value_index",
+	 data_definition->page_value_index,
+	 3 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "current_leaf_value_index",
+	 current_leaf_value_index,
+	 33 );
+
+	result = libesedb_data_definition_free(
+	          &data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_cache_release_page(
+	          page_cache,
+	          &page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular case where the leaf value is not stored in the leaf page
+	 */
+	result = libesedb_page_cache_get_page(
+	          page_cache,
+	          file_io_handle,
+	          2,
+	          &page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "page",
+	 page );
+
+	current_leaf_value_index = 0;
+
+	result = libesedb_page_tree_get_leaf_value_by_index_from_page(
+	          page_tree,
+	          file_io_handle,
+	          page,
+	          15,
+	          &data_definition,
+	          &current_leaf_value_index,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "data_definition",
+	 data_definition );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "current_leaf_value_index",
+	 current_leaf_value_index,
+	 10 );
+
+	result = libesedb_page_cache_release_page(
+	          page_cache,
+	          &page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular case where the leaf page is empty
+	 */
+	result = libesedb_page_cache_get_page(
+	          page_cache,
+	          file_io_handle,
+	          5,
+	          &page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "page",
+	 page );
+
+	current_leaf_value_index = 30;
+
+	result = libesedb_page_tree_get_leaf_value_by_index_from_page(
+	          page_tree,
+	          file_io_handle,
+	          page,
+	          30,
+	          &data_definition,
+	          &current_leaf_value_index,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "data_definition",
+	 data_definition );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "current_leaf_value_index",
+	 current_leaf_value_index,
+	 30 );
+
+	/* Test error cases
+	 */
+	result = libesedb_page_tree_get_leaf_value_by_index_from_page(
+	          NULL,
+	          file_io_handle,
+	          page,
+	          30,
+	          &data_definition,
+	          &current_leaf_value_index,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_tree_get_leaf_value_by_index_from_page(
+	          page_tree,
+	          file_io_handle,
+	          page,
+	          30,
+	          NULL,
+	          &current_leaf_value_index,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_tree_get_leaf_value_by_index_from_page(
+	          page_tree,
+	          file_io_handle,
+	          page,
+	          30,
+	          &data_definition,
+	          NULL,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_tree_get_leaf_value_by_index_from_page(
+	          page_tree,
+	          file_io_handle,
+	          page,
+	          30,
+	          &data_definition,
+	          &current_leaf_value_index,
+	          -1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_tree_get_leaf_value_by_index_from_page(
+	          page_tree,
+	          file_io_handle,
+	          page,
+	          30,
+	          &data_definition,
+	          &current_leaf_value_index,
+	          LIBESEDB_MAXIMUM_INDEX_NODE_RECURSION_DEPTH + 1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_page_cache_release_page(
+	          page_cache,
+	          &page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_page_tree_close_source(
+	          &page_tree,
+	          &page_cache,
+	          &io_handle,
+	          &file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( data_definition != NULL )
+	{
+		libesedb_data_definition_free(
+		 &data_definition,
+		 NULL );
+	}
+	if( page != NULL )
+	{
+		libesedb_page_cache_release_page(
+		 page_cache,
+		 &page,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		esedb_test_page_tree_close_source(
+		 &page_tree,
+		 &page_cache,
+		 &io_handle,
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_page_tree_get_leaf_value_by_index function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_page_tree_get_leaf_value_by_index(
+     void )
+{
+	uint8_t data[ ( 2 + ESEDB_TEST_PAGE_TREE_NUMBER_OF_PAGES ) * ESEDB_TEST_PAGE_TREE_PAGE_SIZE ];
+
+	libbfio_handle_t *file_io_handle            = NULL;
+	libcerror_error_t *error                    = NULL;
+	libesedb_data_definition_t *data_definition = NULL;
+	libesedb_io_handle_t *io_handle             = NULL;
+	libesedb_page_cache_t *page_cache           = NULL;
+	libesedb_page_tree_t *page_tree             = NULL;
+	int result                                  = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_page_tree_open_source(
+	          &page_tree,
+	          &page_cache,
+	          &io_handle,
+	          &file_io_handle,
+	          data,
+	          ( 2 + ESEDB_TEST_PAGE_TREE_NUMBER_OF_PAGES ) * ESEDB_TEST_PAGE_TREE_PAGE_SIZE,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	/* Only the first leaf page is read to retrieve the first leaf value
+	 */
+	result = libesedb_page_tree_get_leaf_value_by_index(
+	          page_tree,
+	          file_io_handle,
+	          0,
+	          &data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "data_definition",
+	 data_definition );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "data_definition->page_number",
+	 data_definition->page_number,
+	 2 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT16(
+	 "data_definition->page_value_index",
+	 data_definition->page_value_index,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "page_tree->number_of_leaf_page_descriptors",
+	 page_tree->number_of_leaf_page_descriptors,
+	 1 );
+
+	result = libesedb_data_definition_free(
+	          &data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Leaf value 30 is stored beyond the leaf pages that have been read
+	 */
+	result = libesedb_page_tree_get_leaf_value_by_index(
+	          page_tree,
+	          file_io_handle,
+	          30,
+	          &data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "data_definition",
+	 data_definition );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "data_definition->page_number",
+	 data_definition->page_number,
+	 6 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT16(
+	 "data_definition->page_value_index",
+	 data_definition->page_value_index,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "page_tree->number_of_leaf_page_descriptors",
+	 page_tree->number_of_leaf_page_descriptors,
+	 5 );
+
+	result = libesedb_data_definition_free(
+	          &data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Leaf value 15 is stored in a leaf page that has already been read
+	 */
+	result = libesedb_page_tree_get_leaf_value_by_index(
+	          page_tree,
+	          file_io_handle,
+	          15,
+	          &data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "data_definition",
+	 data_definition );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "data_definition->page_number",
+	 data_definition->page_number,
+	 3 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT16(
+	 "data_definition->page_value_index",
+	 data_definition->page_value_index,
+	 6 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "page_tree->number_of_leaf_page_descriptors",
+	 page_tree->number_of_leaf_page_descriptors,
+	 5 );
+
+	result = libesedb_data_definition_free(
+	          &data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The last leaf value is stored in the last leaf page
+	 */
+	result = libesedb_page_tree_get_leaf_value_by_index(
+	          page_tree,
+	          file_io_handle,
+	          ESEDB_TEST_PAGE_TREE_NUMBER_OF_LEAF_VALUES - 1,
+	          &data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "data_definition",
+	 data_definition );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "data_definition->page_number",
+	 data_definition->page_number,
+	 11 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT16(
+	 "data_definition->page_value_index",
+	 data_definition->page_value_index,
+	 20 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "page_tree->number_of_leaf_page_descriptors",
+	 page_tree->number_of_leaf_page_descriptors,
+	 ESEDB_TEST_PAGE_TREE_NUMBER_OF_LEAF_PAGES );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "page_tree->next_leaf_page_number",
+	 page_tree->next_leaf_page_number,
+	 0 );
+
+	result = libesedb_data_definition_free(
+	          &data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_page_tree_get_leaf_value_by_index(
+	          page_tree,
+	          file_io_handle,
+	          ESEDB_TEST_PAGE_TREE_NUMBER_OF_LEAF_VALUES,
+	          &data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "data_definition",
+	 data_definition );
+
+	result = libesedb_page_tree_get_leaf_value_by_index(
+	          NULL,
+	          file_io_handle,
+	          0,
+	          &data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_tree_get_leaf_value_by_index(
+	          page_tree,
+	          file_io_handle,
+	          -1,
+	          &data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_tree_get_leaf_value_by_index(
+	          page_tree,
+	          file_io_handle,
+	          0,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = esedb_test_page_tree_close_source(
+	          &page_tree,
+	          &page_cache,
+	          &io_handle,
+	          &file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Initialize test
+	 */
+	result = esedb_test_page_tree_open_source(
+	          &page_tree,
+	          &page_cache,
+	          &io_handle,
+	          &file_io_handle,
+	          data,
+	          ( 2 + ESEDB_TEST_PAGE_TREE_NUMBER_OF_PAGES ) * ESEDB_TEST_PAGE_TREE_PAGE_SIZE,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular case where the leaf value is stored in the last leaf page and no leaf pages have been read
+	 */
+	result = libesedb_page_tree_get_leaf_value_by_index(
+	          page_tree,
+	          file_io_handle,
+	          ESEDB_TEST_PAGE_TREE_NUMBER_OF_LEAF_VALUES - 1,
+	          &data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "data_definition",
+	 data_definition );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT32(
+	 "data_definition->page_number",
+	 data_definition->page_number,
+	 11 );
+
+	ESEDB_TEST_ASSERT_EQUAL_UINT16(
+	 "data_definition->page_value_index",
+	 data_definition->page_value_index,
+	 20 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "page_tree->number_of_leaf_page_descriptors",
+	 page_tree->number_of_leaf_page_descriptors,
+	 ESEDB_TEST_PAGE_TREE_NUMBER_OF_LEAF_PAGES );
+
+	result = libesedb_data_definition_free(
+	          &data_definition,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Clean up
+	 */
+	result = esedb_test_page_tree_close_source(
+	          &page_tree,
+	          &page_cache,
+	          &io_handle,
+	          &file_io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( data_definition != NULL )
+	{
+		libesedb_data_definition_free(
+		 &data_definition,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		esedb_test_page_tree_close_source(
+		 &page_tree,
+		 &page_cache,
+		 &io_handle,
+		 &file_io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_page_tree_get_first_branch_value_index_by_key function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_page_tree_get_first_branch_value_index_by_key(
+     void )
+{
+	uint8_t keys[ 7 ]                                 = { 0x05, 0x10, 0x15, 0x30, 0x45, 0x60, 0x70 };
+	uint8_t trailing_defunct_keys[ 2 ]                = { 0x65, 0x70 };
+	uint16_t expected_page_value_indexes[ 7 ]         = { 1, 2, 2, 4, 4, 7, 7 };
+	uint16_t trailing_defunct_page_value_indexes[ 2 ] = { 7, 7 };
+	libcerror_error_t *error                          = NULL;
+	libesedb_io_handle_t *io_handle                   = NULL;
+	libesedb_page_t *page                             = NULL;
+	libesedb_page_tree_t *page_tree                   = NULL;
+	libesedb_page_tree_key_t *page_tree_key           = NULL;
+	libesedb_page_tree_value_t *page_tree_value       = NULL;
+	libesedb_page_value_t *header_page_value          = NULL;
+	uint16_t page_value_index                         = 0;
+	int key_index                                     = 0;
+	int result                                        = 0;
+	int value_index                                   = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_io_handle_initialize(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "io_handle",
+	 io_handle );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	io_handle->format_revision = 0x0000000c;
+	io_handle->page_size       = ESEDB_TEST_PAGE_TREE_PAGE_SIZE;
+
+	result = libesedb_page_tree_initialize(
+	          &page_tree,
+	          io_handle,
+	          NULL,
+	          0,
+	          ESEDB_TEST_PAGE_TREE_ROOT_PAGE_NUMBER,
+	          NULL,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "page_tree",
+	 page_tree );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_value_initialize(
+	          &page_tree_value,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "page_tree_value",
+	 page_tree_value );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Create a branch page of the page header value and 6 branch page values
+	 * of which the values with keys 0x20, 0x40 and 0x50 are defunct
+	 */
+	result = libesedb_page_initialize(
+	          &page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "page",
+	 page );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = esedb_test_page_tree_append_page_value(
+	          page,
+	          NULL,
+	          0,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( value_index = 0;
+	     value_index < 6;
+	     value_index++ )
+	{
+		result = esedb_test_page_tree_append_page_value(
+		          page,
+		          esedb_test_page_tree_branch_page_values_data[ value_index ],
+		          7,
+		          esedb_test_page_tree_branch_page_values_flags[ value_index ],
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libesedb_page_get_value_by_index(
+	          page,
+	          0,
+	          &header_page_value,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "header_page_value",
+	 header_page_value );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * Keys below the first page value key resolve to the first page value,
+	 * keys equal to a page value key to the page value after it, keys that
+	 * follow a defunct page value to the defunct page value and keys above
+	 * the last page value key to the number of page values
+	 */
+	for( key_index = 0;
+	     key_index < 7;
+	     key_index++ )
+	{
+		result = esedb_test_page_tree_initialize_branch_key(
+		          &page_tree_key,
+		          &( keys[ key_index ] ),
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libesedb_page_tree_get_first_branch_value_index_by_key(
+		          page_tree,
+		          page,
+		          0,
+		          header_page_value,
+		          page_tree_value,
+		          page_tree_key,
+		          &page_value_index,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_EQUAL_UINT16(
+		 "page_value_index",
+		 page_value_index,
+		 expected_page_value_indexes[ key_index ] );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libesedb_page_tree_key_free(
+		          &page_tree_key,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+
+	/* Test regular cases with a trailing defunct page value
+	 * Keys above the last not defunct page value key resolve to the trailing defunct page value
+	 */
+	result = esedb_test_page_tree_append_page_value(
+	          page,
+	          esedb_test_page_tree_branch_page_values_data[ 6 ],
+	          7,
+	          esedb_test_page_tree_branch_page_values_flags[ 6 ],
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( key_index = 0;
+	     key_index < 2;
+	     key_index++ )
+	{
+		result = esedb_test_page_tree_initialize_branch_key(
+		          &page_tree_key,
+		          &( trailing_defunct_keys[ key_index ] ),
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libesedb_page_tree_get_first_branch_value_index_by_key(
+		          page_tree,
+		          page,
+		          0,
+		          header_page_value,
+		          page_tree_value,
+		          page_tree_key,
+		          &page_value_index,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_EQUAL_UINT16(
+		 "page_value_index",
+		 page_value_index,
+		 trailing_defunct_page_value_indexes[ key_index ] );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libesedb_page_tree_key_free(
+		          &page_tree_key,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+
+	/* Test error cases
+	 */
+	result = esedb_test_page_tree_initialize_branch_key(
+	          &page_tree_key,
+	          &( keys[ 0 ] ),
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_get_first_branch_value_index_by_key(
+	          NULL,
+	          page,
+	          0,
+	          header_page_value,
+	          page_tree_value,
+	          page_tree_key,
+	          &page_value_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_tree_get_first_branch_value_index_by_key(
+	          page_tree,
+	          NULL,
+	          0,
+	          header_page_value,
+	          page_tree_value,
+	          page_tree_key,
+	          &page_value_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_tree_get_first_branch_value_index_by_key(
+	          page_tree,
+	          page,
+	          LIBESEDB_PAGE_FLAG_IS_LEAF,
+	          header_page_value,
+	          page_tree_value,
+	          page_tree_key,
+	          &page_value_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_tree_get_first_branch_value_index_by_key(
+	          page_tree,
+	          page,
+	          0,
+	          NULL,
+	          page_tree_value,
+	          page_tree_key,
+	          &page_value_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_tree_get_first_branch_value_index_by_key(
+	          page_tree,
+	          page,
+	          0,
+	          header_page_value,
+	          NULL,
+	          page_tree_key,
+	          &page_value_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_tree_get_first_branch_value_index_by_key(
+	          page_tree,
+	          page,
+	          0,
+	          header_page_value,
+	          page_tree_value,
+	          NULL,
+	          &page_value_index,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_tree_get_first_branch_value_index_by_key(
+	          page_tree,
+	          page,
+	          0,
+	          header_page_value,
+	          page_tree_value,
+	          page_tree_key,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_page_tree_key_free(
+	          &page_tree_key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_free(
+	          &page,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_value_free(
+	          &page_tree_value,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_free(
+	          &page_tree,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_io_handle_free(
+	          &io_handle,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( page_tree_key != NULL )
+	{
+		libesedb_page_tree_key_free(
+		 &page_tree_key,
+		 NULL );
+	}
+	if( page != NULL )
+	{
+		libesedb_page_free(
+		 &page,
+		 NULL );
+	}
+	if( page_tree_value != NULL )
+	{
+		libesedb_page_tree_value_free(
+		 &page_tree_value,
+		 NULL );
+	}
+	if( page_tree != NULL )
+	{
+		libesedb_page_tree_free(
+		 &page_tree,
+		 NULL );
+	}
+	if( io_handle != NULL )
+	{
+		libesedb_io_handle_free(
+		 &io_handle,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argc )
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+	ESEDB_TEST_RUN(
+	 "libesedb_page_tree_initialize",
+	 esedb_test_page_tree_initialize );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_page_tree_free",
+	 esedb_test_page_tree_free );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_page_tree_read_root_page_header",
+	 esedb_test_page_tree_read_root_page_header );
+
+	/* TODO: add tests for libesedb_page_tree_read_space_trees */
+
+	/* TODO: add tests for libesedb_page_tree_get_key */
+
+	/* TODO: add tests for libesedb_page_tree_get_number_of_leaf_values_from_page */
+
+	ESEDB_TEST_RUN(
+	 "libesedb_page_tree_append_leaf_page_descriptor",
+	 esedb_test_page_tree_append_leaf_page_descriptor );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_page_tree_set_leaf_page_descriptors",
+	 esedb_test_page_tree_set_leaf_page_descriptors );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_page_tree_read_leaf_page_descriptors",
+	 esedb_test_page_tree_read_leaf_page_descriptors );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_page_tree_get_number_of_leaf_values",
+	 esedb_test_page_tree_get_number_of_leaf_values );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_page_tree_get_estimated_number_of_leaf_values",
+	 esedb_test_page_tree_get_estimated_number_of_leaf_values );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_page_tree_get_leaf_page_descriptor_index",
+	 esedb_test_page_tree_get_leaf_page_descriptor_index );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_page_tree_get_leaf_page_boundary",
+	 esedb_test_page_tree_get_leaf_page_boundary );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_page_tree_get_leaf_value_partition",
+	 esedb_test_page_tree_get_leaf_value_partition );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_page_tree_get_leaf_value_by_index_from_page",
+	 esedb_test_page_tree_get_leaf_value_by_index_from_page );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_page_tree_get_leaf_value_by_index",
+	 esedb_test_page_tree_get_leaf_value_by_index );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_page_tree_get_first_branch_value_index_by_key",
+	 esedb_test_page_tree_get_first_branch_value_index_by_key );
 
 	/* TODO: add tests for libesedb_page_tree_get_leaf_value_by_key_from_page */
 
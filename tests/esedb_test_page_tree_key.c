@@ -763,6 +763,252 @@ on_error:
 	return( 0 );
 }
 
+/* Tests the libesedb_page_tree_key_compare_data function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_page_tree_key_compare_data(
+     void )
+{
+	uint8_t common_key_data[ 2 ]            = { 0x01, 0x7f };
+	uint8_t key_data[ 6 ]                   = { 0x01, 0x7f, 0x80, 0x00, 0x00, 0x02 };
+	uint8_t local_key_data[ 4 ]             = { 0x80, 0x00, 0x00, 0x02 };
+
+	libcerror_error_t *error                = NULL;
+	libesedb_page_tree_key_t *page_tree_key = NULL;
+	int result                              = 0;
+
+	/* Initialize test
+	 */
+	result = libesedb_page_tree_key_initialize(
+	          &page_tree_key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "page_tree_key",
+	 page_tree_key );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_key_set_data(
+	          page_tree_key,
+	          key_data,
+	          6,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	page_tree_key->type = LIBESEDB_KEY_TYPE_INDEX_VALUE;
+
+	/* Test regular cases
+	 */
+	result = libesedb_page_tree_key_compare_data(
+	          page_tree_key,
+	          common_key_data,
+	          2,
+	          local_key_data,
+	          4,
+	          LIBESEDB_KEY_TYPE_LEAF,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBFDATA_COMPARE_EQUAL );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_key_compare_data(
+	          page_tree_key,
+	          NULL,
+	          0,
+	          key_data,
+	          6,
+	          LIBESEDB_KEY_TYPE_LEAF,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBFDATA_COMPARE_EQUAL );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_key_compare_data(
+	          page_tree_key,
+	          common_key_data,
+	          2,
+	          local_key_data,
+	          3,
+	          LIBESEDB_KEY_TYPE_LEAF,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBFDATA_COMPARE_GREATER );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_page_tree_key_compare_data(
+	          page_tree_key,
+	          common_key_data,
+	          2,
+	          local_key_data,
+	          4,
+	          LIBESEDB_KEY_TYPE_BRANCH,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 LIBFDATA_COMPARE_GREATER );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_page_tree_key_compare_data(
+	          NULL,
+	          common_key_data,
+	          2,
+	          local_key_data,
+	          4,
+	          LIBESEDB_KEY_TYPE_LEAF,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_tree_key_compare_data(
+	          page_tree_key,
+	          NULL,
+	          2,
+	          local_key_data,
+	          4,
+	          LIBESEDB_KEY_TYPE_LEAF,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_tree_key_compare_data(
+	          page_tree_key,
+	          common_key_data,
+	          2,
+	          NULL,
+	          4,
+	          LIBESEDB_KEY_TYPE_LEAF,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_page_tree_key_compare_data(
+	          page_tree_key,
+	          common_key_data,
+	          2,
+	          local_key_data,
+	          4,
+	          0xff,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = libesedb_page_tree_key_free(
+	          &page_tree_key,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "page_tree_key",
+	 page_tree_key );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( page_tree_key != NULL )
+	{
+		libesedb_page_tree_key_free(
+		 &page_tree_key,
+		 NULL );
+	}
+	return( 0 );
+}
+
 #endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
 
 /* The main program
@@ -802,6 +1048,10 @@ int main(
 	 "libesedb_page_tree_key_compare",
 	 esedb_test_page_tree_key_compare );
 
+	ESEDB_TEST_RUN(
+	 "libesedb_page_tree_key_compare_data",
+	 esedb_test_page_tree_key_compare_data );
+
 #endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
@@ -0,0 +1,532 @@
+/*
+ * Library string functions test program
+ *
+ * Copyright (C) 2009-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "esedb_test_libcerror.h"
+#include "esedb_test_libesedb.h"
+#include "esedb_test_macros.h"
+#include "esedb_test_memory.h"
+#include "esedb_test_unused.h"
+
+#include "../libesedb/libesedb_string.h"
+
+/* The string: "Extensible Storage Engine" in UTF-16 little-endian
+ * including the end-of-string character
+ */
+uint8_t esedb_test_string_utf16_stream_ascii[ 52 ] = {
+	0x45, 0x00, 0x78, 0x00, 0x74, 0x00, 0x65, 0x00, 0x6e, 0x00, 0x73, 0x00, 0x69, 0x00, 0x62, 0x00,
+	0x6c, 0x00, 0x65, 0x00, 0x20, 0x00, 0x53, 0x00, 0x74, 0x00, 0x6f, 0x00, 0x72, 0x00, 0x61, 0x00,
+	0x67, 0x00, 0x65, 0x00, 0x20, 0x00, 0x45, 0x00, 0x6e, 0x00, 0x67, 0x00, 0x69, 0x00, 0x6e, 0x00,
+	0x65, 0x00, 0x00, 0x00 };
+
+uint8_t esedb_test_string_utf8_string_ascii[ 26 ] = {
+	'E', 'x', 't', 'e', 'n', 's', 'i', 'b', 'l', 'e', ' ', 'S', 't', 'o', 'r', 'a',
+	'g', 'e', ' ', 'E', 'n', 'g', 'i', 'n', 'e', 0 };
+
+/* The string: "ABCD" U+00E9 U+0141 U+20AC "EFGH" in UTF-16 little-endian
+ * without an end-of-string character
+ */
+uint8_t esedb_test_string_utf16_stream_mixed[ 22 ] = {
+	0x41, 0x00, 0x42, 0x00, 0x43, 0x00, 0x44, 0x00, 0xe9, 0x00, 0x41, 0x01, 0xac, 0x20, 0x45, 0x00,
+	0x46, 0x00, 0x47, 0x00, 0x48, 0x00 };
+
+uint8_t esedb_test_string_utf8_string_mixed[ 16 ] = {
+	0x41, 0x42, 0x43, 0x44, 0xc3, 0xa9, 0xc5, 0x81, 0xe2, 0x82, 0xac, 0x45, 0x46, 0x47, 0x48, 0x00 };
+
+/* The string: "A" U+1F600 in UTF-16 little-endian which contains a surrogate pair
+ */
+uint8_t esedb_test_string_utf16_stream_surrogate[ 6 ] = {
+	0x41, 0x00, 0x3d, 0xd8, 0x00, 0xde };
+
+/* The string: "A" in UTF-16 little-endian with a little-endian byte order mark
+ */
+uint8_t esedb_test_string_utf16_stream_little_endian_byte_order_mark[ 4 ] = {
+	0xff, 0xfe, 0x41, 0x00 };
+
+/* The string: "A" in UTF-16 big-endian with a big-endian byte order mark
+ */
+uint8_t esedb_test_string_utf16_stream_big_endian_byte_order_mark[ 4 ] = {
+	0xfe, 0xff, 0x00, 0x41 };
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+/* Tests the libesedb_string_get_utf8_string_size_from_utf16_stream function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_string_get_utf8_string_size_from_utf16_stream(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	size_t utf8_string_size  = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_string_get_utf8_string_size_from_utf16_stream(
+	          esedb_test_string_utf16_stream_ascii,
+	          52,
+	          &utf8_string_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 26 );
+
+	result = libesedb_string_get_utf8_string_size_from_utf16_stream(
+	          esedb_test_string_utf16_stream_mixed,
+	          22,
+	          &utf8_string_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_SIZE(
+	 "utf8_string_size",
+	 utf8_string_size,
+	 (size_t) 16 );
+
+	/* Test unsupported cases
+	 */
+	result = libesedb_string_get_utf8_string_size_from_utf16_stream(
+	          esedb_test_string_utf16_stream_little_endian_byte_order_mark,
+	          4,
+	          &utf8_string_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_string_get_utf8_string_size_from_utf16_stream(
+	          esedb_test_string_utf16_stream_big_endian_byte_order_mark,
+	          4,
+	          &utf8_string_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_string_get_utf8_string_size_from_utf16_stream(
+	          esedb_test_string_utf16_stream_surrogate,
+	          6,
+	          &utf8_string_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_string_get_utf8_string_size_from_utf16_stream(
+	          esedb_test_string_utf16_stream_ascii,
+	          51,
+	          &utf8_string_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_string_get_utf8_string_size_from_utf16_stream(
+	          esedb_test_string_utf16_stream_ascii,
+	          0,
+	          &utf8_string_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_string_get_utf8_string_size_from_utf16_stream(
+	          NULL,
+	          52,
+	          &utf8_string_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_string_get_utf8_string_size_from_utf16_stream(
+	          esedb_test_string_utf16_stream_ascii,
+	          (size_t) SSIZE_MAX + 1,
+	          &utf8_string_size,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_string_get_utf8_string_size_from_utf16_stream(
+	          esedb_test_string_utf16_stream_ascii,
+	          52,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_string_copy_utf16_stream_to_utf8_string function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_string_copy_utf16_stream_to_utf8_string(
+     void )
+{
+	uint8_t utf8_string[ 64 ];
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_string_copy_utf16_stream_to_utf8_string(
+	          esedb_test_string_utf16_stream_ascii,
+	          52,
+	          utf8_string,
+	          64,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          esedb_test_string_utf8_string_ascii,
+	          sizeof( uint8_t ) * 26 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	result = libesedb_string_copy_utf16_stream_to_utf8_string(
+	          esedb_test_string_utf16_stream_mixed,
+	          22,
+	          utf8_string,
+	          64,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = memory_compare(
+	          utf8_string,
+	          esedb_test_string_utf8_string_mixed,
+	          sizeof( uint8_t ) * 16 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	/* Test unsupported cases
+	 */
+	result = libesedb_string_copy_utf16_stream_to_utf8_string(
+	          esedb_test_string_utf16_stream_little_endian_byte_order_mark,
+	          4,
+	          utf8_string,
+	          64,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_string_copy_utf16_stream_to_utf8_string(
+	          esedb_test_string_utf16_stream_big_endian_byte_order_mark,
+	          4,
+	          utf8_string,
+	          64,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_string_copy_utf16_stream_to_utf8_string(
+	          esedb_test_string_utf16_stream_surrogate,
+	          6,
+	          utf8_string,
+	          64,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_string_copy_utf16_stream_to_utf8_string(
+	          NULL,
+	          52,
+	          utf8_string,
+	          64,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_string_copy_utf16_stream_to_utf8_string(
+	          esedb_test_string_utf16_stream_ascii,
+	          (size_t) SSIZE_MAX + 1,
+	          utf8_string,
+	          64,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_string_copy_utf16_stream_to_utf8_string(
+	          esedb_test_string_utf16_stream_ascii,
+	          52,
+	          NULL,
+	          64,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_string_copy_utf16_stream_to_utf8_string(
+	          esedb_test_string_utf16_stream_ascii,
+	          52,
+	          utf8_string,
+	          (size_t) SSIZE_MAX + 1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_string_copy_utf16_stream_to_utf8_string(
+	          esedb_test_string_utf16_stream_ascii,
+	          52,
+	          utf8_string,
+	          8,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argc )
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+	ESEDB_TEST_RUN(
+	 "libesedb_string_get_utf8_string_size_from_utf16_stream",
+	 esedb_test_string_get_utf8_string_size_from_utf16_stream );
+
+	ESEDB_TEST_RUN(
+	 "libesedb_string_copy_utf16_stream_to_utf8_string",
+	 esedb_test_string_copy_utf16_stream_to_utf8_string );
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
+
+	return( EXIT_SUCCESS );
+
+on_error:
+	return( EXIT_FAILURE );
+}
+
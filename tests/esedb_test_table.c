@@ -21,32 +21,1927 @@
 
 #include <common.h>
 #include <file_stream.h>
+#include <memory.h>
 #include <types.h>
 
 #if defined( HAVE_STDLIB_H ) || defined( WINAPI )
 #include <stdlib.h>
 #endif
 
+#include "esedb_test_functions.h"
+#include "esedb_test_libbfio.h"
 #include "esedb_test_libcerror.h"
+#include "esedb_test_libcthreads.h"
 #include "esedb_test_libesedb.h"
 #include "esedb_test_macros.h"
 #include "esedb_test_memory.h"
 #include "esedb_test_unused.h"
 
+#include "../libesedb/libesedb_catalog_definition.h"
+#include "../libesedb/libesedb_definitions.h"
+#include "../libesedb/libesedb_io_handle.h"
+#include "../libesedb/libesedb_record.h"
 #include "../libesedb/libesedb_table.h"
+#include "../libesedb/libesedb_table_definition.h"
+#include "../libesedb/libesedb_table_state.h"
+
+#define ESEDB_TEST_TABLE_NUMBER_OF_LEAF_PAGES		4
+#define ESEDB_TEST_TABLE_NUMBER_OF_PAGES		8
+#define ESEDB_TEST_TABLE_NUMBER_OF_RECORDS		200
+#define ESEDB_TEST_TABLE_PAGE_SIZE			4096
+#define ESEDB_TEST_TABLE_ROOT_PAGE_NUMBER		4
+
+/* The number of records per leaf page, including an empty leaf page
+ */
+int esedb_test_table_number_of_leaf_values[ ESEDB_TEST_TABLE_NUMBER_OF_LEAF_PAGES ] = {
+	100, 0, 60, 40 };
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+/* Opens a table of ESEDB_TEST_TABLE_NUMBER_OF_RECORDS records without values
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_table_open_source(
+     libesedb_table_t **table,
+     libesedb_table_state_t **table_state,
+     libesedb_table_definition_t **table_definition,
+     libesedb_io_handle_t **io_handle,
+     libbfio_handle_t **file_io_handle,
+     uint8_t **data,
+     libcerror_error_t **error )
+{
+	libesedb_catalog_definition_t *table_catalog_definition = NULL;
+	static char *function                                   = "esedb_test_table_open_source";
+	size_t data_size                                        = 0;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	/* The first 2 pages contain the file header and its backup
+	 */
+	data_size = ( 2 + ESEDB_TEST_TABLE_NUMBER_OF_PAGES ) * ESEDB_TEST_TABLE_PAGE_SIZE;
+
+	*data = (uint8_t *) memory_allocate(
+	                     sizeof( uint8_t ) * data_size );
+
+	if( *data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_INSUFFICIENT,
+		 "%s: unable to create data.",
+		 function );
+
+		goto on_error;
+	}
+	if( memory_set(
+	     *data,
+	     0,
+	     data_size ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear data.",
+		 function );
+
+		goto on_error;
+	}
+	if( esedb_test_write_page_tree(
+	     *data,
+	     data_size,
+	     ESEDB_TEST_TABLE_PAGE_SIZE,
+	     ESEDB_TEST_TABLE_ROOT_PAGE_NUMBER,
+	     1 + ESEDB_TEST_TABLE_NUMBER_OF_LEAF_PAGES,
+	     esedb_test_table_number_of_leaf_values,
+	     ESEDB_TEST_TABLE_NUMBER_OF_LEAF_PAGES,
+	     ESEDB_TEST_PAGE_TREE_LEAF_VALUE_TYPE_RECORD,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to write page tree.",
+		 function );
+
+		goto on_error;
+	}
+	if( esedb_test_open_page_tree_source(
+	     io_handle,
+	     NULL,
+	     file_io_handle,
+	     *data,
+	     data_size,
+	     ESEDB_TEST_TABLE_PAGE_SIZE,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_OPEN_FAILED,
+		 "%s: unable to open page tree source.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_catalog_definition_initialize(
+	     &table_catalog_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create table catalog definition.",
+		 function );
+
+		goto on_error;
+	}
+	table_catalog_definition->type                    = LIBESEDB_CATALOG_DEFINITION_TYPE_TABLE;
+	table_catalog_definition->father_data_page_number = ESEDB_TEST_TABLE_ROOT_PAGE_NUMBER;
+
+	if( libesedb_table_definition_initialize(
+	     table_definition,
+	     table_catalog_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create table definition.",
+		 function );
+
+		goto on_error;
+	}
+	/* The table definition now manages the table catalog definition
+	 */
+	table_catalog_definition = NULL;
+
+	if( libesedb_table_state_initialize(
+	     table_state,
+	     *io_handle,
+	     *table_definition,
+	     NULL,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create table state.",
+		 function );
+
+		goto on_error;
+	}
+	/* The table takes over the reference to the table state
+	 */
+	if( libesedb_table_state_reference(
+	     *table_state,
+	     0,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_SET_FAILED,
+		 "%s: unable to reference table state.",
+		 function );
+
+		goto on_error;
+	}
+	if( libesedb_table_initialize(
+	     table,
+	     *file_io_handle,
+	     *io_handle,
+	     *table_state,
+	     NULL,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to create table.",
+		 function );
+
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	if( *table_state != NULL )
+	{
+		libesedb_table_state_free(
+		 table_state,
+		 NULL );
+	}
+	if( *table_definition != NULL )
+	{
+		libesedb_table_definition_free(
+		 table_definition,
+		 NULL );
+	}
+	if( table_catalog_definition != NULL )
+	{
+		libesedb_catalog_definition_free(
+		 &table_catalog_definition,
+		 NULL );
+	}
+	if( *io_handle != NULL )
+	{
+		esedb_test_close_page_tree_source(
+		 io_handle,
+		 NULL,
+		 file_io_handle,
+		 NULL );
+	}
+	if( *data != NULL )
+	{
+		memory_free(
+		 *data );
+
+		*data = NULL;
+	}
+	return( -1 );
+}
+
+/* Closes a table opened by esedb_test_table_open_source
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_table_close_source(
+     libesedb_table_t **table,
+     libesedb_table_state_t **table_state,
+     libesedb_table_definition_t **table_definition,
+     libesedb_io_handle_t **io_handle,
+     libbfio_handle_t **file_io_handle,
+     uint8_t **data,
+     libcerror_error_t **error )
+{
+	static char *function = "esedb_test_table_close_source";
+	int result            = 1;
+
+	if( data == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid data.",
+		 function );
+
+		return( -1 );
+	}
+	if( libesedb_table_free(
+	     table,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free table.",
+		 function );
+
+		result = -1;
+	}
+	if( libesedb_table_state_free(
+	     table_state,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free table state.",
+		 function );
+
+		result = -1;
+	}
+	if( libesedb_table_definition_free(
+	     table_definition,
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free table definition.",
+		 function );
+
+		result = -1;
+	}
+	if( esedb_test_close_page_tree_source(
+	     io_handle,
+	     NULL,
+	     file_io_handle,
+	     error ) != 0 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_IO,
+		 LIBCERROR_IO_ERROR_CLOSE_FAILED,
+		 "%s: unable to close page tree source.",
+		 function );
+
+		result = -1;
+	}
+	if( *data != NULL )
+	{
+		memory_free(
+		 *data );
+
+		*data = NULL;
+	}
+	return( result );
+}
+
+#if defined( HAVE_ESEDB_TEST_MULTI_THREAD_SUPPORT )
+
+typedef struct esedb_test_table_record_requests esedb_test_table_record_requests_t;
+
+/* The values shared by the record request callback functions
+ */
+struct esedb_test_table_record_requests
+{
+	/* The mutex
+	 */
+	libcthreads_mutex_t *mutex;
+
+	/* The condition
+	 */
+	libcthreads_condition_t *condition;
+
+	/* The number of times each record was retrieved
+	 */
+	int number_of_retrievals[ ESEDB_TEST_TABLE_NUMBER_OF_RECORDS ];
+
+	/* The number of records that were retrieved
+	 */
+	int number_of_records;
+
+	/* The number of records that could not be retrieved
+	 */
+	int number_of_errors;
+
+	/* The result of libesedb_table_wait_for_record_requests called from a callback function
+	 */
+	int wait_result;
+
+	/* The result of libesedb_table_free called from a callback function
+	 */
+	int free_result;
+
+	/* The result of the last libesedb_table_get_record_async called from a callback function
+	 */
+	int async_result;
+
+	/* The number of record requests made from a callback function
+	 */
+	int number_of_callback_requests;
+
+	/* Value to indicate the blocked callback functions can return
+	 */
+	int is_released;
+};
+
+#endif /* defined( HAVE_ESEDB_TEST_MULTI_THREAD_SUPPORT ) */
+
+#endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
 
 /* Tests the libesedb_table_free function
  * Returns 1 if successful or 0 if not
  */
-int esedb_test_table_free(
-     void )
+int esedb_test_table_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = libesedb_table_free(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+
+/* Tests the libesedb_table_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_table_initialize(
+     libbfio_handle_t *file_io_handle,
+     libesedb_io_handle_t *io_handle,
+     libesedb_table_state_t *table_state )
+{
+	libcerror_error_t *error = NULL;
+	libesedb_table_t *table  = NULL;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_table_state_reference(
+	          table_state,
+	          0,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_table_initialize(
+	          &table,
+	          file_io_handle,
+	          io_handle,
+	          table_state,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "table",
+	 table );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_table_free(
+	          &table,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "table",
+	 table );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_table_initialize(
+	          NULL,
+	          file_io_handle,
+	          io_handle,
+	          table_state,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	table = (libesedb_table_t *) 0x12345678UL;
+
+	result = libesedb_table_initialize(
+	          &table,
+	          file_io_handle,
+	          io_handle,
+	          table_state,
+	          NULL,
+	          &error );
+
+	table = NULL;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_initialize(
+	          &table,
+	          file_io_handle,
+	          NULL,
+	          table_state,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "table",
+	 table );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_initialize(
+	          &table,
+	          file_io_handle,
+	          io_handle,
+	          NULL,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "table",
+	 table );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( table != NULL )
+	{
+		libesedb_table_free(
+		 &table,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_table_get_number_of_records function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_table_get_number_of_records(
+     libesedb_table_t *table )
+{
+	libcerror_error_t *error = NULL;
+	int number_of_records    = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 */
+	result = libesedb_table_get_number_of_records(
+	          table,
+	          &number_of_records,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_records",
+	 number_of_records,
+	 ESEDB_TEST_TABLE_NUMBER_OF_RECORDS );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_table_get_number_of_records(
+	          NULL,
+	          &number_of_records,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_get_number_of_records(
+	          table,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_table_get_estimated_number_of_records function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_table_get_estimated_number_of_records(
+     libesedb_table_t *table )
+{
+	libcerror_error_t *error = NULL;
+	int number_of_records    = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 * The table spans fewer leaf pages than are sampled hence the estimate is exact
+	 */
+	result = libesedb_table_get_estimated_number_of_records(
+	          table,
+	          &number_of_records,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_records",
+	 number_of_records,
+	 ESEDB_TEST_TABLE_NUMBER_OF_RECORDS );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_table_get_estimated_number_of_records(
+	          NULL,
+	          &number_of_records,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_get_estimated_number_of_records(
+	          table,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_table_get_record_partition function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_table_get_record_partition(
+     libesedb_table_t *table )
+{
+	libcerror_error_t *error = NULL;
+	int first_record_entry   = 0;
+	int number_of_records    = 0;
+	int result               = 0;
+
+	/* Test regular cases
+	 * The records are stored in leaf pages of 100, 0, 60 and 40 records
+	 */
+	result = libesedb_table_get_record_partition(
+	          table,
+	          0,
+	          2,
+	          &first_record_entry,
+	          &number_of_records,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "first_record_entry",
+	 first_record_entry,
+	 0 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_records",
+	 number_of_records,
+	 100 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_table_get_record_partition(
+	          table,
+	          1,
+	          2,
+	          &first_record_entry,
+	          &number_of_records,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "first_record_entry",
+	 first_record_entry,
+	 100 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_records",
+	 number_of_records,
+	 100 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The partition after record 66 starts after the empty leaf page
+	 */
+	result = libesedb_table_get_record_partition(
+	          table,
+	          0,
+	          3,
+	          &first_record_entry,
+	          &number_of_records,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "first_record_entry",
+	 first_record_entry,
+	 0 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_records",
+	 number_of_records,
+	 100 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_table_get_record_partition(
+	          table,
+	          1,
+	          3,
+	          &first_record_entry,
+	          &number_of_records,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "first_record_entry",
+	 first_record_entry,
+	 100 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_records",
+	 number_of_records,
+	 60 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_table_get_record_partition(
+	          table,
+	          2,
+	          3,
+	          &first_record_entry,
+	          &number_of_records,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "first_record_entry",
+	 first_record_entry,
+	 160 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_records",
+	 number_of_records,
+	 40 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = libesedb_table_get_record_partition(
+	          NULL,
+	          0,
+	          2,
+	          &first_record_entry,
+	          &number_of_records,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_get_record_partition(
+	          table,
+	          0,
+	          0,
+	          &first_record_entry,
+	          &number_of_records,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_get_record_partition(
+	          table,
+	          2,
+	          2,
+	          &first_record_entry,
+	          &number_of_records,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_get_record_partition(
+	          table,
+	          0,
+	          2,
+	          NULL,
+	          &number_of_records,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_get_record_partition(
+	          table,
+	          0,
+	          2,
+	          &first_record_entry,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the libesedb_table_get_record function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_table_get_record(
+     libesedb_table_t *table )
+{
+	int record_entries[ 5 ]   = { 0, 99, 100, 160, ESEDB_TEST_TABLE_NUMBER_OF_RECORDS - 1 };
+	libcerror_error_t *error  = NULL;
+	libesedb_record_t *record = NULL;
+	int record_entry_index    = 0;
+	int result                = 0;
+
+	/* Test regular cases
+	 * The entries are the first and last records of the leaf pages
+	 * including the ones around the empty leaf page
+	 */
+	for( record_entry_index = 0;
+	     record_entry_index < 5;
+	     record_entry_index++ )
+	{
+		result = libesedb_table_get_record(
+		          table,
+		          record_entries[ record_entry_index ],
+		          &record,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NOT_NULL(
+		 "record",
+		 record );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		result = libesedb_record_free(
+		          &record,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	/* Test error cases
+	 */
+	result = libesedb_table_get_record(
+	          NULL,
+	          0,
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_get_record(
+	          table,
+	          -1,
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_get_record(
+	          table,
+	          ESEDB_TEST_TABLE_NUMBER_OF_RECORDS,
+	          &record,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "record",
+	 record );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_get_record(
+	          table,
+	          0,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( record != NULL )
+	{
+		libesedb_record_free(
+		 &record,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#if defined( HAVE_ESEDB_TEST_MULTI_THREAD_SUPPORT )
+
+/* Counts and frees the retrieved record
+ */
+void esedb_test_table_count_record_callback(
+      libesedb_table_t *table ESEDB_TEST_ATTRIBUTE_UNUSED,
+      int record_entry,
+      libesedb_record_t *record,
+      libcerror_error_t *error ESEDB_TEST_ATTRIBUTE_UNUSED,
+      void *callback_data )
+{
+	esedb_test_table_record_requests_t *record_requests = NULL;
+
+	ESEDB_TEST_UNREFERENCED_PARAMETER( table )
+	ESEDB_TEST_UNREFERENCED_PARAMETER( error )
+
+	record_requests = (esedb_test_table_record_requests_t *) callback_data;
+
+	if( libcthreads_mutex_grab(
+	     record_requests->mutex,
+	     NULL ) != 1 )
+	{
+		return;
+	}
+	if( ( record == NULL )
+	 || ( record_entry < 0 )
+	 || ( record_entry >= ESEDB_TEST_TABLE_NUMBER_OF_RECORDS ) )
+	{
+		record_requests->number_of_errors += 1;
+	}
+	else
+	{
+		record_requests->number_of_retrievals[ record_entry ] += 1;
+		record_requests->number_of_records                    += 1;
+	}
+	libcthreads_mutex_release(
+	 record_requests->mutex,
+	 NULL );
+
+	/* The callback function takes over the record
+	 */
+	if( record != NULL )
+	{
+		libesedb_record_free(
+		 &record,
+		 NULL );
+	}
+}
+
+/* Waits until the record requests are released
+ */
+void esedb_test_table_blocked_record_callback(
+      libesedb_table_t *table,
+      int record_entry,
+      libesedb_record_t *record,
+      libcerror_error_t *error,
+      void *callback_data )
+{
+	esedb_test_table_record_requests_t *record_requests = NULL;
+
+	record_requests = (esedb_test_table_record_requests_t *) callback_data;
+
+	if( libcthreads_mutex_grab(
+	     record_requests->mutex,
+	     NULL ) != 1 )
+	{
+		return;
+	}
+	while( record_requests->is_released == 0 )
+	{
+		if( libcthreads_condition_wait(
+		     record_requests->condition,
+		     record_requests->mutex,
+		     NULL ) != 1 )
+		{
+			break;
+		}
+	}
+	libcthreads_mutex_release(
+	 record_requests->mutex,
+	 NULL );
+
+	esedb_test_table_count_record_callback(
+	 table,
+	 record_entry,
+	 record,
+	 error,
+	 callback_data );
+}
+
+/* Calls the table functions that are not supported from a record request callback function
+ */
+void esedb_test_table_reentrant_record_callback(
+      libesedb_table_t *table,
+      int record_entry,
+      libesedb_record_t *record,
+      libcerror_error_t *error,
+      void *callback_data )
+{
+	esedb_test_table_record_requests_t *record_requests = NULL;
+	libcerror_error_t *callback_error                   = NULL;
+	libesedb_table_t *freed_table                       = NULL;
+	int result                                          = 0;
+
+	record_requests = (esedb_test_table_record_requests_t *) callback_data;
+
+	result = libesedb_table_wait_for_record_requests(
+	          table,
+	          &callback_error );
+
+	libcerror_error_free(
+	 &callback_error );
+
+	record_requests->wait_result = result;
+
+	freed_table = table;
+
+	result = libesedb_table_free(
+	          &freed_table,
+	          &callback_error );
+
+	libcerror_error_free(
+	 &callback_error );
+
+	record_requests->free_result = result;
+
+	if( freed_table != table )
+	{
+		record_requests->free_result = 1;
+	}
+	/* Record requests can be chained from a callback function
+	 */
+	result = libesedb_table_get_record_async(
+	          table,
+	          record_entry + 1,
+	          &esedb_test_table_count_record_callback,
+	          callback_data,
+	          &callback_error );
+
+	libcerror_error_free(
+	 &callback_error );
+
+	record_requests->async_result = result;
+
+	esedb_test_table_count_record_callback(
+	 table,
+	 record_entry,
+	 record,
+	 error,
+	 callback_data );
+}
+
+/* Fills the record request queue from a record request callback function
+ */
+void esedb_test_table_queue_record_callback(
+      libesedb_table_t *table,
+      int record_entry,
+      libesedb_record_t *record,
+      libcerror_error_t *error,
+      void *callback_data )
+{
+	esedb_test_table_record_requests_t *record_requests = NULL;
+	libcerror_error_t *callback_error                   = NULL;
+	int result                                          = 0;
+
+	record_requests = (esedb_test_table_record_requests_t *) callback_data;
+
+	/* The other worker threads are blocked by the requested callback functions
+	 * so the queue fills up instead of waiting for a free slot
+	 */
+	do
+	{
+		result = libesedb_table_get_record_async(
+		          table,
+		          record_requests->number_of_callback_requests % ESEDB_TEST_TABLE_NUMBER_OF_RECORDS,
+		          &esedb_test_table_blocked_record_callback,
+		          callback_data,
+		          &callback_error );
+
+		if( result == 1 )
+		{
+			record_requests->number_of_callback_requests += 1;
+		}
+	}
+	while( ( result == 1 )
+	    && ( record_requests->number_of_callback_requests < ( 2 * LIBESEDB_MAXIMUM_NUMBER_OF_RECORD_REQUESTS ) ) );
+
+	libcerror_error_free(
+	 &callback_error );
+
+	record_requests->async_result = result;
+
+	if( libcthreads_mutex_grab(
+	     record_requests->mutex,
+	     NULL ) == 1 )
+	{
+		record_requests->is_released = 1;
+
+		libcthreads_condition_broadcast(
+		 record_requests->condition,
+		 NULL );
+
+		libcthreads_mutex_release(
+		 record_requests->mutex,
+		 NULL );
+	}
+	esedb_test_table_count_record_callback(
+	 table,
+	 record_entry,
+	 record,
+	 error,
+	 callback_data );
+}
+
+/* Initializes the record requests test values
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_table_record_requests_initialize(
+     esedb_test_table_record_requests_t *record_requests,
+     libcerror_error_t **error )
+{
+	static char *function = "esedb_test_table_record_requests_initialize";
+
+	if( record_requests == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record requests.",
+		 function );
+
+		return( -1 );
+	}
+	if( memory_set(
+	     record_requests,
+	     0,
+	     sizeof( esedb_test_table_record_requests_t ) ) == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_MEMORY,
+		 LIBCERROR_MEMORY_ERROR_SET_FAILED,
+		 "%s: unable to clear record requests.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_mutex_initialize(
+	     &( record_requests->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize mutex.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_condition_initialize(
+	     &( record_requests->condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_INITIALIZE_FAILED,
+		 "%s: unable to initialize condition.",
+		 function );
+
+		libcthreads_mutex_free(
+		 &( record_requests->mutex ),
+		 NULL );
+
+		return( -1 );
+	}
+	return( 1 );
+}
+
+/* Frees the record requests test values
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_table_record_requests_free(
+     esedb_test_table_record_requests_t *record_requests,
+     libcerror_error_t **error )
+{
+	static char *function = "esedb_test_table_record_requests_free";
+	int result            = 1;
+
+	if( record_requests == NULL )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_ARGUMENTS,
+		 LIBCERROR_ARGUMENT_ERROR_INVALID_VALUE,
+		 "%s: invalid record requests.",
+		 function );
+
+		return( -1 );
+	}
+	if( libcthreads_condition_free(
+	     &( record_requests->condition ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free condition.",
+		 function );
+
+		result = -1;
+	}
+	if( libcthreads_mutex_free(
+	     &( record_requests->mutex ),
+	     error ) != 1 )
+	{
+		libcerror_error_set(
+		 error,
+		 LIBCERROR_ERROR_DOMAIN_RUNTIME,
+		 LIBCERROR_RUNTIME_ERROR_FINALIZE_FAILED,
+		 "%s: unable to free mutex.",
+		 function );
+
+		result = -1;
+	}
+	return( result );
+}
+
+/* Tests the libesedb_table_get_record_async function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_table_get_record_async(
+     libesedb_table_t *table )
+{
+	esedb_test_table_record_requests_t record_requests;
+
+	libcerror_error_t *error = NULL;
+	int record_entry         = 0;
+	int result               = 0;
+
+	result = esedb_test_table_record_requests_initialize(
+	          &record_requests,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 * More records are requested than fit in the queue
+	 */
+	for( record_entry = 0;
+	     record_entry < ESEDB_TEST_TABLE_NUMBER_OF_RECORDS;
+	     record_entry++ )
+	{
+		result = libesedb_table_get_record_async(
+		          table,
+		          record_entry,
+		          &esedb_test_table_count_record_callback,
+		          &record_requests,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+	}
+	result = libesedb_table_wait_for_record_requests(
+	          table,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "record_requests.number_of_records",
+	 record_requests.number_of_records,
+	 ESEDB_TEST_TABLE_NUMBER_OF_RECORDS );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "record_requests.number_of_errors",
+	 record_requests.number_of_errors,
+	 0 );
+
+	for( record_entry = 0;
+	     record_entry < ESEDB_TEST_TABLE_NUMBER_OF_RECORDS;
+	     record_entry++ )
+	{
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "record_requests.number_of_retrievals",
+		 record_requests.number_of_retrievals[ record_entry ],
+		 1 );
+	}
+	/* Test a request with an out of bounds record entry
+	 * the error is passed to the callback function
+	 */
+	result = libesedb_table_get_record_async(
+	          table,
+	          ESEDB_TEST_TABLE_NUMBER_OF_RECORDS,
+	          &esedb_test_table_count_record_callback,
+	          &record_requests,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_table_wait_for_record_requests(
+	          table,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "record_requests.number_of_errors",
+	 record_requests.number_of_errors,
+	 1 );
+
+	/* Test error cases
+	 */
+	result = libesedb_table_get_record_async(
+	          NULL,
+	          0,
+	          &esedb_test_table_count_record_callback,
+	          &record_requests,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = libesedb_table_get_record_async(
+	          table,
+	          0,
+	          NULL,
+	          &record_requests,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = esedb_test_table_record_requests_free(
+	          &record_requests,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	libesedb_table_wait_for_record_requests(
+	 table,
+	 NULL );
+
+	esedb_test_table_record_requests_free(
+	 &record_requests,
+	 NULL );
+
+	return( 0 );
+}
+
+/* Tests the libesedb_table_get_record_async function with a callback function that calls the table
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_table_get_record_async_from_callback(
+     libesedb_table_t *table )
+{
+	esedb_test_table_record_requests_t record_requests;
+
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	result = esedb_test_table_record_requests_initialize(
+	          &record_requests,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test that waiting for and freeing the table from a callback function fail
+	 * instead of deadlocking and that a chained request is processed
+	 */
+	result = libesedb_table_get_record_async(
+	          table,
+	          0,
+	          &esedb_test_table_reentrant_record_callback,
+	          &record_requests,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_table_wait_for_record_requests(
+	          table,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "record_requests.wait_result",
+	 record_requests.wait_result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "record_requests.free_result",
+	 record_requests.free_result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "record_requests.async_result",
+	 record_requests.async_result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "record_requests.number_of_records",
+	 record_requests.number_of_records,
+	 2 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "record_requests.number_of_retrievals[ 1 ]",
+	 record_requests.number_of_retrievals[ 1 ],
+	 1 );
+
+	/* Test that a callback function gets an error instead of deadlocking on a full queue
+	 */
+	record_requests.number_of_records = 0;
+
+	result = libesedb_table_get_record_async(
+	          table,
+	          0,
+	          &esedb_test_table_queue_record_callback,
+	          &record_requests,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = libesedb_table_wait_for_record_requests(
+	          table,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "record_requests.async_result",
+	 record_requests.async_result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_GREATER_THAN_INT(
+	 "record_requests.number_of_callback_requests",
+	 record_requests.number_of_callback_requests,
+	 LIBESEDB_MAXIMUM_NUMBER_OF_RECORD_REQUESTS - 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "record_requests.number_of_records",
+	 record_requests.number_of_records,
+	 1 + record_requests.number_of_callback_requests );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "record_requests.number_of_errors",
+	 record_requests.number_of_errors,
+	 0 );
+
+	result = esedb_test_table_record_requests_free(
+	          &record_requests,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( libcthreads_mutex_grab(
+	     record_requests.mutex,
+	     NULL ) == 1 )
+	{
+		record_requests.is_released = 1;
+
+		libcthreads_condition_broadcast(
+		 record_requests.condition,
+		 NULL );
+
+		libcthreads_mutex_release(
+		 record_requests.mutex,
+		 NULL );
+	}
+	libesedb_table_wait_for_record_requests(
+	 table,
+	 NULL );
+
+	esedb_test_table_record_requests_free(
+	 &record_requests,
+	 NULL );
+
+	return( 0 );
+}
+
+/* Tests the libesedb_table_wait_for_record_requests function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_table_wait_for_record_requests(
+     libesedb_table_t *table )
 {
 	libcerror_error_t *error = NULL;
 	int result               = 0;
 
+	/* Test regular cases
+	 */
+	result = libesedb_table_wait_for_record_requests(
+	          table,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
 	/* Test error cases
 	 */
-	result = libesedb_table_free(
+	result = libesedb_table_wait_for_record_requests(
 	          NULL,
 	          &error );
 
@@ -73,7 +1968,7 @@ on_error:
 	return( 0 );
 }
 
-#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+#endif /* defined( HAVE_ESEDB_TEST_MULTI_THREAD_SUPPORT ) */
 
 #endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
 
@@ -89,12 +1984,52 @@ int main(
      char * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
 #endif
 {
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+	libbfio_handle_t *file_io_handle                = NULL;
+	libcerror_error_t *error                        = NULL;
+	libesedb_io_handle_t *io_handle                 = NULL;
+	libesedb_table_t *table                         = NULL;
+	libesedb_table_definition_t *table_definition   = NULL;
+	libesedb_table_state_t *table_state             = NULL;
+	uint8_t *data                                   = NULL;
+	int result                                      = 0;
+#endif
+
 	ESEDB_TEST_UNREFERENCED_PARAMETER( argc )
 	ESEDB_TEST_UNREFERENCED_PARAMETER( argv )
 
 #if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
 
-	/* TODO: add tests for libesedb_table_initialize */
+	/* Initialize test
+	 */
+	result = esedb_test_table_open_source(
+	          &table,
+	          &table_state,
+	          &table_definition,
+	          &io_handle,
+	          &file_io_handle,
+	          &data,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "table",
+	 table );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_RUN_WITH_ARGS(
+	 "libesedb_table_initialize",
+	 esedb_test_table_initialize,
+	 file_io_handle,
+	 io_handle,
+	 table_state );
 
 #endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
 
@@ -130,15 +2065,91 @@ int main(
 
 	/* TODO: add tests for libesedb_table_get_index */
 
-	/* TODO: add tests for libesedb_table_get_number_of_records */
+	/* The estimate is tested first since libesedb_table_get_number_of_records
+	 * reads all the leaf pages
+	 */
+	ESEDB_TEST_RUN_WITH_ARGS(
+	 "libesedb_table_get_estimated_number_of_records",
+	 esedb_test_table_get_estimated_number_of_records,
+	 table );
+
+	ESEDB_TEST_RUN_WITH_ARGS(
+	 "libesedb_table_get_number_of_records",
+	 esedb_test_table_get_number_of_records,
+	 table );
+
+	ESEDB_TEST_RUN_WITH_ARGS(
+	 "libesedb_table_get_record_partition",
+	 esedb_test_table_get_record_partition,
+	 table );
+
+	ESEDB_TEST_RUN_WITH_ARGS(
+	 "libesedb_table_get_record",
+	 esedb_test_table_get_record,
+	 table );
+
+#if defined( HAVE_ESEDB_TEST_MULTI_THREAD_SUPPORT )
+
+	ESEDB_TEST_RUN_WITH_ARGS(
+	 "libesedb_table_get_record_async",
+	 esedb_test_table_get_record_async,
+	 table );
+
+	ESEDB_TEST_RUN_WITH_ARGS(
+	 "libesedb_table_get_record_async_from_callback",
+	 esedb_test_table_get_record_async_from_callback,
+	 table );
+
+	ESEDB_TEST_RUN_WITH_ARGS(
+	 "libesedb_table_wait_for_record_requests",
+	 esedb_test_table_wait_for_record_requests,
+	 table );
+
+#endif /* defined( HAVE_ESEDB_TEST_MULTI_THREAD_SUPPORT ) */
+
+	/* Clean up
+	 */
+	result = esedb_test_table_close_source(
+	          &table,
+	          &table_state,
+	          &table_definition,
+	          &io_handle,
+	          &file_io_handle,
+	          &data,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
 
-	/* TODO: add tests for libesedb_table_get_record */
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
 
 #endif /* defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT ) */
 
 	return( EXIT_SUCCESS );
 
 on_error:
+#if defined( __GNUC__ ) && !defined( LIBESEDB_DLL_IMPORT )
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( table != NULL )
+	{
+		esedb_test_table_close_source(
+		 &table,
+		 &table_state,
+		 &table_definition,
+		 &io_handle,
+		 &file_io_handle,
+		 &data,
+		 NULL );
+	}
+#endif
 	return( EXIT_FAILURE );
 }
 
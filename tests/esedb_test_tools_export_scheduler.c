@@ -0,0 +1,1340 @@
+/*
+ * Tools export_scheduler type test program
+ *
+ * Copyright (C) 2009-2022, Joachim Metz <joachim.metz@gmail.com>
+ *
+ * Refer to AUTHORS for acknowledgements.
+ *
+ * This program is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser General Public License
+ * along with this program.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <common.h>
+#include <file_stream.h>
+#include <memory.h>
+#include <system_string.h>
+#include <types.h>
+
+#if defined( HAVE_STDLIB_H ) || defined( WINAPI )
+#include <stdlib.h>
+#endif
+
+#include "esedb_test_libcerror.h"
+#include "esedb_test_macros.h"
+#include "esedb_test_memory.h"
+#include "esedb_test_unused.h"
+
+#include "../esedbtools/export_job.h"
+#include "../esedbtools/export_scheduler.h"
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+/* Creates an export job with a specific number of records
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_tools_export_scheduler_create_job(
+     export_job_t **export_job,
+     int number_of_records,
+     libcerror_error_t **error )
+{
+	if( export_job_initialize(
+	     export_job,
+	     0,
+	     0,
+	     _SYSTEM_STRING( "Test" ),
+	     4,
+	     0,
+	     1,
+	     NULL,
+	     error ) != 1 )
+	{
+		return( -1 );
+	}
+	( *export_job )->number_of_records = number_of_records;
+
+	return( 1 );
+}
+
+/* Creates a scheduler without threads so that the queues can be tested without contention
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_tools_export_scheduler_create_without_threads(
+     export_scheduler_t **scheduler,
+     int number_of_threads,
+     libcerror_error_t **error )
+{
+	size_t queues_size = 0;
+
+	*scheduler = memory_allocate_structure(
+	              export_scheduler_t );
+
+	if( *scheduler == NULL )
+	{
+		return( -1 );
+	}
+	if( memory_set(
+	     *scheduler,
+	     0,
+	     sizeof( export_scheduler_t ) ) == NULL )
+	{
+		memory_free(
+		 *scheduler );
+
+		*scheduler = NULL;
+
+		return( -1 );
+	}
+	( *scheduler )->number_of_threads = number_of_threads;
+
+	queues_size = sizeof( export_scheduler_queue_t ) * number_of_threads;
+
+	( *scheduler )->queues = (export_scheduler_queue_t *) memory_allocate(
+	                                                       queues_size );
+
+	if( ( *scheduler )->queues == NULL )
+	{
+		goto on_error;
+	}
+	if( memory_set(
+	     ( *scheduler )->queues,
+	     0,
+	     queues_size ) == NULL )
+	{
+		goto on_error;
+	}
+	if( libcthreads_mutex_initialize(
+	     &( ( *scheduler )->mutex ),
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libcthreads_condition_initialize(
+	     &( ( *scheduler )->condition ),
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	if( libcdata_array_initialize(
+	     &( ( *scheduler )->jobs ),
+	     0,
+	     error ) != 1 )
+	{
+		goto on_error;
+	}
+	return( 1 );
+
+on_error:
+	export_scheduler_free(
+	 scheduler,
+	 NULL );
+
+	return( -1 );
+}
+
+/* Callback function that marks a job as processed
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_tools_export_scheduler_process_job(
+     export_job_t *export_job,
+     void *callback_data ESEDB_TEST_ATTRIBUTE_UNUSED )
+{
+	ESEDB_TEST_UNREFERENCED_PARAMETER( callback_data )
+
+	if( export_job == NULL )
+	{
+		return( -1 );
+	}
+	export_job->number_of_exported_records = export_job->number_of_records;
+	export_job->result                     = 1;
+
+	return( 1 );
+}
+
+/* Callback function that splits off half of the records of a job into a new job
+ * Returns 1 if successful or -1 on error
+ */
+int esedb_test_tools_export_scheduler_process_and_split_job(
+     export_job_t *export_job,
+     export_scheduler_t *scheduler )
+{
+	export_job_t *split_export_job = NULL;
+
+	if( export_job == NULL )
+	{
+		return( -1 );
+	}
+	export_job->result = -1;
+
+	if( export_job->number_of_records > 1 )
+	{
+		if( esedb_test_tools_export_scheduler_create_job(
+		     &split_export_job,
+		     export_job->number_of_records / 2,
+		     NULL ) != 1 )
+		{
+			return( -1 );
+		}
+		split_export_job->is_split_job = 1;
+
+		if( export_scheduler_push_job(
+		     scheduler,
+		     export_job->thread_index,
+		     split_export_job,
+		     NULL ) != 1 )
+		{
+			export_job_free(
+			 &split_export_job,
+			 NULL );
+
+			return( -1 );
+		}
+		export_job->number_of_records    -= export_job->number_of_records / 2;
+		export_job->number_of_split_jobs += 1;
+	}
+	export_job->number_of_exported_records = export_job->number_of_records;
+	export_job->result                     = 1;
+
+	return( 1 );
+}
+
+/* Tests the export_scheduler_initialize function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_tools_export_scheduler_initialize(
+     void )
+{
+	export_scheduler_t *scheduler = NULL;
+	libcerror_error_t *error      = NULL;
+	int result                    = 0;
+
+	/* Test regular cases
+	 */
+	result = export_scheduler_initialize(
+	          &scheduler,
+	          2,
+	          &esedb_test_tools_export_scheduler_process_job,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "scheduler",
+	 scheduler );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = export_scheduler_free(
+	          &scheduler,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "scheduler",
+	 scheduler );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = export_scheduler_initialize(
+	          NULL,
+	          2,
+	          &esedb_test_tools_export_scheduler_process_job,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	scheduler = (export_scheduler_t *) 0x12345678UL;
+
+	result = export_scheduler_initialize(
+	          &scheduler,
+	          2,
+	          &esedb_test_tools_export_scheduler_process_job,
+	          NULL,
+	          &error );
+
+	scheduler = NULL;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = export_scheduler_initialize(
+	          &scheduler,
+	          0,
+	          &esedb_test_tools_export_scheduler_process_job,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "scheduler",
+	 scheduler );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = export_scheduler_initialize(
+	          &scheduler,
+	          2,
+	          NULL,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "scheduler",
+	 scheduler );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scheduler != NULL )
+	{
+		export_scheduler_free(
+		 &scheduler,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the export_scheduler_free function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_tools_export_scheduler_free(
+     void )
+{
+	libcerror_error_t *error = NULL;
+	int result               = 0;
+
+	/* Test error cases
+	 */
+	result = export_scheduler_free(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	return( 0 );
+}
+
+/* Tests the export_scheduler_push_job and export_scheduler_pop_job functions
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_tools_export_scheduler_push_and_pop_job(
+     void )
+{
+	export_job_t *export_job      = NULL;
+	export_job_t *first_job       = NULL;
+	export_job_t *second_job      = NULL;
+	export_job_t *third_job       = NULL;
+	export_scheduler_t *scheduler = NULL;
+	libcerror_error_t *error      = NULL;
+	int number_of_idle_threads    = 0;
+	int number_of_stolen_jobs     = 0;
+	int result                    = 0;
+
+	/* Initialize test
+	 */
+	result = esedb_test_tools_export_scheduler_create_without_threads(
+	          &scheduler,
+	          2,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "scheduler",
+	 scheduler );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test regular cases
+	 */
+	result = esedb_test_tools_export_scheduler_create_job(
+	          &export_job,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = export_scheduler_push_job(
+	          scheduler,
+	          1,
+	          export_job,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "export_job->job_index",
+	 export_job->job_index,
+	 0 );
+
+	first_job  = export_job;
+	export_job = NULL;
+
+	result = esedb_test_tools_export_scheduler_create_job(
+	          &export_job,
+	          2,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = export_scheduler_push_job(
+	          scheduler,
+	          1,
+	          export_job,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	second_job = export_job;
+	export_job = NULL;
+
+	/* A job pushed from outside the scheduler threads is pushed onto the first queue
+	 */
+	result = esedb_test_tools_export_scheduler_create_job(
+	          &export_job,
+	          3,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = export_scheduler_push_job(
+	          scheduler,
+	          -1,
+	          export_job,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	third_job  = export_job;
+	export_job = NULL;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "scheduler->number_of_queued_jobs",
+	 scheduler->number_of_queued_jobs,
+	 3 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "scheduler->queues[ 1 ].number_of_jobs",
+	 scheduler->queues[ 1 ].number_of_jobs,
+	 2 );
+
+	/* Idle threads that will take a queued job are not counted
+	 */
+	scheduler->number_of_idle_threads = 2;
+
+	result = export_scheduler_get_number_of_idle_threads(
+	          scheduler,
+	          &number_of_idle_threads,
+	          &error );
+
+	scheduler->number_of_idle_threads = 0;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_idle_threads",
+	 number_of_idle_threads,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A thread takes the last job of its own queue
+	 */
+	result = export_scheduler_pop_job(
+	          scheduler,
+	          0,
+	          &export_job,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INTPTR(
+	 "export_job",
+	 (intptr_t) export_job,
+	 (intptr_t) third_job );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "export_job->thread_index",
+	 export_job->thread_index,
+	 0 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "export_job->is_stolen",
+	 (int) export_job->is_stolen,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* A thread with an empty queue steals the first job of another queue
+	 */
+	result = export_scheduler_pop_job(
+	          scheduler,
+	          0,
+	          &export_job,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INTPTR(
+	 "export_job",
+	 (intptr_t) export_job,
+	 (intptr_t) first_job );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "export_job->is_stolen",
+	 (int) export_job->is_stolen,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = export_scheduler_pop_job(
+	          scheduler,
+	          1,
+	          &export_job,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INTPTR(
+	 "export_job",
+	 (intptr_t) export_job,
+	 (intptr_t) second_job );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "export_job->thread_index",
+	 export_job->thread_index,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "export_job->is_stolen",
+	 (int) export_job->is_stolen,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = export_scheduler_pop_job(
+	          scheduler,
+	          1,
+	          &export_job,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 0 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "export_job",
+	 export_job );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = export_scheduler_get_number_of_stolen_jobs(
+	          scheduler,
+	          &number_of_stolen_jobs,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_stolen_jobs",
+	 number_of_stolen_jobs,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* Test error cases
+	 */
+	result = esedb_test_tools_export_scheduler_create_job(
+	          &export_job,
+	          1,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = export_scheduler_push_job(
+	          NULL,
+	          -1,
+	          export_job,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = export_scheduler_push_job(
+	          scheduler,
+	          2,
+	          export_job,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = export_job_free(
+	          &export_job,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	result = export_scheduler_push_job(
+	          scheduler,
+	          -1,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = export_scheduler_pop_job(
+	          NULL,
+	          0,
+	          &export_job,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = export_scheduler_pop_job(
+	          scheduler,
+	          -1,
+	          &export_job,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = export_scheduler_pop_job(
+	          scheduler,
+	          0,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = export_scheduler_free(
+	          &scheduler,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "scheduler",
+	 scheduler );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( scheduler != NULL )
+	{
+		export_scheduler_free(
+		 &scheduler,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the export_scheduler_join function
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_tools_export_scheduler_join(
+     void )
+{
+	export_job_t *export_job      = NULL;
+	export_scheduler_t *scheduler = NULL;
+	libcerror_error_t *error      = NULL;
+	int job_index                 = 0;
+	int number_of_jobs            = 0;
+	int result                    = 0;
+
+	/* Initialize test
+	 */
+	result = export_scheduler_initialize(
+	          &scheduler,
+	          4,
+	          &esedb_test_tools_export_scheduler_process_job,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "scheduler",
+	 scheduler );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( job_index = 0;
+	     job_index < 64;
+	     job_index++ )
+	{
+		result = esedb_test_tools_export_scheduler_create_job(
+		          &export_job,
+		          job_index + 1,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = export_scheduler_push_job(
+		          scheduler,
+		          -1,
+		          export_job,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		export_job = NULL;
+	}
+	/* Test regular cases
+	 */
+	result = export_scheduler_join(
+	          scheduler,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = export_scheduler_get_number_of_jobs(
+	          scheduler,
+	          &number_of_jobs,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_jobs",
+	 number_of_jobs,
+	 64 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( job_index = 0;
+	     job_index < number_of_jobs;
+	     job_index++ )
+	{
+		result = export_scheduler_get_job_by_index(
+		          scheduler,
+		          job_index,
+		          &export_job,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NOT_NULL(
+		 "export_job",
+		 export_job );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "export_job->result",
+		 export_job->result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "export_job->number_of_exported_records",
+		 export_job->number_of_exported_records,
+		 job_index + 1 );
+
+		ESEDB_TEST_ASSERT_GREATER_THAN_INT(
+		 "export_job->thread_index",
+		 export_job->thread_index,
+		 -1 );
+
+		ESEDB_TEST_ASSERT_LESS_THAN_INT(
+		 "export_job->thread_index",
+		 export_job->thread_index,
+		 4 );
+	}
+	export_job = NULL;
+
+	/* Test error cases
+	 */
+	result = export_scheduler_join(
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	result = export_scheduler_get_job_by_index(
+	          scheduler,
+	          number_of_jobs,
+	          &export_job,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 -1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "error",
+	 error );
+
+	libcerror_error_free(
+	 &error );
+
+	/* Clean up
+	 */
+	result = export_scheduler_free(
+	          &scheduler,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( export_job != NULL )
+	{
+		export_job_free(
+		 &export_job,
+		 NULL );
+	}
+	if( scheduler != NULL )
+	{
+		export_scheduler_free(
+		 &scheduler,
+		 NULL );
+	}
+	return( 0 );
+}
+
+/* Tests the export_scheduler_join function with jobs that push split jobs
+ * Returns 1 if successful or 0 if not
+ */
+int esedb_test_tools_export_scheduler_join_with_split_jobs(
+     void )
+{
+	export_job_t *export_job      = NULL;
+	export_scheduler_t *scheduler = NULL;
+	libcerror_error_t *error      = NULL;
+	int job_index                 = 0;
+	int number_of_exported_records = 0;
+	int number_of_jobs            = 0;
+	int number_of_split_jobs      = 0;
+	int result                    = 0;
+
+	/* Initialize test
+	 */
+	result = export_scheduler_initialize(
+	          &scheduler,
+	          4,
+	          (int (*)(export_job_t *, void *)) &esedb_test_tools_export_scheduler_process_and_split_job,
+	          NULL,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NOT_NULL(
+	 "scheduler",
+	 scheduler );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	/* The callback needs the scheduler to push the split jobs
+	 */
+	result = libcthreads_mutex_grab(
+	          scheduler->mutex,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	scheduler->callback_data = (void *) scheduler;
+
+	result = libcthreads_mutex_release(
+	          scheduler->mutex,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	/* Every job of 16 records is split into jobs of 8, 4, 2 and 1 records
+	 */
+	for( job_index = 0;
+	     job_index < 4;
+	     job_index++ )
+	{
+		result = esedb_test_tools_export_scheduler_create_job(
+		          &export_job,
+		          16,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		result = export_scheduler_push_job(
+		          scheduler,
+		          -1,
+		          export_job,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		export_job = NULL;
+	}
+	/* Test regular cases
+	 */
+	result = export_scheduler_join(
+	          scheduler,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	result = export_scheduler_get_number_of_jobs(
+	          scheduler,
+	          &number_of_jobs,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_jobs",
+	 number_of_jobs,
+	 20 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	for( job_index = 0;
+	     job_index < number_of_jobs;
+	     job_index++ )
+	{
+		result = export_scheduler_get_job_by_index(
+		          scheduler,
+		          job_index,
+		          &export_job,
+		          &error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "result",
+		 result,
+		 1 );
+
+		ESEDB_TEST_ASSERT_IS_NOT_NULL(
+		 "export_job",
+		 export_job );
+
+		ESEDB_TEST_ASSERT_IS_NULL(
+		 "error",
+		 error );
+
+		ESEDB_TEST_ASSERT_EQUAL_INT(
+		 "export_job->result",
+		 export_job->result,
+		 1 );
+
+		number_of_exported_records += export_job->number_of_exported_records;
+
+		if( export_job->is_split_job != 0 )
+		{
+			number_of_split_jobs++;
+		}
+	}
+	export_job = NULL;
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_exported_records",
+	 number_of_exported_records,
+	 64 );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "number_of_split_jobs",
+	 number_of_split_jobs,
+	 16 );
+
+	/* Clean up
+	 */
+	result = export_scheduler_free(
+	          &scheduler,
+	          &error );
+
+	ESEDB_TEST_ASSERT_EQUAL_INT(
+	 "result",
+	 result,
+	 1 );
+
+	ESEDB_TEST_ASSERT_IS_NULL(
+	 "error",
+	 error );
+
+	return( 1 );
+
+on_error:
+	if( error != NULL )
+	{
+		libcerror_error_free(
+		 &error );
+	}
+	if( export_job != NULL )
+	{
+		export_job_free(
+		 &export_job,
+		 NULL );
+	}
+	if( scheduler != NULL )
+	{
+		export_scheduler_free(
+		 &scheduler,
+		 NULL );
+	}
+	return( 0 );
+}
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+/* The main program
+ */
+#if defined( HAVE_WIDE_SYSTEM_CHARACTER )
+int wmain(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     wchar_t * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#else
+int main(
+     int argc ESEDB_TEST_ATTRIBUTE_UNUSED,
+     char * const argv[] ESEDB_TEST_ATTRIBUTE_UNUSED )
+#endif
+{
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argc )
+	ESEDB_TEST_UNREFERENCED_PARAMETER( argv )
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+	ESEDB_TEST_RUN(
+	 "export_scheduler_initialize",
+	 esedb_test_tools_export_scheduler_initialize )
+
+	ESEDB_TEST_RUN(
+	 "export_scheduler_free",
+	 esedb_test_tools_export_scheduler_free )
+
+	ESEDB_TEST_RUN(
+	 "export_scheduler_push_and_pop_job",
+	 esedb_test_tools_export_scheduler_push_and_pop_job )
+
+	ESEDB_TEST_RUN(
+	 "export_scheduler_join",
+	 esedb_test_tools_export_scheduler_join )
+
+	ESEDB_TEST_RUN(
+	 "export_scheduler_join_with_split_jobs",
+	 esedb_test_tools_export_scheduler_join_with_split_jobs )
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+
+	return( EXIT_SUCCESS );
+
+#if defined( HAVE_MULTI_THREAD_SUPPORT )
+
+on_error:
+	return( EXIT_FAILURE );
+
+#endif /* defined( HAVE_MULTI_THREAD_SUPPORT ) */
+}
+
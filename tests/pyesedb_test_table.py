@@ -0,0 +1,317 @@
+#!/usr/bin/env python
+#
+# Python-bindings table type test script
+#
+# Copyright (C) 2009-2022, Joachim Metz <joachim.metz@gmail.com>
+#
+# Refer to AUTHORS for acknowledgements.
+#
+# This program is free software: you can redistribute it and/or modify
+# it under the terms of the GNU Lesser General Public License as published by
+# the Free Software Foundation, either version 3 of the License, or
+# (at your option) any later version.
+#
+# This program is distributed in the hope that it will be useful,
+# but WITHOUT ANY WARRANTY; without even the implied warranty of
+# MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+# GNU General Public License for more details.
+#
+# You should have received a copy of the GNU Lesser General Public License
+# along with this program.  If not, see <https://www.gnu.org/licenses/>.
+
+import argparse
+import datetime
+import sys
+import threading
+import unittest
+
+import pyesedb
+
+try:
+  import numpy
+except ImportError:
+  numpy = None
+
+try:
+  import pyarrow
+except ImportError:
+  pyarrow = None
+
+
+# Column types of which the values are stored as fixed-size values.
+FIXED_SIZE_COLUMN_TYPES = frozenset([
+    pyesedb.column_types.BOOLEAN,
+    pyesedb.column_types.INTEGER_8BIT_UNSIGNED,
+    pyesedb.column_types.INTEGER_16BIT_SIGNED,
+    pyesedb.column_types.INTEGER_16BIT_UNSIGNED,
+    pyesedb.column_types.INTEGER_32BIT_SIGNED,
+    pyesedb.column_types.INTEGER_32BIT_UNSIGNED,
+    pyesedb.column_types.INTEGER_64BIT_SIGNED,
+    pyesedb.column_types.CURRENCY,
+    pyesedb.column_types.FLOAT_32BIT,
+    pyesedb.column_types.DOUBLE_64BIT,
+    pyesedb.column_types.DATE_TIME])
+
+
+class TableTypeTests(unittest.TestCase):
+  """Tests the table type."""
+
+  def _GetTables(self, esedb_file):
+    """Retrieves the tables of a file.
+
+    Args:
+      esedb_file (pyesedb.file): file.
+
+    Returns:
+      list[pyesedb.table]: tables.
+    """
+    return [
+        esedb_file.get_table(table_index)
+        for table_index in range(esedb_file.number_of_tables)]
+
+  def test_iter_rows(self):
+    """Tests the iter_rows function."""
+    test_source = unittest.source
+    if not test_source:
+      raise unittest.SkipTest("missing source")
+
+    esedb_file = pyesedb.file()
+
+    esedb_file.open(test_source)
+
+    for esedb_table in self._GetTables(esedb_file):
+      number_of_columns = esedb_table.number_of_columns
+      column_names = [
+          esedb_table.get_column(column_index).name
+          for column_index in range(number_of_columns)]
+
+      rows = list(esedb_table.iter_rows())
+      self.assertEqual(len(rows), esedb_table.number_of_records)
+
+      for row in rows:
+        self.assertIsInstance(row, tuple)
+        self.assertEqual(len(row), number_of_columns)
+
+      dict_rows = list(esedb_table.iter_rows(as_dict=True))
+      self.assertEqual(len(dict_rows), len(rows))
+
+      for row, dict_row in zip(rows, dict_rows):
+        self.assertIsInstance(dict_row, dict)
+        self.assertEqual(dict_row, dict(zip(column_names, row)))
+
+      if number_of_columns > 0:
+        column_indexes = [number_of_columns - 1, 0]
+        selected_rows = list(esedb_table.iter_rows(columns=column_indexes))
+        self.assertEqual(len(selected_rows), len(rows))
+
+        for row, selected_row in zip(rows, selected_rows):
+          self.assertEqual(
+              selected_row, tuple(row[index] for index in column_indexes))
+
+        selected_rows = list(esedb_table.iter_rows(
+            columns=[column_names[index] for index in column_indexes]))
+
+        for row, selected_row in zip(rows, selected_rows):
+          self.assertEqual(
+              selected_row, tuple(
+                  row[column_names.index(column_names[index])]
+                  for index in column_indexes))
+
+      batches = list(esedb_table.iter_rows(batch_size=3))
+
+      batched_rows = []
+      for batch in batches:
+        self.assertIsInstance(batch, list)
+        self.assertGreater(len(batch), 0)
+        self.assertLessEqual(len(batch), 3)
+        batched_rows.extend(batch)
+
+      self.assertEqual(batched_rows, rows)
+
+      with self.assertRaises(ValueError):
+        esedb_table.iter_rows(columns=[number_of_columns])
+
+      with self.assertRaises(ValueError):
+        esedb_table.iter_rows(columns=[-1])
+
+      with self.assertRaises(TypeError):
+        esedb_table.iter_rows(columns=[1.5])
+
+      with self.assertRaises(ValueError):
+        esedb_table.iter_rows(columns=["\x00no such column"])
+
+      with self.assertRaises(ValueError):
+        esedb_table.iter_rows(batch_size=-1)
+
+    esedb_file.close()
+
+  def test_iter_rows_from_multiple_threads(self):
+    """Tests the iter_rows function with an iterator shared by threads."""
+    test_source = unittest.source
+    if not test_source:
+      raise unittest.SkipTest("missing source")
+
+    esedb_file = pyesedb.file()
+
+    esedb_file.open(test_source)
+
+    esedb_tables = self._GetTables(esedb_file)
+    if not esedb_tables:
+      esedb_file.close()
+      raise unittest.SkipTest("missing tables")
+
+    esedb_table = max(
+        esedb_tables, key=lambda esedb_table: esedb_table.number_of_records)
+
+    rows_iterator = esedb_table.iter_rows()
+    number_of_rows = [0]
+    errors = []
+    lock = threading.Lock()
+
+    def _ReadRows():
+      """Reads rows until the iterator is exhausted."""
+      while True:
+        try:
+          next(rows_iterator)
+        except StopIteration:
+          break
+        except RuntimeError:
+          # The iterator is in use by another thread.
+          continue
+        except Exception as exception:  # pylint: disable=broad-except
+          with lock:
+            errors.append(exception)
+          break
+
+        with lock:
+          number_of_rows[0] += 1
+
+    threads = [threading.Thread(target=_ReadRows) for _ in range(4)]
+    for thread in threads:
+      thread.start()
+    for thread in threads:
+      thread.join()
+
+    self.assertEqual(errors, [])
+    self.assertEqual(number_of_rows[0], esedb_table.number_of_records)
+
+    esedb_file.close()
+
+  def test_to_numpy(self):
+    """Tests the to_numpy function."""
+    test_source = unittest.source
+    if not test_source:
+      raise unittest.SkipTest("missing source")
+
+    if not numpy:
+      raise unittest.SkipTest("missing numpy")
+
+    esedb_file = pyesedb.file()
+
+    esedb_file.open(test_source)
+
+    for esedb_table in self._GetTables(esedb_file):
+      number_of_columns = esedb_table.number_of_columns
+      if number_of_columns == 0:
+        continue
+
+      rows = list(esedb_table.iter_rows())
+
+      for column_index in range(number_of_columns):
+        esedb_column = esedb_table.get_column(column_index)
+
+        arrays = esedb_table.to_numpy(columns=[column_index])
+        self.assertEqual(list(arrays.keys()), [esedb_column.name])
+
+        array = arrays[esedb_column.name]
+        self.assertEqual(len(array), len(rows))
+
+        for row, array_value in zip(rows, array):
+          expected_value = row[column_index]
+
+          if array.dtype.kind == "M":
+            # The datetime64[us] values are rounded to micro seconds.
+            if expected_value is None:
+              self.assertIs(array_value, numpy.ma.masked)
+            else:
+              micro_seconds = array_value.astype("datetime64[us]").astype(
+                  numpy.int64)
+              array_datetime = datetime.datetime(1970, 1, 1) + (
+                  datetime.timedelta(microseconds=int(micro_seconds)))
+              self.assertLessEqual(
+                  abs(array_datetime - expected_value),
+                  datetime.timedelta(microseconds=1))
+
+          elif array.dtype.kind != "O":
+            if expected_value is None:
+              self.assertIs(array_value, numpy.ma.masked)
+            else:
+              self.assertEqual(array_value.item(), expected_value)
+
+          else:
+            # Object arrays contain the same values as iter_rows, including
+            # datetime values of columns that contain long or multi values.
+            self.assertEqual(array_value, expected_value)
+
+      with self.assertRaises(ValueError):
+        esedb_table.to_numpy(columns=[0, 0])
+
+    esedb_file.close()
+
+  def test_to_arrow(self):
+    """Tests the to_arrow function."""
+    test_source = unittest.source
+    if not test_source:
+      raise unittest.SkipTest("missing source")
+
+    if not numpy or not pyarrow:
+      raise unittest.SkipTest("missing numpy or pyarrow")
+
+    esedb_file = pyesedb.file()
+
+    esedb_file.open(test_source)
+
+    for esedb_table in self._GetTables(esedb_file):
+      number_of_columns = esedb_table.number_of_columns
+      column_names = [
+          esedb_table.get_column(column_index).name
+          for column_index in range(number_of_columns)]
+
+      rows = list(esedb_table.iter_rows())
+
+      # Fixed-size columns that contain long or multi values cannot be
+      # converted to an Arrow array.
+      has_mixed_column = False
+      for column_index in range(number_of_columns):
+        esedb_column = esedb_table.get_column(column_index)
+        if esedb_column.type in FIXED_SIZE_COLUMN_TYPES:
+          for row in rows:
+            if isinstance(row[column_index], (bytes, str)):
+              has_mixed_column = True
+              break
+
+      if has_mixed_column:
+        with self.assertRaises(ValueError):
+          esedb_table.to_arrow()
+        continue
+
+      arrow_table = esedb_table.to_arrow()
+      self.assertEqual(arrow_table.num_rows, len(rows))
+      self.assertEqual(arrow_table.column_names, column_names)
+
+    esedb_file.close()
+
+
+if __name__ == "__main__":
+  argument_parser = argparse.ArgumentParser()
+
+  argument_parser.add_argument(
+      "source", nargs="?", action="store", metavar="PATH",
+      default=None, help="path of the source file.")
+
+  options, unknown_options = argument_parser.parse_known_args()
+  unknown_options.insert(0, sys.argv[0])
+
+  setattr(unittest, "source", options.source)
+
+  unittest.main(argv=unknown_options, verbosity=2)
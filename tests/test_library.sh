@@ -7,7 +7,7 @@ EXIT_SUCCESS=0;
 EXIT_FAILURE=1;
 EXIT_IGNORE=77;
 
-LIBRARY_TESTS="catalog catalog_definition checksum column column_type compression data_definition data_segment database error file_header index io_handle leaf_page_descriptor long_value multi_value notify page page_header page_tree page_tree_key page_tree_value page_value record table root_page_header space_tree space_tree_value table_definition";
+LIBRARY_TESTS="catalog catalog_definition checksum column column_type compression data_definition data_segment database error file_header index io_handle leaf_page_descriptor long_value metadata_cache metadata_cache_entry multi_value name_hash notify page page_cache page_header page_tree page_tree_key page_tree_value page_value record table root_page_header space_tree space_tree_value string table_definition table_state";
 LIBRARY_TESTS_WITH_INPUT="file support";
 OPTION_SETS="";
 
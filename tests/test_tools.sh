@@ -7,7 +7,7 @@ EXIT_SUCCESS=0;
 EXIT_FAILURE=1;
 EXIT_IGNORE=77;
 
-TOOLS_TESTS="info_handle output signal windows_search_compression";
+TOOLS_TESTS="export_scheduler info_handle output signal windows_search_compression";
 TOOLS_TESTS_WITH_INPUT="";
 OPTION_SETS="";
 